@@ -0,0 +1,249 @@
+/*
+ * File:   BenchmarkHelpers.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_BENCHMARK_BENCHMARKHELPERS_HPP
+#define HTD_BENCHMARK_BENCHMARKHELPERS_HPP
+
+#include <htd/main.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ *  The global allocation functions are replaced in order to count the number of heap allocations performed by the
+ *  code under test and the number of bytes it keeps allocated. This header must therefore be included by exactly one
+ *  translation unit per benchmark program.
+ */
+namespace htd_benchmark
+{
+    /**
+     *  The number of heap allocations performed so far.
+     */
+    static std::atomic<std::size_t> allocationCounter(0);
+
+    /**
+     *  The number of bytes currently allocated on the heap.
+     */
+    static std::atomic<std::size_t> allocatedByteCounter(0);
+
+    /**
+     *  The size of the header which precedes each allocation and records its size. The header preserves the alignment
+     *  guaranteed by std::malloc.
+     */
+    static const std::size_t allocationHeaderSize = sizeof(std::max_align_t);
+
+    /**
+     *  Access the number of heap allocations performed so far.
+     *
+     *  @return The number of heap allocations performed so far.
+     */
+    inline std::size_t allocationCount(void)
+    {
+        return allocationCounter.load(std::memory_order_relaxed);
+    }
+
+    /**
+     *  Access the number of bytes currently allocated on the heap.
+     *
+     *  @return The number of bytes currently allocated on the heap.
+     */
+    inline std::size_t allocatedBytes(void)
+    {
+        return allocatedByteCounter.load(std::memory_order_relaxed);
+    }
+
+    /**
+     *  Create a random graph with the given number of vertices and edges.
+     *
+     *  @param[in] manager      The management instance to which the new graph shall belong.
+     *  @param[in] vertexCount  The number of vertices of the graph.
+     *  @param[in] edgeCount    The number of edges which shall be added to the graph.
+     *  @param[in] seed         The seed of the random number generator which is used to select the endpoints.
+     *
+     *  @return A new graph with the given number of vertices and edges.
+     */
+    inline htd::IMutableMultiHypergraph * createRandomGraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, std::size_t edgeCount, unsigned int seed)
+    {
+        htd::IMutableMultiHypergraph * ret = manager->multiHypergraphFactory().createInstance(vertexCount);
+
+        std::mt19937 generator(seed);
+
+        std::uniform_int_distribution<htd::vertex_t> distribution(1, vertexCount);
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+        edges.reserve(edgeCount);
+
+        for (std::size_t index = 0; index < edgeCount; ++index)
+        {
+            htd::vertex_t vertex1 = distribution(generator);
+            htd::vertex_t vertex2 = distribution(generator);
+
+            if (vertex1 != vertex2)
+            {
+                edges.emplace_back(vertex1, vertex2);
+            }
+        }
+
+        ret->addEdges(edges);
+
+        return ret;
+    }
+
+    /**
+     *  Run a function repeatedly and print the average wall time and the average number of heap allocations per
+     *  unit of work. The function returns the number of units of work it performed, e.g., the number of iterations.
+     *
+     *  @param[in] name         The name of the measurement.
+     *  @param[in] repetitions  The number of repetitions.
+     *  @param[in] function     The function which shall be measured.
+     */
+    template <typename Function>
+    void measure(const std::string & name, std::size_t repetitions, Function && function)
+    {
+        std::size_t units = 0;
+
+        std::size_t allocationsBefore = allocationCount();
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t index = 0; index < repetitions; ++index)
+        {
+            units += function();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        std::size_t allocations = allocationCount() - allocationsBefore;
+
+        double milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+
+        if (units == 0)
+        {
+            units = 1;
+        }
+
+        std::cout << std::left << std::setw(48) << name
+                  << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(12) << milliseconds << " ms total"
+                  << std::setw(14) << (1000.0 * milliseconds / units) << " us/unit"
+                  << std::setw(14) << (static_cast<double>(allocations) / units) << " allocations/unit"
+                  << std::setw(10) << units << " units" << std::endl;
+    }
+
+    /**
+     *  Run a function repeatedly and print the average wall time, the throughput in megabytes per second and the
+     *  average number of heap allocations per run. Each run of the function processes the given number of bytes.
+     *
+     *  @param[in] name         The name of the measurement.
+     *  @param[in] repetitions  The number of repetitions.
+     *  @param[in] bytes        The number of bytes processed by each run of the function.
+     *  @param[in] function     The function which shall be measured.
+     */
+    template <typename Function>
+    void measureThroughput(const std::string & name, std::size_t repetitions, std::size_t bytes, Function && function)
+    {
+        std::size_t allocationsBefore = allocationCount();
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t index = 0; index < repetitions; ++index)
+        {
+            function();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        std::size_t allocations = allocationCount() - allocationsBefore;
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << std::left << std::setw(48) << name
+                  << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(12) << (1000.0 * seconds / repetitions) << " ms/run"
+                  << std::setw(12) << (static_cast<double>(bytes) * repetitions / (1024.0 * 1024.0) / seconds) << " MB/s"
+                  << std::setw(14) << (static_cast<double>(allocations) / repetitions) << " allocations/run" << std::endl;
+    }
+}
+
+void * operator new(std::size_t size)
+{
+    htd_benchmark::allocationCounter.fetch_add(1, std::memory_order_relaxed);
+
+    htd_benchmark::allocatedByteCounter.fetch_add(size, std::memory_order_relaxed);
+
+    char * block = static_cast<char *>(std::malloc(size + htd_benchmark::allocationHeaderSize));
+
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    *reinterpret_cast<std::size_t *>(block) = size;
+
+    return block + htd_benchmark::allocationHeaderSize;
+}
+
+void * operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void * pointer) noexcept
+{
+    if (pointer != nullptr)
+    {
+        char * block = static_cast<char *>(pointer) - htd_benchmark::allocationHeaderSize;
+
+        htd_benchmark::allocatedByteCounter.fetch_sub(*reinterpret_cast<std::size_t *>(block), std::memory_order_relaxed);
+
+        std::free(block);
+    }
+}
+
+void operator delete[](void * pointer) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete(void * pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete[](void * pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+#endif /* HTD_BENCHMARK_BENCHMARKHELPERS_HPP */
@@ -0,0 +1,132 @@
+/*
+ * File:   DeadlineBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ *  Run the algorithm repeatedly with the given time limit and print the number of decompositions reported via the
+ *  progress callback, the best width and the maximum and average overshoot, i.e., the time between the deadline and
+ *  the return of the algorithm.
+ */
+void measureOvershoot(const std::string & name, htd::LibraryInstance & manager, const htd::ICustomizedTreeDecompositionAlgorithm & algorithm, const htd::IMultiHypergraph & graph, std::chrono::milliseconds timeLimit, std::size_t repetitions)
+{
+    double maximumOvershoot = 0;
+    double totalOvershoot = 0;
+
+    std::size_t decompositionCount = 0;
+    std::size_t bestWidth = (std::size_t)-1;
+
+    for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+    {
+        manager.setTimeLimit(timeLimit);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)
+        {
+            ++decompositionCount;
+        });
+
+        double overshoot = std::chrono::duration<double>(std::chrono::steady_clock::now() - manager.deadline()).count();
+
+        maximumOvershoot = std::max(maximumOvershoot, overshoot);
+
+        totalOvershoot += overshoot;
+
+        if (decomposition != nullptr)
+        {
+            bestWidth = std::min(bestWidth, decomposition->maximumBagSize() - 1);
+
+            delete decomposition;
+        }
+    }
+
+    manager.removeDeadline();
+
+    std::cout << std::left << std::setw(36) << name << std::right
+              << " limit " << std::setw(6) << timeLimit.count() << " ms"
+              << "   decompositions/run " << std::setw(8) << decompositionCount / repetitions
+              << "   width " << std::setw(6) << bestWidth
+              << "   overshoot avg " << std::fixed << std::setprecision(2) << std::setw(8) << 1000 * totalOvershoot / repetitions << " ms"
+              << "   max " << std::setw(8) << 1000 * maximumOvershoot << " ms" << std::endl;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+    std::size_t repetitions = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 3;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableMultiHypergraph> graph(htd_benchmark::createRandomGraph(manager.get(), vertexCount, edgeCount, 1));
+
+    std::vector<std::chrono::milliseconds> timeLimits { std::chrono::milliseconds(250), std::chrono::milliseconds(1000), std::chrono::milliseconds(4000) };
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm iterativeImprovementAlgorithm(manager.get(), new htd::BucketEliminationTreeDecompositionAlgorithm(manager.get()), new htd::WidthFitnessFunction());
+
+    iterativeImprovementAlgorithm.setIterationCount(0);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm widthMinimizingAlgorithm(manager.get());
+
+    widthMinimizingAlgorithm.setIterationCount(0);
+
+    htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm adaptiveAlgorithm(manager.get());
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * minDegreeAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(manager.get());
+
+    minDegreeAlgorithm->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(manager.get()));
+
+    adaptiveAlgorithm.addDecompositionAlgorithm(minDegreeAlgorithm);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * minFillAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(manager.get());
+
+    minFillAlgorithm->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(manager.get()));
+
+    adaptiveAlgorithm.addDecompositionAlgorithm(minFillAlgorithm);
+
+    adaptiveAlgorithm.setDecisionRounds(5);
+    adaptiveAlgorithm.setIterationCount((std::size_t)-1);
+
+    std::cout << "Graph: " << graph->vertexCount() << " vertices, " << graph->edgeCount() << " edges" << std::endl;
+
+    for (std::chrono::milliseconds timeLimit : timeLimits)
+    {
+        measureOvershoot("iterative improvement", *manager, iterativeImprovementAlgorithm, *graph, timeLimit, repetitions);
+        measureOvershoot("width minimizing", *manager, widthMinimizingAlgorithm, *graph, timeLimit, repetitions);
+        measureOvershoot("adaptive width minimizing", *manager, adaptiveAlgorithm, *graph, timeLimit, repetitions);
+    }
+
+    return 0;
+}
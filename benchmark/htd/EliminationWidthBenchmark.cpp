@@ -0,0 +1,133 @@
+/*
+ * File:   EliminationWidthBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2 * vertexCount;
+    std::size_t iterations = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 20;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableMultiHypergraph> graph(htd_benchmark::createRandomGraph(manager.get(), vertexCount, edgeCount, 1));
+
+    htd::GraphPreprocessor preprocessor(manager.get());
+
+    std::unique_ptr<htd::IPreprocessedGraph> preprocessedGraph(preprocessor.prepare(*graph));
+
+    htd::MaximumCardinalitySearchOrderingAlgorithm orderingAlgorithm(manager.get());
+
+    std::vector<std::unique_ptr<htd::IVertexOrdering>> orderings;
+
+    for (std::size_t index = 0; index < iterations; ++index)
+    {
+        orderings.emplace_back(orderingAlgorithm.computeOrdering(*graph, *preprocessedGraph));
+    }
+
+    std::cout << "Graph: " << vertexCount << " vertices, " << graph->edgeCount() << " edges" << std::endl;
+
+    htd::EliminationWidthEvaluator evaluator;
+
+    htd_benchmark::measure("EliminationWidthEvaluator (graph)", 1, [&]()
+    {
+        for (const std::unique_ptr<htd::IVertexOrdering> & ordering : orderings)
+        {
+            evaluator.maximumBagSize(*graph, *ordering);
+        }
+
+        return orderings.size();
+    });
+
+    htd_benchmark::measure("EliminationWidthEvaluator (preprocessed)", 1, [&]()
+    {
+        for (const std::unique_ptr<htd::IVertexOrdering> & ordering : orderings)
+        {
+            evaluator.maximumBagSize(*preprocessedGraph, ordering->sequence());
+        }
+
+        return orderings.size();
+    });
+
+    htd_benchmark::measure("MCS ordering", 1, [&]()
+    {
+        for (std::size_t index = 0; index < iterations; ++index)
+        {
+            std::unique_ptr<htd::IVertexOrdering> ordering(orderingAlgorithm.computeOrdering(*graph, *preprocessedGraph));
+        }
+
+        return iterations;
+    });
+
+    htd_benchmark::measure("MCS ordering + bucket elimination", 1, [&]()
+    {
+        htd::BucketEliminationGraphDecompositionAlgorithm algorithm(manager.get());
+
+        algorithm.setOrderingAlgorithm(orderingAlgorithm.clone());
+
+        for (std::size_t index = 0; index < iterations; ++index)
+        {
+            std::unique_ptr<htd::IGraphDecomposition> decomposition(algorithm.computeDecomposition(*graph, *preprocessedGraph));
+        }
+
+        return iterations;
+    });
+
+    manager->orderingAlgorithmFactory().setConstructionTemplate(orderingAlgorithm.clone());
+
+    htd_benchmark::measure("WidthMinimizing (MCS)", 1, [&]()
+    {
+        htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(manager.get());
+
+        algorithm.setIterationCount(iterations);
+
+        std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph, *preprocessedGraph));
+
+        std::cout << "Best maximum bag size: " << decomposition->maximumBagSize() << std::endl;
+
+        return iterations;
+    });
+
+    htd_benchmark::measure("IterativeImprovement (MCS, width fitness)", 1, [&]()
+    {
+        htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(manager.get(), new htd::BucketEliminationTreeDecompositionAlgorithm(manager.get()), new htd::WidthFitnessFunction());
+
+        algorithm.setIterationCount(iterations);
+
+        std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph, *preprocessedGraph));
+
+        std::cout << "Best maximum bag size: " << decomposition->maximumBagSize() << std::endl;
+
+        return iterations;
+    });
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * File:   GraphPreprocessorBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t blockCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+    std::size_t blockSize = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 40;
+    std::size_t blockEdgeCount = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 160;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableMultiHypergraph> graph(manager->multiHypergraphFactory().createInstance());
+
+    std::mt19937 generator(1);
+
+    /* Random blocks which are glued along triangles, i.e., the graph decomposes into (roughly) one atom per block. */
+    std::vector<htd::vertex_t> sharedVertices;
+
+    for (std::size_t block = 0; block < blockCount; ++block)
+    {
+        std::vector<htd::vertex_t> blockVertices(sharedVertices);
+
+        while (blockVertices.size() < blockSize)
+        {
+            blockVertices.push_back(graph->addVertex());
+        }
+
+        std::uniform_int_distribution<std::size_t> distribution(0, blockSize - 1);
+
+        for (std::size_t index = 0; index < blockEdgeCount; ++index)
+        {
+            htd::vertex_t vertex1 = blockVertices[distribution(generator)];
+            htd::vertex_t vertex2 = blockVertices[distribution(generator)];
+
+            if (vertex1 != vertex2)
+            {
+                graph->addEdge(vertex1, vertex2);
+            }
+        }
+
+        sharedVertices.assign(blockVertices.end() - 3, blockVertices.end());
+
+        graph->addEdge(sharedVertices[0], sharedVertices[1]);
+        graph->addEdge(sharedVertices[1], sharedVertices[2]);
+        graph->addEdge(sharedVertices[0], sharedVertices[2]);
+    }
+
+    std::cout << "Graph: " << graph->vertexCount() << " vertices, " << graph->edgeCount() << " edges (" << blockCount << " blocks)" << std::endl;
+
+    std::vector<std::pair<std::size_t, std::size_t>> configurations { { 2, 1 }, { 3, 1 }, { 3, 2 }, { 3, 4 } };
+
+    if (std::thread::hardware_concurrency() > 4)
+    {
+        configurations.emplace_back(3, std::thread::hardware_concurrency());
+    }
+
+    for (const std::pair<std::size_t, std::size_t> & configuration : configurations)
+    {
+        htd::GraphPreprocessor preprocessor(manager.get());
+
+        preprocessor.setPreprocessingStrategy(configuration.first);
+
+        preprocessor.setIterationCount(16);
+
+        preprocessor.setThreadCount(configuration.second);
+
+        htd::MinFillOrderingAlgorithm orderingAlgorithm(manager.get());
+
+        std::size_t remainingVertexCount = 0;
+
+        std::size_t maximumBagSize = 0;
+
+        std::srand(1);
+
+        htd_benchmark::measure("Preprocessing level " + std::to_string(configuration.first) + " + min-fill (" + std::to_string(configuration.second) + " threads)", 1, [&]()
+        {
+            std::unique_ptr<htd::IPreprocessedGraph> preprocessedGraph(preprocessor.prepare(*graph));
+
+            remainingVertexCount = preprocessedGraph->remainingVertices().size();
+
+            std::unique_ptr<htd::IWidthLimitedVertexOrdering> ordering(orderingAlgorithm.computeOrdering(*graph, *preprocessedGraph, (std::size_t)-1, 16));
+
+            maximumBagSize = ordering->maximumBagSize();
+
+            return (std::size_t)1;
+        });
+
+        std::cout << "Remaining vertices after preprocessing: " << remainingVertexCount << ", maximum bag size: " << maximumBagSize << std::endl;
+    }
+
+    return 0;
+}
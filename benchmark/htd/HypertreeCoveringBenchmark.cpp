@@ -0,0 +1,112 @@
+/*
+ * File:   HypertreeCoveringBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+    std::size_t maxEdgeSize = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 4;
+    std::size_t windowSize = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 12;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableMultiHypergraph> graph(manager->multiHypergraphFactory().createInstance(vertexCount));
+
+    std::mt19937 generator(1);
+
+    /* The hyperedges connect vertices within a small window so that the decomposition has many nodes of moderate width. */
+    std::uniform_int_distribution<htd::vertex_t> startDistribution(1, vertexCount - windowSize + 1);
+
+    std::uniform_int_distribution<htd::vertex_t> offsetDistribution(0, windowSize - 1);
+
+    std::uniform_int_distribution<std::size_t> sizeDistribution(2, maxEdgeSize);
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        std::vector<htd::vertex_t> elements;
+
+        htd::vertex_t start = startDistribution(generator);
+
+        std::size_t edgeSize = sizeDistribution(generator);
+
+        for (std::size_t position = 0; position < edgeSize; ++position)
+        {
+            elements.push_back(start + offsetDistribution(generator));
+        }
+
+        graph->addEdge(elements);
+    }
+
+    std::cout << "Graph: " << vertexCount << " vertices, " << edgeCount << " hyperedges (size <= " << maxEdgeSize << ", window " << windowSize << ")" << std::endl;
+
+    std::vector<std::size_t> threadCounts { 1, 2, 4 };
+
+    if (std::thread::hardware_concurrency() > 4)
+    {
+        threadCounts.push_back(std::thread::hardware_concurrency());
+    }
+
+    for (std::size_t threadCount : threadCounts)
+    {
+        htd::HypertreeDecompositionAlgorithm algorithm(manager.get());
+
+        algorithm.setThreadCount(threadCount);
+
+        std::size_t nodeCount = 0;
+
+        std::size_t coveringEdgeCount = 0;
+
+        std::srand(1);
+
+        htd_benchmark::measure("HypertreeDecompositionAlgorithm (" + std::to_string(threadCount) + " threads)", 1, [&]()
+        {
+            std::unique_ptr<htd::IHypertreeDecomposition> decomposition(algorithm.computeDecomposition(*graph));
+
+            nodeCount = decomposition->vertexCount();
+
+            coveringEdgeCount = 0;
+
+            for (htd::vertex_t node : decomposition->vertices())
+            {
+                coveringEdgeCount += decomposition->coveringEdges(node).size();
+            }
+
+            return (std::size_t)1;
+        });
+
+        std::cout << "Decomposition nodes: " << nodeCount << ", total covering edges: " << coveringEdgeCount << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * File:   ImporterBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ *  Write a random instance with the given number of vertices and hyperedges in the formats 'gr', 'hgr' and 'lp'.
+ *  The hyperedges written to the 'gr' file are restricted to their first two vertices.
+ */
+void writeInstances(const std::string & prefix, std::size_t vertexCount, std::size_t edgeCount, std::size_t maximumEdgeSize)
+{
+    std::ofstream grStream(prefix + ".gr");
+    std::ofstream hgrStream(prefix + ".hgr");
+    std::ofstream lpStream(prefix + ".lp");
+
+    grStream << "c random instance\np tw " << vertexCount << " " << edgeCount << "\n";
+    hgrStream << "c random instance\np tw " << vertexCount << " " << edgeCount << "\n";
+
+    for (htd::vertex_t vertex = 1; vertex <= vertexCount; ++vertex)
+    {
+        lpStream << "vertex(v" << vertex << ").\n";
+    }
+
+    std::mt19937 generator(1);
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+    std::uniform_int_distribution<std::size_t> sizeDistribution(2, maximumEdgeSize);
+
+    for (std::size_t edge = 0; edge < edgeCount; ++edge)
+    {
+        std::size_t size = sizeDistribution(generator);
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            htd::vertex_t vertex = vertexDistribution(generator);
+
+            if (index < 2)
+            {
+                grStream << vertex << (index == 0 ? " " : "\n");
+            }
+
+            hgrStream << vertex << (index + 1 < size ? " " : "\n");
+
+            lpStream << (index == 0 ? "edge(" : ",") << "v" << vertex << (index + 1 < size ? "" : ").\n");
+        }
+    }
+}
+
+/**
+ *  Determine the size of the given file in bytes.
+ */
+std::size_t fileSize(const std::string & path)
+{
+    std::ifstream stream(path, std::ios::in | std::ios::binary | std::ios::ate);
+
+    return static_cast<std::size_t>(stream.tellg());
+}
+
+/**
+ *  Tokenize a file in the format 'gr' using std::getline and std::stoul, without creating a graph. This is the
+ *  approach the importers used before and serves as a reference for the throughput of the tokenizer.
+ */
+std::size_t tokenizeWithGetline(const std::string & path)
+{
+    std::size_t ret = 0;
+
+    std::ifstream stream(path);
+
+    std::string line;
+
+    while (std::getline(stream, line))
+    {
+        if (!line.empty() && line[0] != 'c' && line[0] != 'p')
+        {
+            std::size_t position = 0;
+
+            ret += std::stoul(line, &position);
+
+            line = line.substr(position + 1);
+
+            ret += std::stoul(line, &position);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Tokenize a file in the format 'gr' using htd_io::InputBuffer and htd_io::InputCursor, without creating a graph.
+ */
+std::size_t tokenizeWithInputCursor(const std::string & path)
+{
+    std::size_t ret = 0;
+
+    htd_io::InputBuffer buffer(path);
+
+    htd_io::InputCursor cursor(buffer.begin(), buffer.end());
+
+    while (!cursor.atEnd())
+    {
+        char first = cursor.peek();
+
+        if (first != 'c' && first != 'p')
+        {
+            std::size_t vertex1 = 0;
+            std::size_t vertex2 = 0;
+
+            cursor.parseUnsigned(vertex1);
+            cursor.consume(' ');
+            cursor.parseUnsigned(vertex2);
+
+            ret += vertex1 + vertex2;
+        }
+
+        cursor.skipLine();
+    }
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+    std::size_t repetitions = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 3;
+    std::string prefix = argc > 4 ? argv[4] : "htd_importer_benchmark";
+
+    writeInstances(prefix, vertexCount, edgeCount, 6);
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::cout << "Instance: " << vertexCount << " vertices, " << edgeCount << " edges" << std::endl;
+
+    std::size_t grSize = fileSize(prefix + ".gr");
+    std::size_t hgrSize = fileSize(prefix + ".hgr");
+    std::size_t lpSize = fileSize(prefix + ".lp");
+
+    htd_benchmark::measureThroughput("gr: std::getline + std::stoul (tokenize only)", repetitions, grSize, [&]()
+    {
+        return tokenizeWithGetline(prefix + ".gr");
+    });
+
+    htd_benchmark::measureThroughput("gr: htd_io::InputCursor (tokenize only)", repetitions, grSize, [&]()
+    {
+        return tokenizeWithInputCursor(prefix + ".gr");
+    });
+
+    htd_io::GrFormatImporter grImporter(manager.get());
+
+    htd_benchmark::measureThroughput("gr: import from file", repetitions, grSize, [&]()
+    {
+        delete grImporter.import(prefix + ".gr");
+    });
+
+    htd_benchmark::measureThroughput("gr: import from stream", repetitions, grSize, [&]()
+    {
+        std::ifstream stream(prefix + ".gr");
+
+        delete grImporter.import(stream);
+    });
+
+    htd_io::HgrFormatImporter hgrImporter(manager.get());
+
+    htd_benchmark::measureThroughput("hgr: import from file", repetitions, hgrSize, [&]()
+    {
+        delete hgrImporter.import(prefix + ".hgr");
+    });
+
+    htd_io::LpFormatImporter lpImporter(manager.get());
+
+    htd_benchmark::measureThroughput("lp: import from file", repetitions, lpSize, [&]()
+    {
+        delete lpImporter.import(prefix + ".lp");
+    });
+
+    std::remove((prefix + ".gr").c_str());
+    std::remove((prefix + ".hgr").c_str());
+    std::remove((prefix + ".lp").c_str());
+
+    return 0;
+}
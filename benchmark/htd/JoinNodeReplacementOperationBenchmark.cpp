@@ -0,0 +1,99 @@
+/*
+ * File:   JoinNodeReplacementOperationBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t nodeCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    std::size_t vertexCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000;
+    std::size_t bagSize = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 5;
+    std::size_t repetitions = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 3;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableMultiHypergraph> graph(manager->multiHypergraphFactory().createInstance(vertexCount));
+
+    htd::TreeDecomposition decomposition(manager.get());
+
+    std::mt19937 generator(1);
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, vertexCount);
+
+    std::vector<htd::vertex_t> nodes { decomposition.insertRoot() };
+
+    /* Every node is attached to one of the most recently created nodes, which yields a deep tree with many join nodes. */
+    for (std::size_t index = 1; index < nodeCount; ++index)
+    {
+        std::uniform_int_distribution<std::size_t> parentDistribution(nodes.size() > 8 ? nodes.size() - 8 : 0, nodes.size() - 1);
+
+        nodes.push_back(decomposition.addChild(nodes[parentDistribution(generator)]));
+    }
+
+    for (htd::vertex_t node : nodes)
+    {
+        std::vector<htd::vertex_t> & bag = decomposition.mutableBagContent(node);
+
+        for (std::size_t index = 0; index < bagSize; ++index)
+        {
+            bag.push_back(vertexDistribution(generator));
+        }
+
+        std::sort(bag.begin(), bag.end());
+
+        bag.erase(std::unique(bag.begin(), bag.end()), bag.end());
+    }
+
+    std::cout << "Decomposition: " << decomposition.vertexCount() << " nodes, " << decomposition.joinNodeCount() << " join nodes, width " << (decomposition.maximumBagSize() - 1) << std::endl;
+
+    htd_benchmark::measure("copy decomposition", repetitions, [&]()
+    {
+        htd::TreeDecomposition copy(decomposition);
+
+        return copy.vertexCount();
+    });
+
+    htd::JoinNodeReplacementOperation operation(manager.get());
+
+    htd_benchmark::measure("copy decomposition and replace join nodes", repetitions, [&]()
+    {
+        htd::TreeDecomposition copy(decomposition);
+
+        operation.apply(*graph, copy);
+
+        return copy.vertexCount();
+    });
+
+    return 0;
+}
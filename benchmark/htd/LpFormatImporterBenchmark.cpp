@@ -0,0 +1,139 @@
+/*
+ * File:   LpFormatImporterBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ *  Create the name of the atom with the given index. The names resemble the ground atoms produced by ASP grounders
+ *  and are too long for the small string optimization of std::string.
+ */
+std::string atomName(std::size_t index)
+{
+    return "occurs_move_robot" + std::to_string(index % 97) + "_cell" + std::to_string(index / 97) + "_step" + std::to_string(index % 13);
+}
+
+/**
+ *  Write a random instance in the format 'lp' with the given number of atoms and hyperedges. Each hyperedge connects
+ *  atoms whose indices are close to each other.
+ */
+void writeInstance(const std::string & path, std::size_t atomCount, std::size_t edgeCount, std::size_t maximumEdgeSize)
+{
+    std::ofstream stream(path);
+
+    std::mt19937 generator(1);
+
+    std::uniform_int_distribution<std::size_t> atomDistribution(0, atomCount - 1);
+    std::uniform_int_distribution<std::size_t> offsetDistribution(0, 64);
+    std::uniform_int_distribution<std::size_t> sizeDistribution(2, maximumEdgeSize);
+
+    for (std::size_t index = 0; index < atomCount; ++index)
+    {
+        stream << "vertex(" << atomName(index) << ").\n";
+    }
+
+    for (std::size_t edge = 0; edge < edgeCount; ++edge)
+    {
+        std::size_t first = atomDistribution(generator);
+
+        std::size_t size = sizeDistribution(generator);
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            stream << (index == 0 ? "edge(" : ", ") << atomName((first + offsetDistribution(generator)) % atomCount) << (index + 1 < size ? "" : ").\n");
+        }
+    }
+}
+
+/**
+ *  Access the size of the file at the given path.
+ *
+ *  @param[in] path The path of the file.
+ *
+ *  @return The size of the file at the given path in bytes.
+ */
+std::size_t fileSize(const std::string & path)
+{
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+
+    return static_cast<std::size_t>(stream.tellg());
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t atomCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000000;
+    std::size_t repetitions = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 3;
+    std::string path = argc > 4 ? argv[4] : "htd_lp_benchmark.lp";
+
+    writeInstance(path, atomCount, edgeCount, 4);
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::size_t size = fileSize(path);
+
+    std::cout << "Instance: " << atomCount << " atoms, " << edgeCount << " edges, " << size << " bytes" << std::endl;
+
+    htd_io::LpFormatImporter importer(manager.get());
+
+    htd_benchmark::measureThroughput("lp: import from file", repetitions, size, [&]()
+    {
+        delete importer.import(path);
+    });
+
+    std::size_t bytesBefore = htd_benchmark::allocatedBytes();
+
+    std::unique_ptr<htd::NamedMultiHypergraph<std::string, std::string>> graph(importer.import(path));
+
+    std::size_t bytesAfter = htd_benchmark::allocatedBytes();
+
+    std::cout << "Retained heap memory: " << (bytesAfter - bytesBefore) << " bytes, " << (static_cast<double>(bytesAfter - bytesBefore) / graph->vertexCount()) << " bytes per atom" << std::endl;
+
+    htd_benchmark::measure("named graph: look up atoms by name", repetitions, [&]()
+    {
+        std::size_t sum = 0;
+
+        for (std::size_t index = 0; index < atomCount; ++index)
+        {
+            sum += graph->lookupVertex(atomName(index));
+        }
+
+        return sum > 0 ? atomCount : 0;
+    });
+
+    std::remove(path.c_str());
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * File:   MinFillOrderingAlgorithmBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : (5 * vertexCount) / 2;
+    std::size_t iterationCount = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 10;
+
+    unsigned int seed = argc > 4 ? static_cast<unsigned int>(std::strtoul(argv[4], nullptr, 10)) : 1;
+
+    std::srand(seed);
+
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMutableMultiHypergraph * graph = htd_benchmark::createRandomGraph(libraryInstance, vertexCount, edgeCount, 1);
+
+    htd::IGraphPreprocessor * preprocessor = libraryInstance->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(*graph);
+
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    std::cout << "Graph: " << graph->vertexCount() << " vertices, " << graph->edgeCount() << " edges" << std::endl;
+
+    htd_benchmark::measure("min-fill, one iteration per call", iterationCount, [&]()
+    {
+        delete algorithm.computeOrdering(*graph, *preprocessedGraph, (std::size_t)-1, 1);
+
+        return (std::size_t)1;
+    });
+
+    htd::IWidthLimitedVertexOrdering * reference = algorithm.computeOrdering(*graph, *preprocessedGraph, (std::size_t)-1, 1);
+
+    std::size_t bound = reference->maximumBagSize() > 1 ? reference->maximumBagSize() - 1 : 0;
+
+    delete reference;
+
+    /* The bound is chosen below the width of the reference ordering so that the algorithm keeps iterating. */
+    htd_benchmark::measure("min-fill, bounded iterations in one call", 1, [&]()
+    {
+        htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(*graph, *preprocessedGraph, bound, iterationCount);
+
+        std::size_t ret = ordering->requiredIterations();
+
+        delete ordering;
+
+        return ret;
+    });
+
+    delete preprocessedGraph;
+    delete preprocessor;
+    delete graph;
+    delete libraryInstance;
+
+    return 0;
+}
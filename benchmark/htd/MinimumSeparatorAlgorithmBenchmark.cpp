@@ -0,0 +1,63 @@
+/*
+ * File:   MinimumSeparatorAlgorithmBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 3 * vertexCount;
+    std::size_t threadCount = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1;
+
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMutableMultiHypergraph * graph = htd_benchmark::createRandomGraph(libraryInstance, vertexCount, edgeCount, 1);
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    algorithm.setThreadCount(threadCount);
+
+    std::cout << "Graph: " << graph->vertexCount() << " vertices, " << graph->edgeCount() << " edges" << std::endl;
+
+    htd_benchmark::measure("minimum separator, " + std::to_string(threadCount) + " thread(s)", 1, [&]()
+    {
+        std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(*graph);
+
+        std::cout << "Separator size: " << separator->size() << std::endl;
+
+        delete separator;
+
+        return (std::size_t)1;
+    });
+
+    delete graph;
+    delete libraryInstance;
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * File:   NormalizationOperationBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <random>
+
+/**
+ *  Create a deep copy of the given tree decomposition.
+ */
+htd::IMutableTreeDecomposition * copyDecomposition(const htd::IMutableTreeDecomposition & decomposition)
+{
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+    return decomposition.clone();
+#else
+    return decomposition.cloneMutableTreeDecomposition();
+#endif
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 40000;
+    std::size_t windowSize = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 12;
+    std::size_t repetitions = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 3;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableMultiHypergraph> graph(manager->multiHypergraphFactory().createInstance(vertexCount));
+
+    std::mt19937 generator(1);
+
+    /* The edges connect vertices within a small window so that the decomposition has many nodes of moderate width. */
+    std::uniform_int_distribution<htd::vertex_t> startDistribution(1, vertexCount - windowSize + 1);
+
+    std::uniform_int_distribution<htd::vertex_t> offsetDistribution(1, windowSize - 1);
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        htd::vertex_t start = startDistribution(generator);
+
+        graph->addEdge(start, start + offsetDistribution(generator));
+    }
+
+    std::cout << "Graph: " << vertexCount << " vertices, " << edgeCount << " edges (window " << windowSize << ")" << std::endl;
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(manager.get());
+
+    std::unique_ptr<htd::IMutableTreeDecomposition> decomposition(dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm.computeDecomposition(*graph)));
+
+    std::cout << "Decomposition: " << decomposition->vertexCount() << " nodes, width " << (decomposition->maximumBagSize() - 1) << std::endl;
+
+    htd_benchmark::measure("copy only", repetitions, [&]()
+    {
+        std::unique_ptr<htd::IMutableTreeDecomposition> copy(copyDecomposition(*decomposition));
+
+        return copy->vertexCount();
+    });
+
+    htd_benchmark::measure("pipeline of four operations (previous)", repetitions, [&]()
+    {
+        std::unique_ptr<htd::IMutableTreeDecomposition> copy(copyDecomposition(*decomposition));
+
+        htd::SemiNormalizationOperation(manager.get(), true, true, true).apply(*graph, *copy);
+        htd::ExchangeNodeReplacementOperation(manager.get()).apply(*graph, *copy);
+        htd::LimitMaximumForgottenVertexCountOperation(manager.get(), 1).apply(*graph, *copy);
+        htd::LimitMaximumIntroducedVertexCountOperation(manager.get(), 1, true).apply(*graph, *copy);
+
+        return copy->vertexCount();
+    });
+
+    htd_benchmark::measure("htd::NormalizationOperation", repetitions, [&]()
+    {
+        std::unique_ptr<htd::IMutableTreeDecomposition> copy(copyDecomposition(*decomposition));
+
+        htd::NormalizationOperation(manager.get(), true, true, true, true).apply(*graph, *copy);
+
+        return copy->vertexCount();
+    });
+
+    return 0;
+}
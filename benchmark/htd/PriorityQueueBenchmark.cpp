@@ -0,0 +1,181 @@
+/*
+ * File:   PriorityQueueBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+/**
+ *  A single update of the operation trace.
+ */
+struct Update
+{
+    /**
+     *  The vertex whose priority is updated or htd::Vertex::UNKNOWN if the top element shall be removed.
+     */
+    htd::vertex_t vertex;
+
+    /**
+     *  The new priority of the vertex.
+     */
+    std::size_t priority;
+};
+
+/**
+ *  Create a trace which removes all vertices one by one and updates the priorities of some remaining vertices
+ *  after each removal, similar to the access pattern of the min-degree and min-fill heuristics.
+ */
+std::vector<Update> createTrace(std::size_t vertexCount, std::size_t updatesPerRemoval, std::size_t maximumPriority, std::vector<std::size_t> & initialPriorities)
+{
+    std::vector<Update> ret;
+
+    std::mt19937 generator(1);
+
+    std::uniform_int_distribution<std::size_t> priorityDistribution(0, maximumPriority);
+
+    initialPriorities.resize(vertexCount);
+
+    for (std::size_t & priority : initialPriorities)
+    {
+        priority = priorityDistribution(generator);
+    }
+
+    for (std::size_t remaining = vertexCount; remaining > 0; --remaining)
+    {
+        ret.push_back(Update { htd::Vertex::UNKNOWN, 0 });
+
+        for (std::size_t index = 0; index < updatesPerRemoval; ++index)
+        {
+            ret.push_back(Update { static_cast<htd::vertex_t>(generator()), priorityDistribution(generator) });
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Replay the trace on a given queue type. Updates refer to the i-th remaining vertex, with i taken modulo the number
+ *  of remaining vertices, so that both implementations process exactly the same sequence of operations.
+ */
+template <typename Queue, typename Push, typename Select, typename Erase, typename Update_>
+std::size_t replay(Queue & queue, const std::vector<std::size_t> & initialPriorities, const std::vector<Update> & trace, Push push, Select select, Erase erase, Update_ update)
+{
+    std::size_t checksum = 0;
+
+    std::vector<htd::vertex_t> remaining(initialPriorities.size());
+    std::vector<htd::index_t> position(initialPriorities.size());
+    std::vector<std::size_t> priority(initialPriorities);
+
+    for (htd::vertex_t vertex = 0; vertex < initialPriorities.size(); ++vertex)
+    {
+        remaining[vertex] = vertex;
+        position[vertex] = vertex;
+
+        push(queue, vertex, priority[vertex]);
+    }
+
+    for (const Update & operation : trace)
+    {
+        if (operation.vertex == htd::Vertex::UNKNOWN)
+        {
+            htd::vertex_t vertex = select(queue);
+
+            erase(queue, vertex, priority[vertex]);
+
+            htd::vertex_t lastVertex = remaining.back();
+
+            remaining[position[vertex]] = lastVertex;
+            position[lastVertex] = position[vertex];
+            remaining.pop_back();
+
+            checksum += priority[vertex];
+        }
+        else if (!remaining.empty())
+        {
+            htd::vertex_t vertex = remaining[operation.vertex % remaining.size()];
+
+            update(queue, vertex, priority[vertex], operation.priority);
+
+            priority[vertex] = operation.priority;
+        }
+    }
+
+    return checksum;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    std::size_t updatesPerRemoval = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 8;
+    std::size_t maximumPriority = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 64;
+
+    std::srand(1);
+
+    std::vector<std::size_t> initialPriorities;
+
+    std::vector<Update> trace = createTrace(vertexCount, updatesPerRemoval, maximumPriority, initialPriorities);
+
+    std::cout << "Trace: " << vertexCount << " vertices, " << trace.size() << " operations, priorities 0-" << maximumPriority << std::endl;
+
+    htd_benchmark::measure("htd::PriorityQueue", 1, [&]()
+    {
+        typedef htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> Queue;
+
+        Queue queue;
+
+        std::size_t checksum = replay(queue, initialPriorities, trace,
+                                      [](Queue & q, htd::vertex_t vertex, std::size_t priority) { q.push(vertex, priority); },
+                                      [](Queue & q) { return htd::selectRandomElement<htd::vertex_t>(q.topCollection()); },
+                                      [](Queue & q, htd::vertex_t vertex, std::size_t) { q.eraseFromTopCollection(vertex); },
+                                      [](Queue & q, htd::vertex_t vertex, std::size_t oldPriority, std::size_t newPriority) { q.updatePriority(vertex, oldPriority, newPriority); });
+
+        std::cout << "Checksum: " << checksum << std::endl;
+
+        return trace.size();
+    });
+
+    htd_benchmark::measure("htd::BucketPriorityQueue", 1, [&]()
+    {
+        typedef htd::BucketPriorityQueue Queue;
+
+        Queue queue(vertexCount, vertexCount + 1);
+
+        std::size_t checksum = replay(queue, initialPriorities, trace,
+                                      [](Queue & q, htd::vertex_t vertex, std::size_t priority) { q.push(vertex, priority); },
+                                      [](Queue & q) { return q.selectRandomTopElement(); },
+                                      [](Queue & q, htd::vertex_t vertex, std::size_t) { q.erase(vertex); },
+                                      [](Queue & q, htd::vertex_t vertex, std::size_t, std::size_t newPriority) { q.updatePriority(vertex, newPriority); });
+
+        std::cout << "Checksum: " << checksum << std::endl;
+
+        return trace.size();
+    });
+
+    return 0;
+}
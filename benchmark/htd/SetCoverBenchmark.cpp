@@ -0,0 +1,169 @@
+/*
+ * File:   SetCoverBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/**
+ *  Structure representing a set cover instance.
+ */
+struct SetCoverInstance
+{
+    /**
+     *  The elements which shall be covered.
+     */
+    std::vector<htd::id_t> elements;
+
+    /**
+     *  The available containers.
+     */
+    std::vector<std::vector<htd::id_t>> containers;
+};
+
+/**
+ *  Create a random set cover instance resembling the covering problems which occur during the computation of
+ *  hypertree decompositions, i.e., a bag is covered by hyperedges which may also contain vertices outside the bag.
+ *
+ *  @param[in] generator        The random number generator.
+ *  @param[in] bagSize          The number of elements which shall be covered.
+ *  @param[in] containerCount   The number of containers.
+ *  @param[in] maxContainerSize The maximum size of a container.
+ *
+ *  @return The new set cover instance.
+ */
+SetCoverInstance createInstance(std::mt19937 & generator, std::size_t bagSize, std::size_t containerCount, std::size_t maxContainerSize)
+{
+    SetCoverInstance ret;
+
+    std::size_t universeSize = 2 * bagSize;
+
+    std::vector<htd::id_t> universe(universeSize);
+
+    std::iota(universe.begin(), universe.end(), (htd::id_t)1);
+
+    std::shuffle(universe.begin(), universe.end(), generator);
+
+    ret.elements.assign(universe.begin(), universe.begin() + bagSize);
+
+    std::sort(ret.elements.begin(), ret.elements.end());
+
+    std::uniform_int_distribution<std::size_t> sizeDistribution(2, maxContainerSize);
+
+    for (std::size_t index = 0; index < containerCount; ++index)
+    {
+        std::shuffle(universe.begin(), universe.end(), generator);
+
+        std::vector<htd::id_t> container(universe.begin(), universe.begin() + sizeDistribution(generator));
+
+        std::sort(container.begin(), container.end());
+
+        ret.containers.push_back(std::move(container));
+    }
+
+    /* Make sure that every element can be covered. */
+    for (htd::id_t element : ret.elements)
+    {
+        std::vector<htd::id_t> & container = ret.containers[element % containerCount];
+
+        auto position = std::lower_bound(container.begin(), container.end(), element);
+
+        if (position == container.end() || *position != element)
+        {
+            container.insert(position, element);
+        }
+    }
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t bagSize = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 40;
+    std::size_t containerCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 40;
+    std::size_t maxContainerSize = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 12;
+    std::size_t instanceCount = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 20;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::mt19937 generator(1);
+
+    std::vector<SetCoverInstance> instances;
+
+    for (std::size_t index = 0; index < instanceCount; ++index)
+    {
+        instances.push_back(createInstance(generator, bagSize, containerCount, maxContainerSize));
+    }
+
+    std::cout << "Instances: " << instanceCount << " x (" << bagSize << " elements, " << containerCount << " containers)" << std::endl;
+
+    std::size_t totalCoverSize = 0;
+
+    htd_benchmark::measure("SetCoverAlgorithm", 1, [&]()
+    {
+        htd::SetCoverAlgorithm algorithm(manager.get());
+
+        for (const SetCoverInstance & instance : instances)
+        {
+            std::vector<htd::index_t> result;
+
+            algorithm.computeSetCover(instance.elements, instance.containers, result);
+
+            totalCoverSize += result.size();
+        }
+
+        return instances.size();
+    });
+
+    std::cout << "Total size of optimal covers: " << totalCoverSize << std::endl;
+
+    totalCoverSize = 0;
+
+    htd_benchmark::measure("GreedySetCoverAlgorithm", 1, [&]()
+    {
+        htd::GreedySetCoverAlgorithm algorithm(manager.get());
+
+        for (const SetCoverInstance & instance : instances)
+        {
+            std::vector<htd::index_t> result;
+
+            algorithm.computeSetCover(instance.elements, instance.containers, result);
+
+            totalCoverSize += result.size();
+        }
+
+        return instances.size();
+    });
+
+    std::cout << "Total size of greedy covers: " << totalCoverSize << std::endl;
+
+    return 0;
+}
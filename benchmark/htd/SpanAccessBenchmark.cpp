@@ -0,0 +1,160 @@
+/*
+ * File:   SpanAccessBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ *  Compare the iteration of all neighborhoods via htd::IGraphStructure::neighbors() and via
+ *  htd::IContiguousGraphStructure::neighborSpan(). One unit of work is one visited neighbor.
+ *
+ *  @param[in] name         The name of the graph implementation.
+ *  @param[in] graph        The graph which shall be iterated.
+ *  @param[in] repetitions  The number of repetitions of each measurement.
+ */
+void measureNeighborIteration(const std::string & name, const htd::IGraphStructure & graph, std::size_t repetitions)
+{
+    const htd::IContiguousGraphStructure & contiguousGraph = dynamic_cast<const htd::IContiguousGraphStructure &>(graph);
+
+    std::vector<htd::vertex_t> vertices;
+
+    graph.copyVerticesTo(vertices);
+
+    htd_benchmark::measure(name + ": neighbors()", repetitions, [&]()
+    {
+        std::size_t count = 0;
+
+        for (htd::vertex_t vertex : vertices)
+        {
+            for (htd::vertex_t neighbor : graph.neighbors(vertex))
+            {
+                count += neighbor != htd::Vertex::UNKNOWN ? 1 : 0;
+            }
+        }
+
+        return count;
+    });
+
+    htd_benchmark::measure(name + ": neighborSpan()", repetitions, [&]()
+    {
+        std::size_t count = 0;
+
+        for (htd::vertex_t vertex : vertices)
+        {
+            for (htd::vertex_t neighbor : contiguousGraph.neighborSpan(vertex))
+            {
+                count += neighbor != htd::Vertex::UNKNOWN ? 1 : 0;
+            }
+        }
+
+        return count;
+    });
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 3 * vertexCount;
+    std::size_t repetitions = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 10;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableMultiHypergraph> multiHypergraph(htd_benchmark::createRandomGraph(manager.get(), vertexCount, edgeCount, 1));
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+    edges.reserve(multiHypergraph->edgeCount());
+
+    for (const htd::Hyperedge & hyperedge : multiHypergraph->hyperedges())
+    {
+        edges.emplace_back(hyperedge[0], hyperedge[1]);
+    }
+
+    std::unique_ptr<htd::StaticGraph> staticGraph(new htd::StaticGraph(manager.get(), vertexCount, edges));
+
+    htd::GraphPreprocessor preprocessor(manager.get());
+
+    std::unique_ptr<htd::IPreprocessedGraph> preprocessedGraph(preprocessor.prepare(*multiHypergraph));
+
+    std::unique_ptr<htd::IPreprocessedGraph> staticPreprocessedGraph(preprocessor.prepare(*staticGraph));
+
+    std::cout << "Graph: " << vertexCount << " vertices, " << edges.size() << " edges" << std::endl;
+
+    measureNeighborIteration("MultiHypergraph", *multiHypergraph, repetitions);
+
+    measureNeighborIteration("PreprocessedGraph", *preprocessedGraph, repetitions);
+
+    measureNeighborIteration("StaticGraph", *staticGraph, repetitions);
+
+    /* Materialize the hyperedges before measuring the iteration itself. */
+    staticGraph->hyperedgeSpan();
+
+    htd_benchmark::measure("StaticGraph: hyperedges()", repetitions, [&]()
+    {
+        std::size_t count = 0;
+
+        for (const htd::Hyperedge & hyperedge : staticGraph->hyperedges())
+        {
+            count += hyperedge.size() > 0 ? 1 : 0;
+        }
+
+        return count;
+    });
+
+    htd_benchmark::measure("StaticGraph: hyperedgeSpan()", repetitions, [&]()
+    {
+        std::size_t count = 0;
+
+        for (const htd::Hyperedge & hyperedge : staticGraph->hyperedgeSpan())
+        {
+            count += hyperedge.size() > 0 ? 1 : 0;
+        }
+
+        return count;
+    });
+
+    htd::BucketEliminationGraphDecompositionAlgorithm algorithm(manager.get());
+
+    htd_benchmark::measure("MultiHypergraph: bucket elimination", 1, [&]()
+    {
+        std::unique_ptr<htd::IGraphDecomposition> decomposition(algorithm.computeDecomposition(*multiHypergraph, *preprocessedGraph));
+
+        return multiHypergraph->edgeCount();
+    });
+
+    htd_benchmark::measure("StaticGraph: bucket elimination", 1, [&]()
+    {
+        std::unique_ptr<htd::IGraphDecomposition> decomposition(algorithm.computeDecomposition(*staticGraph, *staticPreprocessedGraph));
+
+        return staticGraph->edgeCount();
+    });
+
+    return 0;
+}
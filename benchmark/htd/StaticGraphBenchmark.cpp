@@ -0,0 +1,238 @@
+/*
+ * File:   StaticGraphBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ *  Build a graph, print the time needed for the construction and the number of bytes occupied by the graph.
+ *
+ *  @param[in] name     The name of the graph implementation.
+ *  @param[in] function The function creating the graph.
+ *
+ *  @return The new graph.
+ */
+template <typename Function>
+htd::IMultiHypergraph * measureMemory(const std::string & name, Function && function)
+{
+    std::size_t bytesBefore = htd_benchmark::allocatedBytes();
+
+    htd::IMultiHypergraph * ret = nullptr;
+
+    htd_benchmark::measure(name + ": construction", 1, [&]()
+    {
+        ret = function();
+
+        return ret->edgeCount();
+    });
+
+    std::size_t bytes = htd_benchmark::allocatedBytes() - bytesBefore;
+
+    std::cout << std::left << std::setw(48) << (name + ": memory")
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << (static_cast<double>(bytes) / (1024.0 * 1024.0)) << " MB      "
+              << std::setw(14) << (static_cast<double>(bytes) / std::max(ret->edgeCount(), (std::size_t)1)) << " bytes/edge" << std::endl;
+
+    return ret;
+}
+
+/**
+ *  Measure the throughput of the read-only queries issued by the preprocessing and ordering algorithms.
+ *
+ *  @param[in] name         The name of the graph implementation.
+ *  @param[in] manager      The management instance used by the preprocessor.
+ *  @param[in] graph        The graph which shall be queried.
+ *  @param[in] repetitions  The number of repetitions of each measurement.
+ */
+void measureQueries(const std::string & name, const htd::LibraryInstance * const manager, const htd::IMultiHypergraph & graph, std::size_t repetitions)
+{
+    const htd::ConstCollection<htd::vertex_t> & vertices = graph.vertices();
+
+    std::vector<htd::vertex_t> vertexVector(vertices.begin(), vertices.end());
+
+    htd_benchmark::measure(name + ": neighbors()", repetitions, [&]()
+    {
+        std::size_t count = 0;
+
+        for (htd::vertex_t vertex : vertexVector)
+        {
+            for (htd::vertex_t neighbor : graph.neighbors(vertex))
+            {
+                count += neighbor != htd::Vertex::UNKNOWN ? 1 : 0;
+            }
+        }
+
+        return count;
+    });
+
+    htd_benchmark::measure(name + ": copyNeighborsTo()", repetitions, [&]()
+    {
+        std::vector<htd::vertex_t> neighbors;
+
+        std::size_t sum = 0;
+
+        for (htd::vertex_t vertex : vertexVector)
+        {
+            neighbors.clear();
+
+            graph.copyNeighborsTo(vertex, neighbors);
+
+            sum += neighbors.size();
+        }
+
+        return sum;
+    });
+
+    htd_benchmark::measure(name + ": isNeighbor()", repetitions, [&]()
+    {
+        std::mt19937 generator(1);
+
+        std::uniform_int_distribution<std::size_t> distribution(0, vertexVector.size() - 1);
+
+        for (std::size_t index = 0; index < vertexVector.size(); ++index)
+        {
+            graph.isNeighbor(vertexVector[distribution(generator)], vertexVector[distribution(generator)]);
+        }
+
+        return vertexVector.size();
+    });
+
+    htd_benchmark::measure(name + ": preprocessing", 1, [&]()
+    {
+        htd::GraphPreprocessor preprocessor(manager);
+
+        std::unique_ptr<htd::IPreprocessedGraph> preprocessedGraph(preprocessor.prepare(graph));
+
+        return graph.edgeCount();
+    });
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::size_t vertexCount = 1000000;
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+    if (argc > 1 && std::strtoul(argv[1], nullptr, 10) == 0)
+    {
+        htd_io::GrFormatImporter importer(manager.get());
+
+        std::unique_ptr<htd::IMultiGraph> graph(importer.import(std::string(argv[1])));
+
+        if (!graph)
+        {
+            std::cerr << "Unable to read graph from file '" << argv[1] << "'." << std::endl;
+
+            return 1;
+        }
+
+        vertexCount = graph->vertexCount();
+
+        edges.reserve(graph->edgeCount());
+
+        for (const htd::Hyperedge & hyperedge : graph->hyperedges())
+        {
+            edges.emplace_back(hyperedge[0], hyperedge[1]);
+        }
+    }
+    else
+    {
+        vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : vertexCount;
+
+        std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 3 * vertexCount;
+
+        std::mt19937 generator(1);
+
+        std::uniform_int_distribution<htd::vertex_t> distribution(1, vertexCount);
+
+        edges.reserve(edgeCount);
+
+        while (edges.size() < edgeCount)
+        {
+            htd::vertex_t vertex1 = distribution(generator);
+            htd::vertex_t vertex2 = distribution(generator);
+
+            if (vertex1 != vertex2)
+            {
+                edges.emplace_back(vertex1, vertex2);
+            }
+        }
+    }
+
+    std::size_t repetitions = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 5;
+
+    std::cout << "Graph: " << vertexCount << " vertices, " << edges.size() << " edges" << std::endl;
+
+    std::unique_ptr<htd::IMultiHypergraph> multiGraph(measureMemory("MultiGraph", [&]()
+    {
+        htd::IMutableMultiGraph * ret = manager->multiGraphFactory().createInstance(vertexCount);
+
+        ret->addEdges(edges);
+
+        return ret;
+    }));
+
+    measureQueries("MultiGraph", manager.get(), *multiGraph, repetitions);
+
+    multiGraph.reset();
+
+    std::unique_ptr<htd::IMultiHypergraph> graph(measureMemory("Graph", [&]()
+    {
+        htd::IMutableGraph * ret = manager->graphFactory().createInstance(vertexCount);
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+        {
+            ret->addEdge(edge.first, edge.second);
+        }
+
+        return ret;
+    }));
+
+    measureQueries("Graph", manager.get(), *graph, repetitions);
+
+    graph.reset();
+
+    std::unique_ptr<htd::IMultiHypergraph> staticGraph(measureMemory("StaticGraph", [&]()
+    {
+        return manager->graphFactory().createStaticInstance(vertexCount, edges);
+    }));
+
+    measureQueries("StaticGraph", manager.get(), *staticGraph, repetitions);
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * File:   TdFormatExporterBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+/**
+ *  The previous implementation of the format 'td' which formats each bag via a std::stringstream and renumbers the
+ *  nodes via a hash map.
+ */
+void writeWithStringStream(const htd::ITreeDecomposition & decomposition, std::size_t vertexCount, std::ostream & outputStream)
+{
+    std::unordered_map<htd::vertex_t, std::size_t> indices;
+
+    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << vertexCount << "\n";
+
+    std::size_t index = 1;
+
+    std::stringstream tmpStream;
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        tmpStream << "b " << index << " ";
+
+        indices.emplace(node, index);
+
+        for (htd::vertex_t vertex : decomposition.bagContent(node))
+        {
+            tmpStream << vertex << " ";
+        }
+
+        tmpStream << "\n" << std::flush;
+
+        outputStream << tmpStream.rdbuf();
+
+        tmpStream.clear();
+
+        ++index;
+    }
+
+    for (const htd::Hyperedge & edge : decomposition.hyperedges())
+    {
+        outputStream << indices.at(edge[0]) << " " << indices.at(edge[1]) << "\n";
+    }
+}
+
+/**
+ *  Determine the size of the given file in bytes.
+ */
+std::size_t fileSize(const std::string & path)
+{
+    std::ifstream stream(path, std::ios::in | std::ios::binary | std::ios::ate);
+
+    return static_cast<std::size_t>(stream.tellg());
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t nodeCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::size_t bagSize = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 12;
+    std::size_t repetitions = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 3;
+    std::string prefix = argc > 4 ? argv[4] : "htd_exporter_benchmark";
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::size_t vertexCount = nodeCount * 2;
+
+    htd::MultiHypergraph graph(manager.get(), vertexCount);
+
+    htd::TreeDecomposition decomposition(manager.get());
+
+    std::mt19937 generator(1);
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+
+    std::vector<htd::vertex_t> nodes { decomposition.insertRoot() };
+
+    for (std::size_t index = 1; index < nodeCount; ++index)
+    {
+        std::uniform_int_distribution<std::size_t> parentDistribution(std::max(nodes.size(), (std::size_t)8) - 8, nodes.size() - 1);
+
+        nodes.push_back(decomposition.addChild(nodes[parentDistribution(generator)]));
+    }
+
+    for (htd::vertex_t node : nodes)
+    {
+        std::vector<htd::vertex_t> & bag = decomposition.mutableBagContent(node);
+
+        for (std::size_t index = 0; index < bagSize; ++index)
+        {
+            bag.push_back(vertexDistribution(generator));
+        }
+
+        std::sort(bag.begin(), bag.end());
+
+        bag.erase(std::unique(bag.begin(), bag.end()), bag.end());
+    }
+
+    std::cout << "Decomposition: " << nodeCount << " nodes, bag size " << bagSize << std::endl;
+
+    {
+        std::ofstream stream(prefix + ".td");
+
+        htd_io::TdFormatExporter().write(decomposition, graph, stream);
+    }
+
+    {
+        std::ofstream stream(prefix + ".btd", std::ios::binary);
+
+        htd_io::BinaryTdFormatExporter().write(decomposition, graph, stream);
+    }
+
+    std::size_t tdSize = fileSize(prefix + ".td");
+    std::size_t btdSize = fileSize(prefix + ".btd");
+
+    std::cout << "Output size: td " << tdSize << " bytes, btd " << btdSize << " bytes" << std::endl;
+
+    htd_benchmark::measureThroughput("td: std::stringstream per bag (previous)", repetitions, tdSize, [&]()
+    {
+        std::ofstream stream(prefix + ".td");
+
+        writeWithStringStream(decomposition, graph.vertexCount(), stream);
+    });
+
+    htd_benchmark::measureThroughput("td: htd_io::TdFormatExporter", repetitions, tdSize, [&]()
+    {
+        std::ofstream stream(prefix + ".td");
+
+        htd_io::TdFormatExporter().write(decomposition, graph, stream);
+    });
+
+    htd_benchmark::measureThroughput("btd: htd_io::BinaryTdFormatExporter", repetitions, btdSize, [&]()
+    {
+        std::ofstream stream(prefix + ".btd", std::ios::binary);
+
+        htd_io::BinaryTdFormatExporter().write(decomposition, graph, stream);
+    });
+
+    htd_io::InputBuffer input(prefix + ".btd");
+
+    htd_benchmark::measureThroughput("btd: htd_io::BinaryTdFormatReader (all bags)", repetitions, btdSize, [&]()
+    {
+        htd_io::BinaryTdFormatReader reader(input.begin(), input.end());
+
+        std::vector<htd::vertex_t> bag;
+
+        for (std::size_t node = 1; node <= reader.nodeCount(); ++node)
+        {
+            reader.bagContent(node, bag);
+        }
+    });
+
+    std::remove((prefix + ".td").c_str());
+    std::remove((prefix + ".btd").c_str());
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * File:   TreeCloneBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+/**
+ *  Create a random tree decomposition whose nodes are attached to uniformly chosen existing nodes.
+ */
+htd::TreeDecomposition * createRandomDecomposition(const htd::LibraryInstance * const manager, std::size_t nodeCount, std::size_t bagSize, unsigned int seed)
+{
+    htd::TreeDecomposition * ret = new htd::TreeDecomposition(manager);
+
+    std::mt19937 generator(seed);
+
+    std::vector<htd::vertex_t> nodes;
+
+    nodes.reserve(nodeCount);
+
+    std::vector<htd::vertex_t> bag(bagSize);
+
+    for (std::size_t index = 0; index < nodeCount; ++index)
+    {
+        for (htd::vertex_t & vertex : bag)
+        {
+            vertex = static_cast<htd::vertex_t>(generator() % (nodeCount * 2)) + 1;
+        }
+
+        std::sort(bag.begin(), bag.end());
+
+        bag.erase(std::unique(bag.begin(), bag.end()), bag.end());
+
+        if (nodes.empty())
+        {
+            nodes.push_back(ret->insertRoot(bag, htd::FilteredHyperedgeCollection()));
+        }
+        else
+        {
+            nodes.push_back(ret->addChild(nodes[generator() % nodes.size()], bag, htd::FilteredHyperedgeCollection()));
+        }
+
+        bag.resize(bagSize);
+    }
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t nodeCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    std::size_t bagSize = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 8;
+    std::size_t repetitions = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 20;
+    std::size_t churnCount = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 10000;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::cout << "Tree decomposition: " << nodeCount << " nodes, bag size " << bagSize << std::endl;
+
+    htd_benchmark::measure("construction (insertRoot / addChild)", repetitions, [&]()
+    {
+        std::unique_ptr<htd::TreeDecomposition> decomposition(createRandomDecomposition(manager.get(), nodeCount, bagSize, 1));
+
+        return decomposition->vertexCount();
+    });
+
+    std::unique_ptr<htd::TreeDecomposition> decomposition(createRandomDecomposition(manager.get(), nodeCount, bagSize, 1));
+
+    htd_benchmark::measure("clone()", repetitions, [&]()
+    {
+        std::unique_ptr<htd::TreeDecomposition> copy(decomposition->clone());
+
+        return copy->vertexCount();
+    });
+
+    htd_benchmark::measure("addParent / removeVertex churn", repetitions, [&]()
+    {
+        std::unique_ptr<htd::TreeDecomposition> copy(decomposition->clone());
+
+        const std::vector<htd::vertex_t> & vertices = decomposition->vertexVector();
+
+        std::size_t count = std::min(churnCount, vertices.size());
+
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            copy->removeVertex(copy->addParent(vertices[index]));
+        }
+
+        return count;
+    });
+
+    return 0;
+}
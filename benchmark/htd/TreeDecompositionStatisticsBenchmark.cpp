@@ -0,0 +1,87 @@
+/*
+ * File:   TreeDecompositionStatisticsBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <memory>
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2 * vertexCount;
+    std::size_t repetitions = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1000;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableMultiHypergraph> graph(htd_benchmark::createRandomGraph(manager.get(), vertexCount, edgeCount, 1));
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(manager.get());
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph));
+
+    htd::TreeDecomposition treeDecomposition(*decomposition);
+
+    std::cout << "Decomposition: " << treeDecomposition.vertexCount() << " nodes, width " << treeDecomposition.maximumBagSize() - 1 << std::endl;
+
+    std::size_t checksum = 0;
+
+    htd_benchmark::measure("maximumBagSize()", repetitions, [&]()
+    {
+        checksum += treeDecomposition.maximumBagSize();
+
+        return (std::size_t)1;
+    });
+
+    htd_benchmark::measure("forgetNodeCount() + introduceNodeCount()", repetitions, [&]()
+    {
+        checksum += treeDecomposition.forgetNodeCount() + treeDecomposition.introduceNodeCount();
+
+        return (std::size_t)1;
+    });
+
+    htd_benchmark::measure("mutableBagContent() + maximumBagSize()", 10, [&]()
+    {
+        treeDecomposition.mutableBagContent(treeDecomposition.root());
+
+        checksum += treeDecomposition.maximumBagSize();
+
+        return (std::size_t)1;
+    });
+
+    htd_benchmark::measure("mutableBagContent() + forgetNodeCount()", 10, [&]()
+    {
+        treeDecomposition.mutableBagContent(treeDecomposition.root());
+
+        checksum += treeDecomposition.forgetNodeCount();
+
+        return (std::size_t)1;
+    });
+
+    std::cout << "Checksum: " << checksum << std::endl;
+
+    return 0;
+}
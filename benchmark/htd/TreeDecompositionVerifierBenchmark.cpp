@@ -0,0 +1,146 @@
+/*
+ * File:   TreeDecompositionVerifierBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "BenchmarkHelpers.hpp"
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+/**
+ *  The previous implementation of the hyperedge coverage check which compares every hyperedge with every bag until
+ *  all hyperedges are covered.
+ */
+std::size_t countUncoveredHyperedgesQuadratic(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition)
+{
+    std::unordered_set<htd::id_t> missingEdges;
+
+    std::vector<std::vector<htd::vertex_t>> sortedEdges;
+
+    std::vector<htd::id_t> identifiers;
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        sortedEdges.emplace_back(hyperedge.sortedElements().begin(), hyperedge.sortedElements().end());
+
+        identifiers.push_back(hyperedge.id());
+
+        missingEdges.insert(hyperedge.id());
+    }
+
+    for (auto it = decomposition.vertices().begin(); !missingEdges.empty() && it != decomposition.vertices().end(); ++it)
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(*it);
+
+        for (htd::index_t index = 0; !missingEdges.empty() && index < sortedEdges.size(); ++index)
+        {
+            const std::vector<htd::vertex_t> & edge = sortedEdges[index];
+
+            if (missingEdges.count(identifiers[index]) > 0 && std::includes(bag.begin(), bag.end(), edge.begin(), edge.end()))
+            {
+                missingEdges.erase(identifiers[index]);
+            }
+        }
+    }
+
+    return missingEdges.size();
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    std::size_t edgeCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+    std::size_t windowSize = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 12;
+    std::size_t repetitions = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 3;
+
+    std::unique_ptr<htd::LibraryInstance> manager(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableMultiHypergraph> graph(manager->multiHypergraphFactory().createInstance(vertexCount));
+
+    std::mt19937 generator(1);
+
+    /* The edges connect vertices within a small window so that the decomposition has many nodes of moderate width. */
+    std::uniform_int_distribution<htd::vertex_t> startDistribution(1, vertexCount - windowSize + 1);
+
+    std::uniform_int_distribution<htd::vertex_t> offsetDistribution(1, windowSize - 1);
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        htd::vertex_t start = startDistribution(generator);
+
+        graph->addEdge(start, start + offsetDistribution(generator));
+    }
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(manager.get());
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph));
+
+    std::cout << "Graph: " << vertexCount << " vertices, " << edgeCount << " edges, decomposition: " << decomposition->vertexCount() << " nodes, width " << (decomposition->maximumBagSize() - 1) << std::endl;
+
+    htd_benchmark::measure("coverage: all bags per hyperedge (previous)", repetitions, [&]()
+    {
+        countUncoveredHyperedgesQuadratic(*graph, *decomposition);
+
+        return edgeCount;
+    });
+
+    std::vector<std::size_t> threadCounts { 1, 2, 4 };
+
+    if (std::thread::hardware_concurrency() > 4)
+    {
+        threadCounts.push_back(std::thread::hardware_concurrency());
+    }
+
+    for (std::size_t threadCount : threadCounts)
+    {
+        htd::TreeDecompositionVerifier verifier;
+
+        verifier.setThreadCount(threadCount);
+
+        htd_benchmark::measure("coverage: indexed bags, " + std::to_string(threadCount) + " thread(s)", repetitions, [&]()
+        {
+            verifier.verifyHyperedgeCoverage(*graph, *decomposition);
+
+            return edgeCount;
+        });
+    }
+
+    htd::TreeDecompositionVerifier verifier;
+
+    htd_benchmark::measure("full verification", repetitions, [&]()
+    {
+        verifier.verify(*graph, *decomposition);
+
+        return edgeCount;
+    });
+
+    return 0;
+}
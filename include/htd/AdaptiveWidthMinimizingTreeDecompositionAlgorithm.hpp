@@ -230,6 +230,8 @@ namespace htd
 
             HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) override;
 
+            HTD_API std::vector<htd::ILabelingFunction *> releaseLabelingFunctions(void) override;
+
             HTD_API bool isSafelyInterruptible(void) const override;
 
             HTD_API bool isComputeInducedEdgesEnabled(void) const override;
@@ -250,6 +252,29 @@ namespace htd
              */
             HTD_API void setDecisionRounds(std::size_t rounds);
 
+            /**
+             *  Check whether the algorithms of a decision round are executed concurrently.
+             *
+             *  @return True if the algorithms of a decision round are executed concurrently, false otherwise.
+             */
+            HTD_API bool isRacingEnabled(void) const;
+
+            /**
+             *  Set whether the algorithms of a decision round shall be executed concurrently (Default: false).
+             *
+             *  If racing is enabled, all algorithms which are not disqualified yet run in parallel on the shared preprocessed input
+             *  graph, each of them on a thread of its own. The width of the best decomposition found so far is passed as a live upper
+             *  bound to all base algorithms of type htd::BucketEliminationTreeDecompositionAlgorithm, so that their width-limitable
+             *  ordering algorithms (see htd::IWidthLimitableOrderingAlgorithm) abort as soon as they cannot lead to a decomposition
+             *  at least as good as the best one. For an aborted algorithm, the bound plus one is recorded as its width within the
+             *  decision round.
+             *
+             *  @note The base algorithms must not share any mutable state, calls of the progress callback are serialized.
+             *
+             *  @param[in] racingEnabled    A boolean flag indicating whether the algorithms of a decision round shall be executed concurrently.
+             */
+            HTD_API void setRacingEnabled(bool racingEnabled);
+
             /**
              *  Getter for the number of iterations which shall be performed (0=infinite).
              *
@@ -28,13 +28,20 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 
+#include <deque>
+#include <functional>
 #include <stdexcept>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace htd
 {
     /**
      * Implementation of a graph naming providing bi-directional mappings between vertices (and/or edges) and their names.
+     *
+     * Each name is stored only once. The mappings from names to IDs refer to the stored names, so that looking up or
+     * inserting a name which is already known does not copy it.
      */
     template <typename VertexNameType, typename EdgeNameType,
               typename VertexNameHashFunction = std::hash<VertexNameType>, typename VertexNameEqualityFunction = std::equal_to<VertexNameType>,
@@ -42,7 +49,7 @@ namespace htd
     class BidirectionalGraphNaming
     {
         public:
-            BidirectionalGraphNaming(void) : vertexNames_(), edgeNames_(), vertexNamesReverseMap_(), edgeNamesReverseMap_()
+            BidirectionalGraphNaming(void) : vertexNames_(), edgeNames_()
             {
 
             }
@@ -81,7 +88,7 @@ namespace htd
              */
             bool isNamedVertex(htd::vertex_t vertex) const
             {
-                return vertexNames_.count(vertex) == 1;
+                return vertexNames_.isNamed(vertex);
             }
 
             /**
@@ -93,7 +100,7 @@ namespace htd
              */
             bool isNamedEdge(htd::id_t edgeId) const
             {
-                return edgeNames_.count(edgeId) == 1;
+                return edgeNames_.isNamed(edgeId);
             }
 
             /**
@@ -105,7 +112,7 @@ namespace htd
              */
             const VertexNameType & vertexName(htd::vertex_t vertex) const
             {
-                return vertexNames_.at(vertex);
+                return vertexNames_.name(vertex);
             }
 
             /**
@@ -117,7 +124,7 @@ namespace htd
              */
             const EdgeNameType & edgeName(htd::id_t edgeId) const
             {
-                return edgeNames_.at(edgeId);
+                return edgeNames_.name(edgeId);
             }
 
             /**
@@ -130,25 +137,7 @@ namespace htd
              */
             void setVertexName(htd::vertex_t vertex, const VertexNameType & name)
             {
-                HTD_ASSERT(vertexNamesReverseMap_.count(name) == 0)
-
-                auto position = vertexNames_.find(vertex);
-
-                if (position != vertexNames_.end())
-                {
-                    if (!(position->second == name))
-                    {
-                        auto position2 = vertexNamesReverseMap_.find(position->second);
-
-                        if (position2 != vertexNamesReverseMap_.end())
-                        {
-                            vertexNamesReverseMap_.erase(position2);
-                        }
-                    }
-                }
-
-                vertexNames_[vertex] = name;
-                vertexNamesReverseMap_[name] = vertex;
+                vertexNames_.setName(vertex, name);
             }
 
             /**
@@ -161,25 +150,7 @@ namespace htd
              */
             void setEdgeName(htd::id_t edgeId, const EdgeNameType & name)
             {
-                HTD_ASSERT(edgeNamesReverseMap_.count(name) == 0)
-
-                auto position = edgeNames_.find(edgeId);
-
-                if (position != edgeNames_.end())
-                {
-                    if (!(position->second == name))
-                    {
-                        auto position2 = edgeNamesReverseMap_.find(position->second);
-
-                        if (position2 != edgeNamesReverseMap_.end())
-                        {
-                            edgeNamesReverseMap_.erase(position2);
-                        }
-                    }
-                }
-
-                edgeNames_[edgeId] = name;
-                edgeNamesReverseMap_[name] = edgeId;
+                edgeNames_.setName(edgeId, name);
             }
 
             /**
@@ -196,30 +167,7 @@ namespace htd
              */
             std::pair<htd::id_t, bool> insertVertex(const VertexNameType & name, const std::function<htd::vertex_t(void)> & vertexCreationFunction)
             {
-                std::pair<htd::id_t, bool> ret(0, false);
-
-                auto result = vertexNamesReverseMap_.insert(std::make_pair(name, 0));
-
-                htd::vertex_t & vertexId = result.first->second;
-
-                if (result.second)
-                {
-                    htd::vertex_t newVertex = vertexCreationFunction();
-
-                    ret.first = newVertex;
-
-                    ret.second = true;
-
-                    vertexId = newVertex;
-
-                    vertexNames_.emplace(newVertex, name);
-                }
-                else
-                {
-                    ret.first = vertexId;
-                }
-
-                return ret;
+                return vertexNames_.insert(name, vertexCreationFunction);
             }
 
             /**
@@ -238,27 +186,7 @@ namespace htd
 
                 ret.reserve(names.size());
 
-                for (const VertexNameType & name : names)
-                {
-                    auto result = vertexNamesReverseMap_.emplace(name, htd::Vertex::UNKNOWN);
-
-                    htd::vertex_t & vertexId = result.first->second;
-
-                    if (result.second)
-                    {
-                        htd::vertex_t newVertex = vertexCreationFunction();
-
-                        ret.push_back(newVertex);
-
-                        vertexId = newVertex;
-
-                        vertexNames_.emplace(newVertex, name);
-                    }
-                    else
-                    {
-                        ret.push_back(vertexId);
-                    }
-                }
+                insertVertices(names.begin(), names.end(), vertexCreationFunction, ret);
 
                 return ret;
             }
@@ -279,29 +207,28 @@ namespace htd
 
                 ret.reserve(names.size());
 
-                for (const VertexNameType & name : names)
-                {
-                    auto result = vertexNamesReverseMap_.emplace(name, htd::Vertex::UNKNOWN);
-
-                    htd::vertex_t & vertexId = result.first->second;
-
-                    if (result.second)
-                    {
-                        htd::vertex_t newVertex = vertexCreationFunction();
-
-                        ret.push_back(newVertex);
+                insertVertices(names.begin(), names.end(), vertexCreationFunction, ret);
 
-                        vertexId = newVertex;
+                return ret;
+            }
 
-                        vertexNames_.emplace(newVertex, name);
-                    }
-                    else
-                    {
-                        ret.push_back(vertexId);
-                    }
+            /**
+             *  Insert the vertices with the names in the given range. A vertex is only inserted if a vertex with the same name not already exists.
+             *
+             *  @param[in] first                    An iterator pointing to the first name of the range.
+             *  @param[in] last                     An iterator pointing past the last name of the range.
+             *  @param[in] vertexCreationFunction   A function which is used to generate a new vertex ID in case that no vertex with the given name already exists.
+             *  @param[out] output                  The vector to which the vertex IDs corresponding to the given names shall be appended.
+             *
+             *  @note Examples for the vertex creation function are the addVertex() functions of the mutable graph classes, i.e. htd::IMutableMultiHypergraph::addVertex().
+             */
+            template <typename Iterator>
+            void insertVertices(Iterator first, Iterator last, const std::function<htd::vertex_t(void)> & vertexCreationFunction, std::vector<htd::id_t> & output)
+            {
+                for (Iterator it = first; it != last; ++it)
+                {
+                    output.push_back(vertexNames_.insert(*it, vertexCreationFunction).first);
                 }
-
-                return ret;
             }
 
             /**
@@ -311,18 +238,7 @@ namespace htd
              */
             void removeVertexName(htd::vertex_t vertex)
             {
-                auto position = vertexNames_.find(vertex);
-
-                HTD_ASSERT(position != vertexNames_.end())
-
-                auto position2 = vertexNamesReverseMap_.find(position->second);
-
-                if (position2 != vertexNamesReverseMap_.end())
-                {
-                    vertexNamesReverseMap_.erase(position2);
-                }
-
-                vertexNames_.erase(position);
+                vertexNames_.removeName(vertex);
             }
 
             /**
@@ -332,18 +248,7 @@ namespace htd
              */
             void removeEdgeName(htd::id_t edgeId)
             {
-                auto position = edgeNames_.find(edgeId);
-
-                HTD_ASSERT(position != edgeNames_.end())
-
-                auto position2 = edgeNamesReverseMap_.find(position->second);
-
-                if (position2 != edgeNamesReverseMap_.end())
-                {
-                    edgeNamesReverseMap_.erase(position2);
-                }
-
-                edgeNames_.erase(position);
+                edgeNames_.removeName(edgeId);
             }
 
             /**
@@ -355,7 +260,7 @@ namespace htd
              */
             bool isVertexName(const VertexNameType & name) const
             {
-                return vertexNamesReverseMap_.count(name) > 0;
+                return vertexNames_.isName(name);
             }
 
             /**
@@ -367,7 +272,7 @@ namespace htd
              */
             bool isEdgeName(const EdgeNameType & name) const
             {
-                return edgeNamesReverseMap_.count(name) > 0;
+                return edgeNames_.isName(name);
             }
 
             /**
@@ -379,7 +284,7 @@ namespace htd
              */
             htd::vertex_t lookupVertex(const VertexNameType & name) const
             {
-                return vertexNamesReverseMap_.at(name);
+                return vertexNames_.lookup(name);
             }
 
             /**
@@ -391,7 +296,7 @@ namespace htd
              */
             htd::id_t lookupEdge(const EdgeNameType & name) const
             {
-                return edgeNamesReverseMap_.at(name);
+                return edgeNames_.lookup(name);
             }
 
             /**
@@ -399,31 +304,299 @@ namespace htd
              *
              *  @return A new BidirectionalGraphNaming object identical to the current graph naming.
              */
-            htd::BidirectionalGraphNaming<VertexNameType, EdgeNameType, VertexNameHashFunction, EdgeNameHashFunction, VertexNameEqualityFunction, EdgeNameEqualityFunction> * clone(void) const
+            htd::BidirectionalGraphNaming<VertexNameType, EdgeNameType, VertexNameHashFunction, VertexNameEqualityFunction, EdgeNameHashFunction, EdgeNameEqualityFunction> * clone(void) const
             {
-                auto * ret = new BidirectionalGraphNaming<VertexNameType, EdgeNameType, VertexNameHashFunction, EdgeNameHashFunction, VertexNameEqualityFunction, EdgeNameEqualityFunction>();
+                return new BidirectionalGraphNaming<VertexNameType, EdgeNameType, VertexNameHashFunction, VertexNameEqualityFunction, EdgeNameHashFunction, EdgeNameEqualityFunction>(*this);
+            }
 
-                for (auto name : vertexNames_)
-                {
-                    ret->setVertexName(name.first, name.second);
-                }
+        private:
+            /**
+             *  Mapping between IDs and names which stores every name only once.
+             *
+             *  The names are kept in a pool whose elements never move, and the mapping from names to IDs is keyed by
+             *  references into the pool. A name which is only looked up is referenced in place and never copied. Slots
+             *  of removed names are reused by later insertions.
+             */
+            template <typename NameType, typename HashFunction, typename EqualityFunction>
+            class NameTable
+            {
+                public:
+                    NameTable(void) : names_(), freeSlots_(), slots_(), identifiers_()
+                    {
 
-                for (auto name : edgeNames_)
-                {
-                    ret->setEdgeName(name.first, name.second);
-                }
+                    }
 
-                return ret;
-            }
+                    NameTable(const NameTable & original) : names_(), freeSlots_(), slots_(), identifiers_()
+                    {
+                        copyFrom(original);
+                    }
 
-        private:
-            std::unordered_map<htd::vertex_t, VertexNameType> vertexNames_;
+                    NameTable & operator=(const NameTable & original)
+                    {
+                        if (this != &original)
+                        {
+                            names_.clear();
+                            freeSlots_.clear();
+                            slots_.clear();
+                            identifiers_.clear();
+
+                            copyFrom(original);
+                        }
+
+                        return *this;
+                    }
+
+                    /**
+                     *  Getter for the number of names stored in the table.
+                     *
+                     *  @return The number of names stored in the table.
+                     */
+                    std::size_t size(void) const
+                    {
+                        return slots_.size();
+                    }
+
+                    /**
+                     *  Check whether the given ID has a name.
+                     *
+                     *  @param[in] id   The ID.
+                     *
+                     *  @return True if the given ID has a name, false otherwise.
+                     */
+                    bool isNamed(htd::id_t id) const
+                    {
+                        return slots_.count(id) == 1;
+                    }
+
+                    /**
+                     *  Check whether the given name belongs to an ID.
+                     *
+                     *  @param[in] name The name.
+                     *
+                     *  @return True if the given name belongs to an ID, false otherwise.
+                     */
+                    bool isName(const NameType & name) const
+                    {
+                        return identifiers_.count(Reference(&name)) > 0;
+                    }
+
+                    /**
+                     *  Access the name of the given ID.
+                     *
+                     *  @param[in] id   The ID.
+                     *
+                     *  @return The name of the given ID.
+                     */
+                    const NameType & name(htd::id_t id) const
+                    {
+                        return names_[slots_.at(id)];
+                    }
+
+                    /**
+                     *  Access the ID with the given name.
+                     *
+                     *  @param[in] name The name.
+                     *
+                     *  @return The ID with the given name.
+                     */
+                    htd::id_t lookup(const NameType & name) const
+                    {
+                        return identifiers_.at(Reference(&name));
+                    }
+
+                    /**
+                     *  Set the name of the given ID. An existing name of the ID is replaced.
+                     *
+                     *  @param[in] id   The ID.
+                     *  @param[in] name The new name, which must not belong to an ID yet.
+                     */
+                    void setName(htd::id_t id, const NameType & name)
+                    {
+                        HTD_ASSERT(!isName(name))
+
+                        auto position = slots_.find(id);
+
+                        if (position != slots_.end())
+                        {
+                            identifiers_.erase(Reference(&(names_[position->second])));
+
+                            names_[position->second] = name;
+
+                            identifiers_.emplace(Reference(&(names_[position->second])), id);
+                        }
+                        else
+                        {
+                            add(id, name);
+                        }
+                    }
+
+                    /**
+                     *  Access the ID with the given name and create it if the name is unknown.
+                     *
+                     *  @param[in] name             The name.
+                     *  @param[in] creationFunction The function which is called to create the ID for an unknown name.
+                     *
+                     *  @return A pair of the ID with the given name and a boolean which is true if the ID was created.
+                     */
+                    std::pair<htd::id_t, bool> insert(const NameType & name, const std::function<htd::id_t(void)> & creationFunction)
+                    {
+                        auto position = identifiers_.find(Reference(&name));
+
+                        if (position != identifiers_.end())
+                        {
+                            return std::make_pair(position->second, false);
+                        }
+
+                        htd::id_t id = creationFunction();
+
+                        add(id, name);
+
+                        return std::make_pair(id, true);
+                    }
+
+                    /**
+                     *  Remove the name of the given ID.
+                     *
+                     *  @param[in] id   The ID.
+                     */
+                    void removeName(htd::id_t id)
+                    {
+                        auto position = slots_.find(id);
+
+                        HTD_ASSERT(position != slots_.end())
+
+                        htd::index_t slot = position->second;
+
+                        identifiers_.erase(Reference(&(names_[slot])));
+
+                        /* Assigning a new object releases the memory held by the removed name. */
+                        names_[slot] = NameType();
 
-            std::unordered_map<htd::id_t, EdgeNameType> edgeNames_;
+                        freeSlots_.push_back(slot);
+
+                        slots_.erase(position);
+                    }
+
+                private:
+                    /**
+                     *  Reference to a name which is used as key of the mapping from names to IDs.
+                     *
+                     *  The hash value of the name is stored alongside, so that rehashing the mapping and comparing keys
+                     *  with different hash values does not need to access the referenced names.
+                     */
+                    struct Reference
+                    {
+                        /**
+                         *  Constructor for a reference to a name.
+                         *
+                         *  @param[in] name The referenced name.
+                         */
+                        explicit Reference(const NameType * name) : name(name), hash(HashFunction()(*name))
+                        {
+
+                        }
+
+                        /**
+                         *  The referenced name.
+                         */
+                        const NameType * name;
+
+                        /**
+                         *  The hash value of the referenced name.
+                         */
+                        std::size_t hash;
+                    };
+
+                    /**
+                     *  Hash function for references which returns the stored hash value of the referenced name.
+                     */
+                    struct ReferenceHashFunction
+                    {
+                        std::size_t operator()(const Reference & reference) const
+                        {
+                            return reference.hash;
+                        }
+                    };
+
+                    /**
+                     *  Equality function for references which compares the referenced names.
+                     */
+                    struct ReferenceEqualityFunction
+                    {
+                        bool operator()(const Reference & reference1, const Reference & reference2) const
+                        {
+                            return reference1.hash == reference2.hash && EqualityFunction()(*(reference1.name), *(reference2.name));
+                        }
+                    };
+
+                    /**
+                     *  The pool of names. The names are never moved, so references to them stay valid.
+                     */
+                    std::deque<NameType> names_;
+
+                    /**
+                     *  The slots of the pool which are not in use.
+                     */
+                    std::vector<htd::index_t> freeSlots_;
+
+                    /**
+                     *  The mapping from IDs to the slots of their names.
+                     */
+                    std::unordered_map<htd::id_t, htd::index_t> slots_;
+
+                    /**
+                     *  The mapping from names to IDs.
+                     */
+                    std::unordered_map<Reference, htd::id_t, ReferenceHashFunction, ReferenceEqualityFunction> identifiers_;
+
+                    /**
+                     *  Store a name for an ID which has no name yet.
+                     *
+                     *  @param[in] id   The ID.
+                     *  @param[in] name The name, which must not belong to an ID yet.
+                     */
+                    void add(htd::id_t id, const NameType & name)
+                    {
+                        htd::index_t slot = names_.size();
+
+                        if (freeSlots_.empty())
+                        {
+                            names_.push_back(name);
+                        }
+                        else
+                        {
+                            slot = freeSlots_.back();
+
+                            freeSlots_.pop_back();
+
+                            names_[slot] = name;
+                        }
+
+                        slots_.emplace(id, slot);
+
+                        identifiers_.emplace(Reference(&(names_[slot])), id);
+                    }
+
+                    /**
+                     *  Add all names of the given table to the current, empty table.
+                     *
+                     *  @param[in] original The table whose names shall be copied.
+                     */
+                    void copyFrom(const NameTable & original)
+                    {
+                        slots_.reserve(original.slots_.size());
+                        identifiers_.reserve(original.identifiers_.size());
+
+                        for (const auto & entry : original.slots_)
+                        {
+                            add(entry.first, original.names_[entry.second]);
+                        }
+                    }
+            };
 
-            std::unordered_map<VertexNameType, htd::vertex_t, VertexNameHashFunction, VertexNameEqualityFunction> vertexNamesReverseMap_;
+            NameTable<VertexNameType, VertexNameHashFunction, VertexNameEqualityFunction> vertexNames_;
 
-            std::unordered_map<EdgeNameType, htd::id_t, EdgeNameHashFunction, EdgeNameEqualityFunction> edgeNamesReverseMap_;
+            NameTable<EdgeNameType, EdgeNameHashFunction, EdgeNameEqualityFunction> edgeNames_;
     };
 }
 
@@ -32,6 +32,7 @@
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IPreprocessedGraph.hpp>
 
+#include <atomic>
 #include <utility>
 
 namespace htd
@@ -176,6 +177,32 @@ namespace htd
              */
             HTD_API std::pair<htd::IGraphDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const;
 
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                    The input graph to decompose.
+             *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
+             *  @param[in] maxBagSize               The upper bound for the maximum bag size of the decomposition.
+             *  @param[in] maxIterationCount        The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
+             *  @param[in] sharedMaxBagSize         The upper bound for the maximum bag size which may be tightened concurrently by other threads.
+             *
+             *  @note If the ordering algorithm implements htd::IWidthLimitableOrderingAlgorithm, sharedMaxBagSize is passed to it and the
+             *  computation of an ordering is aborted as soon as its width exceeds the current value of the bound. Otherwise, the bound is ignored.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
+             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
+             *
+             *  @return A pair consisting of the new IGraphDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
+             */
+            HTD_API std::pair<htd::IGraphDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const;
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination ordering.
              *
@@ -193,6 +220,8 @@ namespace htd
 
             HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) override;
 
+            HTD_API std::vector<htd::ILabelingFunction *> releaseLabelingFunctions(void) override;
+
             HTD_API bool isSafelyInterruptible(void) const override;
 
             HTD_API bool isComputeInducedEdgesEnabled(void) const override;
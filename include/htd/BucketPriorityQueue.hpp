@@ -0,0 +1,353 @@
+/*
+ * File:   BucketPriorityQueue.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BUCKETPRIORITYQUEUE_HPP
+#define HTD_HTD_BUCKETPRIORITYQUEUE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Bucket-based priority queue for vertices with small, non-negative integer priorities.
+     *
+     *  The elements with the smallest priority form the top of the queue. Each vertex is stored in the bucket of its
+     *  priority and the position of each vertex within its bucket is recorded, so that inserting and erasing a vertex,
+     *  updating its priority and selecting a random vertex of top priority can be done in constant time. Vertices with
+     *  a priority greater than or equal to the number of buckets share a common overflow bucket which is only scanned
+     *  when no vertex with a smaller priority is left.
+     */
+    class BucketPriorityQueue
+    {
+        public:
+            /**
+             *  Constructor of a new priority queue.
+             *
+             *  @param[in] capacity     The number of vertices which can be stored, i.e., all vertices must be smaller than the capacity.
+             *  @param[in] bucketCount  The number of buckets for vertices with priority 0, 1, ..., bucketCount - 1.
+             */
+            BucketPriorityQueue(std::size_t capacity, std::size_t bucketCount) : buckets_(bucketCount + 1), priority_(capacity, (std::size_t)-1), position_(capacity, 0), minimumBucket_(bucketCount + 1), size_(0)
+            {
+
+            }
+
+            /**
+             *  Destructor of a priority queue.
+             */
+            ~BucketPriorityQueue(void)
+            {
+
+            }
+
+            /**
+             *  Check whether the priority queue is emtpy.
+             *
+             *  @return True if the priority queue is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the number of elements in the priority queue.
+             *
+             *  @return The number of elements in the priority queue.
+             */
+            std::size_t size(void) const
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the given vertex is contained in the priority queue.
+             *
+             *  @param[in] vertex   The vertex which shall be checked.
+             *
+             *  @return True if the given vertex is contained in the priority queue, false otherwise.
+             */
+            bool contains(htd::vertex_t vertex) const
+            {
+                return vertex < priority_.size() && priority_[vertex] != (std::size_t)-1;
+            }
+
+            /**
+             *  Access the priority of the given vertex.
+             *
+             *  @param[in] vertex   The vertex which must be contained in the priority queue.
+             *
+             *  @return The priority of the given vertex.
+             */
+            std::size_t priority(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(contains(vertex))
+
+                return priority_[vertex];
+            }
+
+            /**
+             *  Access the top priority.
+             *
+             *  @return The top priority.
+             */
+            std::size_t topPriority(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                std::size_t ret = minimumBucket_;
+
+                if (minimumBucket_ == buckets_.size() - 1)
+                {
+                    ret = (std::size_t)-1;
+
+                    for (htd::vertex_t vertex : buckets_[minimumBucket_])
+                    {
+                        ret = std::min(ret, priority_[vertex]);
+                    }
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Select a random vertex among all vertices with top priority.
+             *
+             *  @return A random vertex among all vertices with top priority.
+             */
+            htd::vertex_t selectRandomTopElement(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                const std::vector<htd::vertex_t> & topBucket = buckets_[minimumBucket_];
+
+                htd::vertex_t ret = htd::Vertex::UNKNOWN;
+
+                if (minimumBucket_ == buckets_.size() - 1)
+                {
+                    std::size_t minimum = topPriority();
+
+                    std::size_t count = 0;
+
+                    for (htd::vertex_t vertex : topBucket)
+                    {
+                        if (priority_[vertex] == minimum)
+                        {
+                            ++count;
+                        }
+                    }
+
+                    std::size_t selection = static_cast<std::size_t>(htd::randomNumber()) % count;
+
+                    auto it = topBucket.begin();
+
+                    while (selection > 0 || priority_[*it] != minimum)
+                    {
+                        if (priority_[*it] == minimum)
+                        {
+                            --selection;
+                        }
+
+                        ++it;
+                    }
+
+                    ret = *it;
+                }
+                else
+                {
+                    ret = topBucket[static_cast<std::size_t>(htd::randomNumber()) % topBucket.size()];
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Insert a new vertex with the given priority.
+             *
+             *  @param[in] vertex   The vertex which shall be inserted. The vertex must not be contained in the priority queue.
+             *  @param[in] priority The priority of the vertex which shall be inserted.
+             */
+            void push(htd::vertex_t vertex, std::size_t priority)
+            {
+                HTD_ASSERT(vertex < priority_.size() && !contains(vertex))
+
+                insertIntoBucket(vertex, priority);
+
+                ++size_;
+            }
+
+            /**
+             *  Erase the given vertex.
+             *
+             *  @param[in] vertex   The vertex which shall be erased. The vertex must be contained in the priority queue.
+             */
+            void erase(htd::vertex_t vertex)
+            {
+                HTD_ASSERT(contains(vertex))
+
+                removeFromBucket(vertex);
+
+                priority_[vertex] = (std::size_t)-1;
+
+                --size_;
+            }
+
+            /**
+             *  Update the priority of a specific, existing vertex.
+             *
+             *  @param[in] vertex       The vertex which shall be updated. The vertex must be contained in the priority queue.
+             *  @param[in] newPriority  The new priority of the vertex.
+             */
+            void updatePriority(htd::vertex_t vertex, std::size_t newPriority)
+            {
+                HTD_ASSERT(contains(vertex))
+
+                if (bucketIndex(newPriority) != bucketIndex(priority_[vertex]))
+                {
+                    removeFromBucket(vertex);
+
+                    insertIntoBucket(vertex, newPriority);
+                }
+                else
+                {
+                    priority_[vertex] = newPriority;
+                }
+            }
+
+            /**
+             *  Remove all vertices from the priority queue. The memory allocated by the buckets is retained.
+             */
+            void clear(void)
+            {
+                for (std::vector<htd::vertex_t> & bucket : buckets_)
+                {
+                    for (htd::vertex_t vertex : bucket)
+                    {
+                        priority_[vertex] = (std::size_t)-1;
+                    }
+
+                    bucket.clear();
+                }
+
+                minimumBucket_ = buckets_.size();
+
+                size_ = 0;
+            }
+
+        private:
+            /**
+             *  The buckets of the priority queue. The last bucket contains all vertices whose priority exceeds the other buckets.
+             */
+            std::vector<std::vector<htd::vertex_t>> buckets_;
+
+            /**
+             *  The priority of each vertex or (std::size_t)-1 if the vertex is not contained in the priority queue.
+             */
+            std::vector<std::size_t> priority_;
+
+            /**
+             *  The position of each vertex within its bucket.
+             */
+            std::vector<htd::index_t> position_;
+
+            /**
+             *  The index of the first non-empty bucket or the number of buckets if the priority queue is empty.
+             */
+            std::size_t minimumBucket_;
+
+            /**
+             *  The number of elements stored in the priority queue.
+             */
+            std::size_t size_;
+
+            /**
+             *  Getter for the index of the bucket which is responsible for the given priority.
+             *
+             *  @param[in] priority The priority.
+             *
+             *  @return The index of the bucket which is responsible for the given priority.
+             */
+            std::size_t bucketIndex(std::size_t priority) const
+            {
+                return std::min(priority, buckets_.size() - 1);
+            }
+
+            /**
+             *  Append a vertex to the bucket of the given priority.
+             *
+             *  @param[in] vertex   The vertex which shall be inserted.
+             *  @param[in] priority The priority of the vertex.
+             */
+            void insertIntoBucket(htd::vertex_t vertex, std::size_t priority)
+            {
+                std::size_t index = bucketIndex(priority);
+
+                std::vector<htd::vertex_t> & bucket = buckets_[index];
+
+                priority_[vertex] = priority;
+
+                position_[vertex] = bucket.size();
+
+                bucket.push_back(vertex);
+
+                if (index < minimumBucket_)
+                {
+                    minimumBucket_ = index;
+                }
+            }
+
+            /**
+             *  Remove a vertex from its bucket by replacing it with the last vertex of the bucket.
+             *
+             *  @param[in] vertex   The vertex which shall be removed.
+             */
+            void removeFromBucket(htd::vertex_t vertex)
+            {
+                std::size_t index = bucketIndex(priority_[vertex]);
+
+                std::vector<htd::vertex_t> & bucket = buckets_[index];
+
+                htd::vertex_t lastVertex = bucket.back();
+
+                bucket[position_[vertex]] = lastVertex;
+
+                position_[lastVertex] = position_[vertex];
+
+                bucket.pop_back();
+
+                if (index == minimumBucket_ && bucket.empty())
+                {
+                    while (minimumBucket_ < buckets_.size() && buckets_[minimumBucket_].empty())
+                    {
+                        ++minimumBucket_;
+                    }
+                }
+            }
+    };
+}
+
+#endif /* HTD_HTD_BUCKETPRIORITYQUEUE_HPP */
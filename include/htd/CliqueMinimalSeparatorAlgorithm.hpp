@@ -49,6 +49,25 @@ namespace htd
 
             HTD_API std::vector<htd::vertex_t> * computeSeparator(const htd::IGraphStructure & graph) const override;
 
+            /**
+             *  Decompose the given graph along its clique minimal separators into its atoms.
+             *
+             *  The atoms are reported in the order in which they are split off the graph: The vertices of an atom
+             *  which are not contained in its separator do not occur in any of the subsequent atoms and they are
+             *  separated from the remainder of the graph by the separator, which forms a clique in the graph. (Atoms
+             *  which are not connected to the remainder of the graph have an empty separator.) The last atom
+             *  contains all vertices which were not split off and its separator is always empty.
+             *
+             *  @param[in] graph        The graph which shall be decomposed.
+             *  @param[out] atoms       The atoms of the graph, each of them sorted in ascending order.
+             *  @param[out] separators  The clique separator of each atom, sorted in ascending order.
+             *
+             *  @note If the algorithm is terminated prematurely, no atoms are reported.
+             */
+            HTD_API void computeAtoms(const htd::IGraphStructure & graph,
+                                      std::vector<std::vector<htd::vertex_t>> & atoms,
+                                      std::vector<std::vector<htd::vertex_t>> & separators) const;
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const noexcept override;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) override;
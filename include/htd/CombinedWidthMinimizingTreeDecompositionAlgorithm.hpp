@@ -213,6 +213,8 @@ namespace htd
 
             HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) override;
 
+            HTD_API std::vector<htd::ILabelingFunction *> releaseLabelingFunctions(void) override;
+
             HTD_API bool isSafelyInterruptible(void) const override;
 
             HTD_API bool isComputeInducedEdgesEnabled(void) const override;
@@ -0,0 +1,233 @@
+/* 
+ * File:   CompactTreeDecomposition.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_COMPACTTREEDECOMPOSITION_HPP
+#define HTD_HTD_COMPACTTREEDECOMPOSITION_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/TreeDecomposition.hpp>
+
+#include <vector>
+
+MSVC_PRAGMA_WARNING_PUSH
+MSVC_PRAGMA_DISABLE_WARNING_C4250
+
+namespace htd
+{
+    /**
+     *  Implementation of the IMutableTreeDecomposition interface which stores the bag contents and the induced
+     *  hyperedges of the nodes densely, in vectors indexed by the node identifiers, instead of hash maps.
+     *
+     *  Accessing the bag of a node therefore requires neither a hash computation nor a lookup in a bucket list and
+     *  iterating over the nodes of the decomposition visits the bags in the order of their identifiers.
+     *
+     *  The implementation can be selected for all algorithms of a management instance via
+     *  htd::TreeDecompositionFactory::setConstructionTemplate(new htd::CompactTreeDecomposition(manager)).
+     */
+    class CompactTreeDecomposition : public htd::TreeDecomposition
+    {
+        public:
+            /**
+             *  Constructor for a tree decomposition.
+             */
+            HTD_API CompactTreeDecomposition(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a tree decomposition.
+             *
+             *  @param[in] original  The original tree decomposition.
+             */
+            HTD_API CompactTreeDecomposition(const CompactTreeDecomposition & original);
+
+            /**
+             *  Copy constructor for a tree decomposition.
+             *
+             *  @param[in] original  The original tree.
+             */
+            HTD_API CompactTreeDecomposition(const htd::ITree & original);
+
+            /**
+             *  Copy constructor for a tree decomposition.
+             *
+             *  @param[in] original  The original labeled tree.
+             */
+            HTD_API CompactTreeDecomposition(const htd::ILabeledTree & original);
+
+            /**
+             *  Copy constructor for a tree decomposition.
+             *
+             *  @param[in] original  The original tree decomposition.
+             */
+            HTD_API CompactTreeDecomposition(const htd::ITreeDecomposition & original);
+
+            HTD_API virtual ~CompactTreeDecomposition();
+
+            HTD_API void removeVertex(htd::vertex_t vertex) override;
+
+            HTD_API void removeSubtree(htd::vertex_t subtreeRoot) override;
+
+            HTD_API htd::vertex_t insertRoot(void) override;
+
+            HTD_API htd::vertex_t insertRoot(const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedEdges) override;
+
+            HTD_API htd::vertex_t insertRoot(std::vector<htd::vertex_t> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges) override;
+
+            HTD_API htd::vertex_t addChild(htd::vertex_t vertex) override;
+
+            HTD_API htd::vertex_t addChild(htd::vertex_t vertex, const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedEdges) override;
+
+            HTD_API htd::vertex_t addChild(htd::vertex_t vertex, std::vector<htd::vertex_t> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges) override;
+
+            HTD_API htd::vertex_t addParent(htd::vertex_t vertex) override;
+
+            HTD_API htd::vertex_t addParent(htd::vertex_t vertex, const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedEdges) override;
+
+            HTD_API htd::vertex_t addParent(htd::vertex_t vertex, std::vector<htd::vertex_t> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges) override;
+
+            HTD_API void removeChild(htd::vertex_t vertex, htd::vertex_t child) override;
+
+            HTD_API std::size_t bagSize(htd::vertex_t vertex) const override;
+
+            HTD_API std::vector<htd::vertex_t> & mutableBagContent(htd::vertex_t vertex) override;
+
+            HTD_API const std::vector<htd::vertex_t> & bagContent(htd::vertex_t vertex) const override;
+
+            HTD_API htd::FilteredHyperedgeCollection & mutableInducedHyperedges(htd::vertex_t vertex) override;
+
+            HTD_API const htd::FilteredHyperedgeCollection & inducedHyperedges(htd::vertex_t vertex) const override;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API CompactTreeDecomposition * clone(void) const override;
+#else
+            /**
+             *  Create a deep copy of the current tree decomposition.
+             *
+             *  @return A new CompactTreeDecomposition object identical to the current tree decomposition.
+             */
+            HTD_API CompactTreeDecomposition * clone(void) const;
+
+            HTD_API htd::ITree * cloneTree(void) const override;
+
+            HTD_API htd::IGraph * cloneGraph(void) const override;
+
+            HTD_API htd::IMultiGraph * cloneMultiGraph(void) const override;
+
+            HTD_API htd::IHypergraph * cloneHypergraph(void) const override;
+
+            HTD_API htd::IMultiHypergraph * cloneMultiHypergraph(void) const override;
+
+            HTD_API htd::ILabeledTree * cloneLabeledTree(void) const override;
+
+            HTD_API htd::ILabeledGraph * cloneLabeledGraph(void) const override;
+
+            HTD_API htd::ILabeledMultiGraph * cloneLabeledMultiGraph(void) const override;
+
+            HTD_API htd::ILabeledHypergraph * cloneLabeledHypergraph(void) const override;
+
+            HTD_API htd::ILabeledMultiHypergraph * cloneLabeledMultiHypergraph(void) const override;
+
+            HTD_API htd::ITreeDecomposition * cloneTreeDecomposition(void) const override;
+
+            HTD_API htd::IGraphDecomposition * cloneGraphDecomposition(void) const override;
+
+            HTD_API htd::IMutableTree * cloneMutableTree(void) const override;
+
+            HTD_API htd::IMutableLabeledTree * cloneMutableLabeledTree(void) const override;
+
+            HTD_API htd::IMutableTreeDecomposition * cloneMutableTreeDecomposition(void) const override;
+#endif
+
+            /**
+             *  Copy assignment operator for a tree decomposition.
+             *
+             *  @param[in] original  The original tree decomposition.
+             */
+            HTD_API CompactTreeDecomposition & operator=(const CompactTreeDecomposition & original);
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API CompactTreeDecomposition & operator=(const htd::ITree & original) override;
+
+            HTD_API CompactTreeDecomposition & operator=(const htd::ILabeledTree & original) override;
+
+            HTD_API CompactTreeDecomposition & operator=(const htd::ITreeDecomposition & original) override;
+#else
+            HTD_API CompactTreeDecomposition & operator=(const htd::ITree & original);
+
+            HTD_API CompactTreeDecomposition & operator=(const htd::ILabeledTree & original);
+
+            HTD_API CompactTreeDecomposition & operator=(const htd::ITreeDecomposition & original);
+
+            HTD_API void assign(const htd::ITree & original) override;
+
+            HTD_API void assign(const htd::ILabeledTree & original) override;
+
+            HTD_API void assign(const htd::ITreeDecomposition & original) override;
+#endif
+
+        private:
+            /**
+             *  The bag content of each node. The bag of node i is stored at position i - htd::Vertex::FIRST.
+             */
+            std::vector<std::vector<htd::vertex_t>> bagContent_;
+
+            /**
+             *  The induced hyperedges of each node. The induced hyperedges of node i are stored at position i - htd::Vertex::FIRST.
+             */
+            std::vector<htd::FilteredHyperedgeCollection> inducedEdges_;
+
+            /**
+             *  Ensure that the storage provides a slot for the given node and reset the slot.
+             *
+             *  @param[in] vertex   The node for which a slot shall be provided.
+             *
+             *  @return The index of the slot of the given node.
+             */
+            htd::index_t prepareSlot(htd::vertex_t vertex);
+
+            /**
+             *  Release the memory occupied by the bag content and the induced hyperedges of the given node.
+             *
+             *  @param[in] vertex   The node whose slot shall be cleared.
+             */
+            void clearSlot(htd::vertex_t vertex);
+
+            /**
+             *  Replace the bag contents and induced hyperedges by the ones of the given tree decomposition.
+             *
+             *  @param[in] original The tree decomposition whose bags and induced hyperedges shall be copied.
+             */
+            void copySlots(const htd::ITreeDecomposition & original);
+
+            /**
+             *  Replace the bag contents and induced hyperedges by empty ones for all nodes of the given tree.
+             *
+             *  @param[in] original The tree whose nodes shall be provided with empty bags.
+             */
+            void resetSlots(const htd::ITree & original);
+    };
+}
+
+MSVC_PRAGMA_WARNING_POP
+
+#endif /* HTD_HTD_COMPACTTREEDECOMPOSITION_HPP */
@@ -0,0 +1,196 @@
+/* 
+ * File:   ConnectedComponentTreeDecompositionAlgorithm.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_HPP
+#define HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionAlgorithm.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Implementation of the ITreeDecompositionAlgorithm interface which decomposes each connected component of the
+     *  input graph separately using a base decomposition algorithm and joins the resulting decompositions under a
+     *  common root, i.e., the roots of the decompositions of all other components become children of the root of
+     *  the decomposition of the first component.
+     *
+     *  Components consisting of a single vertex are covered by a single bag directly. All other components are
+     *  decomposed by the base algorithm in order of decreasing size, possibly on multiple worker threads, so that
+     *  many small components cannot delay the decomposition of a large one. If the input graph is connected, the
+     *  base algorithm is applied to the input graph (and its preprocessed version, if provided) directly.
+     *
+     *  If the base algorithm roots its decompositions at an empty bag, e.g. because a normalization operation with
+     *  empty root is assigned to it, the components consisting of a single vertex are decomposed by the base algorithm
+     *  as well and the decompositions are joined by a chain of nodes with empty bag, each of which has the root of one
+     *  decomposition and the next node of the chain (or the root of the last decomposition) as its children. This way,
+     *  the joined decomposition is normalized whenever the decompositions of the components are.
+     *
+     *  @note The base algorithm decomposes each component as a graph of its own with vertices renamed to 1, ..., n. If a
+     *  preprocessed version of the input graph is provided, it is split into preprocessed versions of these graphs. The
+     *  labeling functions of the base algorithm are taken over by this algorithm and applied to the joined decomposition,
+     *  i.e. they see the vertices of the input graph and label the joining nodes as well. The remaining post-processing of
+     *  the base algorithm is applied to the decompositions of the components before they are joined, so post-processing
+     *  which operates on the vertices of the input graph or which constrains the structure around the root in any other
+     *  way, e.g. a normalization without empty root, should be assigned to this algorithm instead of the base algorithm.
+     *  The manipulation operations and labeling functions of this algorithm are applied after the labeling functions of
+     *  the base algorithm.
+     */
+    class ConnectedComponentTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new tree decomposition algorithm which decomposes the connected components of the input graph separately.
+             *
+             *  @note When calling this method the control over the memory regions of the base decomposition algorithm is transferred
+             *  to the decomposition algorithm. Deleting the base decomposition algorithm provided to this constructor outside the
+             *  decomposition algorithm will lead to undefined behavior.
+             *
+             *  @note The labeling functions of the base decomposition algorithm are released from it and applied to the joined
+             *  decomposition, its remaining post-processing is applied to the decompositions of the components before they are
+             *  joined, see the class description for the consequences.
+             *
+             *  @param[in] manager      The management instance to which the new algorithm belongs.
+             *  @param[in] algorithm    The decomposition algorithm which shall be applied to each connected component.
+             */
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm);
+
+            /**
+             *  Constructor for a new tree decomposition algorithm which decomposes the connected components of the input graph separately.
+             *
+             *  @note When calling this method the control over the memory regions of the base decomposition algorithm as well as the
+             *  control over the memory regions of the manipulation operations are transferred to the decomposition algorithm. Deleting
+             *  the base decomposition algorithm or a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @note The labeling functions of the base decomposition algorithm are released from it and applied to the joined
+             *  decomposition, its remaining post-processing is applied to the decompositions of the components before they are
+             *  joined, see the class description for the consequences.
+             *
+             *  @param[in] manager                  The management instance to which the new algorithm belongs.
+             *  @param[in] algorithm                The decomposition algorithm which shall be applied to each connected component.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
+             */
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations);
+
+            HTD_API virtual ~ConnectedComponentTreeDecompositionAlgorithm();
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph) const override;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const override;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const override;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const override;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] preprocessedGraph            The input graph in preprocessed format.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const;
+
+            HTD_API void setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) override;
+
+            HTD_API void addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation) override;
+
+            HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) override;
+
+            HTD_API std::vector<htd::ILabelingFunction *> releaseLabelingFunctions(void) override;
+
+            HTD_API bool isSafelyInterruptible(void) const override;
+
+            HTD_API bool isComputeInducedEdgesEnabled(void) const override;
+
+            HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) override;
+
+            /**
+             *  Getter for the number of worker threads which decompose connected components concurrently.
+             *
+             *  @return The number of worker threads which decompose connected components concurrently.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall decompose connected components concurrently (Default: 1).
+             *
+             *  If more than one thread is requested, each worker thread runs its own clone of the base decomposition algorithm and
+             *  the decomposition of component i draws its random numbers from a generator seeded with (s + i), where s is drawn from
+             *  std::rand() in the calling thread. Hence, the result is reproducible for a fixed seed regardless of the scheduling.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall decompose connected components concurrently.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const noexcept override;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) override;
+
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm * clone(void) const override;
+
+        protected:
+            /**
+             *  Copy assignment operator for a tree decomposition algorithm which decomposes the connected components of the input graph separately.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            ConnectedComponentTreeDecompositionAlgorithm & operator=(const ConnectedComponentTreeDecompositionAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_HPP */
@@ -0,0 +1,162 @@
+/*
+ * File:   ConstSpan.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONSTSPAN_HPP
+#define HTD_HTD_CONSTSPAN_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Non-owning, immutable view of a contiguous sequence of elements.
+     *
+     *  In contrast to htd::ConstCollection, iterating a span neither allocates memory nor involves virtual function
+     *  calls, the iterators are plain pointers. A span is only valid as long as the underlying storage is neither
+     *  modified nor destroyed.
+     */
+    template <typename T>
+    class ConstSpan
+    {
+        public:
+            /**
+             *  The value type of the span.
+             */
+            typedef T value_type;
+
+            /**
+             *  The iterator type of the span.
+             */
+            typedef const T * const_iterator;
+
+            /**
+             *  Constructor for an empty span.
+             */
+            ConstSpan(void) noexcept : data_(nullptr), size_(0)
+            {
+
+            }
+
+            /**
+             *  Constructor for a span.
+             *
+             *  @param[in] data The pointer to the first element of the span.
+             *  @param[in] size The number of elements of the span.
+             */
+            ConstSpan(const T * data, std::size_t size) noexcept : data_(data), size_(size)
+            {
+
+            }
+
+            /**
+             *  Constructor for a span covering all elements of the given vector.
+             *
+             *  @param[in] vector   The vector which shall be viewed.
+             */
+            ConstSpan(const std::vector<T> & vector) noexcept : data_(vector.data()), size_(vector.size())
+            {
+
+            }
+
+            /**
+             *  Getter for the pointer to the first element of the span.
+             *
+             *  @return The pointer to the first element of the span.
+             */
+            const T * data(void) const noexcept
+            {
+                return data_;
+            }
+
+            /**
+             *  Getter for the number of elements of the span.
+             *
+             *  @return The number of elements of the span.
+             */
+            std::size_t size(void) const noexcept
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the span is empty.
+             *
+             *  @return True if the span is empty, false otherwise.
+             */
+            bool empty(void) const noexcept
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for an iterator to the first element of the span.
+             *
+             *  @return An iterator to the first element of the span.
+             */
+            const_iterator begin(void) const noexcept
+            {
+                return data_;
+            }
+
+            /**
+             *  Getter for an iterator past the last element of the span.
+             *
+             *  @return An iterator past the last element of the span.
+             */
+            const_iterator end(void) const noexcept
+            {
+                return data_ + size_;
+            }
+
+            /**
+             *  Access the element at the specific position.
+             *
+             *  @param[in] index    The position of the element.
+             *
+             *  @return The element at the specific position.
+             */
+            const T & operator[](htd::index_t index) const
+            {
+                HTD_ASSERT(index < size_)
+
+                return data_[index];
+            }
+
+        private:
+            /**
+             *  The pointer to the first element of the span.
+             */
+            const T * data_;
+
+            /**
+             *  The number of elements of the span.
+             */
+            std::size_t size_;
+    };
+}
+
+#endif /* HTD_HTD_CONSTSPAN_HPP */
@@ -26,6 +26,7 @@
 #define HTD_HTD_DINITZMAXFLOWALGORITHM_HPP
 
 #include <htd/IMaxFlowAlgorithm.hpp>
+#include <htd/ResidualNetwork.hpp>
 
 namespace htd
 {
@@ -50,6 +51,19 @@ namespace htd
 
             HTD_API htd::IFlow * determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const override;
 
+            /**
+             *  Increase the flow between the source and the target vertex in the given residual network until it is
+             *  maximal or until the given maximum value is reached.
+             *
+             *  @param[in] network      The residual network which will be updated.
+             *  @param[in] source       The source vertex.
+             *  @param[in] target       The target vertex.
+             *  @param[in] maximumValue The value at which the computation stops even if the flow is not yet maximal.
+             *
+             *  @return The amount by which the flow from the source to the target vertex was increased.
+             */
+            HTD_API std::size_t increaseFlow(htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::size_t maximumValue) const;
+
             HTD_API DinitzMaxFlowAlgorithm * clone(void) const override;
 
         private:
@@ -0,0 +1,107 @@
+/*
+ * File:   EliminationWidthEvaluator.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_ELIMINATIONWIDTHEVALUATOR_HPP
+#define HTD_HTD_ELIMINATIONWIDTHEVALUATOR_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+#include <htd/IVertexOrdering.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Class for computing the maximum bag size of the decomposition induced by a vertex elimination ordering without
+     *  actually constructing the decomposition.
+     *
+     *  The bag of a vertex v consists of v and all neighbors of v which are eliminated after v in the graph obtained by
+     *  eliminating the vertices according to the ordering. The sizes of all bags are determined via the elimination tree
+     *  of the ordering, a union-find based least-common-ancestor computation and the row subtree counting scheme of
+     *  Gilbert, Ng and Peyton. This requires O((n + m) * α(n + m)) time for a graph with n vertices and m neighborhood
+     *  entries, independent of the number of fill edges.
+     */
+    class EliminationWidthEvaluator
+    {
+        public:
+            /**
+             *  Constructor for an elimination width evaluator.
+             */
+            HTD_API EliminationWidthEvaluator(void);
+
+            HTD_API virtual ~EliminationWidthEvaluator();
+
+            /**
+             *  Compute the maximum bag size of the decomposition induced by a vertex elimination ordering.
+             *
+             *  The result is equal to the maximum bag size of the decomposition computed by
+             *  htd::BucketEliminationGraphDecompositionAlgorithm for the same graph and ordering.
+             *
+             *  @param[in] graph    The input graph.
+             *  @param[in] ordering The vertex elimination ordering. It must contain each vertex of the graph exactly once.
+             *
+             *  @return The maximum bag size of the decomposition induced by the ordering.
+             */
+            HTD_API std::size_t maximumBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering) const;
+
+            /**
+             *  Compute the maximum bag size of the decomposition induced by a vertex elimination ordering.
+             *
+             *  @param[in] graph    The input graph.
+             *  @param[in] ordering The vertex elimination ordering. It must contain each vertex of the graph exactly once.
+             *
+             *  @return The maximum bag size of the decomposition induced by the ordering.
+             */
+            HTD_API std::size_t maximumBagSize(const htd::IMultiHypergraph & graph, const htd::IVertexOrdering & ordering) const;
+
+            /**
+             *  Compute the maximum bag size of the decomposition induced by a vertex elimination ordering based on a
+             *  preprocessed graph.
+             *
+             *  The ordering must start with the elimination sequence of the preprocessed graph followed by the names of
+             *  the remaining vertices, which holds for all orderings computed by the ordering algorithms of htd. The
+             *  bags of the vertices eliminated during preprocessing are accounted for by the lower bound for the
+             *  treewidth stored in the preprocessed graph, i.e., the result is the same bound which is reported by the
+             *  width-limitable ordering algorithms.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[in] ordering             The vertex elimination ordering.
+             *
+             *  @return The maximum bag size of the decomposition induced by the ordering.
+             */
+            HTD_API std::size_t maximumBagSize(const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::vertex_t> & ordering) const;
+
+        protected:
+            /**
+             *  Copy assignment operator for an elimination width evaluator.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized elimination width evaluator.
+             */
+            EliminationWidthEvaluator & operator=(const EliminationWidthEvaluator &) { return *this; }
+    };
+}
+
+#endif /* HTD_HTD_ELIMINATIONWIDTHEVALUATOR_HPP */
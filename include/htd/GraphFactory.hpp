@@ -29,6 +29,9 @@
 #include <htd/GraphTypeFactory.hpp>
 #include <htd/IMutableGraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -80,6 +83,19 @@ namespace htd
              *  @return A new IMutableGraph object of the given size.
              */
             HTD_API htd::IMutableGraph * createInstance(std::size_t initialSize) const;
+
+            /**
+             *  Create a new, immutable IGraph object from a bulk edge list.
+             *
+             *  The returned graph is an instance of htd::StaticGraph. It stores its neighborhoods in contiguous arrays
+             *  and therefore requires considerably less memory than the mutable default implementation.
+             *
+             *  @param[in] vertexCount  The number of vertices of the created graph.
+             *  @param[in] edges        The endpoints of the edges of the created graph.
+             *
+             *  @return A new IGraph object with the vertices htd::Vertex::FIRST, ..., htd::Vertex::FIRST + vertexCount - 1 and the given edges.
+             */
+            HTD_API htd::IGraph * createStaticInstance(std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) const;
     };
 }
 
@@ -51,7 +51,11 @@ namespace htd
             /**
              *  Set the preprocessing strategy which shall be used.
              *
-             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3: full, 4 or more: full + retain only largest biconnected component)
+             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3 or more: full)
+             *
+             *  @note The full preprocessing retains only the largest biconnected component of the graph and splits it further into its
+             *  atoms along clique minimal separators. All other parts of the graph are eliminated based on the vertex elimination
+             *  orderings computed by the ordering algorithm of the preprocessor, see setOrderingAlgorithm().
              */
             HTD_API void setPreprocessingStrategy(std::size_t level);
 
@@ -91,10 +95,28 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of worker threads which compute the vertex elimination orderings of the separated parts of the graph concurrently.
+             *
+             *  @return The number of worker threads which compute the vertex elimination orderings of the separated parts of the graph concurrently.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall compute the vertex elimination orderings of the separated parts of the graph concurrently.
+             *
+             *  @note The i-th separated part is always ordered with a random number generator seeded with (s + i), where s is drawn
+             *  once per call of prepare(), so the resulting elimination sequence does not depend on the number of worker threads.
+             *  The default value is 1.
+             *
+             *  @param[in] threadCount  The number of worker threads. The value must be greater than 0.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination
-             *  ordering of the remainder of the input graph when only the largest biconnected
-             *  component is retained.
+             *  orderings of the parts of the input graph which are separated from the retained
+             *  remainder of the graph during the full preprocessing.
              *
              *  @param[in] algorithm    The ordering algorithm which shall be used to compute the vertex elimination ordering.
              *
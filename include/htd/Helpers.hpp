@@ -43,6 +43,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <random>
 #include <set>
 #include <string>
 #include <tuple>
@@ -325,14 +326,69 @@ namespace htd
         }
     }
 
+    /**
+     *  Draw a pseudo-random number in the range [0, RAND_MAX].
+     *
+     *  As long as no seed was assigned to the calling thread via htd::seedThreadLocalRandomNumberGenerator(),
+     *  the result of std::rand() is returned. Otherwise, the number is drawn from a generator owned by the
+     *  calling thread so that concurrently running algorithms neither interfere nor lose reproducibility.
+     *
+     *  @return A pseudo-random number in the range [0, RAND_MAX].
+     */
+    HTD_API int randomNumber(void);
+
+    /**
+     *  Assign a seed to the random number generator owned by the calling thread.
+     *
+     *  @param[in] seed The seed for the random number generator of the calling thread.
+     */
+    HTD_API void seedThreadLocalRandomNumberGenerator(unsigned int seed);
+
+    /**
+     *  Detach the calling thread from its own random number generator so that htd::randomNumber() falls back to std::rand().
+     */
+    HTD_API void resetThreadLocalRandomNumberGenerator(void);
+
+    /**
+     *  Guard which captures the state of the random number generator owned by the calling thread on construction and
+     *  restores it on destruction. This allows to seed the generator of the calling thread temporarily, e.g. per work
+     *  item, without affecting the sequence of random numbers observed by the caller afterwards.
+     */
+    class ThreadLocalRandomNumberGeneratorGuard
+    {
+        public:
+            /**
+             *  Constructor for a new guard capturing the state of the random number generator of the calling thread.
+             */
+            HTD_API ThreadLocalRandomNumberGeneratorGuard(void);
+
+            /**
+             *  Destructor of a guard which restores the captured state of the random number generator of the calling thread.
+             */
+            HTD_API ~ThreadLocalRandomNumberGeneratorGuard();
+
+            ThreadLocalRandomNumberGeneratorGuard(const ThreadLocalRandomNumberGeneratorGuard & original) = delete;
+
+            ThreadLocalRandomNumberGeneratorGuard & operator=(const ThreadLocalRandomNumberGeneratorGuard & original) = delete;
+
+        private:
+            /**
+             *  The captured state of the random number generator.
+             */
+            std::mt19937 generator_;
+
+            /**
+             *  A boolean flag indicating whether a seed was assigned to the random number generator at construction time.
+             */
+            bool seeded_;
+    };
+
     template < typename T, typename Collection >
     const T & selectRandomElement(const Collection & collection)
     {
         auto position = collection.begin();
 
-        /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-        // coverity[dont_call]
-        std::advance(position, std::rand() % collection.size());
+        std::advance(position, htd::randomNumber() % collection.size());
 
         return *position;
     }
@@ -110,12 +110,31 @@ namespace htd
 
             HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) override;
 
+            HTD_API std::vector<htd::ILabelingFunction *> releaseLabelingFunctions(void) override;
+
             HTD_API bool isSafelyInterruptible(void) const override;
 
             HTD_API bool isComputeInducedEdgesEnabled(void) const override;
 
             HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) override;
 
+            /**
+             *  Getter for the number of worker threads which compute the covering hyperedges of the bags concurrently.
+             *
+             *  @return The number of worker threads which compute the covering hyperedges of the bags concurrently.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall compute the covering hyperedges of the bags concurrently (Default: 1).
+             *
+             *  Each distinct bag content leads to a single set cover instance which is solved by one of the worker threads
+             *  using a set cover algorithm of its own. The result does not depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall compute the covering hyperedges concurrently.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const noexcept override;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) override;
@@ -0,0 +1,59 @@
+/*
+ * File:   IContiguousGraphStructure.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_ICONTIGUOUSGRAPHSTRUCTURE_HPP
+#define HTD_HTD_ICONTIGUOUSGRAPHSTRUCTURE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ConstSpan.hpp>
+
+namespace htd
+{
+    /**
+     *  Optional interface for graph structures which store the neighborhood of each vertex in contiguous memory.
+     *
+     *  Algorithms may query for this interface (via dynamic_cast) once per invocation and then iterate neighborhoods
+     *  without the overhead of htd::ConstCollection. Graph structures not implementing it are accessed via
+     *  htd::IGraphStructure::neighbors() instead.
+     */
+    class IContiguousGraphStructure
+    {
+        public:
+            virtual ~IContiguousGraphStructure() = 0;
+
+            /**
+             *  Access the neighborhood of a given vertex.
+             *
+             *  @param[in] vertex   The vertex for which the neighborhood shall be returned.
+             *
+             *  @return The neighborhood of the given vertex sorted in ascending order. The span is invalidated by any
+             *          modification of the graph.
+             */
+            virtual htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex) const = 0;
+    };
+
+    inline htd::IContiguousGraphStructure::~IContiguousGraphStructure() { }
+}
+
+#endif /* HTD_HTD_ICONTIGUOUSGRAPHSTRUCTURE_HPP */
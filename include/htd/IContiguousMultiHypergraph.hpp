@@ -0,0 +1,58 @@
+/*
+ * File:   IContiguousMultiHypergraph.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_ICONTIGUOUSMULTIHYPERGRAPH_HPP
+#define HTD_HTD_ICONTIGUOUSMULTIHYPERGRAPH_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ConstSpan.hpp>
+#include <htd/Hyperedge.hpp>
+
+namespace htd
+{
+    /**
+     *  Optional interface for multi-hypergraphs which store their hyperedges in contiguous memory.
+     *
+     *  Algorithms may query for this interface (via dynamic_cast) once per invocation and then iterate the hyperedges
+     *  without the overhead of htd::ConstCollection. Multi-hypergraphs not implementing it are accessed via
+     *  htd::IMultiHypergraph::hyperedges() instead.
+     */
+    class IContiguousMultiHypergraph
+    {
+        public:
+            virtual ~IContiguousMultiHypergraph() = 0;
+
+            /**
+             *  Access all hyperedges of the multi-hypergraph.
+             *
+             *  @return The hyperedges of the multi-hypergraph in the same order as returned by
+             *          htd::IMultiHypergraph::hyperedges(). The span is invalidated by any modification of the graph.
+             */
+            virtual htd::ConstSpan<htd::Hyperedge> hyperedgeSpan(void) const = 0;
+    };
+
+    inline htd::IContiguousMultiHypergraph::~IContiguousMultiHypergraph() { }
+}
+
+#endif /* HTD_HTD_ICONTIGUOUSMULTIHYPERGRAPH_HPP */
@@ -29,6 +29,7 @@
 #include <htd/IMultiHypergraph.hpp>
 #include <htd/IGraphDecomposition.hpp>
 #include <htd/IDecompositionManipulationOperation.hpp>
+#include <htd/ILabelingFunction.hpp>
 #include <htd/IPreprocessedGraph.hpp>
 
 #include <vector>
@@ -142,6 +143,19 @@ namespace htd
              */
             virtual void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) = 0;
 
+            /**
+             *  Remove the labeling functions from the manipulation operations which are applied globally to each decomposition
+             *  generated by the algorithm (including the ones of its base algorithms, if any) and hand them over to the caller.
+             *
+             *  This allows wrapping algorithms which rename the vertices of the input graph, e.g. when decomposing its connected
+             *  components separately, to compute the labels on the final decomposition with the original vertex identifiers.
+             *
+             *  @note When calling this method the control over the memory regions of the returned labeling functions is transferred to the caller.
+             *
+             *  @return The removed labeling functions in the order in which they would have been applied.
+             */
+            virtual std::vector<htd::ILabelingFunction *> releaseLabelingFunctions(void) = 0;
+
             /**
              *  Check whether the algorithm always returns a valid decomposition (or nulltpr) in case it is interrupted.
              *
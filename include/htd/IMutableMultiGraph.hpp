@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/IMultiGraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -90,6 +93,18 @@ namespace htd
              */
             virtual htd::id_t addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) = 0;
 
+            /**
+             *  Add new edges to the multi-graph.
+             *
+             *  In contrast to adding the edges one by one, the neighborhoods of the affected vertices are sorted only once,
+             *  after all edges were added. The edges get consecutive IDs in the order in which they are provided.
+             *
+             *  @param[in] edges    The endpoints of the edges which shall be added.
+             *
+             *  @return The ID of the first new edge. If no edge is provided, the ID the next edge added to the graph will get.
+             */
+            virtual htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) = 0;
+
             /**
              *  Remove an edge from the multi-graph.
              *
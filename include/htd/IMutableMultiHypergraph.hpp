@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/IMultiHypergraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -135,6 +138,33 @@ namespace htd
              */
             virtual htd::id_t addEdge(htd::Hyperedge && hyperedge) = 0;
 
+            /**
+             *  Add new edges to the multi-hypergraph.
+             *
+             *  In contrast to adding the edges one by one, the neighborhoods of the affected vertices are sorted only once,
+             *  after all edges were added. The edges get consecutive IDs in the order in which they are provided.
+             *
+             *  @param[in] edges    The endpoints of the edges which shall be added.
+             *
+             *  @return The ID of the first new edge. If no edge is provided, the ID the next edge added to the graph will get.
+             */
+            virtual htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) = 0;
+
+            /**
+             *  Add new hyperedges to the multi-hypergraph.
+             *
+             *  In contrast to adding the hyperedges one by one, the neighborhoods of the affected vertices are sorted only
+             *  once, after all hyperedges were added. The hyperedges get consecutive IDs in the order in which they are provided.
+             *
+             *  @param[in] elements The endpoints of all hyperedges, stored consecutively.
+             *  @param[in] offsets  The positions at which the hyperedges start within the given elements, followed by the
+             *                      total number of elements. Hyperedge i consists of the endpoints at the positions
+             *                      offsets[i], ..., offsets[i + 1] - 1 and must not be empty.
+             *
+             *  @return The ID of the first new hyperedge. If no hyperedge is provided, the ID the next edge added to the graph will get.
+             */
+            virtual htd::id_t addEdges(const std::vector<htd::vertex_t> & elements, const std::vector<htd::index_t> & offsets) = 0;
+
             /**
              *  Remove an edge from the multi-hypergraph.
              *
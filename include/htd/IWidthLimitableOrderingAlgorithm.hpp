@@ -29,6 +29,8 @@
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IWidthLimitedVertexOrdering.hpp>
 
+#include <atomic>
+
 namespace htd
 {
     /**
@@ -64,6 +66,23 @@ namespace htd
              */
             virtual htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const noexcept = 0;
 
+            /**
+             *  Compute the vertex ordering of a given graph.
+             *
+             *  In addition to maxBagSize, the construction of an ordering is aborted as soon as the maximum bag size of the partial
+             *  ordering exceeds the current value of sharedMaxBagSize. This allows concurrent computations to share the width of the
+             *  best decomposition found so far. The resulting ordering is incomplete in this case.
+             *
+             *  @param[in] graph                The input graph for which the vertex ordering shall be computed.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+             *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which an empty ordering is returned.
+             *  @param[in] sharedMaxBagSize     The upper bound for the maximum bag size which may be tightened concurrently by other threads.
+             *
+             *  @return The vertex ordering of the given graph.
+             */
+            virtual htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const noexcept = 0;
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             /**
              *  Create a deep copy of the current ordering algorithm.
@@ -0,0 +1,112 @@
+/* 
+ * File:   IterationPlanner.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_ITERATIONPLANNER_HPP
+#define HTD_HTD_ITERATIONPLANNER_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <chrono>
+
+namespace htd
+{
+    /**
+     *  Class for planning the iterations of anytime algorithms against the deadline of a management instance.
+     *
+     *  The planner measures the time spent between consecutive calls of recordIterations(std::size_t) and
+     *  uses the highest average duration of an iteration observed so far as a conservative estimate for the
+     *  duration of future iterations. An iteration is only planned if it is expected to finish before the
+     *  deadline of the management instance, which bounds the amount of time by which the deadline is exceeded.
+     */
+    class IterationPlanner
+    {
+        public:
+            /**
+             *  Constructor for a new iteration planner.
+             *
+             *  The time measurement for the first iteration starts with the construction of the planner.
+             *
+             *  @param[in] manager   The management instance whose deadline shall be respected.
+             */
+            HTD_API IterationPlanner(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Destructor for an iteration planner.
+             */
+            HTD_API virtual ~IterationPlanner();
+
+            /**
+             *  Inform the planner that the given number of iterations finished since the last call of this method.
+             *
+             *  @param[in] iterationCount   The number of iterations finished since the last call of this method.
+             */
+            HTD_API void recordIterations(std::size_t iterationCount);
+
+            /**
+             *  Getter for the estimated duration of a single iteration.
+             *
+             *  @return The estimated duration of a single iteration or zero if no iteration was recorded so far.
+             */
+            HTD_API std::chrono::steady_clock::duration iterationDuration(void) const;
+
+            /**
+             *  Compute the number of iterations which are expected to finish before the deadline.
+             *
+             *  If the management instance has no deadline, the requested number of iterations is returned. As long as
+             *  no iteration was recorded, at most one iteration is planned before the deadline passes.
+             *
+             *  @param[in] requestedIterationCount  The number of iterations the algorithm would like to perform.
+             *
+             *  @return The number of iterations, at most requestedIterationCount, which are expected to finish before the deadline.
+             */
+            HTD_API std::size_t plannedIterationCount(std::size_t requestedIterationCount) const;
+
+            /**
+             *  Check whether a further iteration is expected to finish before the deadline.
+             *
+             *  @return True if a further iteration is expected to finish before the deadline, false otherwise.
+             */
+            HTD_API bool allowsIteration(void) const;
+
+        private:
+            /**
+             *  The management instance whose deadline shall be respected.
+             */
+            const htd::LibraryInstance * managementInstance_;
+
+            /**
+             *  The point in time at which the last call of recordIterations(std::size_t) took place.
+             */
+            std::chrono::steady_clock::time_point checkpoint_;
+
+            /**
+             *  The highest average duration of an iteration observed so far.
+             */
+            std::chrono::steady_clock::duration iterationDuration_;
+    };
+}
+
+#endif /* HTD_HTD_ITERATIONPLANNER_HPP */
@@ -45,6 +45,18 @@ namespace htd
      *
      *  Per default, the first decomposition is returned, i.e. only a single iteration is performed.
      *
+     *  If the fitness function is an instance of htd::WidthFitnessFunction and the base decomposition algorithm is an
+     *  instance of htd::BucketEliminationTreeDecompositionAlgorithm, the width of each candidate ordering is evaluated
+     *  before the decomposition is materialized and candidates which cannot improve the best width found so far are
+     *  skipped. Since post-processing may change the width of a decomposition, the fast path is only taken if neither
+     *  the base algorithm nor this algorithm applies post-processing operations other than labeling functions. Other
+     *  fitness functions (also custom ones based on the width), other base algorithms and configurations with such
+     *  post-processing operations do not benefit from this fast path, every candidate is materialized and evaluated
+     *  in this case.
+     *
+     *  @note The progress callback is invoked for each materialized decomposition only, i.e. candidates skipped by
+     *  the width fast path are not reported.
+     *
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithm and the given manipulations (or nullptr) also if it was interrupted
      *  by a call to htd::LibraryInstance::terminate().
@@ -149,6 +161,8 @@ namespace htd
 
             HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) override;
 
+            HTD_API std::vector<htd::ILabelingFunction *> releaseLabelingFunctions(void) override;
+
             HTD_API bool isSafelyInterruptible(void) const override;
 
             HTD_API bool isComputeInducedEdgesEnabled(void) const override;
@@ -187,6 +201,29 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of worker threads which compute decompositions concurrently.
+             *
+             *  @return The number of worker threads which compute decompositions concurrently.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall compute decompositions concurrently (Default: 1).
+             *
+             *  If more than one thread is requested, each worker thread runs its own clone of the base decomposition algorithm on
+             *  the shared preprocessed input graph and the iteration count, the non-improvement limit as well as calls to
+             *  htd::LibraryInstance::terminate() are respected globally. Iteration i draws its random numbers from a generator
+             *  seeded with (s + i), where s is drawn from std::rand() in the calling thread, so that results are reproducible for
+             *  a fixed seed as long as no non-improvement limit is hit. Ties are broken in favor of the earliest iteration.
+             *
+             *  @note The fitness function, the labeling functions and the manipulation operations are shared between the worker
+             *  threads and must therefore not rely on mutable state. Calls of the progress callback are serialized.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall compute decompositions concurrently.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const noexcept override;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) override;
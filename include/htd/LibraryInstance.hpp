@@ -27,6 +27,7 @@
 
 #include <htd/Id.hpp>
 
+#include <chrono>
 #include <memory>
 
 namespace htd
@@ -231,6 +232,52 @@ namespace htd
              */
             HTD_API void reset(void);
 
+            /**
+             *  Set the deadline until which the anytime algorithms of the library shall return their best result.
+             *
+             *  In contrast to terminate(), reaching the deadline does not abort running computations. Iterative
+             *  algorithms like htd::IterativeImprovementTreeDecompositionAlgorithm always complete their first
+             *  iteration and do not start further iterations which are not expected to finish before the deadline.
+             *
+             *  @param[in] deadline The point in time until which the best result shall be returned.
+             */
+            HTD_API void setDeadline(const std::chrono::steady_clock::time_point & deadline);
+
+            /**
+             *  Set the deadline of the management instance to the given amount of time from now.
+             *
+             *  @param[in] timeLimit    The amount of time, starting now, until which the best result shall be returned.
+             */
+            HTD_API void setTimeLimit(const std::chrono::steady_clock::duration & timeLimit);
+
+            /**
+             *  Remove the deadline of the management instance.
+             */
+            HTD_API void removeDeadline(void);
+
+            /**
+             *  Check whether a deadline is set for the management instance.
+             *
+             *  @return True if a deadline is set for the management instance, false otherwise.
+             */
+            HTD_API bool hasDeadline(void) const;
+
+            /**
+             *  Getter for the deadline of the management instance.
+             *
+             *  @note If no deadline is set, the maximum representable point in time is returned.
+             *
+             *  @return The deadline of the management instance.
+             */
+            HTD_API std::chrono::steady_clock::time_point deadline(void) const;
+
+            /**
+             *  Check whether the deadline of the management instance has passed.
+             *
+             *  @return True if a deadline is set and it has passed, false otherwise.
+             */
+            HTD_API bool isDeadlineReached(void) const;
+
             /**
              *  Access the factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
              */
@@ -53,6 +53,8 @@ namespace htd
 
             HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const noexcept override;
 
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const noexcept override;
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const noexcept override;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) override;
@@ -49,6 +49,24 @@ namespace htd
 
             HTD_API std::vector<htd::vertex_t> * computeSeparator(const htd::IGraphStructure & graph) const override;
 
+            /**
+             *  Getter for the number of worker threads which compute maximum flows concurrently.
+             *
+             *  @return The number of worker threads which compute maximum flows concurrently.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall compute maximum flows concurrently (Default: 1).
+             *
+             *  The pairs of non-adjacent vertices are distributed row-wise among the worker threads. Each worker thread
+             *  owns a residual network which is reset in place for every pair. The result does not depend on the number
+             *  of threads: Among all separators of minimum size, the one found for the first pair of vertices is returned.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall compute maximum flows concurrently.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const noexcept override;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) override;
@@ -145,6 +145,8 @@ namespace htd
 
             HTD_API htd::id_t addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) override;
 
+            HTD_API htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) override;
+
             HTD_API void removeEdge(htd::id_t edgeId) override;
 
             HTD_API const htd::LibraryInstance * managementInstance(void) const noexcept override;
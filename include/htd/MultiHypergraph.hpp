@@ -25,6 +25,7 @@
 #ifndef HTD_HTD_MULTIHYPERGRAPH_HPP
 #define HTD_HTD_MULTIHYPERGRAPH_HPP
 
+#include <htd/IContiguousGraphStructure.hpp>
 #include <htd/IMutableMultiHypergraph.hpp>
 #include <htd/LibraryInstance.hpp>
 
@@ -36,7 +37,7 @@ namespace htd
     /**
      *  Default implementation of the IMutableMultiHypergraph interface.
      */
-    class MultiHypergraph : public virtual htd::IMutableMultiHypergraph
+    class MultiHypergraph : public virtual htd::IMutableMultiHypergraph, public virtual htd::IContiguousGraphStructure
     {
         public:
             /**
@@ -117,6 +118,8 @@ namespace htd
 
             HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const override;
 
+            HTD_API htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex) const override;
+
             HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const override;
 
             HTD_API std::size_t isolatedVertexCount(void) const override;
@@ -163,6 +166,10 @@ namespace htd
 
             HTD_API htd::id_t addEdge(htd::Hyperedge && hyperedge) override;
 
+            HTD_API htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) override;
+
+            HTD_API htd::id_t addEdges(const std::vector<htd::vertex_t> & elements, const std::vector<htd::index_t> & offsets) override;
+
             HTD_API void removeEdge(htd::id_t edgeId) override;
 
             HTD_API const htd::LibraryInstance * managementInstance(void) const noexcept override;
@@ -721,6 +721,41 @@ namespace htd
                 return base_->addEdge(addVertices(elements));
             }
 
+            /**
+             *  Add new hyperedges to the multi-hypergraph. Vertices which do not exist yet are added in the order in which
+             *  they occur. The hyperedges get consecutive IDs in the order in which they are provided.
+             *
+             *  @param[in] elements The endpoints of all hyperedges, stored consecutively.
+             *  @param[in] offsets  The positions at which the hyperedges start within the given elements, followed by the
+             *                      total number of elements. Hyperedge i consists of the endpoints at the positions
+             *                      offsets[i], ..., offsets[i + 1] - 1 and must not be empty.
+             *
+             *  @return The ID of the first new hyperedge. If no hyperedge is provided, the ID the next edge added to the graph will get.
+             */
+            htd::id_t addEdges(const std::vector<VertexNameType> & elements, const std::vector<htd::index_t> & offsets)
+            {
+                return base_->addEdges(addVertices(elements), offsets);
+            }
+
+            /**
+             *  Add new hyperedges between existing vertices of the multi-hypergraph which are given by their IDs. The hyperedges
+             *  get consecutive IDs in the order in which they are provided.
+             *
+             *  This allows to resolve the names of the endpoints one by one, e.g., via addVertex(const VertexNameType &), and to
+             *  add the hyperedges afterwards without keeping the names of all endpoints.
+             *
+             *  @param[in] elements The IDs of the endpoints of all hyperedges, stored consecutively.
+             *  @param[in] offsets  The positions at which the hyperedges start within the given elements, followed by the
+             *                      total number of elements. Hyperedge i consists of the endpoints at the positions
+             *                      offsets[i], ..., offsets[i + 1] - 1 and must not be empty.
+             *
+             *  @return The ID of the first new hyperedge. If no hyperedge is provided, the ID the next edge added to the graph will get.
+             */
+            htd::id_t addEdgesBetweenVertices(const std::vector<htd::vertex_t> & elements, const std::vector<htd::index_t> & offsets)
+            {
+                return base_->addEdges(elements, offsets);
+            }
+
             /**
              *  Add a new edge to the multi-hypergraph.
              *
@@ -35,6 +35,14 @@ namespace htd
      *  Implementation of the IDecompositionManipulationOperation interface which manipulates
      *  given tree and path decompositions such that the resulting decomposition is fully
      *  normalized.
+     *
+     *  When applied to a complete decomposition of type htd::TreeDecomposition, the normalized
+     *  decomposition is built in a single traversal of the original decomposition and assigned
+     *  to it afterwards. The labels of the original nodes are retained, but the identifiers of
+     *  all nodes may change, so node identifiers obtained before the operation must not be used
+     *  afterwards. Decompositions of any other type are normalized in place by a sequence of
+     *  semi-normalization, exchange node replacement and the limitation of the forgotten and
+     *  introduced vertices to one per node, which retains the identifiers of the original nodes.
      */
     class NormalizationOperation : public htd::SemiNormalizationOperation
     {
@@ -26,6 +26,7 @@
 #define HTD_HTD_PREPROCESSEDGRAPH_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/IContiguousGraphStructure.hpp>
 #include <htd/IPreprocessedGraph.hpp>
 
 #include <vector>
@@ -45,7 +46,7 @@ namespace htd
      *  vertex is assigned the ID 0. This allows for efficient storage and data handling
      *  based on arrays and vectors.
      */
-    class PreprocessedGraph : public htd::IPreprocessedGraph
+    class PreprocessedGraph : public htd::IPreprocessedGraph, public htd::IContiguousGraphStructure
     {
         public:
             /**
@@ -109,6 +110,8 @@ namespace htd
 
             HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const override;
 
+            HTD_API htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex) const override;
+
             HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const override;
 
             HTD_API bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const override;
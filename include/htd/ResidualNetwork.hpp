@@ -0,0 +1,289 @@
+/*
+ * File:   ResidualNetwork.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_RESIDUALNETWORK_HPP
+#define HTD_HTD_RESIDUALNETWORK_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IFlowNetworkStructure.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Sparse residual graph of a flow network.
+     *
+     *  Each edge of the flow network with positive capacity is represented by a forward edge and a reverse edge of
+     *  capacity 0. The edges are stored in flat arrays grouped by their source vertex and, within each group, sorted by
+     *  their target vertex. Each edge knows the index of its reverse edge, so that pushing flow along an edge only
+     *  touches two array entries. The memory consumption is therefore linear in the number of edges of the network.
+     *
+     *  @note The vertices of the network are assumed to be numbered between 0 and vertexCount - 1.
+     */
+    class ResidualNetwork
+    {
+        public:
+            /**
+             *  Constructor for a residual network.
+             *
+             *  @param[in] flowNetwork  The flow network for which the residual network shall be created.
+             */
+            ResidualNetwork(const htd::IFlowNetworkStructure & flowNetwork) : offsets_(flowNetwork.vertexCount() + 1, 0), targets_(), capacities_(), residualCapacities_(), reverseEdges_()
+            {
+                std::vector<htd::vertex_t> sources;
+                std::vector<htd::vertex_t> targets;
+                std::vector<std::size_t> capacities;
+
+                std::size_t vertexCount = flowNetwork.vertexCount();
+
+                for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    for (htd::vertex_t neighbor : flowNetwork.neighbors(vertex))
+                    {
+                        std::size_t capacity = flowNetwork.capacity(vertex, neighbor);
+
+                        if (capacity > 0)
+                        {
+                            sources.push_back(vertex);
+                            targets.push_back(neighbor);
+                            capacities.push_back(capacity);
+
+                            sources.push_back(neighbor);
+                            targets.push_back(vertex);
+                            capacities.push_back(0);
+                        }
+                    }
+                }
+
+                std::size_t edgeCount = sources.size();
+
+                std::vector<htd::index_t> order(edgeCount);
+
+                std::iota(order.begin(), order.end(), 0);
+
+                std::sort(order.begin(), order.end(), [&](htd::index_t edge1, htd::index_t edge2)
+                {
+                    return sources[edge1] < sources[edge2] ||
+                           (sources[edge1] == sources[edge2] && (targets[edge1] < targets[edge2] ||
+                                                                 (targets[edge1] == targets[edge2] && edge1 < edge2)));
+                });
+
+                std::vector<htd::index_t> positions(edgeCount);
+
+                for (htd::index_t position = 0; position < edgeCount; ++position)
+                {
+                    positions[order[position]] = position;
+                }
+
+                targets_.resize(edgeCount);
+                capacities_.resize(edgeCount);
+                reverseEdges_.resize(edgeCount);
+
+                for (htd::index_t position = 0; position < edgeCount; ++position)
+                {
+                    htd::index_t edge = order[position];
+
+                    targets_[position] = targets[edge];
+                    capacities_[position] = capacities[edge];
+                    reverseEdges_[position] = positions[edge ^ 1];
+
+                    ++offsets_[sources[edge] + 1];
+                }
+
+                std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+                residualCapacities_ = capacities_;
+            }
+
+            /**
+             *  Destructor of a residual network.
+             */
+            ~ResidualNetwork(void)
+            {
+
+            }
+
+            /**
+             *  Getter for the number of vertices of the residual network.
+             *
+             *  @return The number of vertices of the residual network.
+             */
+            std::size_t vertexCount(void) const
+            {
+                return offsets_.size() - 1;
+            }
+
+            /**
+             *  Getter for the number of edges of the residual network, including the reverse edges.
+             *
+             *  @return The number of edges of the residual network.
+             */
+            std::size_t edgeCount(void) const
+            {
+                return targets_.size();
+            }
+
+            /**
+             *  Getter for the index of the first edge leaving the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The index of the first edge leaving the given vertex.
+             */
+            htd::index_t firstEdge(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return offsets_[vertex];
+            }
+
+            /**
+             *  Getter for the index one past the last edge leaving the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The index one past the last edge leaving the given vertex.
+             */
+            htd::index_t lastEdge(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return offsets_[vertex + 1];
+            }
+
+            /**
+             *  Getter for the target vertex of an edge.
+             *
+             *  @param[in] edge The index of the edge.
+             *
+             *  @return The target vertex of the edge.
+             */
+            htd::vertex_t target(htd::index_t edge) const
+            {
+                return targets_[edge];
+            }
+
+            /**
+             *  Getter for the index of the reverse edge of an edge.
+             *
+             *  @param[in] edge The index of the edge.
+             *
+             *  @return The index of the reverse edge of the edge.
+             */
+            htd::index_t reverseEdge(htd::index_t edge) const
+            {
+                return reverseEdges_[edge];
+            }
+
+            /**
+             *  Getter for the original capacity of an edge. The original capacity of a reverse edge is 0.
+             *
+             *  @param[in] edge The index of the edge.
+             *
+             *  @return The original capacity of the edge.
+             */
+            std::size_t capacity(htd::index_t edge) const
+            {
+                return capacities_[edge];
+            }
+
+            /**
+             *  Getter for the residual capacity of an edge.
+             *
+             *  @param[in] edge The index of the edge.
+             *
+             *  @return The residual capacity of the edge.
+             */
+            std::size_t residualCapacity(htd::index_t edge) const
+            {
+                return residualCapacities_[edge];
+            }
+
+            /**
+             *  Getter for the flow on an edge, i.e., the difference between its original and its residual capacity.
+             *
+             *  @param[in] edge The index of the edge.
+             *
+             *  @return The flow on the edge. The flow on reverse edges is negative.
+             */
+            long long flow(htd::index_t edge) const
+            {
+                return static_cast<long long>(capacities_[edge] - residualCapacities_[edge]);
+            }
+
+            /**
+             *  Push flow along an edge and update the residual capacity of its reverse edge accordingly.
+             *
+             *  @param[in] edge     The index of the edge.
+             *  @param[in] amount   The amount of flow. The amount must not exceed the residual capacity of the edge.
+             */
+            void pushFlow(htd::index_t edge, std::size_t amount)
+            {
+                HTD_ASSERT(amount <= residualCapacities_[edge])
+
+                residualCapacities_[edge] -= amount;
+
+                residualCapacities_[reverseEdges_[edge]] += amount;
+            }
+
+            /**
+             *  Restore the original capacities of all edges, i.e., remove the current flow from the network.
+             */
+            void reset(void)
+            {
+                std::copy(capacities_.begin(), capacities_.end(), residualCapacities_.begin());
+            }
+
+        private:
+            /**
+             *  The offsets of the edges leaving each vertex. The edges of vertex i have the indices offsets_[i], ..., offsets_[i + 1] - 1.
+             */
+            std::vector<htd::index_t> offsets_;
+
+            /**
+             *  The target vertex of each edge.
+             */
+            std::vector<htd::vertex_t> targets_;
+
+            /**
+             *  The original capacity of each edge.
+             */
+            std::vector<std::size_t> capacities_;
+
+            /**
+             *  The residual capacity of each edge.
+             */
+            std::vector<std::size_t> residualCapacities_;
+
+            /**
+             *  The index of the reverse edge of each edge.
+             */
+            std::vector<htd::index_t> reverseEdges_;
+    };
+}
+
+#endif /* HTD_HTD_RESIDUALNETWORK_HPP */
@@ -34,6 +34,10 @@ namespace htd
 {
     /**
      * Implementation of the ISetCoverAlgorithm interface based on exhaustive search via a branch-and-bound approach.
+     *
+     * The elements are remapped to bit positions so that each container is represented by the bitset of the elements
+     * it covers. The search branches on the uncovered element contained in the fewest containers and prunes nodes via
+     * the lower bound given by the maximum coverage of a single container.
      */
     class SetCoverAlgorithm : public virtual htd::ISetCoverAlgorithm
     {
@@ -0,0 +1,192 @@
+/*
+ * File:   StaticGraph.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_STATICGRAPH_HPP
+#define HTD_HTD_STATICGRAPH_HPP
+
+#include <htd/IContiguousGraphStructure.hpp>
+#include <htd/IContiguousMultiHypergraph.hpp>
+#include <htd/IGraph.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Immutable implementation of the IGraph interface.
+     *
+     *  The graph is stored in compressed sparse row form: For each vertex, the sorted neighbors and the positions of
+     *  the incident edges occupy a contiguous range of two flat arrays which is delimited by an offset array. The
+     *  endpoints of all edges are stored in a third flat array. The htd::Hyperedge objects required by the methods
+     *  returning hyperedges are only created when one of these methods is called for the first time.
+     */
+    class StaticGraph : public virtual htd::IGraph, public virtual htd::IContiguousGraphStructure, public virtual htd::IContiguousMultiHypergraph
+    {
+        public:
+            /**
+             *  Constructor for a static graph.
+             *
+             *  The vertices of the new graph are htd::Vertex::FIRST, ..., htd::Vertex::FIRST + vertexCount - 1. The
+             *  edges get consecutive IDs, starting with htd::Id::FIRST, in the order in which they are provided. Edges
+             *  which occur more than once are only added once, just like for htd::Graph.
+             *
+             *  @param[in] manager      The management instance to which the new graph belongs.
+             *  @param[in] vertexCount  The number of vertices of the new graph.
+             *  @param[in] edges        The endpoints of the edges of the new graph.
+             */
+            HTD_API StaticGraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges);
+
+            /**
+             *  Copy constructor for a static graph.
+             *
+             *  @param[in] original  The original static graph.
+             */
+            HTD_API StaticGraph(const StaticGraph & original);
+
+            /**
+             *  Copy constructor for a static graph.
+             *
+             *  @param[in] original  The original graph.
+             */
+            HTD_API StaticGraph(const htd::IGraph & original);
+
+            HTD_API virtual ~StaticGraph();
+
+            HTD_API std::size_t vertexCount(void) const override;
+
+            HTD_API std::size_t edgeCount(void) const override;
+
+            HTD_API std::size_t edgeCount(htd::vertex_t vertex) const override;
+
+            HTD_API bool isVertex(htd::vertex_t vertex) const override;
+
+            HTD_API bool isEdge(htd::id_t edgeId) const override;
+
+            HTD_API bool isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const override;
+
+            HTD_API bool isEdge(const std::vector<htd::vertex_t> & elements) const override;
+
+            HTD_API bool isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const override;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const override;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const override;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const override;
+
+            HTD_API bool isConnected(void) const override;
+
+            HTD_API bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const override;
+
+            HTD_API bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const override;
+
+            HTD_API std::size_t neighborCount(htd::vertex_t vertex) const override;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const override;
+
+            HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const override;
+
+            HTD_API htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex) const override;
+
+            HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const override;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> vertices(void) const override;
+
+            HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const override;
+
+            HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const override;
+
+            /**
+             *  Access the vector of all vertices of the graph in ascending order.
+             *
+             *  @return The vector of all vertices of the graph in ascending order.
+             */
+            HTD_API const std::vector<htd::vertex_t> & vertexVector(void) const;
+
+            HTD_API std::size_t isolatedVertexCount(void) const override;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const override;
+
+            HTD_API htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const override;
+
+            HTD_API bool isIsolatedVertex(htd::vertex_t vertex) const override;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(void) const override;
+
+            HTD_API htd::ConstSpan<htd::Hyperedge> hyperedgeSpan(void) const override;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(htd::vertex_t vertex) const override;
+
+            HTD_API const htd::Hyperedge & hyperedge(htd::id_t edgeId) const override;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index) const override;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const override;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const override;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(std::vector<htd::index_t> && indices) const override;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const noexcept override;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) override;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API StaticGraph * clone(void) const override;
+#else
+            /**
+             *  Create a deep copy of the current static graph.
+             *
+             *  @return A new StaticGraph object identical to the current static graph.
+             */
+            HTD_API StaticGraph * clone(void) const;
+
+            HTD_API htd::IGraph * cloneGraph(void) const override;
+
+            HTD_API htd::IMultiGraph * cloneMultiGraph(void) const override;
+
+            HTD_API htd::IHypergraph * cloneHypergraph(void) const override;
+
+            HTD_API htd::IGraphStructure * cloneGraphStructure(void) const override;
+
+            HTD_API htd::IMultiHypergraph * cloneMultiHypergraph(void) const override;
+#endif
+
+            /**
+             *  Copy assignment operator for a static graph.
+             *
+             *  @param[in] original  The original static graph.
+             */
+            HTD_API StaticGraph & operator=(const StaticGraph & original);
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_STATICGRAPH_HPP */
@@ -30,6 +30,8 @@
 #include <htd/IMutableTreeDecomposition.hpp>
 #include <htd/LabeledTree.hpp>
 
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 MSVC_PRAGMA_WARNING_PUSH
@@ -39,6 +41,13 @@ namespace htd
 {
     /**
      *  Default implementation of the IMutableTreeDecomposition interface.
+     *
+     *  The minimum and maximum bag size as well as the lists of join, forget, introduce and exchange nodes are cached.
+     *  The cache is updated or invalidated by all mutating methods, so repeated queries on an unchanged decomposition
+     *  take constant time.
+     *
+     *  @note A call of mutableBagContent() suspends the cache until the next structural change of the decomposition.
+     *  In the meantime, the statistics are recomputed on every query, so they always reflect modifications of the bag.
      */
     class TreeDecomposition : public htd::LabeledTree, public virtual htd::IMutableTreeDecomposition
     {
@@ -88,6 +97,8 @@ namespace htd
 
             HTD_API htd::vertex_t insertRoot(std::vector<htd::vertex_t> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges) override;
 
+            HTD_API void makeRoot(htd::vertex_t vertex) override;
+
             HTD_API htd::vertex_t addChild(htd::vertex_t vertex) override;
 
             HTD_API htd::vertex_t addChild(htd::vertex_t vertex, const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedEdges) override;
@@ -102,6 +113,10 @@ namespace htd
 
             HTD_API void removeChild(htd::vertex_t vertex, htd::vertex_t child) override;
 
+            HTD_API void setParent(htd::vertex_t vertex, htd::vertex_t newParent) override;
+
+            HTD_API void swapWithParent(htd::vertex_t vertex) override;
+
             HTD_API std::size_t joinNodeCount(void) const override;
 
             HTD_API htd::ConstCollection<htd::vertex_t> joinNodes(void) const override;
@@ -293,10 +308,100 @@ namespace htd
              */
             void getChildBagSetUnion(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const;
 
+            /**
+             *  Update the cached statistics after a new node was added to the decomposition.
+             *
+             *  The bag sizes are maintained incrementally, the node lists are invalidated because the node type of the
+             *  neighbors of the new node may change. Derived classes which bypass the mutating methods of this class must
+             *  call this method whenever they add a node.
+             *
+             *  @param[in] bagSize  The bag size of the new node.
+             */
+            void registerNewNode(std::size_t bagSize);
+
+            /**
+             *  Invalidate the cached statistics.
+             *
+             *  Derived classes which bypass the mutating methods of this class must call this method whenever they modify
+             *  the bags or the structure of the decomposition. Caching is resumed if it was suspended by mutableBagContent().
+             *
+             *  @param[in] bagSizes Whether the bag sizes may have changed.
+             */
+            void invalidateStatistics(bool bagSizes);
+
+            /**
+             *  Invalidate the cached statistics and suspend caching until the next call of invalidateStatistics().
+             *
+             *  Derived classes must call this method whenever they hand out a mutable reference to a bag, because the bag
+             *  may then be modified without notice.
+             */
+            void suspendStatistics(void);
+
         private:
             std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> bagContent_;
 
             std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+
+            /**
+             *  The smallest bag size of the decomposition. The value is only meaningful if bagSizeStatisticsValid_ is set.
+             */
+            mutable std::size_t minimumBagSize_;
+
+            /**
+             *  The largest bag size of the decomposition. The value is only meaningful if bagSizeStatisticsValid_ is set.
+             */
+            mutable std::size_t maximumBagSize_;
+
+            /**
+             *  The join nodes of the decomposition. The value is only meaningful if nodeTypeStatisticsValid_ is set.
+             */
+            mutable std::vector<htd::vertex_t> joinNodes_;
+
+            /**
+             *  The forget nodes of the decomposition. The value is only meaningful if nodeTypeStatisticsValid_ is set.
+             */
+            mutable std::vector<htd::vertex_t> forgetNodes_;
+
+            /**
+             *  The introduce nodes of the decomposition. The value is only meaningful if nodeTypeStatisticsValid_ is set.
+             */
+            mutable std::vector<htd::vertex_t> introduceNodes_;
+
+            /**
+             *  The exchange nodes of the decomposition. The value is only meaningful if nodeTypeStatisticsValid_ is set.
+             */
+            mutable std::vector<htd::vertex_t> exchangeNodes_;
+
+            /**
+             *  Flag indicating whether minimumBagSize_ and maximumBagSize_ reflect the current bags.
+             */
+            mutable std::atomic<bool> bagSizeStatisticsValid_;
+
+            /**
+             *  Flag indicating whether the cached node lists reflect the current bags and the current tree structure.
+             */
+            mutable std::atomic<bool> nodeTypeStatisticsValid_;
+
+            /**
+             *  Flag indicating whether a reference to a bag was handed out by mutableBagContent() since the last structural change.
+             *  While it is set, the statistics are recomputed on every query instead of being cached.
+             */
+            std::atomic<bool> statisticsCachingSuspended_;
+
+            /**
+             *  Mutex serializing the computation of the cached statistics by concurrent readers.
+             */
+            mutable std::mutex statisticsMutex_;
+
+            /**
+             *  Recompute the minimum and maximum bag size if the cached values are outdated.
+             */
+            void updateBagSizeStatistics(void) const;
+
+            /**
+             *  Recompute the lists of join, forget, introduce and exchange nodes if the cached lists are outdated.
+             */
+            void updateNodeTypeStatistics(void) const;
     };
 }
 
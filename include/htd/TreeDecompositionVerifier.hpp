@@ -32,6 +32,10 @@ namespace htd
 {
     /**
      *  Default implementation of the ITreeDecompositionVerifier interface.
+     *
+     *  The bags are indexed by the vertices they contain so that each hyperedge is only compared with the bags
+     *  containing its least frequent vertex and the connectedness criterion is checked via a single scan of the
+     *  nodes.
      */
     class TreeDecompositionVerifier : public virtual htd::ITreeDecompositionVerifier
     {
@@ -57,6 +61,20 @@ namespace htd
             
             HTD_API htd::ConstCollection<htd::vertex_t> violationsConnectednessCriterion(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const override;
 
+            /**
+             *  Getter for the number of worker threads which check the coverage of the hyperedges concurrently.
+             *
+             *  @return The number of worker threads which check the coverage of the hyperedges concurrently.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall check the coverage of the hyperedges concurrently (Default: 1).
+             *
+             *  @param[in] threadCount  The number of worker threads which shall check the coverage of the hyperedges concurrently.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
         protected:
             /**
              *  Copy assignment operator for a tree decomposition verifier.
@@ -64,6 +82,12 @@ namespace htd
              *  @note This operator is protected to prevent assignments to an already initialized tree decomposition verifier.
              */
             TreeDecompositionVerifier & operator=(const TreeDecompositionVerifier &) { return *this; }
+
+        private:
+            /**
+             *  The number of worker threads which check the coverage of the hyperedges concurrently.
+             */
+            std::size_t threadCount_;
     };
 }
 
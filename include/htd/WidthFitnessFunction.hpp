@@ -0,0 +1,58 @@
+/* 
+ * File:   WidthFitnessFunction.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_WIDTHFITNESSFUNCTION_HPP
+#define HTD_HTD_WIDTHFITNESSFUNCTION_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionFitnessFunction.hpp>
+
+namespace htd
+{
+    /**
+     *  Fitness function which rates tree decompositions only by their maximum bag size.
+     *
+     *  The fitness evaluation consists of a single level holding the negated maximum bag size, i.e., smaller bags
+     *  are better. htd::IterativeImprovementTreeDecompositionAlgorithm recognizes this fitness function and, for a
+     *  bucket elimination base algorithm, only materializes decompositions whose elimination ordering improves on
+     *  the best maximum bag size found so far.
+     */
+    class WidthFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+    {
+        public:
+            /**
+             *  Constructor for a new width fitness function.
+             */
+            HTD_API WidthFitnessFunction(void);
+
+            HTD_API virtual ~WidthFitnessFunction();
+
+            HTD_API htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const override;
+
+            HTD_API WidthFitnessFunction * clone(void) const override;
+    };
+}
+
+#endif /* HTD_HTD_WIDTHFITNESSFUNCTION_HPP */
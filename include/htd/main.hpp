@@ -36,16 +36,20 @@
 #include <htd/BreadthFirstGraphTraversal.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
 #include <htd/Collection.hpp>
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/CompactTreeDecomposition.hpp>
 #include <htd/CompressionOperation.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
+#include <htd/ConnectedComponentTreeDecompositionAlgorithm.hpp>
 #include <htd/ConstCollection.hpp>
 #include <htd/ConstIteratorBase.hpp>
 #include <htd/ConstIterator.hpp>
 #include <htd/ConstIteratorWrapper.hpp>
 #include <htd/ConstPointerIteratorWrapper.hpp>
+#include <htd/ConstSpan.hpp>
 #include <htd/DepthFirstConnectedComponentAlgorithm.hpp>
 #include <htd/DepthFirstGraphTraversal.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
@@ -53,6 +57,7 @@
 #include <htd/DirectedGraph.hpp>
 #include <htd/DirectedMultiGraphFactory.hpp>
 #include <htd/DirectedMultiGraph.hpp>
+#include <htd/EliminationWidthEvaluator.hpp>
 #include <htd/EnhancedMaximumCardinalitySearchOrderingAlgorithm.hpp>
 #include <htd/ExchangeNodeReplacementOperation.hpp>
 #include <htd/ExhaustiveVertexSelectionStrategy.hpp>
@@ -84,6 +89,8 @@
 #include <htd/HypertreeDecomposition.hpp>
 #include <htd/IBiconnectedComponentAlgorithm.hpp>
 #include <htd/IConnectedComponentAlgorithm.hpp>
+#include <htd/IContiguousGraphStructure.hpp>
+#include <htd/IContiguousMultiHypergraph.hpp>
 #include <htd/ICustomizedTreeDecompositionAlgorithm.hpp>
 #include <htd/IDecompositionManipulationOperation.hpp>
 #include <htd/Id.hpp>
@@ -148,6 +155,7 @@
 #include <htd/IPreprocessedGraph.hpp>
 #include <htd/ISetCoverAlgorithm.hpp>
 #include <htd/IStronglyConnectedComponentAlgorithm.hpp>
+#include <htd/IterationPlanner.hpp>
 #include <htd/IterativeImprovementTreeDecompositionAlgorithm.hpp>
 #include <htd/IteratorBase.hpp>
 #include <htd/Iterator.hpp>
@@ -223,12 +231,14 @@
 #include <htd/PriorityQueue.hpp>
 #include <htd/RandomOrderingAlgorithm.hpp>
 #include <htd/RandomVertexSelectionStrategy.hpp>
+#include <htd/ResidualNetwork.hpp>
 #include <htd/SemiNormalizationOperation.hpp>
 #include <htd/SeparatorBasedTreeDecompositionAlgorithm.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
 #include <htd/SetCoverAlgorithm.hpp>
 #include <htd/SingleNeighborVertexSelectionStrategy.hpp>
 #include <htd/State.hpp>
+#include <htd/StaticGraph.hpp>
 #include <htd/StronglyConnectedComponentAlgorithmFactory.hpp>
 #include <htd/TarjanStronglyConnectedComponentAlgorithm.hpp>
 #include <htd/TreeDecompositionAlgorithmFactory.hpp>
@@ -245,6 +255,7 @@
 #include <htd/Vertex.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/WeakNormalizationOperation.hpp>
+#include <htd/WidthFitnessFunction.hpp>
 #include <htd/WidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/WidthReductionOperation.hpp>
 
@@ -0,0 +1,67 @@
+/*
+ * File:   BinaryTdFormatExporter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTDFORMATEXPORTER_HPP
+#define HTD_IO_BINARYTDFORMATEXPORTER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd_io/ITreeDecompositionExporter.hpp>
+
+#include <iostream>
+
+namespace htd_io
+{
+    /**
+     *  Exporter which allows to export tree decompositions in the compact binary tree decomposition format 'btd'.
+     *
+     *  The format carries the same information as the format 'td' and uses the same node numbering. All fixed-size
+     *  numbers are unsigned 64-bit integers in little-endian byte order, all other numbers are encoded as unsigned
+     *  LEB128 varints. A file consists of the following sections:
+     *
+     *  - A header of 40 bytes: The magic string "HTDBTD", a zero byte and the format version 1, followed by the number
+     *    of nodes N, the maximum bag size, the number of vertices of the input graph and the number of tree edges M.
+     *  - A table of N + 1 fixed-size offsets. Entry i - 1 is the position of the content of bag i relative to the start
+     *    of the bag section and entry N is the size of the bag section.
+     *  - The bag section. Each bag is stored as its size, followed by its smallest vertex and the differences between
+     *    consecutive vertices in ascending order.
+     *  - The edge section consisting of M pairs of node indices.
+     *
+     *  The offset table allows to access bags directly when the output is memory-mapped (see htd_io::BinaryTdFormatReader).
+     */
+    class BinaryTdFormatExporter : public htd_io::ITreeDecompositionExporter
+    {
+        public:
+            HTD_IO_API BinaryTdFormatExporter(void);
+
+            HTD_IO_API virtual ~BinaryTdFormatExporter();
+
+            HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const override;
+
+            HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const override;
+    };
+}
+
+#endif /* HTD_IO_BINARYTDFORMATEXPORTER_HPP */
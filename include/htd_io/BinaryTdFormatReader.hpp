@@ -0,0 +1,168 @@
+/*
+ * File:   BinaryTdFormatReader.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTDFORMATREADER_HPP
+#define HTD_IO_BINARYTDFORMATREADER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace htd_io
+{
+    /**
+     *  Read-only view of a tree decomposition stored in the binary format 'btd' (see htd_io::BinaryTdFormatExporter).
+     *
+     *  The reader does not copy the data, so it can be used directly on memory-mapped files (e.g. via htd_io::InputBuffer).
+     *  Individual bags are decoded on demand using the offset table of the format.
+     */
+    class BinaryTdFormatReader
+    {
+        public:
+            /**
+             *  Constructor for a new reader.
+             *
+             *  @param[in] begin    The first byte of the data in the format 'btd'.
+             *  @param[in] end      The position one past the last byte of the data.
+             */
+            HTD_IO_API BinaryTdFormatReader(const char * begin, const char * end);
+
+            /**
+             *  Destructor of a reader.
+             */
+            HTD_IO_API virtual ~BinaryTdFormatReader();
+
+            /**
+             *  Check whether the header and the offset table of the data are well-formed.
+             *
+             *  @return True if the header and the offset table of the data are well-formed, false otherwise.
+             */
+            HTD_IO_API bool good(void) const;
+
+            /**
+             *  Getter for the number of nodes of the stored decomposition.
+             *
+             *  @return The number of nodes of the stored decomposition or 0 if the data is malformed.
+             */
+            HTD_IO_API std::size_t nodeCount(void) const;
+
+            /**
+             *  Getter for the maximum bag size of the stored decomposition.
+             *
+             *  @return The maximum bag size of the stored decomposition or 0 if the data is malformed.
+             */
+            HTD_IO_API std::size_t maximumBagSize(void) const;
+
+            /**
+             *  Getter for the number of vertices of the graph from which the stored decomposition was constructed.
+             *
+             *  @return The number of vertices of the graph from which the stored decomposition was constructed or 0 if the data is malformed.
+             */
+            HTD_IO_API std::size_t vertexCount(void) const;
+
+            /**
+             *  Getter for the number of edges of the stored decomposition.
+             *
+             *  @return The number of edges of the stored decomposition or 0 if the data is malformed.
+             */
+            HTD_IO_API std::size_t edgeCount(void) const;
+
+            /**
+             *  Decode the bag content of a node.
+             *
+             *  @param[in] node     The index of the node, starting with 1.
+             *  @param[out] target  The vector to which the vertices of the bag, in ascending order, shall be written. The vector is cleared before.
+             *
+             *  @return True if the bag was decoded successfully, false if the node index is invalid or the bag is malformed.
+             */
+            HTD_IO_API bool bagContent(std::size_t node, std::vector<htd::vertex_t> & target) const;
+
+            /**
+             *  Decode the edges of the stored decomposition.
+             *
+             *  @param[out] target  The vector to which the edges, given as pairs of node indices, shall be written. The vector is cleared before.
+             *
+             *  @return True if the edges were decoded successfully, false if the edge section is malformed.
+             */
+            HTD_IO_API bool edges(std::vector<std::pair<std::size_t, std::size_t>> & target) const;
+
+        private:
+            /**
+             *  The first byte of the data.
+             */
+            const unsigned char * data_;
+
+            /**
+             *  The size of the data in bytes.
+             */
+            std::size_t size_;
+
+            /**
+             *  A boolean flag indicating whether the header and the offset table of the data are well-formed.
+             */
+            bool good_;
+
+            /**
+             *  The number of nodes of the stored decomposition.
+             */
+            std::size_t nodeCount_;
+
+            /**
+             *  The maximum bag size of the stored decomposition.
+             */
+            std::size_t maximumBagSize_;
+
+            /**
+             *  The number of vertices of the graph from which the stored decomposition was constructed.
+             */
+            std::size_t vertexCount_;
+
+            /**
+             *  The number of edges of the stored decomposition.
+             */
+            std::size_t edgeCount_;
+
+            /**
+             *  The position of the bag section relative to the start of the data.
+             */
+            std::size_t bagSectionOffset_;
+
+            /**
+             *  Read a fixed-size number from the data.
+             *
+             *  @param[in] position The position of the number relative to the start of the data.
+             *
+             *  @return The number stored at the given position.
+             */
+            std::uint64_t readFixed64(std::size_t position) const;
+    };
+}
+
+#endif /* HTD_IO_BINARYTDFORMATREADER_HPP */
@@ -0,0 +1,296 @@
+/*
+ * File:   InputBuffer.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_INPUTBUFFER_HPP
+#define HTD_IO_INPUTBUFFER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Read-only, contiguous view of the complete content of a file or an input stream.
+     *
+     *  Regular files are memory-mapped where the platform supports it, so that no copy of the file content is created.
+     *  Other files and input streams are read into a single buffer in one pass.
+     */
+    class InputBuffer
+    {
+        public:
+            /**
+             *  Constructor for an input buffer providing the content of the given file.
+             *
+             *  @param[in] path The path to the file which shall be read.
+             */
+            HTD_IO_API InputBuffer(const std::string & path);
+
+            /**
+             *  Constructor for an input buffer providing the remaining content of the given input stream.
+             *
+             *  @param[in] stream   The input stream which shall be read.
+             */
+            HTD_IO_API InputBuffer(std::istream & stream);
+
+            /**
+             *  Destructor of an input buffer.
+             */
+            HTD_IO_API virtual ~InputBuffer();
+
+            /**
+             *  Check whether the input could be read successfully.
+             *
+             *  @return True if the input could be read successfully, false otherwise.
+             */
+            HTD_IO_API bool good(void) const;
+
+            /**
+             *  Getter for the first character of the input.
+             *
+             *  @return A pointer to the first character of the input.
+             */
+            HTD_IO_API const char * begin(void) const;
+
+            /**
+             *  Getter for the position one past the last character of the input.
+             *
+             *  @return A pointer to the position one past the last character of the input.
+             */
+            HTD_IO_API const char * end(void) const;
+
+            /**
+             *  Getter for the size of the input in bytes.
+             *
+             *  @return The size of the input in bytes.
+             */
+            HTD_IO_API std::size_t size(void) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+
+    /**
+     *  Lightweight cursor over a range of characters which offers the primitives needed to tokenize line-based input formats.
+     */
+    class InputCursor
+    {
+        public:
+            /**
+             *  Constructor for a new input cursor.
+             *
+             *  @param[in] begin    The first character of the range.
+             *  @param[in] end      The position one past the last character of the range.
+             */
+            InputCursor(const char * begin, const char * end) : position_(begin), end_(end)
+            {
+
+            }
+
+            /**
+             *  Check whether the cursor reached the end of the range.
+             *
+             *  @return True if the cursor reached the end of the range, false otherwise.
+             */
+            bool atEnd(void) const
+            {
+                return position_ == end_;
+            }
+
+            /**
+             *  Getter for the current position of the cursor.
+             *
+             *  @return The current position of the cursor.
+             */
+            const char * position(void) const
+            {
+                return position_;
+            }
+
+            /**
+             *  Getter for the character at the current position of the cursor.
+             *
+             *  @return The character at the current position of the cursor or '\\0' if the cursor reached the end of the range.
+             */
+            char peek(void) const
+            {
+                return position_ != end_ ? *position_ : '\0';
+            }
+
+            /**
+             *  Move the cursor past the given character if it is the character at the current position.
+             *
+             *  @param[in] character    The expected character.
+             *
+             *  @return True if the cursor was moved, false otherwise.
+             */
+            bool consume(char character)
+            {
+                bool ret = position_ != end_ && *position_ == character;
+
+                if (ret)
+                {
+                    ++position_;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Move the cursor past the given literal if the characters at the current position match it.
+             *
+             *  @param[in] literal  The expected, null-terminated literal.
+             *
+             *  @return True if the cursor was moved, false otherwise.
+             */
+            bool consume(const char * literal)
+            {
+                std::size_t length = std::strlen(literal);
+
+                bool ret = static_cast<std::size_t>(end_ - position_) >= length && std::memcmp(position_, literal, length) == 0;
+
+                if (ret)
+                {
+                    position_ += length;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Parse a non-empty sequence of decimal digits and move the cursor past it.
+             *
+             *  @param[out] value   The parsed value. The value is only modified if the parsing succeeds.
+             *
+             *  @return True if a number fitting into std::size_t was parsed, false otherwise.
+             */
+            bool parseUnsigned(std::size_t & value)
+            {
+                const char * current = position_;
+
+                std::size_t result = 0;
+
+                bool overflow = false;
+
+                while (!overflow && current != end_ && static_cast<unsigned char>(*current - '0') < 10)
+                {
+                    std::size_t digit = static_cast<std::size_t>(*current - '0');
+
+                    overflow = result > (std::numeric_limits<std::size_t>::max() - digit) / 10;
+
+                    result = result * 10 + digit;
+
+                    ++current;
+                }
+
+                bool ret = !overflow && current != position_;
+
+                if (ret)
+                {
+                    value = result;
+
+                    position_ = current;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Getter for the end of the current line, excluding the line break and an optional carriage return before it.
+             *
+             *  @return A pointer to the end of the current line.
+             */
+            const char * lineEnd(void) const
+            {
+                const char * ret = static_cast<const char *>(std::memchr(position_, '\n', static_cast<std::size_t>(end_ - position_)));
+
+                if (ret == nullptr)
+                {
+                    ret = end_;
+                }
+
+                if (ret != position_ && *(ret - 1) == '\r')
+                {
+                    --ret;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Check whether the cursor is located at the end of the current line, i.e., whether only an optional carriage
+             *  return is left before the line break or the end of the range.
+             *
+             *  @return True if the cursor is located at the end of the current line, false otherwise.
+             */
+            bool atLineEnd(void) const
+            {
+                return position_ == end_ ||
+                       *position_ == '\n' ||
+                       (*position_ == '\r' && (position_ + 1 == end_ || *(position_ + 1) == '\n'));
+            }
+
+            /**
+             *  Move the cursor to the beginning of the next line.
+             */
+            void skipLine(void)
+            {
+                const char * lineBreak = static_cast<const char *>(std::memchr(position_, '\n', static_cast<std::size_t>(end_ - position_)));
+
+                position_ = lineBreak != nullptr ? lineBreak + 1 : end_;
+            }
+
+            /**
+             *  Move the cursor to the given position.
+             *
+             *  @param[in] position The new position of the cursor. The position must be located within the range of the cursor.
+             */
+            void seek(const char * position)
+            {
+                position_ = position;
+            }
+
+        private:
+            /**
+             *  The current position of the cursor.
+             */
+            const char * position_;
+
+            /**
+             *  The position one past the last character of the range.
+             */
+            const char * end_;
+    };
+}
+
+#endif /* HTD_IO_INPUTBUFFER_HPP */
@@ -0,0 +1,266 @@
+/*
+ * File:   OutputBuffer.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_OUTPUTBUFFER_HPP
+#define HTD_IO_OUTPUTBUFFER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace htd_io
+{
+    /**
+     *  Write buffer which collects the output of an exporter and forwards it to an output stream in large blocks.
+     *
+     *  Pending output is written to the stream when the buffer is full, when flush() is called and when the buffer is
+     *  destroyed.
+     */
+    class OutputBuffer
+    {
+        public:
+            /**
+             *  Constructor for a new output buffer.
+             *
+             *  @param[in] outputStream The output stream to which the collected output shall be written.
+             *  @param[in] capacity     The number of bytes which are collected before they are written to the stream.
+             */
+            OutputBuffer(std::ostream & outputStream, std::size_t capacity = 65536) : outputStream_(outputStream), buffer_(capacity < 64 ? 64 : capacity), position_(0)
+            {
+
+            }
+
+            /**
+             *  Destructor of an output buffer.
+             */
+            ~OutputBuffer()
+            {
+                flush();
+            }
+
+            OutputBuffer(const OutputBuffer & original) = delete;
+
+            OutputBuffer & operator=(const OutputBuffer & original) = delete;
+
+            /**
+             *  Append a single character to the buffer.
+             *
+             *  @param[in] character    The character which shall be appended.
+             */
+            void append(char character)
+            {
+                reserve(1);
+
+                buffer_[position_++] = character;
+            }
+
+            /**
+             *  Append a sequence of characters to the buffer.
+             *
+             *  @param[in] data     The first character of the sequence.
+             *  @param[in] length   The length of the sequence.
+             */
+            void append(const char * data, std::size_t length)
+            {
+                if (length > buffer_.size() - position_)
+                {
+                    flush();
+
+                    if (length > buffer_.size())
+                    {
+                        outputStream_.write(data, static_cast<std::streamsize>(length));
+
+                        return;
+                    }
+                }
+
+                std::memcpy(buffer_.data() + position_, data, length);
+
+                position_ += length;
+            }
+
+            /**
+             *  Append the decimal representation of a non-negative number to the buffer.
+             *
+             *  @param[in] value    The number which shall be appended.
+             */
+            void appendDecimal(std::uint64_t value)
+            {
+                static const char digitPairs[] =
+                    "00010203040506070809"
+                    "10111213141516171819"
+                    "20212223242526272829"
+                    "30313233343536373839"
+                    "40414243444546474849"
+                    "50515253545556575859"
+                    "60616263646566676869"
+                    "70717273747576777879"
+                    "80818283848586878889"
+                    "90919293949596979899";
+
+                char digits[20];
+
+                char * start = digits + sizeof(digits);
+
+                while (value >= 100)
+                {
+                    std::size_t pair = static_cast<std::size_t>(value % 100) * 2;
+
+                    value /= 100;
+
+                    *--start = digitPairs[pair + 1];
+                    *--start = digitPairs[pair];
+                }
+
+                if (value >= 10)
+                {
+                    std::size_t pair = static_cast<std::size_t>(value) * 2;
+
+                    *--start = digitPairs[pair + 1];
+                    *--start = digitPairs[pair];
+                }
+                else
+                {
+                    *--start = static_cast<char>('0' + value);
+                }
+
+                std::size_t length = static_cast<std::size_t>(digits + sizeof(digits) - start);
+
+                reserve(length);
+
+                std::memcpy(buffer_.data() + position_, start, length);
+
+                position_ += length;
+            }
+
+            /**
+             *  Append a number in the variable-length LEB128 encoding to the buffer, i.e., seven bits per byte, starting
+             *  with the least significant bits, where the most significant bit of each byte is set if further bytes follow.
+             *
+             *  @param[in] value    The number which shall be appended.
+             */
+            void appendVarint(std::uint64_t value)
+            {
+                reserve(10);
+
+                while (value >= 0x80)
+                {
+                    buffer_[position_++] = static_cast<char>((value & 0x7F) | 0x80);
+
+                    value >>= 7;
+                }
+
+                buffer_[position_++] = static_cast<char>(value);
+            }
+
+            /**
+             *  Append a number as eight bytes in little-endian byte order to the buffer.
+             *
+             *  @param[in] value    The number which shall be appended.
+             */
+            void appendFixed64(std::uint64_t value)
+            {
+                reserve(8);
+
+                for (std::size_t index = 0; index < 8; ++index)
+                {
+                    buffer_[position_++] = static_cast<char>(value & 0xFF);
+
+                    value >>= 8;
+                }
+            }
+
+            /**
+             *  Write all pending output to the underlying output stream.
+             */
+            void flush(void)
+            {
+                if (position_ > 0)
+                {
+                    outputStream_.write(buffer_.data(), static_cast<std::streamsize>(position_));
+
+                    position_ = 0;
+                }
+            }
+
+            /**
+             *  Compute the number of bytes needed by the variable-length encoding of a number.
+             *
+             *  @param[in] value    The number in question.
+             *
+             *  @return The number of bytes needed by the variable-length encoding of the given number.
+             *
+             *  @see appendVarint(std::uint64_t)
+             */
+            static std::size_t varintSize(std::uint64_t value)
+            {
+                std::size_t ret = 1;
+
+                while (value >= 0x80)
+                {
+                    value >>= 7;
+
+                    ++ret;
+                }
+
+                return ret;
+            }
+
+        private:
+            /**
+             *  The output stream to which the collected output is written.
+             */
+            std::ostream & outputStream_;
+
+            /**
+             *  The buffer holding the pending output.
+             */
+            std::vector<char> buffer_;
+
+            /**
+             *  The number of pending bytes in the buffer.
+             */
+            std::size_t position_;
+
+            /**
+             *  Ensure that the given number of bytes can be appended without exceeding the capacity of the buffer.
+             *
+             *  @param[in] length   The number of bytes which shall be appended. The value must not exceed the capacity of the buffer.
+             */
+            void reserve(std::size_t length)
+            {
+                if (length > buffer_.size() - position_)
+                {
+                    flush();
+                }
+            }
+    };
+}
+
+#endif /* HTD_IO_OUTPUTBUFFER_HPP */
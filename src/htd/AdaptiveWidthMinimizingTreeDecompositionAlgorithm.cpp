@@ -29,9 +29,17 @@
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/Helpers.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/IterationPlanner.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdarg>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
 
 /**
  *  Private implementation details of class htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm.
@@ -44,7 +52,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), computeInducedEdges_(true), racingEnabled_(false)
     {
 
     }
@@ -54,7 +62,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), computeInducedEdges_(original.computeInducedEdges_), racingEnabled_(original.racingEnabled_)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
@@ -105,6 +113,38 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  A boolean flag indicating whether the algorithms of a decision round shall be executed concurrently.
+     */
+    bool racingEnabled_;
+
+    /**
+     *  Perform a single decision round by executing all qualified algorithms concurrently, each of them on a thread of its own.
+     *
+     *  The width of the best decomposition found so far is published to all threads as a shared upper bound, so that
+     *  width-limitable ordering algorithms abort as soon as they cannot lead to a decomposition which is at least as good
+     *  as the best one. For an aborted algorithm, the bound plus one is recorded as (lower bound of) its achieved width.
+     *
+     *  @param[in] graph                    The input graph to decompose.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format, shared read-only by all threads.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
+     *  @param[in] progressCallback         A callback function which is invoked for each new decomposition, calls are serialized.
+     *  @param[in] disqualifiedAlgorithms   The indices of the algorithms which shall not be executed.
+     *  @param[in,out] minimalWidths        The minimal widths achieved by the individual algorithms.
+     *  @param[in,out] accumulatedWidths    The accumulated widths achieved by the individual algorithms.
+     *  @param[in,out] bestDecomposition    The best decomposition found so far.
+     *  @param[in,out] bestMaxBagSize       The maximum bag size of the best decomposition found so far.
+     */
+    void raceAlgorithms(const htd::IMultiHypergraph & graph,
+                        const htd::IPreprocessedGraph & preprocessedGraph,
+                        const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                        const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                        const std::unordered_set<htd::index_t> & disqualifiedAlgorithms,
+                        std::vector<std::size_t> & minimalWidths,
+                        std::vector<std::size_t> & accumulatedWidths,
+                        htd::ITreeDecomposition * & bestDecomposition,
+                        std::size_t & bestMaxBagSize) const;
+
     /**
      *  Compute a decomposition of the given graph and apply the given manipulation operations to it.
      *
@@ -334,11 +374,18 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         }
     }
 
-    for (htd::index_t round = 0; round < implementation_->decisionRounds_ && !managementInstance.isTerminated(); ++round)
+    htd::IterationPlanner planner(implementation_->managementInstance_);
+
+    for (htd::index_t round = 0; round < implementation_->decisionRounds_ && !managementInstance.isTerminated() && (ret == nullptr || planner.allowsIteration()); ++round)
     {
+        if (implementation_->racingEnabled_)
+        {
+            implementation_->raceAlgorithms(graph, preprocessedGraph, manipulationOperations, progressCallback, disqualifiedAlgorithms, minimalWidths, accumulatedWidths, ret, bestMaxBagSize);
+        }
+
         htd::index_t algorithmIndex = 0;
 
-        for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated(); ++it)
+        for (auto it = implementation_->algorithms_.begin(); !implementation_->racingEnabled_ && it != implementation_->algorithms_.end() && !managementInstance.isTerminated() && (ret == nullptr || !managementInstance.isDeadlineReached()); ++it)
         {
             if (disqualifiedAlgorithms.count(algorithmIndex) == 0)
             {
@@ -420,6 +467,8 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                 }
             }
         }
+
+        planner.recordIterations(1);
     }
 
     std::size_t optimum = (std::size_t)-1;
@@ -588,6 +637,31 @@ void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::addManipulationOper
     }
 }
 
+std::vector<htd::ILabelingFunction *> htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    /* The global manipulation operations are assigned to each base algorithm, so the labeling functions are released once per label name. */
+    std::unordered_set<std::string> labelNames;
+
+    for (htd::ITreeDecompositionAlgorithm * algorithm : implementation_->algorithms_)
+    {
+        for (htd::ILabelingFunction * labelingFunction : algorithm->releaseLabelingFunctions())
+        {
+            if (labelNames.insert(labelingFunction->name()).second)
+            {
+                ret.push_back(labelingFunction);
+            }
+            else
+            {
+                delete labelingFunction;
+            }
+        }
+    }
+
+    return ret;
+}
+
 bool htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return true;
@@ -650,11 +724,135 @@ void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setDecisionRounds(s
     implementation_->decisionRounds_ = rounds;
 }
 
+bool htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::isRacingEnabled(void) const
+{
+    return implementation_->racingEnabled_;
+}
+
+void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setRacingEnabled(bool racingEnabled)
+{
+    implementation_->racingEnabled_ = racingEnabled;
+}
+
 htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::clone(void) const
 {
     return new htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(*this);
 }
 
+void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation::raceAlgorithms(const htd::IMultiHypergraph & graph,
+                                                                                             const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                             const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                                                             const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                                                             const std::unordered_set<htd::index_t> & disqualifiedAlgorithms,
+                                                                                             std::vector<std::size_t> & minimalWidths,
+                                                                                             std::vector<std::size_t> & accumulatedWidths,
+                                                                                             htd::ITreeDecomposition * & bestDecomposition,
+                                                                                             std::size_t & bestMaxBagSize) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    std::atomic<std::size_t> sharedBound(bestMaxBagSize);
+
+    unsigned int baseSeed = static_cast<unsigned int>(htd::randomNumber());
+
+    std::mutex resultMutex;
+
+    std::vector<std::thread> workers;
+
+    for (htd::index_t algorithmIndex = 0; algorithmIndex < algorithms_.size(); ++algorithmIndex)
+    {
+        if (disqualifiedAlgorithms.count(algorithmIndex) == 0)
+        {
+            std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
+
+            for (const htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+            {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                clonedManipulationOperations.push_back(operation->clone());
+#else
+                clonedManipulationOperations.push_back(operation->cloneDecompositionManipulationOperation());
+#endif
+            }
+
+            workers.emplace_back([&, algorithmIndex, clonedManipulationOperations]()
+            {
+                const htd::ITreeDecompositionAlgorithm & algorithm = *(algorithms_[algorithmIndex]);
+
+                htd::seedThreadLocalRandomNumberGenerator(baseSeed + static_cast<unsigned int>(algorithmIndex));
+
+                htd::ITreeDecomposition * currentDecomposition = nullptr;
+
+                const htd::BucketEliminationTreeDecompositionAlgorithm * bucketEliminationAlgorithm = dynamic_cast<const htd::BucketEliminationTreeDecompositionAlgorithm *>(&algorithm);
+
+                if (bucketEliminationAlgorithm != nullptr)
+                {
+                    currentDecomposition = bucketEliminationAlgorithm->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, (std::size_t)-1, 1, sharedBound).first;
+                }
+                else
+                {
+                    currentDecomposition = algorithm.computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations);
+                }
+
+                htd::resetThreadLocalRandomNumberGenerator();
+
+                std::lock_guard<std::mutex> lock(resultMutex);
+
+                if (currentDecomposition != nullptr)
+                {
+                    if (!managementInstance.isTerminated() || algorithm.isSafelyInterruptible())
+                    {
+                        std::size_t currentMaxBagSize = currentDecomposition->maximumBagSize();
+
+                        accumulatedWidths[algorithmIndex] += currentMaxBagSize;
+
+                        if (currentMaxBagSize < minimalWidths[algorithmIndex])
+                        {
+                            minimalWidths[algorithmIndex] = currentMaxBagSize;
+                        }
+
+                        if (currentMaxBagSize < bestMaxBagSize)
+                        {
+                            progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentMaxBagSize))));
+
+                            delete bestDecomposition;
+
+                            bestDecomposition = currentDecomposition;
+
+                            bestMaxBagSize = currentMaxBagSize;
+
+                            sharedBound.store(currentMaxBagSize);
+                        }
+                        else
+                        {
+                            delete currentDecomposition;
+                        }
+                    }
+                    else
+                    {
+                        delete currentDecomposition;
+                    }
+                }
+                else if (!managementInstance.isTerminated() && sharedBound.load() != (std::size_t)-1)
+                {
+                    std::size_t estimatedMaxBagSize = sharedBound.load() + 1;
+
+                    accumulatedWidths[algorithmIndex] += estimatedMaxBagSize;
+
+                    if (estimatedMaxBagSize < minimalWidths[algorithmIndex])
+                    {
+                        minimalWidths[algorithmIndex] = estimatedMaxBagSize;
+                    }
+                }
+            });
+        }
+    }
+
+    for (std::thread & worker : workers)
+    {
+        worker.join();
+    }
+}
+
 htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation::computeImprovedDecomposition(const htd::ITreeDecompositionAlgorithm & algorithm,
                                                                                                                                const htd::IMultiHypergraph & graph,
                                                                                                                                const htd::IPreprocessedGraph & preprocessedGraph,
@@ -669,7 +867,9 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t nonImprovementCount = 0;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    htd::IterationPlanner planner(managementInstance_);
+
+    while (remainingIterations > 0 && !managementInstance_->isTerminated() && planner.allowsIteration())
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -737,6 +937,8 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         {
             --remainingIterations;
         }
+
+        planner.recordIterations(1);
     }
 
     for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
@@ -759,7 +961,9 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t remainingIterations = iterationCount_;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    htd::IterationPlanner planner(managementInstance_);
+
+    while (remainingIterations > 0 && !managementInstance_->isTerminated() && planner.allowsIteration())
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -772,7 +976,13 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 #endif
         }
 
-        std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult = algorithm.computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, bestMaxBagSize - 1, std::min(remainingIterations, nonImprovementLimit_));
+        std::size_t iterationLimit = std::min(remainingIterations, nonImprovementLimit_);
+
+        iterationLimit = std::min(iterationLimit, std::max(planner.plannedIterationCount(iterationLimit), (std::size_t)1));
+
+        std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult = algorithm.computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, bestMaxBagSize - 1, iterationLimit);
+
+        planner.recordIterations(decompositionResult.second);
 
         htd::ITreeDecomposition * currentDecomposition = decompositionResult.first;
 
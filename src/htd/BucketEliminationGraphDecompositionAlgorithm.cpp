@@ -28,14 +28,17 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
+#include <htd/EliminationWidthEvaluator.hpp>
 #include <htd/ILabelingFunction.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
 #include <htd/GraphDecompositionFactory.hpp>
+#include <htd/IContiguousMultiHypergraph.hpp>
 #include <htd/IWidthLimitableOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdarg>
 #include <functional>
 #include <memory>
@@ -123,10 +126,11 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
      *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition.
      *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
+     *  @param[in] sharedMaxBagSize     The upper bound for the maximum bag size which may be tightened concurrently by other threads.
      *
      *  @return A pair consisting of a mutable graph decompostion of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
      */
-    std::pair<htd::IMutableGraphDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+    std::pair<htd::IMutableGraphDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const;
 
     /**
      *  Get the vertex which is ranked first in the vertex elimination ordering.
@@ -386,7 +390,14 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
 
 std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const
 {
-    std::pair<htd::IMutableGraphDecomposition *, std::size_t> ret = implementation_->computeMutableDecomposition(graph, preprocessedGraph, maxBagSize, maxIterationCount);
+    std::atomic<std::size_t> sharedMaxBagSize((std::size_t)-1);
+
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations, maxBagSize, maxIterationCount, sharedMaxBagSize);
+}
+
+std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const
+{
+    std::pair<htd::IMutableGraphDecomposition *, std::size_t> ret = implementation_->computeMutableDecomposition(graph, preprocessedGraph, maxBagSize, maxIterationCount, sharedMaxBagSize);
 
     htd::IMutableGraphDecomposition * decomposition = ret.first;
 
@@ -572,6 +583,15 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::addManipulationOperation
     }
 }
 
+std::vector<htd::ILabelingFunction *> htd::BucketEliminationGraphDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    ret.swap(implementation_->labelingFunctions_);
+
+    return ret;
+}
+
 bool htd::BucketEliminationGraphDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return false;
@@ -643,7 +663,7 @@ htd::BucketEliminationGraphDecompositionAlgorithm * htd::BucketEliminationGraphD
     return ret;
 }
 
-std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const
+std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const
 {
     htd::IMutableGraphDecomposition * ret = nullptr;
 
@@ -651,6 +671,8 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
 
     std::size_t iterations = 0;
 
+    htd::EliminationWidthEvaluator widthEvaluator;
+
     if (widthLimitableAlgorithm == nullptr)
     {
         htd::IVertexOrdering * ordering = nullptr;
@@ -661,7 +683,8 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
 
             if (ordering != nullptr)
             {
-                if (ordering->sequence().size() == graph.vertexCount())
+                /* Only materialize the decomposition if the ordering satisfies the width limit. */
+                if (ordering->sequence().size() == graph.vertexCount() && (maxBagSize == (std::size_t)-1 || widthEvaluator.maximumBagSize(graph, *ordering) <= maxBagSize))
                 {
                     ret = computeMutableDecomposition(graph, ordering->sequence());
 
@@ -684,11 +707,12 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
     }
     else
     {
-        htd::IWidthLimitedVertexOrdering * ordering = widthLimitableAlgorithm->computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount);
+        htd::IWidthLimitedVertexOrdering * ordering = widthLimitableAlgorithm->computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount, sharedMaxBagSize);
 
         if (ordering != nullptr)
         {
-            if (ordering->sequence().size() == graph.vertexCount())
+            /* Orderings exceeding the width limit are usually truncated, but the last elimination may still exceed it. */
+            if (ordering->sequence().size() == graph.vertexCount() && (maxBagSize == (std::size_t)-1 || widthEvaluator.maximumBagSize(graph, ordering->sequence()) <= maxBagSize))
             {
                 ret = computeMutableDecomposition(graph, ordering->sequence());
             }
@@ -741,13 +765,27 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             std::size_t edgeCount = graph.edgeCount();
 
-            const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
+            /* Graphs with contiguous hyperedge storage are iterated directly to avoid the overhead of htd::ConstCollection. */
+            const htd::IContiguousMultiHypergraph * contiguousGraph = dynamic_cast<const htd::IContiguousMultiHypergraph *>(&graph);
+
+            htd::ConstSpan<htd::Hyperedge> hyperedgeSpan;
+
+            htd::ConstCollection<htd::Hyperedge> hyperedges;
+
+            if (contiguousGraph != nullptr)
+            {
+                hyperedgeSpan = contiguousGraph->hyperedgeSpan();
+            }
+            else
+            {
+                hyperedges = graph.hyperedges();
+            }
 
             auto hyperedgePosition = hyperedges.begin();
 
             for (htd::index_t index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
             {
-                const std::vector<htd::vertex_t> & elements = hyperedgePosition->sortedElements();
+                const std::vector<htd::vertex_t> & elements = contiguousGraph != nullptr ? hyperedgeSpan[index].sortedElements() : hyperedgePosition->sortedElements();
 
                 switch (elements.size())
                 {
@@ -813,7 +851,10 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
                     }
                 }
 
-                ++hyperedgePosition;
+                if (contiguousGraph == nullptr)
+                {
+                    ++hyperedgePosition;
+                }
             }
 
             for (auto it = ordering.begin(); it != ordering.end() && !managementInstance.isTerminated(); ++it)
@@ -889,7 +930,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
                 for (index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
                 {
-                    const std::vector<htd::vertex_t> & edgeElements = hyperedgePosition->sortedElements();
+                    const std::vector<htd::vertex_t> & edgeElements = contiguousGraph != nullptr ? hyperedgeSpan[index].sortedElements() : hyperedgePosition->sortedElements();
 
                     if (edgeElements.size() == 2)
                     {
@@ -900,7 +941,10 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
                         distributeEdge(index, edgeElements, edgeTarget[index], buckets, neighbors, inducedEdges, lastAssignedEdge, originStack);
                     }
 
-                    ++hyperedgePosition;
+                    if (contiguousGraph == nullptr)
+                    {
+                        ++hyperedgePosition;
+                    }
                 }
             }
 
@@ -42,6 +42,7 @@
 #include <htd/IGraphPreprocessor.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdarg>
 #include <memory>
 #include <unordered_map>
@@ -131,10 +132,11 @@ struct htd::BucketEliminationTreeDecompositionAlgorithm::Implementation
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
      *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition.
      *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
+     *  @param[in] sharedMaxBagSize     The upper bound for the maximum bag size which may be tightened concurrently by other threads.
      *
      *  @return A pair consisting of a mutable tree decompostion of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
      */
-    std::pair<htd::IMutableTreeDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+    std::pair<htd::IMutableTreeDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const;
 };
 
 htd::BucketEliminationTreeDecompositionAlgorithm::BucketEliminationTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -204,7 +206,14 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
 
 std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const
 {
-    std::pair<htd::IMutableTreeDecomposition *, std::size_t> ret = implementation_->computeMutableDecomposition(graph, preprocessedGraph, maxBagSize, maxIterationCount);
+    std::atomic<std::size_t> sharedMaxBagSize((std::size_t)-1);
+
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations, maxBagSize, maxIterationCount, sharedMaxBagSize);
+}
+
+std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const
+{
+    std::pair<htd::IMutableTreeDecomposition *, std::size_t> ret = implementation_->computeMutableDecomposition(graph, preprocessedGraph, maxBagSize, maxIterationCount, sharedMaxBagSize);
 
     htd::IMutableTreeDecomposition * decomposition = ret.first;
 
@@ -374,6 +383,15 @@ void htd::BucketEliminationTreeDecompositionAlgorithm::addManipulationOperations
     }
 }
 
+std::vector<htd::ILabelingFunction *> htd::BucketEliminationTreeDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    ret.swap(implementation_->labelingFunctions_);
+
+    return ret;
+}
+
 bool htd::BucketEliminationTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return false;
@@ -391,6 +409,11 @@ void htd::BucketEliminationTreeDecompositionAlgorithm::setManagementInstance(con
     implementation_->managementInstance_ = manager;
 }
 
+bool htd::BucketEliminationTreeDecompositionAlgorithm::hasPostProcessingOperations(void) const
+{
+    return !implementation_->postProcessingOperations_.empty();
+}
+
 bool htd::BucketEliminationTreeDecompositionAlgorithm::isCompressionEnabled(void) const
 {
     return implementation_->baseAlgorithm_->isCompressionEnabled();
@@ -416,7 +439,7 @@ htd::BucketEliminationTreeDecompositionAlgorithm * htd::BucketEliminationTreeDec
     return new htd::BucketEliminationTreeDecompositionAlgorithm(*this);
 }
 
-std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const
+std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const
 {
     htd::IMutableTreeDecomposition * ret = managementInstance_->treeDecompositionFactory().createInstance();
 
@@ -424,7 +447,7 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
     if (graph.vertexCount() > 0)
     {
-        std::pair<htd::IGraphDecomposition *, std::size_t> graphDecomposition = baseAlgorithm_->computeDecomposition(graph, preprocessedGraph, maxBagSize, maxIterationCount);
+        std::pair<htd::IGraphDecomposition *, std::size_t> graphDecomposition = baseAlgorithm_->computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>(), maxBagSize, maxIterationCount, sharedMaxBagSize);
 
         if (graphDecomposition.first != nullptr)
         {
@@ -453,13 +476,9 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
                             const std::vector<htd::vertex_t> & component1 = components[index];
                             const std::vector<htd::vertex_t> & component2 = components[index + 1];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex1 = component1[std::rand() % component1.size()];
+                            htd::vertex_t vertex1 = component1[htd::randomNumber() % component1.size()];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex2 = component2[std::rand() % component2.size()];
+                            htd::vertex_t vertex2 = component2[htd::randomNumber() % component2.size()];
 
                             mutableGraphDecomposition.addEdge(vertex1, vertex2);
                         }
@@ -472,9 +491,7 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
                 htd::BreadthFirstGraphTraversal graphTraversal(managementInstance_);
 
-                /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                // coverity[dont_call]
-                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(std::rand() % graphDecomposition.first->vertexCount()), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
+                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(htd::randomNumber() % graphDecomposition.first->vertexCount()), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
                 {
                     HTD_UNUSED(distanceFromStartingVertex)
 
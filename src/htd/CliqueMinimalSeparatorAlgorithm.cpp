@@ -22,20 +22,16 @@
  * along with htd.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+
 #ifndef HTD_HTD_CLIQUEMINIMALSEPARATORALGORITHM_CPP
 #define HTD_HTD_CLIQUEMINIMALSEPARATORALGORITHM_CPP
 
 #include <htd/Helpers.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
-
-#include <htd/MultiGraphFactory.hpp>
-#include <htd/VectorAdapter.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 
 #include <algorithm>
-#include <numeric>
-#include <stack>
-#include <unordered_map>
-#include <unordered_set>
+#include <iterator>
 
 /**
  *  Private implementation details of class htd::CliqueMinimalSeparatorAlgorithm.
@@ -63,715 +59,321 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Internal data structure representing a triangulated graph.
+     *  Check whether the given set of vertices forms a clique.
+     *
+     *  @param[in] neighborhood The neighborhood relation of the graph.
+     *  @param[in] vertices     The set of vertices, sorted in ascending order.
+     *
+     *  @return True if the given set of vertices forms a clique, false otherwise.
      */
-    class TriangulatedGraph : public htd::IGraphStructure
+    bool isComplete(const std::vector<std::vector<htd::vertex_t>> & neighborhood, const std::vector<htd::vertex_t> & vertices) const
     {
-        public:
-            /**
-             *  Constructor for a triangulated graph.
-             *
-             *  @param[in] graph    The graph which shall be triangulated.
-             */
-            TriangulatedGraph(const htd::IGraphStructure & graph) : names_(), internalNames_(), vertices_(graph.vertexCount()), neighborhood_(graph.vertexCount()), edgeCount_()
-            {
-                initialize(graph);
-
-                std::iota(vertices_.begin(), vertices_.end(), 0);
-            }
+        bool ret = true;
 
-            /**
-             *  Copy constructor for a triangulated graph.
-             *
-             *  @param[in] original The original triangulated graph.
-             */
-            TriangulatedGraph(const TriangulatedGraph & original) : names_(original.names_), internalNames_(original.internalNames_), vertices_(original.vertices_), neighborhood_(original.neighborhood_), edgeCount_(original.edgeCount_)
-            {
+        for (auto it = vertices.begin(); ret && it != vertices.end(); ++it)
+        {
+            const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[*it];
 
-            }
+            ret = htd::set_intersection_size(currentNeighborhood.begin(), currentNeighborhood.end(), vertices.begin(), vertices.end()) >= vertices.size() - 1;
+        }
 
-            /**
-             *  Destructor for a triangulated graph.
-             */
-            virtual ~TriangulatedGraph()
-            {
+        return ret;
+    }
 
-            }
+    /**
+     *  Decompose the given graph along its clique minimal separators.
+     *
+     *  The decomposition is based on a minimal elimination ordering computed by algorithm MCS-M. The vertices are scanned
+     *  in elimination order and each generator of the ordering whose higher neighborhood in the minimal triangulation forms
+     *  a clique in the graph splits off the connected component of the remainder of the graph containing it (together with
+     *  the clique) as a new atom.
+     *
+     *  @param[in] graph        The graph which shall be decomposed.
+     *  @param[out] atoms       The atoms of the graph in the order in which they were split off.
+     *  @param[out] separators  The clique separator which split off each of the atoms.
+     */
+    void decompose(const htd::IGraphStructure & graph,
+                   std::vector<std::vector<htd::vertex_t>> & atoms,
+                   std::vector<std::vector<htd::vertex_t>> & separators) const;
+};
 
-            std::size_t vertexCount(void) const noexcept override
-            {
-                return neighborhood_.size();
-            }
+void htd::CliqueMinimalSeparatorAlgorithm::Implementation::decompose(const htd::IGraphStructure & graph,
+                                                                     std::vector<std::vector<htd::vertex_t>> & atoms,
+                                                                     std::vector<std::vector<htd::vertex_t>> & separators) const
+{
+    std::size_t size = graph.vertexCount();
 
-            std::size_t edgeCount(void) const noexcept override
-            {
-                return edgeCount_;
-            }
+    if (size == 0)
+    {
+        return;
+    }
 
-            std::size_t edgeCount(htd::vertex_t vertex) const override
-            {
-                return neighborCount(vertex);
-            }
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
 
-            htd::ConstCollection<htd::vertex_t> vertices(void) const override
-            {
-                return htd::ConstCollection<htd::vertex_t>::getInstance(vertices_);
-            }
+    std::vector<htd::vertex_t> names;
 
-            void copyVerticesTo(std::vector<htd::vertex_t> & target) const override
-            {
-                target.insert(target.end(), vertices_.begin(), vertices_.end());
-            }
+    names.reserve(size);
 
-            htd::vertex_t vertexAtPosition(htd::index_t index) const override
-            {
-                HTD_ASSERT(index < vertices_.size())
+    graph.copyVerticesTo(names);
 
-                return vertices_[index];
-            }
+    std::sort(names.begin(), names.end());
 
-            bool isVertex(htd::vertex_t vertex) const override
-            {
-                return vertex < vertexCount();
-            }
+    /* Identifiers which do not belong to a vertex of the graph are mapped to the invalid index 'size'. */
+    std::vector<htd::vertex_t> internalNames(names.back() + 1, static_cast<htd::vertex_t>(size));
 
-            std::size_t isolatedVertexCount(void) const override
-            {
-                std::size_t ret = 0;
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        internalNames[names[index]] = static_cast<htd::vertex_t>(index);
+    }
 
-                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
-                {
-                    if (currentNeighborhood.empty())
-                    {
-                        ret++;
-                    }
-                }
+    std::vector<std::vector<htd::vertex_t>> neighborhood(size);
 
-                return ret;
-            }
+    std::vector<htd::vertex_t> neighbors;
 
-            htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const override
-            {
-                htd::VectorAdapter<htd::vertex_t> ret;
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
-                auto & result = ret.container();
+        neighbors.clear();
 
-                for (htd::vertex_t vertex : vertices_)
-                {
-                    if (neighborhood_[vertex].empty())
-                    {
-                        result.push_back(vertex);
-                    }
-                }
+        graph.copyNeighborsTo(names[vertex], neighbors);
 
-                return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
+        for (htd::vertex_t neighbor : neighbors)
+        {
+            if (neighbor < internalNames.size() && internalNames[neighbor] < size && internalNames[neighbor] != vertex)
+            {
+                currentNeighborhood.push_back(internalNames[neighbor]);
             }
+        }
 
-            htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const override
-            {
-                const htd::ConstCollection<htd::vertex_t> & isolatedVertexCollection = isolatedVertices();
+        std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
 
-                HTD_ASSERT(index < isolatedVertexCollection.size())
+        currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+    }
 
-                htd::ConstIterator<htd::vertex_t> it = isolatedVertexCollection.begin();
+    /* Phase 1: Compute a minimal elimination ordering by algorithm MCS-M. */
+    std::vector<std::size_t> labels(size, 0);
 
-                std::advance(it, index);
+    std::vector<bool> numbered(size, false);
 
-                return *it;
-            }
+    std::vector<bool> generators(size, false);
 
-            bool isIsolatedVertex(htd::vertex_t vertex) const override
-            {
-                HTD_ASSERT(isVertex(vertex))
+    std::vector<std::vector<htd::vertex_t>> higherNeighbors(size);
 
-                return neighborhood_[vertex].empty();
-            }
+    std::vector<std::size_t> lastVisit(size, (std::size_t)-1);
 
-            std::size_t neighborCount(htd::vertex_t vertex) const override
-            {
-                HTD_ASSERT(isVertex(vertex))
+    std::vector<std::vector<htd::vertex_t>> reachable(size + 1);
 
-                return neighborhood_[vertex].size();
-            }
+    std::vector<htd::vertex_t> reachedVertices;
 
-            htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const override
-            {
-                HTD_ASSERT(isVertex(vertex))
+    std::vector<htd::vertex_t> ordering;
 
-                return htd::ConstCollection<htd::vertex_t>::getInstance(neighborhood_[vertex]);
-            }
+    ordering.reserve(size);
 
-            void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const override
-            {
-                HTD_ASSERT(isVertex(vertex))
+    /* The vertex with the largest label forms the top of the queue, hence the priority of a vertex is size - label. */
+    htd::BucketPriorityQueue priorityQueue(size, size + 1);
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        priorityQueue.push(vertex, size);
+    }
 
-                target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
-            }
+    std::size_t maximumLabel = 0;
 
-            htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const override
-            {
-                HTD_ASSERT(isVertex(vertex))
+    std::size_t lastLabel = 0;
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+    for (htd::index_t step = 0; step < size && !managementInstance.isTerminated(); ++step)
+    {
+        htd::vertex_t selectedVertex = priorityQueue.selectRandomTopElement();
 
-                HTD_ASSERT(index < currentNeighborhood.size())
+        priorityQueue.erase(selectedVertex);
 
-                return currentNeighborhood[index];
-            }
+        numbered[selectedVertex] = true;
 
-            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const override
-            {
-                HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
+        if (step > 0 && labels[selectedVertex] <= lastLabel)
+        {
+            generators[selectedVertex] = true;
+        }
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+        lastLabel = labels[selectedVertex];
 
-                return std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), neighbor);
-            }
+        ordering.push_back(selectedVertex);
 
-            bool isConnected(void) const override
+        reachedVertices.clear();
+
+        for (htd::vertex_t neighbor : neighborhood[selectedVertex])
+        {
+            if (!numbered[neighbor])
             {
-                bool ret = true;
+                lastVisit[neighbor] = step;
 
-                if (!vertices_.empty())
-                {
-                    std::stack<htd::vertex_t> originStack;
+                reachedVertices.push_back(neighbor);
 
-                    std::unordered_set<htd::vertex_t> visitedVertices;
+                reachable[labels[neighbor]].push_back(neighbor);
+            }
+        }
+
+        /* Vertices reachable via paths whose inner vertices all have a smaller label are reached as well. */
+        for (std::size_t label = 0; label <= maximumLabel; ++label)
+        {
+            std::vector<htd::vertex_t> & currentlyReachableVertices = reachable[label];
 
-                    htd::vertex_t currentVertex = vertices_[0];
+            while (!currentlyReachableVertices.empty())
+            {
+                htd::vertex_t reachableVertex = currentlyReachableVertices.back();
 
-                    originStack.push(currentVertex);
+                currentlyReachableVertices.pop_back();
 
-                    while (!originStack.empty())
+                for (htd::vertex_t neighbor : neighborhood[reachableVertex])
+                {
+                    if (!numbered[neighbor] && lastVisit[neighbor] != step)
                     {
-                        currentVertex = originStack.top();
+                        lastVisit[neighbor] = step;
 
-                        if (visitedVertices.count(currentVertex) == 0)
+                        if (labels[neighbor] > label)
                         {
-                            visitedVertices.insert(currentVertex);
-
-                            originStack.pop();
+                            reachedVertices.push_back(neighbor);
 
-                            for (htd::vertex_t neighbor : neighborhood_[currentVertex])
-                            {
-                                if (visitedVertices.count(neighbor) == 0)
-                                {
-                                    originStack.push(neighbor);
-                                }
-                            }
+                            reachable[labels[neighbor]].push_back(neighbor);
                         }
                         else
                         {
-                            originStack.pop();
+                            currentlyReachableVertices.push_back(neighbor);
                         }
                     }
-
-                    ret = visitedVertices.size() == vertices_.size();
-                }
-                else
-                {
-                    ret = true;
                 }
-
-                return ret;
             }
+        }
 
-            bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const override
-            {
-                HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
-
-                bool ret = false;
-
-                if (vertex1 == vertex2)
-                {
-                    ret = true;
-                }
-                else
-                {
-                    std::vector<htd::vertex_t> newVertices;
-                    std::vector<htd::vertex_t> tmpVertices;
-
-                    std::vector<bool> reachableVertices(vertices_.size());
-
-                    reachableVertices[vertex1] = true;
-
-                    newVertices.push_back(vertex1);
-
-                    while (!ret && !newVertices.empty())
-                    {
-                        std::swap(tmpVertices, newVertices);
+        for (htd::vertex_t vertex : reachedVertices)
+        {
+            std::size_t label = ++labels[vertex];
 
-                        newVertices.resize(0);
+            if (label > maximumLabel)
+            {
+                maximumLabel = label;
+            }
 
-                        for (auto it = tmpVertices.begin(); !ret && it != tmpVertices.end(); it++)
-                        {
-                            const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[*it];
+            priorityQueue.updatePriority(vertex, size - label);
 
-                            for (auto it2 = currentNeighborhood.begin(); !ret && it2 != currentNeighborhood.end(); ++it2)
-                            {
-                                htd::vertex_t neighbor = *it2;
+            higherNeighbors[vertex].push_back(selectedVertex);
+        }
+    }
 
-                                if (!reachableVertices[neighbor])
-                                {
-                                    reachableVertices[neighbor] = true;
+    if (managementInstance.isTerminated())
+    {
+        return;
+    }
 
-                                    newVertices.push_back(neighbor);
+    /* Phase 2: Split off the atoms in elimination order, i.e., in reverse order of the MCS-M numbering. */
+    std::reverse(ordering.begin(), ordering.end());
 
-                                    if (neighbor == vertex2)
-                                    {
-                                        ret = true;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+    std::vector<bool> removed(size, false);
 
-                return ret;
-            }
+    std::vector<bool> separatorMember(size, false);
 
-            /**
-             *  Getter for the actual identifiers of the vertices.
-             *
-             *  @return The actual identifiers of the vertices.
-             */
-            const std::vector<htd::vertex_t> & vertexNames(void) const noexcept
-            {
-                return names_;
-            }
+    std::size_t remainingVertexCount = size;
 
-            /**
-             *  Getter for the actual identifier of the given vertex.
-             *
-             *  @param[in] vertex   The internal name of the vertex whose position shall be returned.
-             *
-             *  @return The actual identifier of the given vertex.
-             */
-            htd::vertex_t vertexName(htd::vertex_t vertex) const
-            {
-                HTD_ASSERT(vertex < names_.size());
+    std::vector<htd::vertex_t> component;
 
-                return names_[vertex];
-            }
+    std::vector<htd::vertex_t> originStack;
 
-            /**
-             *  Getter for the internal identifier of the given vertex.
-             *
-             *  @param[in] vertex   The name of the vertex whose internal identifier shall be returned.
-             *
-             *  @return The internal identifier of the given vertex.
-             */
-            htd::vertex_t internalVertexName(htd::vertex_t vertex) const
-            {
-                return internalNames_.at(vertex);
-            }
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> & separator = higherNeighbors[vertex];
 
-            /**
-             *  Updatable getter for the vector containing the preprocessed neighborhood of each of the vertices.
-             *
-             *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
-             *
-             *  @return The updatable vector containing the preprocessed neighborhood of each of the vertices.
-             */
-            std::vector<std::vector<htd::vertex_t>> & neighborhood(void) noexcept
-            {
-                return neighborhood_;
-            }
+        std::sort(separator.begin(), separator.end());
 
-            /**
-             *  Getter for the vector containing the preprocessed neighborhood of each of the vertices.
-             *
-             *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
-             *
-             *  @return The vector containing the preprocessed neighborhood of each of the vertices.
-             */
-            const std::vector<std::vector<htd::vertex_t>> & neighborhood(void) const noexcept
+        if (generators[vertex] && !removed[vertex] && isComplete(neighborhood, separator))
+        {
+            for (htd::vertex_t separatorVertex : separator)
             {
-                return neighborhood_;
+                separatorMember[separatorVertex] = true;
             }
 
-            /**
-             *  Updatable getter for the vector containing the preprocessed neighborhood of a vertex.
-             *
-             *  @note The neighborhood returned by this data structure does not include the vertex itself.
-             *
-             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
-             *
-             *  @return The updatable vector containing the preprocessed neighborhood of the requested vertex.
-             */
-            std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex)
-            {
-                HTD_ASSERT(vertex < names_.size());
+            component.clear();
 
-                return neighborhood_[vertex];
-            }
+            originStack.push_back(vertex);
 
-            /**
-             *  Getter for the vector containing the preprocessed neighborhood of a vertex.
-             *
-             *  @note The neighborhood returned by this data structure does not include the vertex itself.
-             *
-             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
-             *
-             *  @return The vector containing the preprocessed neighborhood of the requested vertex.
-             */
-            const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const
-            {
-                HTD_ASSERT(vertex < names_.size());
+            removed[vertex] = true;
 
-                return neighborhood_[vertex];
-            }
-
-            /**
-             *  Remove a vertex from the graph.
-             *
-             *  @param[in] vertex   The ID of the vertex which shall be removed.
-             */
-            void removeVertex(htd::vertex_t vertex)
+            while (!originStack.empty())
             {
-                HTD_ASSERT(vertex < names_.size());
+                htd::vertex_t currentVertex = originStack.back();
 
-                std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood_[vertex];
+                originStack.pop_back();
 
-                edgeCount_ -= selectedNeighborhood.size();
+                component.push_back(currentVertex);
 
-                for (htd::vertex_t neighbor : selectedNeighborhood)
+                for (htd::vertex_t neighbor : neighborhood[currentVertex])
                 {
-                    std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[neighbor];
+                    if (!removed[neighbor] && !separatorMember[neighbor])
+                    {
+                        removed[neighbor] = true;
 
-                    /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'currentNeighborhood'. */
-                    // coverity[use_iterator]
-                    currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex));
+                        originStack.push_back(neighbor);
+                    }
                 }
-
-                std::vector<htd::vertex_t>().swap(selectedNeighborhood);
             }
 
-            /**
-             *  Add a new edge to the graph.
-             *
-             *  @param[in] vertex1  The first endpoint of the edge.
-             *  @param[in] vertex2  The second endpoint of the edge.
-             */
-            void addTriangulationEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
+            for (htd::vertex_t separatorVertex : separator)
             {
-                HTD_ASSERT(vertex1 != vertex2)
-                HTD_ASSERT(vertex1 < names_.size() && vertex2 < names_.size());
-
-                std::vector<htd::vertex_t> & neighborhood1 = neighborhood_[vertex1];
-
-                auto position = std::lower_bound(neighborhood1.begin(), neighborhood1.end(), vertex2);
-
-                if (position == neighborhood1.end() || *position != vertex2)
-                {
-                    neighborhood1.insert(position, vertex2);
-
-                    std::vector<htd::vertex_t> & neighborhood2 = neighborhood_[vertex2];
-
-                    neighborhood2.insert(std::lower_bound(neighborhood2.begin(), neighborhood2.end(), vertex1), vertex1);
-                }
-
-                ++edgeCount_;
+                separatorMember[separatorVertex] = false;
             }
 
-            /**
-             *  Recompute the number of edges in the graph to update the result of the function edgeCount().
-             */
-            void updateEdgeCount(void)
+            if (component.size() + separator.size() < remainingVertexCount)
             {
-                edgeCount_ = 0;
+                remainingVertexCount -= component.size();
 
-                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
-                {
-                    edgeCount_ += currentNeighborhood.size();
-                }
+                std::vector<htd::vertex_t> atom;
 
-                edgeCount_ = edgeCount_ >> 1;
-            }
+                atom.reserve(component.size() + separator.size());
 
-#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-            /**
-             *  Create a deep copy of the current graph structure.
-             *
-             *  @return A new TriangulatedGraph object identical to the current graph structure.
-             */
-            TriangulatedGraph * clone(void) const
-            {
-                return new TriangulatedGraph(*this);
-            }
+                std::sort(component.begin(), component.end());
 
-            htd::IGraphStructure * cloneGraphStructure(void) const override
-            {
-                return clone();
-            }
-#else
-            TriangulatedGraph * clone(void) const override
-            {
-                return new TriangulatedGraph(*this);
-            }
-#endif
-
-        private:
-            /**
-             *  The actual identifiers of the vertices.
-             */
-            std::vector<htd::vertex_t> names_;
-
-            /**
-             *  A map which maps to each vertex its internal counterpart.
-             */
-            std::unordered_map<htd::vertex_t, htd::vertex_t> internalNames_;
-
-            /**
-             *  The vertices of the triangulated graph.
-             */
-            std::vector<htd::vertex_t> vertices_;
-
-            /**
-             *  A vector containing the neighborhood of each of the vertices.
-             */
-            std::vector<std::vector<htd::vertex_t>> neighborhood_;
-
-            /**
-             *  The number of edges in the triangulated graph.
-             */
-            std::size_t edgeCount_;
-
-            /**
-             *  Register a given vertex and return its index.
-             *
-             *  @param[in] vertex   The vertex which shall be registered.
-             *
-             *  @return The index of the vertex within the (updated) vector vertexNames.
-             */
-            htd::vertex_t registerVertex(htd::vertex_t vertex)
-            {
-                auto result = internalNames_.emplace(vertex, names_.size());
+                std::merge(component.begin(), component.end(), separator.begin(), separator.end(), std::back_inserter(atom));
 
-                if (result.second)
+                for (htd::vertex_t & atomVertex : atom)
                 {
-                    names_.push_back(vertex);
+                    atomVertex = names[atomVertex];
                 }
 
-                return result.first->second;
-            }
+                atoms.emplace_back(std::move(atom));
 
-            /**
-             *  Inititialize the data structure.
-             *
-             *  @param[in] graph    The input graph.
-             */
-            void initialize(const htd::IGraphStructure & graph)
-            {
-                std::size_t size = graph.vertexCount();
+                separators.emplace_back();
 
-                if (size > 0)
+                for (htd::vertex_t separatorVertex : separator)
                 {
-                    names_.reserve(size);
-
-                    if (graph.vertexAtPosition(size - 1) == static_cast<htd::vertex_t>(size))
-                    {
-                        for (htd::index_t index = 0; index < size; ++index)
-                        {
-                            htd::vertex_t vertex = static_cast<htd::vertex_t>(index) + 1;
-
-                            htd::vertex_t mappedVertex = static_cast<htd::vertex_t>(index);
-
-                            names_.push_back(vertex);
-
-                            internalNames_[vertex] = mappedVertex;
-
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
-
-                            graph.copyNeighborsTo(vertex, currentNeighborhood);
-
-                            auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
-
-                            if (position != currentNeighborhood.end() && *position == mappedVertex)
-                            {
-                                currentNeighborhood.erase(position);
-                            }
-
-                            std::for_each(currentNeighborhood.begin(), currentNeighborhood.end(), [](htd::vertex_t & neighbor){ --neighbor; });
-                        }
-                    }
-                    else if (graph.vertexAtPosition(size - 1) == static_cast<htd::vertex_t>(size - 1))
-                    {
-                        for (htd::index_t index = 0; index < size; ++index)
-                        {
-                            htd::vertex_t vertex = static_cast<htd::vertex_t>(index);
-
-                            names_.push_back(vertex);
-
-                            internalNames_[vertex] = vertex;
-
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
-
-                            graph.copyNeighborsTo(vertex, currentNeighborhood);
-
-                            auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
-
-                            if (position != currentNeighborhood.end() && *position == vertex)
-                            {
-                                currentNeighborhood.erase(position);
-                            }
-                        }
-                    }
-                    else
-                    {
-                        const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
-
-                        auto position = vertexCollection.begin();
-
-                        for (std::size_t remainder = vertexCollection.size(); remainder > 0; --remainder)
-                        {
-                            htd::vertex_t vertex = *position;
-
-                            htd::vertex_t mappedVertex = registerVertex(vertex);
-
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
-
-                            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
-
-                            auto position2 = neighborCollection.begin();
-
-                            currentNeighborhood.reserve(neighborCollection.size() + 1);
-
-                            for (std::size_t remainder2 = neighborCollection.size(); remainder2 > 0; --remainder2)
-                            {
-                                currentNeighborhood.push_back(registerVertex(*position2));
-
-                                ++position2;
-                            }
-
-                            std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
-
-                            auto position3 = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), mappedVertex);
-
-                            if (position3 != currentNeighborhood.end() && *position3 == mappedVertex)
-                            {
-                                currentNeighborhood.erase(position3);
-                            }
-
-                            ++position;
-                        }
-                    }
+                    separators.back().push_back(names[separatorVertex]);
                 }
-
-                updateEdgeCount();
             }
-    };
-
-    /**
-     *  Fill the pool of vertices having maximum weight.
-     *
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[out] pool    The vertex pool which shall be filled with all vertices of maximum weight.
-     */
-    void fillMaxCardinalityPool(const std::unordered_set<htd::vertex_t> & vertices, const std::vector<std::size_t> & weights, std::vector<htd::vertex_t> & pool) const noexcept
-    {
-        std::size_t max = 0;
-
-        pool.clear();
-
-        for (htd::vertex_t vertex : vertices)
-        {
-            std::size_t tmp = weights[vertex];
-
-            if (tmp >= max)
+            else
             {
-                if (tmp > max)
+                /* The separator does not split the remainder of the graph. */
+                for (htd::vertex_t componentVertex : component)
                 {
-                    max = tmp;
-
-                    pool.clear();
+                    removed[componentVertex] = false;
                 }
-
-                pool.push_back(vertex);
             }
         }
     }
 
-    /**
-     *  Check whether the given set of vertices forms a clique.
-     *
-     *  @param[in] graph    The graph.
-     *  @param[in] vertices The set of vertices.
-     *
-     *  @return True if the given set of vertices forms a clique, false otherwise.
-     */
-    bool isComplete(const TriangulatedGraph & graph, const std::vector<htd::vertex_t> & vertices) const
-    {
-        bool ret = true;
+    std::vector<htd::vertex_t> lastAtom;
 
-        for (auto it = vertices.begin(); ret && it != vertices.end(); ++it)
-        {
-            const std::vector<htd::vertex_t> & currentNeighborhood = graph.neighborhood(*it);
-
-            ret = htd::set_intersection_size(currentNeighborhood.begin(), currentNeighborhood.end(), vertices.begin(), vertices.end()) >= vertices.size() - 1;
-        }
+    lastAtom.reserve(remainingVertexCount);
 
-        return ret;
-    }
-
-    /**
-     *  Determine the connected component of the graph separated by the provided separator which contains the given vertex.
-     *
-     *  @param[in] graph        The graph.
-     *  @param[in] separator    A set of vertices separating the given graph.
-     *  @param[in] vertex       The vertex.
-     *
-     *  @return The connected component of the graph separated by the provided separator which contains the given vertex.
-     */
-    std::vector<htd::vertex_t> * determineComponent(const TriangulatedGraph & graph, const std::vector<htd::vertex_t> & separator, htd::vertex_t vertex)
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
     {
-        HTD_ASSERT(graph.isVertex(vertex))
-
-        std::vector<htd::vertex_t> * ret =
-            new std::vector<htd::vertex_t>();
-
-        std::stack<htd::vertex_t> originStack;
-
-        std::unordered_set<htd::vertex_t> visitedVertices(separator.begin(), separator.end());
-
-        htd::vertex_t currentVertex = vertex;
-
-        originStack.push(currentVertex);
-
-        while (!originStack.empty() && !managementInstance_->isTerminated())
+        if (!removed[vertex])
         {
-            currentVertex = originStack.top();
-
-            if (visitedVertices.count(currentVertex) == 0)
-            {
-                ret->push_back(currentVertex);
-
-                visitedVertices.insert(currentVertex);
-
-                originStack.pop();
-
-                for (htd::vertex_t neighbor : graph.neighborhood(currentVertex))
-                {
-                    if (visitedVertices.count(neighbor) == 0)
-                    {
-                        originStack.push(neighbor);
-                    }
-                }
-            }
-            else
-            {
-                originStack.pop();
-            }
+            lastAtom.push_back(names[vertex]);
         }
+    }
 
-        std::sort(ret->begin(), ret->end());
+    atoms.emplace_back(std::move(lastAtom));
 
-        return ret;
-    }
-};
+    separators.emplace_back();
+}
 
 htd::CliqueMinimalSeparatorAlgorithm::CliqueMinimalSeparatorAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
 {
@@ -785,179 +387,40 @@ htd::CliqueMinimalSeparatorAlgorithm::~CliqueMinimalSeparatorAlgorithm(void)
 
 std::vector<htd::vertex_t> * htd::CliqueMinimalSeparatorAlgorithm::computeSeparator(const htd::IGraphStructure & graph) const
 {
-    std::size_t size = graph.vertexCount();
-
     std::vector<htd::vertex_t> * ret = new std::vector<htd::vertex_t>();
 
-    if (size > 0)
-    {
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph referenceGraph(graph);
-
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph eliminationGraph(referenceGraph);
-
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph triangulatedGraph(referenceGraph);
-
-        std::unordered_set<htd::vertex_t> vertices(size);
-
-        htd::fillSet(eliminationGraph.vertices(), vertices);
-
-        std::vector<htd::vertex_t> pool;
-
-        std::vector<std::size_t> labels(graph.vertexCount());
-
-        std::unordered_set<htd::vertex_t> reached;
-
-        std::unordered_map<std::size_t, std::vector<htd::vertex_t>> reachable;
-
-        std::vector<htd::vertex_t> generators;
-
-        const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
-
-        std::vector<htd::vertex_t> ordering;
-        ordering.reserve(graph.vertexCount());
-
-        std::size_t lastLabel = (std::size_t)-1;
-
-        for (htd::index_t index = 0; index < size; ++index)
-        {
-            labels[index] = 0;
-        }
-
-        while (size > 0 && !managementInstance.isTerminated())
-        {
-            implementation_->fillMaxCardinalityPool(vertices, labels, pool);
-
-            htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool);
-
-            const std::vector<htd::vertex_t> & selectedNeighborhood = eliminationGraph.neighborhood(selectedVertex);
-
-            if (lastLabel != (std::size_t)-1 && labels[selectedVertex] <= lastLabel)
-            {
-                htd::insertSorted(generators, selectedVertex);
-            }
-
-            lastLabel = labels[selectedVertex];
-
-            std::vector<htd::vertex_t> triangulationNeighbors(eliminationGraph.neighborhood(selectedVertex));
-
-            ordering.push_back(selectedVertex);
-
-            vertices.erase(selectedVertex);
-
-            pool.clear();
-
-            --size;
-
-            reached.insert(selectedVertex);
-
-            for (htd::index_t index = 0; index <= size; ++index)
-            {
-                reachable[index].clear();
-            }
-
-            for (htd::vertex_t neighbor : selectedNeighborhood)
-            {
-                reached.insert(neighbor);
-
-                reachable[labels[neighbor]].push_back(neighbor);
-            }
-
-            for (htd::index_t index = 0; index <= size; ++index)
-            {
-                std::vector<htd::vertex_t> & currentlyReachableVertices = reachable[index];
-
-                while (!currentlyReachableVertices.empty())
-                {
-                    htd::vertex_t reachableVertex = htd::selectRandomElement<htd::vertex_t>(currentlyReachableVertices);
-
-                    currentlyReachableVertices.erase(std::lower_bound(currentlyReachableVertices.begin(),
-                                                                      currentlyReachableVertices.end(),
-                                                                      reachableVertex));
-
-                    for (htd::vertex_t neighbor : eliminationGraph.neighborhood(reachableVertex))
-                    {
-                        if (reached.count(neighbor) == 0)
-                        {
-                            reached.insert(neighbor);
-
-                            if (labels[neighbor] > index)
-                            {
-                                triangulationNeighbors.push_back(neighbor);
-
-                                htd::insertSorted(reachable[labels[neighbor]], neighbor);
-                            }
-                            else
-                            {
-                                htd::insertSorted(currentlyReachableVertices, neighbor);
-                            }
-                        }
-                    }
-                }
-            }
-
-            for (htd::vertex_t neighbor : triangulationNeighbors)
-            {
-                triangulatedGraph.addTriangulationEdge(selectedVertex, neighbor);
-
-                labels[neighbor]++;
-            }
-
-            eliminationGraph.removeVertex(selectedVertex);
-
-            reached.clear();
-        }
-
-        std::reverse(ordering.begin(), ordering.end());
-
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph referenceGraph2(referenceGraph);
-
-        std::vector<std::vector<htd::vertex_t>> cliqueSeparators;
-
-        for (htd::vertex_t vertex : ordering)
-        {
-            if (std::binary_search(generators.begin(), generators.end(), vertex))
-            {
-                const std::vector<htd::vertex_t> & currentNeighborhood = triangulatedGraph.neighborhood(vertex);
+    std::vector<std::vector<htd::vertex_t>> atoms;
 
-                if (!currentNeighborhood.empty())
-                {
-                    if (implementation_->isComplete(referenceGraph, currentNeighborhood))
-                    {
-                        std::vector<htd::vertex_t> * component = implementation_->determineComponent(referenceGraph2, currentNeighborhood, vertex);
+    std::vector<std::vector<htd::vertex_t>> cliqueSeparators;
 
-                        for (htd::vertex_t componentVertex : *component)
-                        {
-                            referenceGraph2.removeVertex(componentVertex);
-                        }
-
-                        cliqueSeparators.push_back(currentNeighborhood);
-
-                        delete component;
-                    }
-                }
-            }
+    implementation_->decompose(graph, atoms, cliqueSeparators);
 
-            triangulatedGraph.removeVertex(vertex);
-        }
+    cliqueSeparators.erase(std::remove_if(cliqueSeparators.begin(), cliqueSeparators.end(), [](const std::vector<htd::vertex_t> & separator)
+    {
+        return separator.empty();
+    }), cliqueSeparators.end());
 
-        std::sort(cliqueSeparators.begin(), cliqueSeparators.end());
+    std::sort(cliqueSeparators.begin(), cliqueSeparators.end());
 
-        cliqueSeparators.erase(std::unique(cliqueSeparators.begin(), cliqueSeparators.end()), cliqueSeparators.end());
+    cliqueSeparators.erase(std::unique(cliqueSeparators.begin(), cliqueSeparators.end()), cliqueSeparators.end());
 
-        if (!cliqueSeparators.empty())
-        {
-            const std::vector<htd::vertex_t> & separator = htd::selectRandomElement<std::vector<htd::vertex_t>>(cliqueSeparators);
+    if (!cliqueSeparators.empty())
+    {
+        const std::vector<htd::vertex_t> & separator = htd::selectRandomElement<std::vector<htd::vertex_t>>(cliqueSeparators);
 
-            for (htd::vertex_t vertex : separator)
-            {
-                ret->push_back(referenceGraph.vertexName(vertex));
-            }
-        }
+        ret->insert(ret->end(), separator.begin(), separator.end());
     }
 
     return ret;
 }
 
+void htd::CliqueMinimalSeparatorAlgorithm::computeAtoms(const htd::IGraphStructure & graph,
+                                                         std::vector<std::vector<htd::vertex_t>> & atoms,
+                                                         std::vector<std::vector<htd::vertex_t>> & separators) const
+{
+    implementation_->decompose(graph, atoms, separators);
+}
+
 const htd::LibraryInstance * htd::CliqueMinimalSeparatorAlgorithm::managementInstance(void) const noexcept
 {
     return implementation_->managementInstance_;
@@ -32,6 +32,8 @@
 #include <htd/IGraphPreprocessor.hpp>
 
 #include <cstdarg>
+#include <string>
+#include <unordered_set>
 
 /**
  *  Private implementation details of class htd::CombinedWidthMinimizingTreeDecompositionAlgorithm.
@@ -419,6 +421,31 @@ void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::addManipulationOper
     }
 }
 
+std::vector<htd::ILabelingFunction *> htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    /* The global manipulation operations are assigned to each base algorithm, so the labeling functions are released once per label name. */
+    std::unordered_set<std::string> labelNames;
+
+    for (htd::ITreeDecompositionAlgorithm * algorithm : implementation_->algorithms_)
+    {
+        for (htd::ILabelingFunction * labelingFunction : algorithm->releaseLabelingFunctions())
+        {
+            if (labelNames.insert(labelingFunction->name()).second)
+            {
+                ret.push_back(labelingFunction);
+            }
+            else
+            {
+                delete labelingFunction;
+            }
+        }
+    }
+
+    return ret;
+}
+
 bool htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return true;
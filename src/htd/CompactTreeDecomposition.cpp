@@ -0,0 +1,491 @@
+/* 
+ * File:   CompactTreeDecomposition.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_COMPACTTREEDECOMPOSITION_CPP
+#define HTD_HTD_COMPACTTREEDECOMPOSITION_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/CompactTreeDecomposition.hpp>
+
+#include <utility>
+
+htd::CompactTreeDecomposition::CompactTreeDecomposition(const htd::LibraryInstance * const manager) : htd::TreeDecomposition::TreeDecomposition(manager), bagContent_(), inducedEdges_()
+{
+
+}
+
+htd::CompactTreeDecomposition::CompactTreeDecomposition(const htd::CompactTreeDecomposition & original) : htd::TreeDecomposition::TreeDecomposition(original.managementInstance()), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_)
+{
+    htd::LabeledTree::operator=(original);
+
+    invalidateStatistics(true);
+}
+
+htd::CompactTreeDecomposition::CompactTreeDecomposition(const htd::ITree & original) : htd::TreeDecomposition::TreeDecomposition(original.managementInstance()), bagContent_(), inducedEdges_()
+{
+    htd::LabeledTree::operator=(original);
+
+    resetSlots(original);
+
+    invalidateStatistics(true);
+}
+
+htd::CompactTreeDecomposition::CompactTreeDecomposition(const htd::ILabeledTree & original) : htd::TreeDecomposition::TreeDecomposition(original.managementInstance()), bagContent_(), inducedEdges_()
+{
+    htd::LabeledTree::operator=(original);
+
+    resetSlots(original);
+
+    invalidateStatistics(true);
+}
+
+htd::CompactTreeDecomposition::CompactTreeDecomposition(const htd::ITreeDecomposition & original) : htd::TreeDecomposition::TreeDecomposition(original.managementInstance()), bagContent_(), inducedEdges_()
+{
+    htd::LabeledTree::operator=(original);
+
+    copySlots(original);
+
+    invalidateStatistics(true);
+}
+
+htd::CompactTreeDecomposition::~CompactTreeDecomposition()
+{
+
+}
+
+void htd::CompactTreeDecomposition::removeVertex(htd::vertex_t vertex)
+{
+    htd::Tree::removeVertex(vertex);
+
+    clearSlot(vertex);
+
+    invalidateStatistics(true);
+}
+
+void htd::CompactTreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
+{
+    /* htd::Tree::removeSubtree removes the nodes one by one via removeVertex, which releases their slots. */
+    htd::Tree::removeSubtree(subtreeRoot);
+}
+
+htd::vertex_t htd::CompactTreeDecomposition::insertRoot(void)
+{
+    bool inserted = vertexCount() == 0;
+
+    htd::vertex_t ret = htd::Tree::insertRoot();
+
+    if (inserted)
+    {
+        prepareSlot(ret);
+
+        registerNewNode(0);
+    }
+
+    return ret;
+}
+
+htd::vertex_t htd::CompactTreeDecomposition::insertRoot(const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedEdges)
+{
+    bool inserted = vertexCount() == 0;
+
+    htd::vertex_t ret = htd::Tree::insertRoot();
+
+    if (inserted)
+    {
+        htd::index_t index = prepareSlot(ret);
+
+        bagContent_[index] = bagContent;
+
+        inducedEdges_[index] = inducedEdges;
+
+        registerNewNode(bagContent_[index].size());
+    }
+
+    return ret;
+}
+
+htd::vertex_t htd::CompactTreeDecomposition::insertRoot(std::vector<htd::vertex_t> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges)
+{
+    bool inserted = vertexCount() == 0;
+
+    htd::vertex_t ret = htd::Tree::insertRoot();
+
+    if (inserted)
+    {
+        htd::index_t index = prepareSlot(ret);
+
+        bagContent_[index] = std::move(bagContent);
+
+        inducedEdges_[index] = std::move(inducedEdges);
+
+        registerNewNode(bagContent_[index].size());
+    }
+
+    return ret;
+}
+
+htd::vertex_t htd::CompactTreeDecomposition::addChild(htd::vertex_t vertex)
+{
+    htd::vertex_t ret = htd::Tree::addChild(vertex);
+
+    prepareSlot(ret);
+
+    registerNewNode(0);
+
+    return ret;
+}
+
+htd::vertex_t htd::CompactTreeDecomposition::addChild(htd::vertex_t vertex, const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedEdges)
+{
+    htd::vertex_t ret = htd::Tree::addChild(vertex);
+
+    htd::index_t index = prepareSlot(ret);
+
+    bagContent_[index] = bagContent;
+
+    inducedEdges_[index] = inducedEdges;
+
+    registerNewNode(bagContent_[index].size());
+
+    return ret;
+}
+
+htd::vertex_t htd::CompactTreeDecomposition::addChild(htd::vertex_t vertex, std::vector<htd::vertex_t> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges)
+{
+    htd::vertex_t ret = htd::Tree::addChild(vertex);
+
+    htd::index_t index = prepareSlot(ret);
+
+    bagContent_[index] = std::move(bagContent);
+
+    inducedEdges_[index] = std::move(inducedEdges);
+
+    registerNewNode(bagContent_[index].size());
+
+    return ret;
+}
+
+htd::vertex_t htd::CompactTreeDecomposition::addParent(htd::vertex_t vertex)
+{
+    htd::vertex_t ret = htd::Tree::addParent(vertex);
+
+    prepareSlot(ret);
+
+    registerNewNode(0);
+
+    return ret;
+}
+
+htd::vertex_t htd::CompactTreeDecomposition::addParent(htd::vertex_t vertex, const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedEdges)
+{
+    htd::vertex_t ret = htd::Tree::addParent(vertex);
+
+    htd::index_t index = prepareSlot(ret);
+
+    bagContent_[index] = bagContent;
+
+    inducedEdges_[index] = inducedEdges;
+
+    registerNewNode(bagContent_[index].size());
+
+    return ret;
+}
+
+htd::vertex_t htd::CompactTreeDecomposition::addParent(htd::vertex_t vertex, std::vector<htd::vertex_t> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges)
+{
+    htd::vertex_t ret = htd::Tree::addParent(vertex);
+
+    htd::index_t index = prepareSlot(ret);
+
+    bagContent_[index] = std::move(bagContent);
+
+    inducedEdges_[index] = std::move(inducedEdges);
+
+    registerNewNode(bagContent_[index].size());
+
+    return ret;
+}
+
+void htd::CompactTreeDecomposition::removeChild(htd::vertex_t vertex, htd::vertex_t child)
+{
+    htd::Tree::removeChild(vertex, child);
+
+    clearSlot(child);
+
+    invalidateStatistics(true);
+}
+
+std::size_t htd::CompactTreeDecomposition::bagSize(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return bagContent_[vertex - htd::Vertex::FIRST].size();
+}
+
+std::vector<htd::vertex_t> & htd::CompactTreeDecomposition::mutableBagContent(htd::vertex_t vertex)
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    suspendStatistics();
+
+    return bagContent_[vertex - htd::Vertex::FIRST];
+}
+
+const std::vector<htd::vertex_t> & htd::CompactTreeDecomposition::bagContent(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return bagContent_[vertex - htd::Vertex::FIRST];
+}
+
+htd::FilteredHyperedgeCollection & htd::CompactTreeDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return inducedEdges_[vertex - htd::Vertex::FIRST];
+}
+
+const htd::FilteredHyperedgeCollection & htd::CompactTreeDecomposition::inducedHyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return inducedEdges_[vertex - htd::Vertex::FIRST];
+}
+
+htd::CompactTreeDecomposition * htd::CompactTreeDecomposition::clone(void) const
+{
+    return new htd::CompactTreeDecomposition(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::ITree * htd::CompactTreeDecomposition::cloneTree(void) const
+{
+    return clone();
+}
+
+htd::IGraph * htd::CompactTreeDecomposition::cloneGraph(void) const
+{
+    return clone();
+}
+
+htd::IMultiGraph * htd::CompactTreeDecomposition::cloneMultiGraph(void) const
+{
+    return clone();
+}
+
+htd::IHypergraph * htd::CompactTreeDecomposition::cloneHypergraph(void) const
+{
+    return clone();
+}
+
+htd::IMultiHypergraph * htd::CompactTreeDecomposition::cloneMultiHypergraph(void) const
+{
+    return clone();
+}
+
+htd::ILabeledTree * htd::CompactTreeDecomposition::cloneLabeledTree(void) const
+{
+    return clone();
+}
+
+htd::ILabeledGraph * htd::CompactTreeDecomposition::cloneLabeledGraph(void) const
+{
+    return clone();
+}
+
+htd::ILabeledMultiGraph * htd::CompactTreeDecomposition::cloneLabeledMultiGraph(void) const
+{
+    return clone();
+}
+
+htd::ILabeledHypergraph * htd::CompactTreeDecomposition::cloneLabeledHypergraph(void) const
+{
+    return clone();
+}
+
+htd::ILabeledMultiHypergraph * htd::CompactTreeDecomposition::cloneLabeledMultiHypergraph(void) const
+{
+    return clone();
+}
+
+htd::ITreeDecomposition * htd::CompactTreeDecomposition::cloneTreeDecomposition(void) const
+{
+    return clone();
+}
+
+htd::IGraphDecomposition * htd::CompactTreeDecomposition::cloneGraphDecomposition(void) const
+{
+    return clone();
+}
+
+htd::IMutableTree * htd::CompactTreeDecomposition::cloneMutableTree(void) const
+{
+    return clone();
+}
+
+htd::IMutableLabeledTree * htd::CompactTreeDecomposition::cloneMutableLabeledTree(void) const
+{
+    return clone();
+}
+
+htd::IMutableTreeDecomposition * htd::CompactTreeDecomposition::cloneMutableTreeDecomposition(void) const
+{
+    return clone();
+}
+#endif
+
+htd::CompactTreeDecomposition & htd::CompactTreeDecomposition::operator=(const htd::CompactTreeDecomposition & original)
+{
+    if (this != &original)
+    {
+        htd::LabeledTree::operator=(original);
+
+        bagContent_ = original.bagContent_;
+
+        inducedEdges_ = original.inducedEdges_;
+
+        invalidateStatistics(true);
+    }
+
+    return *this;
+}
+
+htd::CompactTreeDecomposition & htd::CompactTreeDecomposition::operator=(const htd::ITree & original)
+{
+    if (this != &original)
+    {
+        htd::LabeledTree::operator=(original);
+
+        resetSlots(original);
+
+        invalidateStatistics(true);
+    }
+
+    return *this;
+}
+
+htd::CompactTreeDecomposition & htd::CompactTreeDecomposition::operator=(const htd::ILabeledTree & original)
+{
+    if (this != &original)
+    {
+        htd::LabeledTree::operator=(original);
+
+        resetSlots(original);
+
+        invalidateStatistics(true);
+    }
+
+    return *this;
+}
+
+htd::CompactTreeDecomposition & htd::CompactTreeDecomposition::operator=(const htd::ITreeDecomposition & original)
+{
+    if (this != &original)
+    {
+        htd::LabeledTree::operator=(original);
+
+        copySlots(original);
+
+        invalidateStatistics(true);
+    }
+
+    return *this;
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+void htd::CompactTreeDecomposition::assign(const htd::ITree & original)
+{
+    *this = original;
+}
+
+void htd::CompactTreeDecomposition::assign(const htd::ILabeledTree & original)
+{
+    *this = original;
+}
+
+void htd::CompactTreeDecomposition::assign(const htd::ITreeDecomposition & original)
+{
+    *this = original;
+}
+#endif
+
+htd::index_t htd::CompactTreeDecomposition::prepareSlot(htd::vertex_t vertex)
+{
+    htd::index_t ret = vertex - htd::Vertex::FIRST;
+
+    if (ret >= bagContent_.size())
+    {
+        bagContent_.resize(ret + 1);
+
+        inducedEdges_.resize(ret + 1);
+    }
+    else
+    {
+        clearSlot(vertex);
+    }
+
+    return ret;
+}
+
+void htd::CompactTreeDecomposition::clearSlot(htd::vertex_t vertex)
+{
+    htd::index_t index = vertex - htd::Vertex::FIRST;
+
+    if (index < bagContent_.size())
+    {
+        std::vector<htd::vertex_t>().swap(bagContent_[index]);
+
+        inducedEdges_[index] = htd::FilteredHyperedgeCollection();
+    }
+}
+
+void htd::CompactTreeDecomposition::copySlots(const htd::ITreeDecomposition & original)
+{
+    bagContent_.clear();
+
+    inducedEdges_.clear();
+
+    for (htd::vertex_t vertex : original.vertices())
+    {
+        htd::index_t index = prepareSlot(vertex);
+
+        bagContent_[index] = original.bagContent(vertex);
+
+        inducedEdges_[index] = original.inducedHyperedges(vertex);
+    }
+}
+
+void htd::CompactTreeDecomposition::resetSlots(const htd::ITree & original)
+{
+    bagContent_.clear();
+
+    inducedEdges_.clear();
+
+    for (htd::vertex_t vertex : original.vertices())
+    {
+        prepareSlot(vertex);
+    }
+}
+
+#endif /* HTD_HTD_COMPACTTREEDECOMPOSITION_CPP */
@@ -0,0 +1,939 @@
+/* 
+ * File:   ConnectedComponentTreeDecompositionAlgorithm.cpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_CPP
+#define HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_CPP
+
+#include <htd/ConnectedComponentTreeDecompositionAlgorithm.hpp>
+
+#include <htd/ConnectedComponentAlgorithmFactory.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/IConnectedComponentAlgorithm.hpp>
+#include <htd/ILabelingFunction.hpp>
+#include <htd/ITreeDecompositionManipulationOperation.hpp>
+#include <htd/MultiHypergraphFactory.hpp>
+#include <htd/PreOrderTreeTraversal.hpp>
+#include <htd/PreprocessedGraph.hpp>
+#include <htd/TreeDecompositionFactory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
+
+/**
+ *  Private implementation details of class htd::ConnectedComponentTreeDecompositionAlgorithm.
+ */
+struct htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager      The management instance to which the current object instance belongs.
+     *  @param[in] algorithm    The decomposition algorithm which shall be applied to each connected component.
+     */
+    Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm)
+        : managementInstance_(manager), threadCount_(1), algorithm_(algorithm), baseLabelingFunctions_(), labelingFunctions_(), postProcessingOperations_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        delete algorithm_;
+
+        for (auto & labelingFunction : baseLabelingFunctions_)
+        {
+            delete labelingFunction;
+        }
+
+        for (auto & labelingFunction : labelingFunctions_)
+        {
+            delete labelingFunction;
+        }
+
+        for (auto & postProcessingOperation : postProcessingOperations_)
+        {
+            delete postProcessingOperation;
+        }
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of worker threads which shall decompose connected components concurrently.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The decomposition algorithm which shall be applied to each connected component.
+     */
+    htd::ITreeDecompositionAlgorithm * algorithm_;
+
+    /**
+     *  The labeling functions released by the base algorithm. They are applied to the joined decomposition, i.e. based on the
+     *  vertices of the input graph, before the manipulation operations of this algorithm.
+     */
+    std::vector<htd::ILabelingFunction *> baseLabelingFunctions_;
+
+    /**
+     *  The labeling functions which are applied after the decompositions of the components were joined.
+     */
+    std::vector<htd::ILabelingFunction *> labelingFunctions_;
+
+    /**
+     *  The manipuation operations which are applied after the decompositions of the components were joined.
+     */
+    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations_;
+
+    /**
+     *  Compute a new mutable tree decompostion of the given graph.
+     *
+     *  @param[in] graph                The graph which shall be decomposed.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format or nullptr if it is not available.
+     *
+     *  @return A mutable tree decompostion of the given graph or nullptr if the base algorithm failed or the algorithm was terminated.
+     */
+    htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph * preprocessedGraph) const;
+
+    /**
+     *  Decompose the given connected components separately and join the resulting decompositions.
+     *
+     *  @param[in] graph                The graph which shall be decomposed.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format or nullptr if it is not available.
+     *  @param[in] components           The connected components of the graph.
+     *
+     *  @return A mutable tree decompostion of the given graph or nullptr if the base algorithm failed or the algorithm was terminated.
+     */
+    htd::IMutableTreeDecomposition * computeJoinedDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph * preprocessedGraph, const std::vector<std::vector<htd::vertex_t>> & components) const;
+
+    /**
+     *  Split a preprocessed version of the input graph into preprocessed versions of the graphs of its connected components.
+     *
+     *  The vertex i (0-based) of the preprocessed graph of a component corresponds to the vertex i + 1 of the graph of the
+     *  component. The remaining vertices, their neighborhoods and the elimination sequence of the preprocessed input graph
+     *  are restricted to the component. The lower bound for the treewidth of the input graph is retained, because no
+     *  decomposition of the input graph can be narrower than it anyway.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] sortedComponents     The sorted connected components of the input graph.
+     *  @param[in] componentIndices     The index of the component of each vertex of the input graph.
+     *  @param[in] localNames           The identifier of each vertex of the input graph within the graph of its component.
+     *  @param[in] hyperedgePositions   The positions of the hyperedges of each component within the input graph.
+     *  @param[out] target              The vector which shall hold the preprocessed graphs of the components consisting of more than one vertex.
+     */
+    void splitPreprocessedGraph(const htd::IPreprocessedGraph & preprocessedGraph,
+                                const std::vector<std::vector<htd::vertex_t>> & sortedComponents,
+                                const std::vector<htd::index_t> & componentIndices,
+                                const std::vector<htd::vertex_t> & localNames,
+                                const std::vector<std::vector<htd::index_t>> & hyperedgePositions,
+                                std::vector<std::unique_ptr<htd::IPreprocessedGraph>> & target) const;
+
+    /**
+     *  Apply the global manipulation operations and labeling functions as well as the given ones to a decomposition.
+     *
+     *  @param[in] graph                    The input graph.
+     *  @param[in] decomposition            The decomposition which shall be post-processed.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied after the global ones.
+     *  @param[in] postProcessingOperations The manipulation operations which shall be applied after the global ones.
+     */
+    void postProcess(const htd::IMultiHypergraph & graph,
+                     htd::IMutableTreeDecomposition & decomposition,
+                     const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                     const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations) const;
+};
+
+htd::IMutableTreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph * preprocessedGraph) const
+{
+    std::vector<std::vector<htd::vertex_t>> components;
+
+    htd::IConnectedComponentAlgorithm * connectedComponentAlgorithm = managementInstance_->connectedComponentAlgorithmFactory().createInstance();
+
+    HTD_ASSERT(connectedComponentAlgorithm != nullptr)
+
+    connectedComponentAlgorithm->determineComponents(graph, components);
+
+    delete connectedComponentAlgorithm;
+
+    if (components.size() > 1)
+    {
+        return computeJoinedDecomposition(graph, preprocessedGraph, components);
+    }
+
+    htd::ITreeDecomposition * decomposition = preprocessedGraph != nullptr ? algorithm_->computeDecomposition(graph, *preprocessedGraph) : algorithm_->computeDecomposition(graph);
+
+    htd::IMutableTreeDecomposition * ret = dynamic_cast<htd::IMutableTreeDecomposition *>(decomposition);
+
+    if (ret == nullptr)
+    {
+        delete decomposition;
+    }
+
+    return ret;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::splitPreprocessedGraph(const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                               const std::vector<std::vector<htd::vertex_t>> & sortedComponents,
+                                                                                               const std::vector<htd::index_t> & componentIndices,
+                                                                                               const std::vector<htd::vertex_t> & localNames,
+                                                                                               const std::vector<std::vector<htd::index_t>> & hyperedgePositions,
+                                                                                               std::vector<std::unique_ptr<htd::IPreprocessedGraph>> & target) const
+{
+    std::size_t componentCount = sortedComponents.size();
+
+    const std::vector<htd::vertex_t> & vertexNames = preprocessedGraph.vertexNames();
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> neighborhoods(componentCount);
+
+    std::vector<std::vector<htd::vertex_t>> remainingVertices(componentCount);
+
+    std::vector<std::vector<htd::vertex_t>> eliminationSequences(componentCount);
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        if (sortedComponents[index].size() > 1)
+        {
+            neighborhoods[index].resize(sortedComponents[index].size());
+        }
+    }
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        htd::vertex_t vertexName = vertexNames[vertex];
+
+        htd::index_t component = componentIndices[vertexName];
+
+        if (sortedComponents[component].size() > 1)
+        {
+            htd::vertex_t localVertex = localNames[vertexName] - 1;
+
+            std::vector<htd::vertex_t> & neighborhood = neighborhoods[component][localVertex];
+
+            for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+            {
+                neighborhood.push_back(localNames[vertexNames[neighbor]] - 1);
+            }
+
+            std::sort(neighborhood.begin(), neighborhood.end());
+
+            remainingVertices[component].push_back(localVertex);
+        }
+    }
+
+    for (htd::vertex_t vertexName : preprocessedGraph.eliminationSequence())
+    {
+        htd::index_t component = componentIndices[vertexName];
+
+        if (sortedComponents[component].size() > 1)
+        {
+            eliminationSequences[component].push_back(localNames[vertexName]);
+        }
+    }
+
+    target.resize(componentCount);
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        if (sortedComponents[index].size() > 1)
+        {
+            std::vector<htd::vertex_t> componentVertexNames(sortedComponents[index].size());
+
+            std::iota(componentVertexNames.begin(), componentVertexNames.end(), 1);
+
+            std::sort(remainingVertices[index].begin(), remainingVertices[index].end());
+
+            target[index].reset(new htd::PreprocessedGraph(std::move(componentVertexNames),
+                                                           std::move(neighborhoods[index]),
+                                                           std::move(eliminationSequences[index]),
+                                                           std::move(remainingVertices[index]),
+                                                           hyperedgePositions[index].size(),
+                                                           preprocessedGraph.minTreeWidth()));
+        }
+    }
+}
+
+htd::IMutableTreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::computeJoinedDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph * preprocessedGraph, const std::vector<std::vector<htd::vertex_t>> & components) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    bool computeInducedEdges = algorithm_->isComputeInducedEdgesEnabled();
+
+    std::size_t componentCount = components.size();
+
+    htd::vertex_t maximumVertex = 0;
+
+    for (const std::vector<htd::vertex_t> & component : components)
+    {
+        maximumVertex = std::max(maximumVertex, *std::max_element(component.begin(), component.end()));
+    }
+
+    /* Vertex v of the input graph is vertex localNames[v] of component componentIndices[v]. */
+    std::vector<htd::index_t> componentIndices(maximumVertex + 1);
+
+    std::vector<htd::vertex_t> localNames(maximumVertex + 1);
+
+    std::vector<std::vector<htd::vertex_t>> sortedComponents(components);
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        std::vector<htd::vertex_t> & component = sortedComponents[index];
+
+        std::sort(component.begin(), component.end());
+
+        for (htd::index_t position = 0; position < component.size(); ++position)
+        {
+            componentIndices[component[position]] = index;
+
+            localNames[component[position]] = static_cast<htd::vertex_t>(position + 1);
+        }
+    }
+
+    std::vector<std::unique_ptr<htd::IMutableMultiHypergraph>> componentGraphs(componentCount);
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        if (sortedComponents[index].size() > 1)
+        {
+            componentGraphs[index].reset(managementInstance.multiHypergraphFactory().createInstance(sortedComponents[index].size()));
+        }
+    }
+
+    /* The positions (within the input graph) of the hyperedges of each component, ordered by their identifiers within the component. */
+    std::vector<std::vector<htd::index_t>> hyperedgePositions(componentCount);
+
+    htd::index_t position = 0;
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        const std::vector<htd::vertex_t> & elements = hyperedge.elements();
+
+        htd::index_t component = elements.empty() ? 0 : componentIndices[elements[0]];
+
+        if (componentGraphs[component])
+        {
+            std::vector<htd::vertex_t> localElements;
+
+            localElements.reserve(elements.size());
+
+            for (htd::vertex_t vertex : elements)
+            {
+                localElements.push_back(localNames[vertex]);
+            }
+
+            HTD_UNUSED(componentGraphs[component]->addEdge(std::move(localElements)))
+
+            HTD_ASSERT(hyperedgePositions[component].size() + 1 == componentGraphs[component]->edgeCount())
+        }
+
+        hyperedgePositions[component].push_back(position);
+
+        ++position;
+    }
+
+    /* Decompose the non-trivial components, the largest ones first. */
+    std::vector<htd::index_t> schedule;
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        if (componentGraphs[index])
+        {
+            schedule.push_back(index);
+        }
+    }
+
+    std::stable_sort(schedule.begin(), schedule.end(), [&](htd::index_t index1, htd::index_t index2)
+    {
+        return sortedComponents[index1].size() + hyperedgePositions[index1].size() > sortedComponents[index2].size() + hyperedgePositions[index2].size();
+    });
+
+    /* The preprocessed graphs of the non-trivial components, if a preprocessed version of the input graph is available. */
+    std::vector<std::unique_ptr<htd::IPreprocessedGraph>> componentPreprocessedGraphs;
+
+    if (preprocessedGraph != nullptr)
+    {
+        splitPreprocessedGraph(*preprocessedGraph, sortedComponents, componentIndices, localNames, hyperedgePositions, componentPreprocessedGraphs);
+    }
+
+    std::vector<std::unique_ptr<htd::ITreeDecomposition>> componentDecompositions(componentCount);
+
+    auto decomposeComponent = [&](const htd::ITreeDecompositionAlgorithm & algorithm, htd::index_t component)
+    {
+        if (preprocessedGraph != nullptr)
+        {
+            componentDecompositions[component].reset(algorithm.computeDecomposition(*(componentGraphs[component]), *(componentPreprocessedGraphs[component])));
+        }
+        else
+        {
+            componentDecompositions[component].reset(algorithm.computeDecomposition(*(componentGraphs[component])));
+        }
+    };
+
+    std::size_t threadCount = std::min(threadCount_, schedule.size());
+
+    /* Component i is always decomposed with a random number generator seeded with (s + i), so the result does not depend on the number of threads. */
+    unsigned int baseSeed = static_cast<unsigned int>(htd::randomNumber());
+
+    if (threadCount <= 1)
+    {
+        htd::ThreadLocalRandomNumberGeneratorGuard guard;
+
+        for (htd::index_t index = 0; index < schedule.size() && !managementInstance.isTerminated(); ++index)
+        {
+            htd::seedThreadLocalRandomNumberGenerator(baseSeed + static_cast<unsigned int>(schedule[index]));
+
+            decomposeComponent(*algorithm_, schedule[index]);
+        }
+    }
+    else
+    {
+        std::atomic<std::size_t> nextComponent(0);
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(threadCount);
+
+        for (htd::index_t worker = 0; worker < threadCount; ++worker)
+        {
+            workers.emplace_back([&]()
+            {
+                std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(algorithm_->clone());
+
+                for (htd::index_t index = nextComponent++; index < schedule.size() && !managementInstance.isTerminated(); index = nextComponent++)
+                {
+                    htd::index_t component = schedule[index];
+
+                    htd::seedThreadLocalRandomNumberGenerator(baseSeed + static_cast<unsigned int>(component));
+
+                    decomposeComponent(*algorithm, component);
+                }
+
+                htd::resetThreadLocalRandomNumberGenerator();
+            });
+        }
+
+        for (std::thread & worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    if (managementInstance.isTerminated())
+    {
+        return nullptr;
+    }
+
+    for (htd::index_t component : schedule)
+    {
+        if (dynamic_cast<htd::IMutableTreeDecomposition *>(componentDecompositions[component].get()) == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    /* If the base algorithm roots its decompositions at an empty bag, e.g. because it normalizes them, the components
+       consisting of a single vertex are decomposed by it as well and all decompositions are joined by empty nodes. */
+    bool emptyRoots = true;
+
+    for (htd::index_t component : schedule)
+    {
+        const htd::ITreeDecomposition & componentDecomposition = *(componentDecompositions[component]);
+
+        emptyRoots = emptyRoots && componentDecomposition.bagSize(componentDecomposition.root()) == 0;
+    }
+
+    htd::ThreadLocalRandomNumberGeneratorGuard guard;
+
+    for (htd::index_t index = 0; index < componentCount && emptyRoots && !managementInstance.isTerminated(); ++index)
+    {
+        if (!componentDecompositions[index])
+        {
+            std::unique_ptr<htd::IMutableMultiHypergraph> componentGraph(managementInstance.multiHypergraphFactory().createInstance(1));
+
+            for (htd::index_t position : hyperedgePositions[index])
+            {
+                HTD_UNUSED(componentGraph->addEdge(std::vector<htd::vertex_t>(graph.hyperedgeAtPosition(position).elements().size(), 1)))
+            }
+
+            htd::seedThreadLocalRandomNumberGenerator(baseSeed + static_cast<unsigned int>(index));
+
+            componentDecompositions[index].reset(algorithm_->computeDecomposition(*componentGraph));
+
+            if (dynamic_cast<htd::IMutableTreeDecomposition *>(componentDecompositions[index].get()) == nullptr)
+            {
+                return nullptr;
+            }
+
+            /* Without a non-trivial component, the decomposition of the first one decides whether roots are empty. */
+            emptyRoots = !schedule.empty() || componentDecompositions[index]->bagSize(componentDecompositions[index]->root()) == 0;
+        }
+    }
+
+    if (managementInstance.isTerminated())
+    {
+        return nullptr;
+    }
+
+    htd::IMutableTreeDecomposition * ret = managementInstance.treeDecompositionFactory().createInstance();
+
+    /* The node below which the root of the decomposition of the next component is attached. If the roots are empty,
+       each join node has the root of one decomposition and the next join node (or the last root) as its children.
+       Otherwise, the roots of all other components become children of the root of the first one. */
+    htd::vertex_t attachmentPoint = htd::Vertex::UNKNOWN;
+
+    if (emptyRoots)
+    {
+        attachmentPoint = ret->insertRoot(std::vector<htd::vertex_t>(), htd::FilteredHyperedgeCollection());
+    }
+
+    htd::PreOrderTreeTraversal treeTraversal;
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        const std::vector<htd::vertex_t> & component = sortedComponents[index];
+
+        if (componentDecompositions[index])
+        {
+            htd::IMutableTreeDecomposition & componentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition &>(*(componentDecompositions[index]));
+
+            const std::vector<htd::index_t> & positions = hyperedgePositions[index];
+
+            std::unordered_map<htd::vertex_t, htd::vertex_t> nodeMapping;
+
+            treeTraversal.traverse(componentDecomposition, [&](htd::vertex_t node, htd::vertex_t parent, std::size_t distanceToRoot)
+            {
+                HTD_UNUSED(distanceToRoot)
+
+                std::vector<htd::vertex_t> bag;
+
+                bag.reserve(componentDecomposition.bagSize(node));
+
+                for (htd::vertex_t vertex : componentDecomposition.bagContent(node))
+                {
+                    bag.push_back(component[vertex - 1]);
+                }
+
+                htd::FilteredHyperedgeCollection inducedEdges;
+
+                if (computeInducedEdges)
+                {
+                    std::vector<htd::index_t> inducedPositions;
+
+                    for (const htd::Hyperedge & hyperedge : componentDecomposition.inducedHyperedges(node))
+                    {
+                        inducedPositions.push_back(positions[hyperedge.id() - 1]);
+                    }
+
+                    inducedEdges = graph.hyperedgesAtPositions(std::move(inducedPositions));
+                }
+
+                htd::vertex_t newNode = htd::Vertex::UNKNOWN;
+
+                if (parent != htd::Vertex::UNKNOWN)
+                {
+                    newNode = ret->addChild(nodeMapping.at(parent), std::move(bag), std::move(inducedEdges));
+                }
+                else if (attachmentPoint != htd::Vertex::UNKNOWN)
+                {
+                    newNode = ret->addChild(attachmentPoint, std::move(bag), std::move(inducedEdges));
+                }
+                else
+                {
+                    newNode = ret->insertRoot(std::move(bag), std::move(inducedEdges));
+
+                    attachmentPoint = newNode;
+                }
+
+                nodeMapping.emplace(node, newNode);
+            });
+        }
+        else
+        {
+            htd::FilteredHyperedgeCollection inducedEdges;
+
+            if (computeInducedEdges)
+            {
+                inducedEdges = graph.hyperedgesAtPositions(hyperedgePositions[index]);
+            }
+
+            if (attachmentPoint != htd::Vertex::UNKNOWN)
+            {
+                ret->addChild(attachmentPoint, std::vector<htd::vertex_t>(component), std::move(inducedEdges));
+            }
+            else
+            {
+                attachmentPoint = ret->insertRoot(std::vector<htd::vertex_t>(component), std::move(inducedEdges));
+            }
+        }
+
+        if (emptyRoots && index + 2 < componentCount)
+        {
+            attachmentPoint = ret->addChild(attachmentPoint, std::vector<htd::vertex_t>(), htd::FilteredHyperedgeCollection());
+        }
+    }
+
+    return ret;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::postProcess(const htd::IMultiHypergraph & graph,
+                                                                                    htd::IMutableTreeDecomposition & decomposition,
+                                                                                    const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                                                                                    const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations) const
+{
+    for (const htd::ILabelingFunction * labelingFunction : baseLabelingFunctions_)
+    {
+        for (htd::vertex_t vertex : decomposition.vertices())
+        {
+            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+            delete labelCollection;
+
+            decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+        }
+    }
+
+    for (const htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations_)
+    {
+        operation->apply(graph, decomposition);
+    }
+
+    for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+    {
+        operation->apply(graph, decomposition);
+    }
+
+    for (const htd::ILabelingFunction * labelingFunction : labelingFunctions_)
+    {
+        for (htd::vertex_t vertex : decomposition.vertices())
+        {
+            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+            delete labelCollection;
+
+            decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+        }
+    }
+
+    for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
+    {
+        for (htd::vertex_t vertex : decomposition.vertices())
+        {
+            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+            delete labelCollection;
+
+            decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+        }
+    }
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm) : implementation_(new Implementation(manager, algorithm))
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    implementation_->baseLabelingFunctions_ = algorithm->releaseLabelingFunctions();
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) : implementation_(new Implementation(manager, algorithm))
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    implementation_->baseLabelingFunctions_ = algorithm->releaseLabelingFunctions();
+
+    setManipulationOperations(manipulationOperations);
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::~ConnectedComponentTreeDecompositionAlgorithm()
+{
+
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph) const
+{
+    return computeDecomposition(graph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    std::vector<htd::ILabelingFunction *> labelingFunctions;
+
+    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations;
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(operation);
+
+        if (labelingFunction != nullptr)
+        {
+            labelingFunctions.push_back(labelingFunction);
+        }
+
+        htd::ITreeDecompositionManipulationOperation * manipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(operation);
+
+        if (manipulationOperation != nullptr)
+        {
+            postProcessingOperations.push_back(manipulationOperation);
+        }
+    }
+
+    htd::IMutableTreeDecomposition * ret = implementation_->computeMutableDecomposition(graph, nullptr);
+
+    if (ret != nullptr)
+    {
+        implementation_->postProcess(graph, *ret, labelingFunctions, postProcessingOperations);
+    }
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        delete operation;
+    }
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    std::vector<htd::ILabelingFunction *> labelingFunctions;
+
+    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations;
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(operation);
+
+        if (labelingFunction != nullptr)
+        {
+            labelingFunctions.push_back(labelingFunction);
+        }
+
+        htd::ITreeDecompositionManipulationOperation * manipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(operation);
+
+        if (manipulationOperation != nullptr)
+        {
+            postProcessingOperations.push_back(manipulationOperation);
+        }
+    }
+
+    htd::IMutableTreeDecomposition * ret = implementation_->computeMutableDecomposition(graph, &preprocessedGraph);
+
+    if (ret != nullptr)
+    {
+        implementation_->postProcess(graph, *ret, labelingFunctions, postProcessingOperations);
+    }
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        delete operation;
+    }
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, manipulationOperations);
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations);
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    for (auto & labelingFunction : implementation_->labelingFunctions_)
+    {
+        delete labelingFunction;
+    }
+
+    for (auto & postProcessingOperation : implementation_->postProcessingOperations_)
+    {
+        delete postProcessingOperation;
+    }
+
+    implementation_->labelingFunctions_.clear();
+
+    implementation_->postProcessingOperations_.clear();
+
+    addManipulationOperations(manipulationOperations);
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation)
+{
+    htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(manipulationOperation);
+
+    if (labelingFunction != nullptr)
+    {
+        implementation_->labelingFunctions_.emplace_back(labelingFunction);
+    }
+
+    htd::ITreeDecompositionManipulationOperation * newManipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(manipulationOperation);
+
+    if (newManipulationOperation != nullptr)
+    {
+        implementation_->postProcessingOperations_.emplace_back(newManipulationOperation);
+    }
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        addManipulationOperation(operation);
+    }
+}
+
+std::vector<htd::ILabelingFunction *> htd::ConnectedComponentTreeDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    ret.swap(implementation_->baseLabelingFunctions_);
+
+    ret.insert(ret.end(), implementation_->labelingFunctions_.begin(), implementation_->labelingFunctions_.end());
+
+    implementation_->labelingFunctions_.clear();
+
+    return ret;
+}
+
+bool htd::ConnectedComponentTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
+{
+    return false;
+}
+
+bool htd::ConnectedComponentTreeDecompositionAlgorithm::isComputeInducedEdgesEnabled(void) const
+{
+    return implementation_->algorithm_->isComputeInducedEdgesEnabled();
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled)
+{
+    implementation_->algorithm_->setComputeInducedEdgesEnabled(computeInducedEdgesEnabled);
+}
+
+std::size_t htd::ConnectedComponentTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
+const htd::LibraryInstance * htd::ConnectedComponentTreeDecompositionAlgorithm::managementInstance(void) const noexcept
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm * htd::ConnectedComponentTreeDecompositionAlgorithm::clone(void) const
+{
+    htd::ConnectedComponentTreeDecompositionAlgorithm * ret = new htd::ConnectedComponentTreeDecompositionAlgorithm(managementInstance(), implementation_->algorithm_->clone());
+
+    for (htd::ILabelingFunction * labelingFunction : implementation_->baseLabelingFunctions_)
+    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        ret->implementation_->baseLabelingFunctions_.push_back(labelingFunction->clone());
+#else
+        ret->implementation_->baseLabelingFunctions_.push_back(labelingFunction->cloneLabelingFunction());
+#endif
+    }
+
+    for (htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
+    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        ret->addManipulationOperation(labelingFunction->clone());
+#else
+        ret->addManipulationOperation(labelingFunction->cloneLabelingFunction());
+#endif
+    }
+
+    for (htd::ITreeDecompositionManipulationOperation * postProcessingOperation : implementation_->postProcessingOperations_)
+    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        ret->addManipulationOperation(postProcessingOperation->clone());
+#else
+        ret->addManipulationOperation(postProcessingOperation->cloneTreeDecompositionManipulationOperation());
+#endif
+    }
+
+    ret->setThreadCount(implementation_->threadCount_);
+
+    return ret;
+}
+
+#endif /* HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_CPP */
@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/DepthFirstGraphTraversal.hpp>
+#include <htd/IContiguousGraphStructure.hpp>
 
 #include <stack>
 #include <tuple>
@@ -85,6 +86,8 @@ void htd::DepthFirstGraphTraversal::traverse(const htd::IGraphStructure & graph,
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
+    const htd::IContiguousGraphStructure * contiguousGraph = dynamic_cast<const htd::IContiguousGraphStructure *>(&graph);
+
     while (!originDeque.empty() && !managementInstance.isTerminated())
     {
         currentVertex = std::get<0>(originDeque.front());
@@ -99,20 +102,33 @@ void htd::DepthFirstGraphTraversal::traverse(const htd::IGraphStructure & graph,
 
             originDeque.pop_front();
 
-            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
-
-            auto it = neighborCollection.begin();
-
-            for (std::size_t remainder = neighborCollection.size(); remainder > 0; --remainder)
+            if (contiguousGraph != nullptr)
             {
-                htd::vertex_t neighbor = *it;
-
-                if (visitedVertices.count(neighbor) == 0)
+                for (htd::vertex_t neighbor : contiguousGraph->neighborSpan(currentVertex))
                 {
-                    originDeque.emplace_back(neighbor, currentVertex, currentDistance + 1);
+                    if (visitedVertices.count(neighbor) == 0)
+                    {
+                        originDeque.emplace_back(neighbor, currentVertex, currentDistance + 1);
+                    }
                 }
+            }
+            else
+            {
+                const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
 
-                ++it;
+                auto it = neighborCollection.begin();
+
+                for (std::size_t remainder = neighborCollection.size(); remainder > 0; --remainder)
+                {
+                    htd::vertex_t neighbor = *it;
+
+                    if (visitedVertices.count(neighbor) == 0)
+                    {
+                        originDeque.emplace_back(neighbor, currentVertex, currentDistance + 1);
+                    }
+
+                    ++it;
+                }
             }
         }
         else
@@ -31,15 +31,14 @@
 #include <htd/IFlow.hpp>
 
 #include <algorithm>
-#include <deque>
-#include <stack>
-#include <stdexcept>
-#include <unordered_map>
+#include <vector>
 
 namespace htd
 {
     /**
      *  Internal implementation of the htd::IFlow interface.
+     *
+     *  The net flow between adjacent vertices is stored in a sparse, adjacency-list based format.
      */
     class Flow : public htd::IFlow
     {
@@ -47,13 +46,39 @@ namespace htd
             /**
              *  Constructor of a new flow data structure.
              *
-             *  @param[in] vertexCount  The number of vertices of the flow data structure.
-             *  @param[in] source       The source vertex.
-             *  @param[in] target       The target vertex.
+             *  @param[in] network  The residual network from which the flow shall be extracted.
+             *  @param[in] source   The source vertex.
+             *  @param[in] target   The target vertex.
+             *  @param[in] value    The value of the flow.
              */
-            Flow(std::size_t vertexCount, htd::vertex_t source, htd::vertex_t target) : flow_(vertexCount, std::vector<long long>(vertexCount)), source_(source), target_(target)
+            Flow(const htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::size_t value) : offsets_(), targets_(), flow_(), source_(source), target_(target), value_(value)
             {
+                std::size_t vertexCount = network.vertexCount();
+
+                offsets_.reserve(vertexCount + 1);
+
+                offsets_.push_back(0);
+
+                for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    for (htd::index_t edge = network.firstEdge(vertex); edge < network.lastEdge(vertex); ++edge)
+                    {
+                        htd::vertex_t currentTarget = network.target(edge);
+
+                        if (targets_.size() > offsets_.back() && targets_.back() == currentTarget)
+                        {
+                            flow_.back() += network.flow(edge);
+                        }
+                        else
+                        {
+                            targets_.push_back(currentTarget);
+
+                            flow_.push_back(network.flow(edge));
+                        }
+                    }
 
+                    offsets_.push_back(targets_.size());
+                }
             }
 
             /**
@@ -61,14 +86,14 @@ namespace htd
              *
              *  @param[in] original The original flow data structure.
              */
-            Flow(const Flow & original) : flow_(original.flow_), source_(original.source_), target_(original.target_)
+            Flow(const Flow & original) : offsets_(original.offsets_), targets_(original.targets_), flow_(original.flow_), source_(original.source_), target_(original.target_), value_(original.value_)
             {
 
             }
 
             std::size_t vertexCount(void) const override
             {
-                return flow_.size();
+                return offsets_.size() - 1;
             }
 
             htd::vertex_t source(void) const override
@@ -83,21 +108,26 @@ namespace htd
 
             std::size_t value(void) const override
             {
-                std::size_t ret = 0;
-
-                for (const std::vector<long long> & current : flow_)
-                {
-                    ret = ret + static_cast<std::size_t>(current[target_]);
-                }
-
-                return ret;
+                return value_;
             }
 
             virtual long long flow(htd::vertex_t source, htd::vertex_t target) const override
             {
                 HTD_ASSERT(source < vertexCount() && target < vertexCount())
 
-                return flow_[source][target];
+                long long ret = 0;
+
+                auto first = targets_.begin() + offsets_[source];
+                auto last = targets_.begin() + offsets_[source + 1];
+
+                auto position = std::lower_bound(first, last, target);
+
+                if (position != last && *position == target)
+                {
+                    ret = flow_[static_cast<std::size_t>(std::distance(targets_.begin(), position))];
+                }
+
+                return ret;
             }
 
             Flow * clone(void) const override
@@ -105,10 +135,21 @@ namespace htd
                 return new Flow(*this);
             }
 
+        private:
+            /**
+             *  The offsets of the adjacency lists of each vertex.
+             */
+            std::vector<htd::index_t> offsets_;
+
+            /**
+             *  The sorted adjacency list of each vertex.
+             */
+            std::vector<htd::vertex_t> targets_;
+
             /**
-             *  The flow.
+             *  The net flow from each vertex to each of its adjacent vertices.
              */
-            std::vector<std::vector<long long>> flow_;
+            std::vector<long long> flow_;
 
             /**
              *  The source vertex.
@@ -119,6 +160,11 @@ namespace htd
              *  The target vertex.
              */
             htd::vertex_t target_;
+
+            /**
+             *  The value of the flow.
+             */
+            std::size_t value_;
     };
 }
 
@@ -148,47 +194,33 @@ struct htd::DinitzMaxFlowAlgorithm::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Try to improve an existing flow.
+     *  Compute the level graph of the residual network, i.e., the distance of each vertex from the source vertex
+     *  using only edges with positive residual capacity.
      *
-     *  @param[in] flowNetwork  The network for which the improved flow shall be computed.
-     *  @param[in] flow         The (currently) best known flow within the given flow network.
+     *  @param[in] network  The residual network.
+     *  @param[in] source   The source vertex.
+     *  @param[in] target   The target vertex.
+     *  @param[out] levels  The distance of each vertex from the source vertex or (std::size_t)-1 if the vertex is not reachable.
+     *  @param[out] queue   A buffer which is used for the breadth-first search.
      *
-     *  @return A matrix containing the updated residual capacities or nullptr if the provided flow is already maximal.
+     *  @return True if the target vertex is reachable from the source vertex, false otherwise.
      */
-    std::vector<std::vector<std::size_t>> * improveFlow(const htd::IFlowNetworkStructure & flowNetwork, const htd::Flow & flow) const;
+    bool computeLevels(const htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::vector<std::size_t> & levels, std::vector<htd::vertex_t> & queue) const;
 
     /**
-     *  Perform an improvement step for the flow between the source and the target vertex.
+     *  Compute a blocking flow in the level graph of the residual network using the current-arc technique.
      *
-     *  @param[in] flowNetwork  The flow network.
-     *  @param[in] capacities   The residual capacities which will be updated.
-     *  @param[in] distances    The distances from each vertex to the target vertex of the flow network.
-     *  @param[in] source       The source vertex.
-     *  @param[in] target       The target vertex.
-     */
-    void performImprovementStep(const htd::IFlowNetworkStructure & flowNetwork, std::vector<std::vector<std::size_t>> & capacities, const std::vector<std::size_t> & distances, htd::vertex_t source, htd::vertex_t target) const;
-
-    /**
-     *  Compute the minimum distances between the vertices of the given flow network to the selected target vertex.
-     *
-     *  @param[in] flowNetwork  The flow network.
-     *  @param[in] capacities   The current residual capacities of the flow network.
-     *  @param[in] target       The target vertex.
+     *  @param[in] network          The residual network which will be updated.
+     *  @param[in] source           The source vertex.
+     *  @param[in] target           The target vertex.
+     *  @param[in] levels           The levels of the vertices. Dead-end vertices are removed from the level graph during the computation.
+     *  @param[in] currentEdges     A buffer holding the current edge of each vertex.
+     *  @param[in] path             A buffer holding the edges of the current path.
+     *  @param[in] maximumValue     The maximum amount of flow which shall be pushed.
      *
-     *  @return A vector containing the distances from each vertex to the target vertex.
+     *  @return The amount of flow which was pushed from the source to the target vertex.
      */
-    std::vector<std::size_t> * computeMinimumDistances(const htd::IFlowNetworkStructure & flowNetwork, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const;
-
-    /**
-     *  Compute the minimum capacity within the given path starting from the given target vertex.
-     *
-     *  @param[in] path         A sequence of vertices which defines the path to investigate.
-     *  @param[in] capacities   The current residual capacities of the flow network.
-     *  @param[in] target       The target vertex.
-     *
-     *  @return The minimum capacity within the given path.
-     */
-    std::size_t computeMinimumCapacity(const std::vector<htd::vertex_t> & path, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const;
+    std::size_t computeBlockingFlow(htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::vector<std::size_t> & levels, std::vector<htd::index_t> & currentEdges, std::vector<htd::index_t> & path, std::size_t maximumValue) const;
 };
 
 htd::DinitzMaxFlowAlgorithm::DinitzMaxFlowAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -203,25 +235,43 @@ htd::DinitzMaxFlowAlgorithm::~DinitzMaxFlowAlgorithm()
 
 htd::IFlow * htd::DinitzMaxFlowAlgorithm::determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const
 {
-    std::size_t vertexCount = flowNetwork.vertexCount();
+    HTD_ASSERT(source < flowNetwork.vertexCount() && target < flowNetwork.vertexCount())
+
+    htd::ResidualNetwork network(flowNetwork);
 
-    htd::Flow * ret = new htd::Flow(vertexCount, source, target);
+    std::size_t value = increaseFlow(network, source, target, (std::size_t)-1);
 
-    std::vector<std::vector<std::size_t>> * capacities = implementation_->improveFlow(flowNetwork, *ret);
+    return new htd::Flow(network, source, target, value);
+}
 
-    while (capacities != nullptr)
+std::size_t htd::DinitzMaxFlowAlgorithm::increaseFlow(htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::size_t maximumValue) const
+{
+    HTD_ASSERT(source < network.vertexCount() && target < network.vertexCount())
+
+    std::size_t ret = 0;
+
+    if (source != target)
     {
-        for (htd::index_t i = 0; i < vertexCount; ++i)
+        std::size_t vertexCount = network.vertexCount();
+
+        std::vector<std::size_t> levels(vertexCount);
+
+        std::vector<htd::vertex_t> queue;
+        queue.reserve(vertexCount);
+
+        std::vector<htd::index_t> currentEdges(vertexCount);
+
+        std::vector<htd::index_t> path;
+
+        while (ret < maximumValue && !implementation_->managementInstance_->isTerminated() && implementation_->computeLevels(network, source, target, levels, queue))
         {
-            for (htd::index_t j = 0; j < vertexCount; ++j)
+            for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
             {
-                ret->flow_[i][j] = flowNetwork.capacity(i, j) - (*capacities)[i][j];
+                currentEdges[vertex] = network.firstEdge(vertex);
             }
-        }
-
-        delete capacities;
 
-        capacities = implementation_->improveFlow(flowNetwork, *ret);
+            ret += implementation_->computeBlockingFlow(network, source, target, levels, currentEdges, path, maximumValue - ret);
+        }
     }
 
     return ret;
@@ -244,162 +294,123 @@ htd::DinitzMaxFlowAlgorithm * htd::DinitzMaxFlowAlgorithm::clone(void) const
     return new htd::DinitzMaxFlowAlgorithm(managementInstance());
 }
 
-std::vector<std::vector<std::size_t>> * htd::DinitzMaxFlowAlgorithm::Implementation::improveFlow(const htd::IFlowNetworkStructure & flowNetwork, const htd::Flow & flow) const
+bool htd::DinitzMaxFlowAlgorithm::Implementation::computeLevels(const htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::vector<std::size_t> & levels, std::vector<htd::vertex_t> & queue) const
 {
-    std::size_t vertexCount = flowNetwork.vertexCount();
+    std::fill(levels.begin(), levels.end(), (std::size_t)-1);
 
-    std::vector<std::vector<std::size_t>> * ret = new std::vector<std::vector<std::size_t>>(vertexCount, std::vector<std::size_t>(vertexCount));
+    queue.clear();
 
-    std::vector<std::vector<std::size_t>> & capacities = *ret;
+    levels[source] = 0;
 
-    for (htd::index_t i = 0; i < vertexCount; i++)
+    queue.push_back(source);
+
+    for (htd::index_t index = 0; index < queue.size() && levels[target] == (std::size_t)-1; ++index)
     {
-        for (htd::index_t j = 0; j < vertexCount; j++)
-        {
-            capacities[i][j] = flowNetwork.capacity(i, j) - static_cast<std::size_t>(flow.flow_[i][j]);
-        }
-    }
+        htd::vertex_t vertex = queue[index];
 
-    std::vector<std::size_t> * distances = computeMinimumDistances(flowNetwork, capacities, flow.target_);
+        std::size_t nextLevel = levels[vertex] + 1;
 
-    if ((*distances)[flow.source_] == (std::size_t)-1)
-    {
-        delete ret;
+        for (htd::index_t edge = network.firstEdge(vertex); edge < network.lastEdge(vertex); ++edge)
+        {
+            htd::vertex_t neighbor = network.target(edge);
 
-        ret = nullptr;
-    }
-    else
-    {
-        performImprovementStep(flowNetwork, capacities, *distances, flow.source_, flow.target_);
-    }
+            if (levels[neighbor] == (std::size_t)-1 && network.residualCapacity(edge) > 0)
+            {
+                levels[neighbor] = nextLevel;
 
-    delete distances;
+                queue.push_back(neighbor);
+            }
+        }
+    }
 
-    return ret;
+    return levels[target] != (std::size_t)-1;
 }
 
-void htd::DinitzMaxFlowAlgorithm::Implementation::performImprovementStep(const htd::IFlowNetworkStructure & flowNetwork, std::vector<std::vector<std::size_t>> & capacities, const std::vector<std::size_t> & distances, htd::vertex_t source, htd::vertex_t target) const
+std::size_t htd::DinitzMaxFlowAlgorithm::Implementation::computeBlockingFlow(htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::vector<std::size_t> & levels, std::vector<htd::index_t> & currentEdges, std::vector<htd::index_t> & path, std::size_t maximumValue) const
 {
-    std::deque<htd::vertex_t> originDeque;
-
-    std::unordered_set<htd::vertex_t> visitedVertices;
+    std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = source;
+    path.clear();
 
-    originDeque.emplace_back(currentVertex);
+    htd::vertex_t vertex = source;
 
-    std::vector<htd::vertex_t> predecessors(flowNetwork.vertexCount(), (htd::vertex_t)-1);
+    bool finished = false;
 
-    while (!originDeque.empty() && !managementInstance_->isTerminated())
+    while (!finished && !managementInstance_->isTerminated())
     {
-        currentVertex = originDeque.front();
-
-        if (visitedVertices.count(currentVertex) == 0)
+        if (vertex == target)
         {
-            visitedVertices.insert(currentVertex);
+            std::size_t delta = maximumValue - ret;
 
-            if (currentVertex == target)
+            for (htd::index_t edge : path)
             {
-                std::size_t delta = computeMinimumCapacity(predecessors, capacities, target);
-
-                htd::vertex_t current = currentVertex;
-
-                htd::vertex_t predecessor = predecessors[currentVertex];
-
-                while (predecessor != (htd::vertex_t)-1)
-                {
-                    capacities[predecessor][current] = capacities[predecessor][current] - delta;
-                    capacities[current][predecessor] = capacities[current][predecessor] + delta;
-
-                    if (capacities[predecessor][current] == 0)
-                    {
-                        currentVertex = predecessor;
-                    }
-
-                    current = predecessor;
+                delta = std::min(delta, network.residualCapacity(edge));
+            }
 
-                    predecessor = predecessors[predecessor];
-                }
+            for (htd::index_t edge : path)
+            {
+                network.pushFlow(edge, delta);
             }
 
-            originDeque.pop_front();
+            ret += delta;
 
-            for (htd::vertex_t otherVertex = 0; otherVertex < flowNetwork.vertexCount(); ++otherVertex)
+            if (ret >= maximumValue)
             {
-                if (visitedVertices.count(otherVertex) == 0 && flowNetwork.capacity(currentVertex, otherVertex) > 0 && capacities[currentVertex][otherVertex] > 0 && distances[currentVertex] == distances[otherVertex] + 1)
-                {
-                    predecessors[otherVertex] = currentVertex;
+                finished = true;
+            }
+            else
+            {
+                /* Continue the search from the source of the first saturated edge on the path. */
+                htd::index_t position = 0;
 
-                    originDeque.emplace_back(otherVertex);
+                while (network.residualCapacity(path[position]) > 0)
+                {
+                    ++position;
                 }
+
+                path.resize(position);
+
+                vertex = path.empty() ? source : network.target(path.back());
             }
         }
         else
         {
-            originDeque.pop_front();
-        }
-    }
-}
+            htd::index_t & edge = currentEdges[vertex];
 
-std::vector<std::size_t> * htd::DinitzMaxFlowAlgorithm::Implementation::computeMinimumDistances(const htd::IFlowNetworkStructure & flowNetwork, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const
-{
-    std::size_t vertexCount = flowNetwork.vertexCount();
-
-    std::vector<std::size_t> * ret = new std::vector<std::size_t>(vertexCount, (std::size_t)-1);
-
-    std::vector<std::size_t> & distances = *ret;
-
-    distances[target]=0;
+            htd::index_t lastEdge = network.lastEdge(vertex);
 
-    std::stack<htd::vertex_t> stack;
+            std::size_t nextLevel = levels[vertex] + 1;
 
-    stack.push(target);
-
-    while(!stack.empty())
-    {
-        htd::vertex_t vertex = stack.top();
+            while (edge < lastEdge && (network.residualCapacity(edge) == 0 || levels[network.target(edge)] != nextLevel))
+            {
+                ++edge;
+            }
 
-        stack.pop();
+            if (edge < lastEdge)
+            {
+                path.push_back(edge);
 
-        for (htd::index_t index = 0; index < vertexCount; ++index)
-        {
-            if (flowNetwork.capacity(index, vertex) > 0 && capacities[index][vertex] > 0)
+                vertex = network.target(edge);
+            }
+            else
             {
-                std::size_t distance = distances[vertex] + 1;
+                /* The vertex is a dead end, hence it is removed from the level graph. */
+                levels[vertex] = (std::size_t)-1;
 
-                if (distance < distances[index])
+                if (path.empty())
                 {
-                    distances[index] = distance;
-
-                    stack.push(index);
+                    finished = true;
                 }
-            }
-        }
-    }
-
-    return ret;
-}
-
-std::size_t htd::DinitzMaxFlowAlgorithm::Implementation::computeMinimumCapacity(const std::vector<htd::vertex_t> & path, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const
-{
-    std::size_t ret = (std::size_t)-1;
-
-    htd::vertex_t current = target;
-
-    htd::vertex_t predecessor = path[current];
+                else
+                {
+                    vertex = network.target(network.reverseEdge(path.back()));
 
-    while (predecessor != (htd::vertex_t)-1)
-    {
-        std::size_t capacity = capacities[predecessor][current];
+                    path.pop_back();
 
-        if (ret > capacity)
-        {
-            ret = capacity;
+                    ++currentEdges[vertex];
+                }
+            }
         }
-
-        current = predecessor;
-
-        predecessor = path[predecessor];
     }
 
     return ret;
@@ -0,0 +1,362 @@
+/*
+ * File:   EliminationWidthEvaluator.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_ELIMINATIONWIDTHEVALUATOR_CPP
+#define HTD_HTD_ELIMINATIONWIDTHEVALUATOR_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/EliminationWidthEvaluator.hpp>
+#include <htd/IContiguousGraphStructure.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace
+{
+    /**
+     *  Constant for the identification of a missing entry.
+     */
+    constexpr htd::index_t NONE = (htd::index_t)-1;
+
+    /**
+     *  Find the representative of the set containing the given vertex and compress the path to it.
+     *
+     *  @param[in] vertex       The vertex.
+     *  @param[in,out] ancestor The union-find forest.
+     *
+     *  @return The representative of the set containing the given vertex.
+     */
+    htd::index_t find(htd::index_t vertex, std::vector<htd::index_t> & ancestor)
+    {
+        htd::index_t ret = vertex;
+
+        while (ret != ancestor[ret])
+        {
+            ret = ancestor[ret];
+        }
+
+        while (vertex != ret)
+        {
+            htd::index_t next = ancestor[vertex];
+
+            ancestor[vertex] = ret;
+
+            vertex = next;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute the maximum bag size of the decomposition induced by eliminating the vertices 0, 1, ..., n - 1 in
+     *  ascending order.
+     *
+     *  @param[in] offsets      The offsets of the neighborhoods. The neighbors of vertex v are stored at the indices
+     *                          offsets[v], ..., offsets[v + 1] - 1 of the adjacency vector.
+     *  @param[in] adjacency    The neighborhoods of all vertices. Self-loops and duplicate entries are allowed.
+     *
+     *  @return The maximum bag size of the decomposition induced by the elimination ordering.
+     */
+    std::size_t maximumBagSize(const std::vector<htd::index_t> & offsets, const std::vector<htd::index_t> & adjacency)
+    {
+        std::size_t size = offsets.size() - 1;
+
+        std::vector<htd::index_t> parent(size, NONE);
+
+        std::vector<htd::index_t> ancestor(size, NONE);
+
+        /* Compute the elimination tree: The parent of a vertex is the first vertex eliminated after it to which it is
+           connected in the filled graph. Shortcuts to the current root of each subtree keep the search near-linear. */
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            for (htd::index_t position = offsets[vertex]; position < offsets[vertex + 1]; ++position)
+            {
+                htd::index_t current = adjacency[position];
+
+                while (current != NONE && current < vertex)
+                {
+                    htd::index_t next = ancestor[current];
+
+                    ancestor[current] = vertex;
+
+                    if (next == NONE)
+                    {
+                        parent[current] = vertex;
+                    }
+
+                    current = next;
+                }
+            }
+        }
+
+        /* Compute a postorder of the elimination tree. */
+        std::vector<htd::index_t> head(size, NONE);
+        std::vector<htd::index_t> next(size, NONE);
+
+        for (htd::index_t vertex = size; vertex > 0; --vertex)
+        {
+            htd::index_t child = vertex - 1;
+
+            if (parent[child] != NONE)
+            {
+                next[child] = head[parent[child]];
+
+                head[parent[child]] = child;
+            }
+        }
+
+        std::vector<htd::index_t> postOrder;
+
+        postOrder.reserve(size);
+
+        std::vector<htd::index_t> stack;
+
+        for (htd::index_t root = 0; root < size; ++root)
+        {
+            if (parent[root] == NONE)
+            {
+                stack.push_back(root);
+
+                while (!stack.empty())
+                {
+                    htd::index_t top = stack.back();
+
+                    htd::index_t child = head[top];
+
+                    if (child == NONE)
+                    {
+                        stack.pop_back();
+
+                        postOrder.push_back(top);
+                    }
+                    else
+                    {
+                        head[top] = next[child];
+
+                        stack.push_back(child);
+                    }
+                }
+            }
+        }
+
+        /* Count the bag sizes: delta[v] is set up such that the sum of the deltas in the subtree rooted at v equals the
+           size of the bag of v. Each neighbor i of v eliminated after v contributes only if v is a leaf of the row
+           subtree of i, the overlap with the previous leaf is subtracted at their least common ancestor. */
+        std::vector<std::ptrdiff_t> delta(size, 0);
+
+        std::vector<htd::index_t> first(size, NONE);
+        std::vector<htd::index_t> maxFirst(size, NONE);
+        std::vector<htd::index_t> previousLeaf(size, NONE);
+
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            htd::index_t vertex = postOrder[index];
+
+            delta[vertex] = first[vertex] == NONE ? 1 : 0;
+
+            for (; vertex != NONE && first[vertex] == NONE; vertex = parent[vertex])
+            {
+                first[vertex] = index;
+            }
+        }
+
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            ancestor[vertex] = vertex;
+        }
+
+        for (htd::index_t vertex : postOrder)
+        {
+            if (parent[vertex] != NONE)
+            {
+                --delta[parent[vertex]];
+            }
+
+            for (htd::index_t position = offsets[vertex]; position < offsets[vertex + 1]; ++position)
+            {
+                htd::index_t neighbor = adjacency[position];
+
+                if (neighbor > vertex && (maxFirst[neighbor] == NONE || first[vertex] > maxFirst[neighbor]))
+                {
+                    maxFirst[neighbor] = first[vertex];
+
+                    htd::index_t lastLeaf = previousLeaf[neighbor];
+
+                    previousLeaf[neighbor] = vertex;
+
+                    ++delta[vertex];
+
+                    if (lastLeaf != NONE)
+                    {
+                        --delta[find(lastLeaf, ancestor)];
+                    }
+                }
+            }
+
+            if (parent[vertex] != NONE)
+            {
+                ancestor[vertex] = parent[vertex];
+            }
+        }
+
+        std::size_t ret = 0;
+
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            if (parent[vertex] != NONE)
+            {
+                delta[parent[vertex]] += delta[vertex];
+            }
+
+            ret = std::max(ret, static_cast<std::size_t>(delta[vertex]));
+        }
+
+        return ret;
+    }
+}
+
+htd::EliminationWidthEvaluator::EliminationWidthEvaluator(void)
+{
+
+}
+
+htd::EliminationWidthEvaluator::~EliminationWidthEvaluator()
+{
+
+}
+
+std::size_t htd::EliminationWidthEvaluator::maximumBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering) const
+{
+    HTD_ASSERT(ordering.size() == graph.vertexCount())
+
+    std::size_t size = ordering.size();
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    std::vector<htd::index_t> positions(graph.vertexAtPosition(size - 1) + 1, NONE);
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        HTD_ASSERT(graph.isVertex(ordering[index]) && positions[ordering[index]] == NONE)
+
+        positions[ordering[index]] = index;
+    }
+
+    std::vector<htd::index_t> offsets;
+    std::vector<htd::index_t> adjacency;
+
+    offsets.reserve(size + 1);
+    offsets.push_back(0);
+
+    const htd::IContiguousGraphStructure * contiguousGraph = dynamic_cast<const htd::IContiguousGraphStructure *>(&graph);
+
+    std::vector<htd::vertex_t> neighbors;
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        if (contiguousGraph != nullptr)
+        {
+            for (htd::vertex_t neighbor : contiguousGraph->neighborSpan(vertex))
+            {
+                adjacency.push_back(positions[neighbor]);
+            }
+        }
+        else
+        {
+            neighbors.clear();
+
+            graph.copyNeighborsTo(vertex, neighbors);
+
+            for (htd::vertex_t neighbor : neighbors)
+            {
+                adjacency.push_back(positions[neighbor]);
+            }
+        }
+
+        offsets.push_back(adjacency.size());
+    }
+
+    return ::maximumBagSize(offsets, adjacency);
+}
+
+std::size_t htd::EliminationWidthEvaluator::maximumBagSize(const htd::IMultiHypergraph & graph, const htd::IVertexOrdering & ordering) const
+{
+    return maximumBagSize(graph, ordering.sequence());
+}
+
+std::size_t htd::EliminationWidthEvaluator::maximumBagSize(const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::vertex_t> & ordering) const
+{
+    const std::vector<htd::vertex_t> & vertexNames = preprocessedGraph.vertexNames();
+
+    if (vertexNames.empty())
+    {
+        return 0;
+    }
+
+    std::size_t eliminatedVertexCount = preprocessedGraph.eliminationSequence().size();
+
+    HTD_ASSERT(ordering.size() == eliminatedVertexCount + preprocessedGraph.remainingVertices().size())
+    HTD_ASSERT(std::equal(preprocessedGraph.eliminationSequence().begin(), preprocessedGraph.eliminationSequence().end(), ordering.begin()))
+
+    std::vector<htd::vertex_t> internalVertices(*std::max_element(vertexNames.begin(), vertexNames.end()) + 1, htd::Vertex::UNKNOWN);
+
+    for (htd::vertex_t vertex = 0; vertex < vertexNames.size(); ++vertex)
+    {
+        internalVertices[vertexNames[vertex]] = vertex;
+    }
+
+    std::vector<htd::index_t> positions(vertexNames.size(), NONE);
+
+    for (htd::index_t index = eliminatedVertexCount; index < ordering.size(); ++index)
+    {
+        positions[internalVertices[ordering[index]]] = index - eliminatedVertexCount;
+    }
+
+    std::vector<htd::index_t> offsets;
+    std::vector<htd::index_t> adjacency;
+
+    offsets.reserve(ordering.size() - eliminatedVertexCount + 1);
+    offsets.push_back(0);
+
+    for (htd::index_t index = eliminatedVertexCount; index < ordering.size(); ++index)
+    {
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(internalVertices[ordering[index]]))
+        {
+            if (positions[neighbor] != NONE)
+            {
+                adjacency.push_back(positions[neighbor]);
+            }
+        }
+
+        offsets.push_back(adjacency.size());
+    }
+
+    return std::max(preprocessedGraph.minTreeWidth() + 1, ::maximumBagSize(offsets, adjacency));
+}
+
+#endif /* HTD_HTD_ELIMINATIONWIDTHEVALUATOR_CPP */
@@ -129,20 +129,12 @@ struct htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::Implementation
 
             if (!ret)
             {
-                const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
-
-                auto it = neighborCollection.begin();
-
-                for (std::size_t remainder = neighborCollection.size(); remainder > 0; --remainder)
+                for (htd::vertex_t neighbor : graph.neighborhood(currentVertex))
                 {
-                    htd::vertex_t neighbor = *it;
-
                     if (visitedVertices.count(neighbor) == 0 && ((vertices.count(neighbor) == 1 && weights[neighbor] < currentWeight) || neighbor == target))
                     {
                         originDeque.push_back(neighbor);
                     }
-
-                    ++it;
                 }
             }
 
@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 #include <htd/GraphFactory.hpp>
 #include <htd/Graph.hpp>
+#include <htd/StaticGraph.hpp>
 
 htd::GraphFactory::GraphFactory(const htd::LibraryInstance * const manager) : htd::GraphTypeFactory<htd::IGraph, htd::IMutableGraph>(new htd::Graph(manager))
 {
@@ -57,4 +58,9 @@ htd::IMutableGraph * htd::GraphFactory::createInstance(std::size_t initialSize)
     return ret;
 }
 
+htd::IGraph * htd::GraphFactory::createStaticInstance(std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) const
+{
+    return new htd::StaticGraph(managementInstance_, vertexCount, edges);
+}
+
 #endif /* HTD_HTD_GRAPHFACTORY_CPP */
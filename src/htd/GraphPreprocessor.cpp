@@ -31,6 +31,7 @@
 #include <htd/GraphPreprocessor.hpp>
 
 #include <htd/PreprocessedGraph.hpp>
+#include <htd/IContiguousGraphStructure.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
@@ -39,7 +40,10 @@
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <numeric>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -355,6 +359,7 @@ struct htd::GraphPreprocessor::Implementation
                                                                  applyPreprocessing4_(false),
                                                                  iterationCount_(1),
                                                                  nonImprovementLimit_(0),
+                                                                 threadCount_(1),
                                                                  orderingAlgorithm_(new htd::MinFillOrderingAlgorithm(manager))
     {
 
@@ -409,6 +414,11 @@ struct htd::GraphPreprocessor::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The number of worker threads which shall compute the vertex elimination orderings of separated parts of the graph concurrently.
+     */
+    std::size_t threadCount_;
+
     /**
      *  The base ordering algorithm which shall be used to eliminate all but the largest biconnected component.
      */
@@ -501,6 +511,8 @@ struct htd::GraphPreprocessor::Implementation
 
                     std::unordered_map<htd::vertex_t, htd::vertex_t> mapping(vertexCollection.size());
 
+                    const htd::IContiguousGraphStructure * contiguousGraph = dynamic_cast<const htd::IContiguousGraphStructure *>(&graph);
+
                     for (std::size_t remainder = vertexCollection.size(); remainder > 0; --remainder)
                     {
                         htd::vertex_t vertex = *position;
@@ -509,17 +521,31 @@ struct htd::GraphPreprocessor::Implementation
 
                         std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[mappedVertex];
 
-                        const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
-
-                        auto position2 = neighborCollection.begin();
+                        if (contiguousGraph != nullptr)
+                        {
+                            const htd::ConstSpan<htd::vertex_t> & neighborSpan = contiguousGraph->neighborSpan(vertex);
 
-                        currentNeighborhood.reserve(neighborCollection.size() + 1);
+                            currentNeighborhood.reserve(neighborSpan.size() + 1);
 
-                        for (std::size_t remainder2 = neighborCollection.size(); remainder2 > 0; --remainder2)
+                            for (htd::vertex_t neighbor : neighborSpan)
+                            {
+                                currentNeighborhood.push_back(registerVertex(neighbor, mapping, vertexNames));
+                            }
+                        }
+                        else
                         {
-                            currentNeighborhood.push_back(registerVertex(*position2, mapping, vertexNames));
+                            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
 
-                            ++position2;
+                            auto position2 = neighborCollection.begin();
+
+                            currentNeighborhood.reserve(neighborCollection.size() + 1);
+
+                            for (std::size_t remainder2 = neighborCollection.size(); remainder2 > 0; --remainder2)
+                            {
+                                currentNeighborhood.push_back(registerVertex(*position2, mapping, vertexNames));
+
+                                ++position2;
+                            }
                         }
 
                         std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
@@ -723,25 +749,47 @@ struct htd::GraphPreprocessor::Implementation
                                                 std::unordered_set<htd::vertex_t> & vertices) const;
 
     /**
-     *  Eliminate a connected component from the given preprocessed graph and update the preprocessed graph's elimination sequence.
+     *  Compute the best vertex elimination ordering of the given graph component the given ordering algorithm finds within the configured number of iterations.
+     *
+     *  @param[in] graph        The graph underlying the operation.
+     *  @param[in] component    The graph component which shall be eliminated.
+     *  @param[in] algorithm    The ordering algorithm which shall be used.
+     *
+     *  @return The best vertex elimination ordering found or nullptr if the algorithm was terminated before an ordering was found.
+     */
+    htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph,
+                                                       const htd::IPreprocessedGraph & component,
+                                                       const htd::IWidthLimitableOrderingAlgorithm & algorithm) const;
+
+    /**
+     *  Eliminate the given graph components, which are independent of each other, and append their elimination orderings to the preprocessed graph's elimination sequence.
+     *
+     *  If more than one worker thread is configured, the orderings of the components are computed concurrently. The
+     *  resulting elimination sequence does not depend on the number of worker threads which were used.
      *
      *  @param[in] graph                The graph underlying the operation.
-     *  @param[in] vertices             The vertices which shall be eliminated.
+     *  @param[in] components           The graph components which shall be eliminated.
+     *  @param[in] retainedVertices     For each component, the sorted set of the identifiers of its vertices which shall not be eliminated.
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in,out] minTreeWidth     The lower bound for the treewidth of the given graph component.
      */
-    void eliminateVertices(const htd::IMultiHypergraph & graph,
-                           const std::unordered_set<htd::vertex_t> & vertices,
-                           htd::PreprocessedGraph & preprocessedGraph,
-                           std::size_t & minTreeWidth) const;
+    void eliminateComponents(const htd::IMultiHypergraph & graph,
+                             const std::vector<std::unique_ptr<htd::IPreprocessedGraph>> & components,
+                             const std::vector<std::vector<htd::vertex_t>> & retainedVertices,
+                             htd::PreprocessedGraph & preprocessedGraph) const;
 
     /**
-     *  Iteratively compute the clique minimal separators of the given graph and remove them from the graph.
+     *  Decompose the given graph into its atoms along its clique minimal separators and eliminate all but the last atom.
+     *
+     *  The vertices of each atom which are not contained in the clique separator splitting it off are eliminated
+     *  based on an ordering of the atom, all atoms are processed independently. The last atom is retained as the
+     *  remainder of the preprocessed graph.
      *
+     *  @param[in] graph                The graph which shall be preprocessed.
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
      *  @param[in] vertices             The set of all available vertices.
      */
-    void applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+    void applyCliqueSeparatorPreprocessing(const htd::IMultiHypergraph & graph,
+                                           htd::PreprocessedGraph & preprocessedGraph,
                                            std::unordered_set<htd::vertex_t> & vertices) const;
 };
 
@@ -891,13 +939,11 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
         ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::move(ordering), std::move(remainingVertices), graph.edgeCount(), minTreeWidth);
 
-        if (implementation_->applyPreprocessing4_)
+        if (implementation_->applyPreprocessing4_ && !vertices.empty())
         {
-            //TODO
-            //implementation_->applyBiconnectedComponentPreprocessing(graph, *ret, vertices);
+            implementation_->applyBiconnectedComponentPreprocessing(graph, *ret, vertices);
 
-            //TODO
-            //implementation_->applyCliqueSeparatorPreprocessing(*ret, vertices);
+            implementation_->applyCliqueSeparatorPreprocessing(graph, *ret, vertices);
         }
     }
     else
@@ -976,6 +1022,18 @@ void htd::GraphPreprocessor::setNonImprovementLimit(std::size_t nonImprovementLi
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::GraphPreprocessor::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::GraphPreprocessor::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 void htd::GraphPreprocessor::setOrderingAlgorithm(htd::IWidthLimitableOrderingAlgorithm * algorithm)
 {
     HTD_ASSERT(algorithm != nullptr)
@@ -1717,6 +1775,8 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
            return component1.size() < component2.size();
         });
 
+        std::vector<std::unique_ptr<htd::IPreprocessedGraph>> separatedComponents;
+
         for (const std::vector<htd::vertex_t> & component : connectedComponents)
         {
             std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
@@ -1834,9 +1894,14 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
 
             if (!std::binary_search(component.begin(), component.end(), selectedComponent[0]))
             {
-                oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+                if (!componentVertices.empty())
+                {
+                    std::vector<htd::vertex_t> remainingComponentVertices(componentVertices.begin(), componentVertices.end());
 
-                eliminateVertices(graph, componentVertices, preprocessedGraph, minTreeWidth);
+                    std::sort(remainingComponentVertices.begin(), remainingComponentVertices.end());
+
+                    separatedComponents.emplace_back(new htd::PreprocessedGraphComponent(preprocessedGraph, std::move(remainingComponentVertices), minTreeWidth));
+                }
 
                 for (auto it = componentVertices.begin(); it != componentVertices.end(); ++it)
                 {
@@ -1854,20 +1919,16 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
 
             preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), minTreeWidth);
         }
+
+        /* The separated components only share vertices with the largest biconnected component, hence they can be eliminated independently. */
+        eliminateComponents(graph, separatedComponents, std::vector<std::vector<htd::vertex_t>>(separatedComponents.size()), preprocessedGraph);
     }
 }
 
-void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMultiHypergraph & graph,
-                                                               const std::unordered_set<htd::vertex_t> & vertices,
-                                                               htd::PreprocessedGraph & preprocessedGraph,
-                                                               std::size_t & minTreeWidth) const
+htd::IWidthLimitedVertexOrdering * htd::GraphPreprocessor::Implementation::computeOrdering(const htd::IMultiHypergraph & graph,
+                                                                                          const htd::IPreprocessedGraph & component,
+                                                                                          const htd::IWidthLimitableOrderingAlgorithm & algorithm) const
 {
-    std::vector<htd::vertex_t> remainingComponentVertices(vertices.begin(), vertices.end());
-
-    std::sort(remainingComponentVertices.begin(), remainingComponentVertices.end());
-
-    htd::PreprocessedGraphComponent component(preprocessedGraph, std::move(remainingComponentVertices), minTreeWidth);
-
     htd::IWidthLimitedVertexOrdering * optimalOrdering = nullptr;
 
     std::size_t bestMaxBagSize = 0;
@@ -1883,7 +1944,7 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
             remainingIterations = std::min(remainingIterations, nonImprovementLimit_);
         }
 
-        htd::IWidthLimitedVertexOrdering * currentOrdering = orderingAlgorithm_->computeOrdering(graph, component, bestMaxBagSize - 1, remainingIterations);
+        htd::IWidthLimitedVertexOrdering * currentOrdering = algorithm.computeOrdering(graph, component, bestMaxBagSize - 1, remainingIterations);
 
         if (currentOrdering->requiredIterations() < nonImprovementLimit_)
         {
@@ -1896,23 +1957,13 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
 
         std::size_t currentMaxBagSize = currentOrdering->maximumBagSize();
 
-        if (!managementInstance_->isTerminated())
+        if (!managementInstance_->isTerminated() && (optimalOrdering == nullptr || currentMaxBagSize < bestMaxBagSize))
         {
-            if ((iteration == 1 && bestMaxBagSize == 0) || currentMaxBagSize < bestMaxBagSize)
-            {
-                if (iteration > 1)
-                {
-                    delete optimalOrdering;
-                }
+            delete optimalOrdering;
 
-                optimalOrdering = currentOrdering;
+            optimalOrdering = currentOrdering;
 
-                bestMaxBagSize = currentMaxBagSize;
-            }
-            else
-            {
-                delete currentOrdering;
-            }
+            bestMaxBagSize = currentMaxBagSize;
         }
         else
         {
@@ -1920,40 +1971,191 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
         }
     }
 
-    if (optimalOrdering != nullptr)
+    return optimalOrdering;
+}
+
+void htd::GraphPreprocessor::Implementation::eliminateComponents(const htd::IMultiHypergraph & graph,
+                                                                 const std::vector<std::unique_ptr<htd::IPreprocessedGraph>> & components,
+                                                                 const std::vector<std::vector<htd::vertex_t>> & retainedVertices,
+                                                                 htd::PreprocessedGraph & preprocessedGraph) const
+{
+    HTD_ASSERT(components.size() == retainedVertices.size())
+
+    std::size_t componentCount = components.size();
+
+    std::vector<std::unique_ptr<htd::IWidthLimitedVertexOrdering>> orderings(componentCount);
+
+    std::size_t threadCount = std::min(threadCount_, componentCount);
+
+    /* Component i is always ordered with a random number generator seeded with (s + i), so the result does not depend on the number of threads. */
+    unsigned int baseSeed = static_cast<unsigned int>(htd::randomNumber());
+
+    if (threadCount <= 1)
     {
-        preprocessedGraph.eliminationSequence().insert(preprocessedGraph.eliminationSequence().end(), optimalOrdering->sequence().begin(), optimalOrdering->sequence().end());
+        htd::ThreadLocalRandomNumberGeneratorGuard guard;
 
-        preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), optimalOrdering->maximumBagSize() - 1);
+        for (htd::index_t index = 0; index < componentCount && !managementInstance_->isTerminated(); ++index)
+        {
+            htd::seedThreadLocalRandomNumberGenerator(baseSeed + static_cast<unsigned int>(index));
 
-        delete optimalOrdering;
+            orderings[index].reset(computeOrdering(graph, *(components[index]), *orderingAlgorithm_));
+        }
+    }
+    else
+    {
+        std::atomic<std::size_t> nextComponent(0);
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(threadCount);
+
+        for (htd::index_t worker = 0; worker < threadCount; ++worker)
+        {
+            workers.emplace_back([&]()
+            {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                std::unique_ptr<htd::IWidthLimitableOrderingAlgorithm> algorithm(orderingAlgorithm_->clone());
+#else
+                std::unique_ptr<htd::IWidthLimitableOrderingAlgorithm> algorithm(orderingAlgorithm_->cloneWidthLimitableOrderingAlgorithm());
+#endif
+
+                for (htd::index_t index = nextComponent++; index < componentCount && !managementInstance_->isTerminated(); index = nextComponent++)
+                {
+                    htd::seedThreadLocalRandomNumberGenerator(baseSeed + static_cast<unsigned int>(index));
+
+                    orderings[index].reset(computeOrdering(graph, *(components[index]), *algorithm));
+                }
+
+                htd::resetThreadLocalRandomNumberGenerator();
+            });
+        }
+
+        for (std::thread & worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    std::vector<htd::vertex_t> & eliminationSequence = preprocessedGraph.eliminationSequence();
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        if (orderings[index])
+        {
+            const std::vector<htd::vertex_t> & retained = retainedVertices[index];
+
+            for (htd::vertex_t vertex : orderings[index]->sequence())
+            {
+                if (!std::binary_search(retained.begin(), retained.end(), vertex))
+                {
+                    eliminationSequence.push_back(vertex);
+                }
+            }
+
+            preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), orderings[index]->maximumBagSize() - 1);
+        }
     }
 }
 
-void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(const htd::IMultiHypergraph & graph,
+                                                                               htd::PreprocessedGraph & preprocessedGraph,
                                                                                std::unordered_set<htd::vertex_t> & vertices) const
 {
     htd::CliqueMinimalSeparatorAlgorithm algorithm(managementInstance_);
 
-    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(preprocessedGraph);
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    algorithm.computeAtoms(preprocessedGraph, atoms, separators);
 
-    while (separator != nullptr && !separator->empty())
+    if (atoms.size() > 1)
     {
-        for (htd::vertex_t vertex : *separator)
+        std::vector<std::unique_ptr<htd::IPreprocessedGraph>> components;
+
+        std::vector<std::vector<htd::vertex_t>> retainedVertices;
+
+        std::vector<htd::vertex_t> localNames(preprocessedGraph.inputGraphVertexCount());
+
+        for (htd::index_t index = 0; index < atoms.size() - 1; ++index)
         {
-            preprocessedGraph.removeVertex(vertex);
+            const std::vector<htd::vertex_t> & atom = atoms[index];
 
-            vertices.erase(vertex);
+            const std::vector<htd::vertex_t> & separator = separators[index];
+
+            std::size_t atomSize = atom.size();
+
+            for (htd::index_t position = 0; position < atomSize; ++position)
+            {
+                localNames[atom[position]] = static_cast<htd::vertex_t>(position);
+            }
+
+            std::vector<htd::vertex_t> atomVertexNames;
+
+            std::vector<std::vector<htd::vertex_t>> atomNeighborhood(atomSize);
+
+            atomVertexNames.reserve(atomSize);
+
+            std::size_t atomEdgeCount = 0;
+
+            for (htd::index_t position = 0; position < atomSize; ++position)
+            {
+                htd::vertex_t vertex = atom[position];
+
+                atomVertexNames.push_back(preprocessedGraph.vertexName(vertex));
+
+                for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+                {
+                    if (std::binary_search(atom.begin(), atom.end(), neighbor))
+                    {
+                        atomNeighborhood[position].push_back(localNames[neighbor]);
+                    }
+                }
+
+                atomEdgeCount += atomNeighborhood[position].size();
+
+                if (!std::binary_search(separator.begin(), separator.end(), vertex))
+                {
+                    vertices.erase(vertex);
+                }
+            }
+
+            std::vector<htd::vertex_t> atomVertices(atomSize);
+
+            std::iota(atomVertices.begin(), atomVertices.end(), 0);
+
+            components.emplace_back(new htd::PreprocessedGraph(std::move(atomVertexNames), std::move(atomNeighborhood), std::vector<htd::vertex_t>(), std::move(atomVertices), atomEdgeCount >> 1, 0));
+
+            retainedVertices.emplace_back();
+
+            std::vector<htd::vertex_t> & retained = retainedVertices.back();
+
+            for (htd::vertex_t vertex : separator)
+            {
+                retained.push_back(preprocessedGraph.vertexName(vertex));
+            }
+
+            std::sort(retained.begin(), retained.end());
         }
 
-        delete separator;
+        /* The clique separators ensure that eliminating an atom does not introduce fill edges outside of it. */
+        eliminateComponents(graph, components, retainedVertices, preprocessedGraph);
 
-        separator = algorithm.computeSeparator(preprocessedGraph);
-    }
+        const std::vector<htd::vertex_t> & lastAtom = atoms.back();
 
-    if (separator != nullptr)
-    {
-        delete separator;
+        for (htd::vertex_t vertex : lastAtom)
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+
+            currentNeighborhood.erase(std::remove_if(currentNeighborhood.begin(), currentNeighborhood.end(), [&](htd::vertex_t neighbor)
+            {
+                return !std::binary_search(lastAtom.begin(), lastAtom.end(), neighbor);
+            }), currentNeighborhood.end());
+        }
+
+        preprocessedGraph.setRemainingVertices(lastAtom);
+
+        preprocessedGraph.updateEdgeCount();
     }
 }
 
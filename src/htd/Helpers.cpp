@@ -27,6 +27,22 @@
 
 #include <htd/Helpers.hpp>
 
+#include <cstdlib>
+#include <random>
+
+namespace
+{
+    /**
+     *  The random number generator owned by the calling thread.
+     */
+    thread_local std::mt19937 threadLocalRandomNumberGenerator;
+
+    /**
+     *  A boolean flag indicating whether a seed was assigned to the random number generator of the calling thread.
+     */
+    thread_local bool threadLocalRandomNumberGeneratorSeeded = false;
+}
+
 htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
 {
     htd::LibraryInstance * ret = new htd::LibraryInstance(id);
@@ -36,6 +52,42 @@ htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
     return ret;
 }
 
+int htd::randomNumber(void)
+{
+    if (threadLocalRandomNumberGeneratorSeeded)
+    {
+        return static_cast<int>(threadLocalRandomNumberGenerator() % (static_cast<unsigned long>(RAND_MAX) + 1));
+    }
+
+    /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
+    // coverity[dont_call]
+    return std::rand();
+}
+
+void htd::seedThreadLocalRandomNumberGenerator(unsigned int seed)
+{
+    threadLocalRandomNumberGenerator.seed(seed);
+
+    threadLocalRandomNumberGeneratorSeeded = true;
+}
+
+void htd::resetThreadLocalRandomNumberGenerator(void)
+{
+    threadLocalRandomNumberGeneratorSeeded = false;
+}
+
+htd::ThreadLocalRandomNumberGeneratorGuard::ThreadLocalRandomNumberGeneratorGuard(void) : generator_(threadLocalRandomNumberGenerator), seeded_(threadLocalRandomNumberGeneratorSeeded)
+{
+
+}
+
+htd::ThreadLocalRandomNumberGeneratorGuard::~ThreadLocalRandomNumberGeneratorGuard()
+{
+    threadLocalRandomNumberGenerator = generator_;
+
+    threadLocalRandomNumberGeneratorSeeded = seeded_;
+}
+
 void htd::print(bool input)
 {
     print(input, std::cout);
@@ -33,13 +33,15 @@
 #include <htd/IMutableHypertreeDecomposition.hpp>
 #include <htd/HypertreeDecompositionFactory.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdarg>
 #include <stdexcept>
-#include <unordered_set>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 /**
@@ -52,7 +54,7 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true), threadCount_(1)
     {
 
     }
@@ -90,9 +92,18 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  The number of worker threads which solve the set cover instances of the bags concurrently.
+     */
+    std::size_t threadCount_;
+
     /**
      *  Set the hyperedges covering the bags of the hypertree decomposition.
      *
+     *  Nodes with identical bags share a single set cover instance. The candidate containers of each instance are
+     *  restricted to the hyperedges intersecting the bag via an index from vertices to incident hyperedges. The
+     *  distinct instances are distributed among threadCount_ worker threads.
+     *
      *  @param[in] graph            The graph which was decomposed.
      *  @param[in] decomposition    The hypertree decomposition which shall be updated.
      */
@@ -322,6 +333,15 @@ void htd::HypertreeDecompositionAlgorithm::addManipulationOperations(const std::
     }
 }
 
+std::vector<htd::ILabelingFunction *> htd::HypertreeDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    ret.swap(implementation_->labelingFunctions_);
+
+    return ret;
+}
+
 bool htd::HypertreeDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return false;
@@ -349,6 +369,18 @@ void htd::HypertreeDecompositionAlgorithm::setManagementInstance(const htd::Libr
     implementation_->managementInstance_ = manager;
 }
 
+std::size_t htd::HypertreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::HypertreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 htd::HypertreeDecompositionAlgorithm * htd::HypertreeDecompositionAlgorithm::clone(void) const
 {
     htd::HypertreeDecompositionAlgorithm * ret = new htd::HypertreeDecompositionAlgorithm(managementInstance());
@@ -371,6 +403,8 @@ htd::HypertreeDecompositionAlgorithm * htd::HypertreeDecompositionAlgorithm::clo
 #endif
     }
 
+    ret->setThreadCount(implementation_->threadCount_);
+
     ret->setManagementInstance(managementInstance());
 
     return ret;
@@ -378,108 +412,255 @@ htd::HypertreeDecompositionAlgorithm * htd::HypertreeDecompositionAlgorithm::clo
 
 void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(const htd::IMultiHypergraph & graph, htd::IMutableHypertreeDecomposition & decomposition) const
 {
-    std::vector<htd::Hyperedge> relevantHyperedges;
+    /* Build an index from the vertices to the (ascending) positions of the containers they are contained in. */
+    auto buildIncidence = [](const std::vector<const std::vector<htd::vertex_t> *> & containers, std::vector<std::size_t> & offsets, std::vector<htd::index_t> & incidence)
+    {
+        htd::vertex_t maximumVertex = 0;
+
+        for (const std::vector<htd::vertex_t> * container : containers)
+        {
+            if (!container->empty() && container->back() > maximumVertex)
+            {
+                maximumVertex = container->back();
+            }
+        }
+
+        offsets.assign(maximumVertex + 2, 0);
+
+        for (const std::vector<htd::vertex_t> * container : containers)
+        {
+            for (htd::vertex_t vertex : *container)
+            {
+                ++offsets[vertex + 1];
+            }
+        }
 
-    std::vector<htd::Hyperedge> newRelevantHyperedges;
+        for (htd::index_t index = 1; index < offsets.size(); ++index)
+        {
+            offsets[index] += offsets[index - 1];
+        }
 
-    std::vector<std::vector<htd::id_t>> relevantContainers;
+        incidence.resize(offsets.back());
 
-    std::vector<std::vector<htd::id_t>> newRelevantContainers;
+        std::vector<std::size_t> insertionPositions(offsets.begin(), offsets.end() - 1);
+
+        for (htd::index_t index = 0; index < containers.size(); ++index)
+        {
+            for (htd::vertex_t vertex : *(containers[index]))
+            {
+                incidence[insertionPositions[vertex]++] = index;
+            }
+        }
+    };
 
     const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
 
-    std::size_t edgeCount = graph.edgeCount();
+    std::vector<htd::Hyperedge> allHyperedges(hyperedges.begin(), hyperedges.end());
+
+    std::vector<const std::vector<htd::vertex_t> *> allContainers;
 
-    auto it1 = hyperedges.begin();
+    allContainers.reserve(allHyperedges.size());
 
-    for (htd::index_t index1 = 0; index1 < edgeCount; ++index1)
+    for (const htd::Hyperedge & hyperedge : allHyperedges)
     {
-        const std::vector<htd::vertex_t> & elements1 = it1->sortedElements();
+        allContainers.push_back(&(hyperedge.sortedElements()));
+    }
 
-        bool maximal = true;
+    std::vector<std::size_t> incidenceOffsets;
 
-        auto it2 = it1;
+    std::vector<htd::index_t> incidentContainers;
+
+    buildIncidence(allContainers, incidenceOffsets, incidentContainers);
+
+    /* A hyperedge is relevant if it is not a subset of a later hyperedge. Every superset of a non-empty hyperedge is
+       contained in the incidence list of each of its vertices, so it suffices to inspect the shortest such list. */
+    std::vector<htd::Hyperedge> relevantHyperedges;
 
-        ++it2;
+    std::vector<const std::vector<htd::vertex_t> *> relevantContainers;
 
-        for (htd::index_t index2 = index1 + 1; index2 < edgeCount; ++index2)
+    for (htd::index_t index1 = 0; index1 < allHyperedges.size(); ++index1)
+    {
+        const std::vector<htd::vertex_t> & elements1 = *(allContainers[index1]);
+
+        bool maximal = true;
+
+        if (elements1.empty())
         {
-            const std::vector<htd::vertex_t> & elements2 = it2->sortedElements();
+            maximal = index1 + 1 == allHyperedges.size();
+        }
+        else
+        {
+            htd::vertex_t rarestVertex = elements1[0];
 
-            if (std::includes(elements2.begin(), elements2.end(), elements1.begin(), elements1.end()))
+            for (htd::vertex_t vertex : elements1)
             {
-                maximal = false;
+                if (incidenceOffsets[vertex + 1] - incidenceOffsets[vertex] < incidenceOffsets[rarestVertex + 1] - incidenceOffsets[rarestVertex])
+                {
+                    rarestVertex = vertex;
+                }
             }
 
-            ++it2;
+            auto first = incidentContainers.begin() + incidenceOffsets[rarestVertex];
+            auto last = incidentContainers.begin() + incidenceOffsets[rarestVertex + 1];
+
+            for (auto it = std::upper_bound(first, last, index1); maximal && it != last; ++it)
+            {
+                const std::vector<htd::vertex_t> & elements2 = *(allContainers[*it]);
+
+                if (std::includes(elements2.begin(), elements2.end(), elements1.begin(), elements1.end()))
+                {
+                    maximal = false;
+                }
+            }
         }
 
         if (maximal)
         {
-            relevantHyperedges.push_back(*it1);
+            relevantHyperedges.push_back(allHyperedges[index1]);
 
-            relevantContainers.push_back(elements1);
+            relevantContainers.push_back(&elements1);
         }
-
-        ++it1;
     }
 
-    htd::ISetCoverAlgorithm * setCoverAlgorithm = managementInstance_->setCoverAlgorithmFactory().createInstance();
+    /* Index the relevant containers by the vertices they contain. */
+    buildIncidence(relevantContainers, incidenceOffsets, incidentContainers);
 
-    htd::PostOrderTreeTraversal traversal;
+    htd::vertex_t maximumVertex = incidenceOffsets.size() - 2;
 
-    std::vector<htd::vertex_t> forgottenVertices;
+    /* Group the nodes by their bag content so that each distinct bag is covered only once. */
+    std::unordered_map<std::vector<htd::vertex_t>, htd::index_t> bagIndices;
 
-    traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t depth)
-    {
-        HTD_UNUSED(depth)
+    std::vector<const std::vector<htd::vertex_t> *> distinctBags;
 
-        std::vector<htd::index_t> selectedIndices;
+    const htd::ConstCollection<htd::vertex_t> & decompositionNodes = decomposition.vertices();
+
+    const std::vector<htd::vertex_t> nodes(decompositionNodes.begin(), decompositionNodes.end());
 
-        setCoverAlgorithm->computeSetCover(decomposition.bagContent(vertex), relevantContainers, selectedIndices);
+    std::vector<htd::index_t> nodeBagIndices;
 
-        std::vector<htd::Hyperedge> selectedHyperedges;
+    nodeBagIndices.reserve(nodes.size());
 
-        for (htd::index_t selectedHyperedgeIndex : selectedIndices)
+    for (htd::vertex_t node : nodes)
+    {
+        auto result = bagIndices.emplace(decomposition.bagContent(node), distinctBags.size());
+
+        if (result.second)
         {
-            selectedHyperedges.push_back(relevantHyperedges.at(selectedHyperedgeIndex));
+            distinctBags.push_back(&(result.first->first));
         }
 
-        decomposition.setCoveringEdges(vertex, selectedHyperedges);
+        nodeBagIndices.push_back(result.first->second);
+    }
 
-        if (parent != htd::Vertex::UNKNOWN)
-        {
-            std::size_t forgottenVertexCount = forgottenVertices.size();
+    std::vector<std::vector<htd::index_t>> selectedContainers(distinctBags.size());
+
+    std::atomic<std::size_t> nextBag(0);
 
-            decomposition.copyForgottenVerticesTo(parent, forgottenVertices, vertex);
+    auto coverBags = [&](htd::ISetCoverAlgorithm * setCoverAlgorithm)
+    {
+        std::vector<std::size_t> lastVisit(relevantContainers.size(), 0);
 
-            std::inplace_merge(forgottenVertices.begin(), forgottenVertices.begin() + forgottenVertexCount, forgottenVertices.end());
+        std::vector<htd::index_t> candidates;
 
-            if (forgottenVertices.size() > 0)
-            {
-                htd::index_t index = 0;
+        std::vector<std::vector<htd::id_t>> candidateContainers;
 
-                for (std::vector<htd::id_t> & container : relevantContainers)
+        std::vector<htd::index_t> selectedIndices;
+
+        for (std::size_t bagIndex = nextBag++; bagIndex < distinctBags.size(); bagIndex = nextBag++)
+        {
+            const std::vector<htd::vertex_t> & bag = *(distinctBags[bagIndex]);
+
+            candidates.clear();
+
+            for (htd::vertex_t vertex : bag)
+            {
+                if (vertex <= maximumVertex)
                 {
-                    if (!std::includes(forgottenVertices.begin(), forgottenVertices.end(), container.begin(), container.end()))
+                    for (std::size_t position = incidenceOffsets[vertex]; position < incidenceOffsets[vertex + 1]; ++position)
                     {
-                        newRelevantContainers.push_back(std::move(container));
-                        newRelevantHyperedges.push_back(std::move(relevantHyperedges.at(index)));
-                    }
+                        htd::index_t container = incidentContainers[position];
 
-                    ++index;
+                        if (lastVisit[container] != bagIndex + 1)
+                        {
+                            lastVisit[container] = bagIndex + 1;
+
+                            candidates.push_back(container);
+                        }
+                    }
                 }
+            }
+
+            /* Keep the original order of the containers so that ties are broken exactly as without the filtering. */
+            std::sort(candidates.begin(), candidates.end());
+
+            candidateContainers.resize(candidates.size());
+
+            for (htd::index_t index = 0; index < candidates.size(); ++index)
+            {
+                const std::vector<htd::id_t> & container = *(relevantContainers[candidates[index]]);
+
+                candidateContainers[index].assign(container.begin(), container.end());
+            }
+
+            selectedIndices.clear();
 
-                relevantContainers.swap(newRelevantContainers);
-                relevantHyperedges.swap(newRelevantHyperedges);
+            setCoverAlgorithm->computeSetCover(bag, candidateContainers, selectedIndices);
 
-                newRelevantContainers.clear();
-                newRelevantHyperedges.clear();
+            std::vector<htd::index_t> & target = selectedContainers[bagIndex];
+
+            for (htd::index_t selectedIndex : selectedIndices)
+            {
+                target.push_back(candidates[selectedIndex]);
             }
         }
-    });
+    };
+
+    std::size_t threadCount = std::max(std::min(threadCount_, distinctBags.size()), (std::size_t)1);
+
+    std::vector<htd::ISetCoverAlgorithm *> setCoverAlgorithms;
 
-    delete setCoverAlgorithm;
+    for (htd::index_t index = 0; index < threadCount; ++index)
+    {
+        setCoverAlgorithms.push_back(managementInstance_->setCoverAlgorithmFactory().createInstance());
+    }
+
+    if (threadCount == 1)
+    {
+        coverBags(setCoverAlgorithms[0]);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+
+        for (htd::index_t index = 0; index < threadCount; ++index)
+        {
+            threads.emplace_back(coverBags, setCoverAlgorithms[index]);
+        }
+
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    for (htd::ISetCoverAlgorithm * setCoverAlgorithm : setCoverAlgorithms)
+    {
+        delete setCoverAlgorithm;
+    }
+
+    std::vector<htd::Hyperedge> selectedHyperedges;
+
+    for (htd::index_t index = 0; index < nodes.size(); ++index)
+    {
+        selectedHyperedges.clear();
+
+        for (htd::index_t selectedHyperedgeIndex : selectedContainers[nodeBagIndices[index]])
+        {
+            selectedHyperedges.push_back(relevantHyperedges.at(selectedHyperedgeIndex));
+        }
+
+        decomposition.setCoveringEdges(nodes[index], selectedHyperedges);
+    }
 }
 
 #endif /* HTD_HTD_HYPERTREEDECOMPOSITIONALGORITHM_CPP */
@@ -0,0 +1,99 @@
+/*
+ * File:   IterationPlanner.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_ITERATIONPLANNER_CPP
+#define HTD_HTD_ITERATIONPLANNER_CPP
+
+#include <htd/Helpers.hpp>
+#include <htd/IterationPlanner.hpp>
+
+#include <algorithm>
+
+htd::IterationPlanner::IterationPlanner(const htd::LibraryInstance * const manager) : managementInstance_(manager), checkpoint_(std::chrono::steady_clock::now()), iterationDuration_(std::chrono::steady_clock::duration::zero())
+{
+    HTD_ASSERT(manager != nullptr)
+}
+
+htd::IterationPlanner::~IterationPlanner()
+{
+
+}
+
+void htd::IterationPlanner::recordIterations(std::size_t iterationCount)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    if (iterationCount > 0)
+    {
+        std::chrono::steady_clock::duration averageDuration = (now - checkpoint_) / static_cast<std::chrono::steady_clock::rep>(iterationCount);
+
+        iterationDuration_ = std::max(iterationDuration_, std::max(averageDuration, std::chrono::steady_clock::duration(1)));
+    }
+
+    checkpoint_ = now;
+}
+
+std::chrono::steady_clock::duration htd::IterationPlanner::iterationDuration(void) const
+{
+    return iterationDuration_;
+}
+
+std::size_t htd::IterationPlanner::plannedIterationCount(std::size_t requestedIterationCount) const
+{
+    if (!managementInstance_->hasDeadline())
+    {
+        return requestedIterationCount;
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    std::chrono::steady_clock::time_point deadline = managementInstance_->deadline();
+
+    if (now >= deadline)
+    {
+        return 0;
+    }
+
+    if (iterationDuration_ == std::chrono::steady_clock::duration::zero())
+    {
+        return std::min(requestedIterationCount, (std::size_t)1);
+    }
+
+    std::chrono::steady_clock::rep affordableIterationCount = (deadline - now) / iterationDuration_;
+
+    if (static_cast<unsigned long long>(affordableIterationCount) < static_cast<unsigned long long>(requestedIterationCount))
+    {
+        return static_cast<std::size_t>(affordableIterationCount);
+    }
+
+    return requestedIterationCount;
+}
+
+bool htd::IterationPlanner::allowsIteration(void) const
+{
+    return plannedIterationCount(1) > 0;
+}
+
+#endif /* HTD_HTD_ITERATIONPLANNER_CPP */
@@ -27,10 +27,18 @@
 
 #include <htd/IterativeImprovementTreeDecompositionAlgorithm.hpp>
 
+#include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/Helpers.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/IterationPlanner.hpp>
+#include <htd/WidthFitnessFunction.hpp>
 
+#include <atomic>
 #include <cstdarg>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 /**
  *  Private implementation details of class htd::IterativeImprovementTreeDecompositionAlgorithm.
@@ -45,7 +53,7 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @param[in] fitnessFunction  The fitness function which will be used to evaluate the constructed tree decompositions.
      */
     Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction)
-        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
+        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
     {
 
     }
@@ -82,6 +90,11 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The number of worker threads which shall compute decompositions concurrently.
+     */
+    std::size_t threadCount_;
+
     /**
      *  The decomposition algorithm which will be called repeatedly.
      */
@@ -110,8 +123,267 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @return A mutable tree decompostion of the given graph.
      */
     htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph) const;
+
+    /**
+     *  Compute a candidate decomposition using the given instance of the base algorithm.
+     *
+     *  If the fitness function is htd::WidthFitnessFunction and the base algorithm is bucket elimination, the width of
+     *  the elimination ordering is evaluated first and the decomposition is only materialized if its maximum bag size
+     *  does not exceed maxBagSize. Otherwise, the decomposition is always computed.
+     *
+     *  The maximum bag sizes of the best candidates are measured after post-processing. The width of the elimination
+     *  ordering is therefore only comparable to maxBagSize if no post-processing operations are configured, neither
+     *  for the base algorithm nor for this algorithm nor for the current call. Otherwise, the decomposition is always
+     *  computed as well.
+     *
+     *  @param[in] algorithm                The instance of the base algorithm.
+     *  @param[in] graph                    The input graph.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] postProcessingOperations The manipulation operations which will be applied after the global ones.
+     *  @param[in] maxBagSize               The maximum bag size a candidate may have to be worth materializing.
+     *
+     *  @return The candidate decomposition or nullptr if no decomposition was computed.
+     */
+    htd::IMutableTreeDecomposition * computeCandidate(const htd::ITreeDecompositionAlgorithm & algorithm,
+                                                      const htd::IMultiHypergraph & graph,
+                                                      const htd::IPreprocessedGraph & preprocessedGraph,
+                                                      const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                      std::size_t maxBagSize) const;
+
+    /**
+     *  Apply the global manipulation operations and labeling functions as well as the given ones to a decomposition.
+     *
+     *  @param[in] graph                    The input graph.
+     *  @param[in] decomposition            The decomposition which shall be post-processed.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied after the global ones.
+     *  @param[in] postProcessingOperations The manipulation operations which shall be applied after the global ones.
+     */
+    void postProcess(const htd::IMultiHypergraph & graph,
+                     htd::IMutableTreeDecomposition & decomposition,
+                     const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                     const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations) const;
+
+    /**
+     *  Perform the iterations concurrently on threadCount_ worker threads, each of them owning a clone of the base decomposition algorithm.
+     *
+     *  Iteration i uses a random number generator seeded with (s + i), where s is drawn once in the calling thread. Hence, if all
+     *  iterations are performed, the result is independent of the thread scheduling: Among all decompositions with the best fitness
+     *  value, the one of the earliest iteration is returned.
+     *
+     *  @param[in] graph                    The input graph.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format, shared read-only by all worker threads.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied after the global ones.
+     *  @param[in] postProcessingOperations The manipulation operations which shall be applied after the global ones.
+     *  @param[in] progressCallback         A callback function which is invoked for each materialized decomposition, calls are serialized.
+     *                                      Candidates pruned by the width fast path of computeCandidate() are not reported.
+     *
+     *  @return The best decomposition found or nullptr if no decomposition was completed.
+     */
+    htd::ITreeDecomposition * computeDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                             const htd::IPreprocessedGraph & preprocessedGraph,
+                                                             const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                                                             const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                             const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const;
 };
 
+htd::IMutableTreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::computeCandidate(const htd::ITreeDecompositionAlgorithm & algorithm,
+                                                                                                                      const htd::IMultiHypergraph & graph,
+                                                                                                                      const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                                                      const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                                                                                      std::size_t maxBagSize) const
+{
+    if (maxBagSize != (std::size_t)-1 && postProcessingOperations_.empty() && postProcessingOperations.empty() && dynamic_cast<const htd::WidthFitnessFunction *>(fitnessFunction_) != nullptr)
+    {
+        const htd::BucketEliminationTreeDecompositionAlgorithm * bucketEliminationAlgorithm = dynamic_cast<const htd::BucketEliminationTreeDecompositionAlgorithm *>(&algorithm);
+
+        if (bucketEliminationAlgorithm != nullptr && !bucketEliminationAlgorithm->hasPostProcessingOperations())
+        {
+            return dynamic_cast<htd::IMutableTreeDecomposition *>(bucketEliminationAlgorithm->computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>(), maxBagSize, 1).first);
+        }
+    }
+
+    return dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm.computeDecomposition(graph, preprocessedGraph));
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::postProcess(const htd::IMultiHypergraph & graph,
+                                                                                      htd::IMutableTreeDecomposition & decomposition,
+                                                                                      const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                                                                                      const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations) const
+{
+    for (const htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations_)
+    {
+        operation->apply(graph, decomposition);
+    }
+
+    for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+    {
+        operation->apply(graph, decomposition);
+    }
+
+    for (const htd::ILabelingFunction * labelingFunction : labelingFunctions_)
+    {
+        for (htd::vertex_t vertex : decomposition.vertices())
+        {
+            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+            delete labelCollection;
+
+            decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+        }
+    }
+
+    for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
+    {
+        for (htd::vertex_t vertex : decomposition.vertices())
+        {
+            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+            delete labelCollection;
+
+            decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+        }
+    }
+}
+
+htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::computeDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                                                                                            const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                                                            const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                                                                                                                            const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                                                                                            const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    unsigned int baseSeed = static_cast<unsigned int>(htd::randomNumber());
+
+    std::atomic<std::size_t> nextIteration(0);
+
+    std::atomic<std::size_t> nonImprovementCount(0);
+
+    /* The evaluation of the best decomposition is published via std::atomic_load / std::atomic_store so that
+       non-improving candidates, i.e. the vast majority, can be rejected without acquiring the mutex. */
+    std::shared_ptr<htd::FitnessEvaluation> bestEvaluation;
+
+    htd::IMutableTreeDecomposition * bestDecomposition = nullptr;
+
+    htd::index_t bestIteration = 0;
+
+    std::size_t bestMaxBagSize = (std::size_t)-1;
+
+    std::mutex bestDecompositionMutex;
+
+    std::mutex progressCallbackMutex;
+
+    std::vector<std::thread> workers;
+
+    workers.reserve(threadCount_);
+
+    for (htd::index_t worker = 0; worker < threadCount_; ++worker)
+    {
+        workers.emplace_back([&]()
+        {
+            std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(algorithm_->clone());
+
+            htd::IterationPlanner planner(managementInstance_);
+
+            htd::index_t iteration = nextIteration.fetch_add(1);
+
+            while ((iteration == 0 || iterationCount_ == 0 || iteration < iterationCount_) && nonImprovementCount.load() <= nonImprovementLimit_ && !managementInstance.isTerminated() && (iteration == 0 || planner.allowsIteration()))
+            {
+                htd::seedThreadLocalRandomNumberGenerator(baseSeed + static_cast<unsigned int>(iteration));
+
+                /* Candidates of earlier iterations win ties, so they only need to match the best maximum bag size. */
+                std::size_t maxBagSize = (std::size_t)-1;
+
+                {
+                    std::lock_guard<std::mutex> lock(bestDecompositionMutex);
+
+                    if (bestMaxBagSize != (std::size_t)-1)
+                    {
+                        maxBagSize = iteration < bestIteration || bestMaxBagSize == 0 ? bestMaxBagSize : bestMaxBagSize - 1;
+                    }
+                }
+
+                htd::IMutableTreeDecomposition * currentDecomposition = computeCandidate(*algorithm, graph, preprocessedGraph, postProcessingOperations, maxBagSize);
+
+                if (currentDecomposition != nullptr)
+                {
+                    postProcess(graph, *currentDecomposition, labelingFunctions, postProcessingOperations);
+
+                    if (!managementInstance.isTerminated())
+                    {
+                        std::shared_ptr<htd::FitnessEvaluation> currentEvaluation(fitnessFunction_->fitness(graph, *currentDecomposition));
+
+                        if (!managementInstance.isTerminated())
+                        {
+                            {
+                                std::lock_guard<std::mutex> lock(progressCallbackMutex);
+
+                                progressCallback(graph, *currentDecomposition, *currentEvaluation);
+                            }
+
+                            bool improvement = false;
+
+                            std::shared_ptr<htd::FitnessEvaluation> snapshot = std::atomic_load(&bestEvaluation);
+
+                            if (snapshot == nullptr || !(*snapshot > *currentEvaluation))
+                            {
+                                std::lock_guard<std::mutex> lock(bestDecompositionMutex);
+
+                                snapshot = std::atomic_load(&bestEvaluation);
+
+                                improvement = snapshot == nullptr || *currentEvaluation > *snapshot;
+
+                                if (improvement || (*currentEvaluation == *snapshot && iteration < bestIteration))
+                                {
+                                    std::swap(bestDecomposition, currentDecomposition);
+
+                                    bestIteration = iteration;
+
+                                    bestMaxBagSize = bestDecomposition->maximumBagSize();
+
+                                    std::atomic_store(&bestEvaluation, currentEvaluation);
+                                }
+                            }
+
+                            if (improvement)
+                            {
+                                nonImprovementCount.store(0);
+                            }
+                            else
+                            {
+                                ++nonImprovementCount;
+                            }
+                        }
+                    }
+
+                    delete currentDecomposition;
+                }
+                else
+                {
+                    ++nonImprovementCount;
+                }
+
+                planner.recordIterations(1);
+
+                iteration = nextIteration.fetch_add(1);
+            }
+
+            htd::resetThreadLocalRandomNumberGenerator();
+        });
+    }
+
+    for (std::thread & worker : workers)
+    {
+        worker.join();
+    }
+
+    return bestDecomposition;
+}
+
 htd::IterativeImprovementTreeDecompositionAlgorithm::IterativeImprovementTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction) : implementation_(new Implementation(manager, algorithm, fitnessFunction))
 {
     HTD_ASSERT(algorithm != nullptr)
@@ -207,57 +479,37 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
         }
     }
 
-    htd::ITreeDecomposition * ret = nullptr;
-
-    htd::FitnessEvaluation * bestEvaluation = nullptr;
-
-    std::size_t nonImprovementCount = 0;
-
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
-
-    for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated(); ++iteration)
+    if (implementation_->threadCount_ > 1)
     {
-        htd::IMutableTreeDecomposition * currentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph));
+        htd::ITreeDecomposition * ret = implementation_->computeDecompositionInParallel(graph, preprocessedGraph, labelingFunctions, postProcessingOperations, progressCallback);
 
-        if (currentDecomposition != nullptr)
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
         {
-            for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
-            {
-                operation->apply(graph, *currentDecomposition);
-            }
+            delete operation;
+        }
 
-            for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
-            {
-                operation->apply(graph, *currentDecomposition);
-            }
+        return ret;
+    }
 
-            for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
-            {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+    htd::ITreeDecomposition * ret = nullptr;
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+    htd::FitnessEvaluation * bestEvaluation = nullptr;
 
-                    delete labelCollection;
+    std::size_t bestMaxBagSize = (std::size_t)-1;
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
-                }
-            }
+    std::size_t nonImprovementCount = 0;
 
-            for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
-            {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+    htd::IterationPlanner planner(implementation_->managementInstance_);
 
-                    delete labelCollection;
+    for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated() && (iteration == 0 || planner.allowsIteration()); ++iteration)
+    {
+        htd::IMutableTreeDecomposition * currentDecomposition = implementation_->computeCandidate(*(implementation_->algorithm_), graph, preprocessedGraph, postProcessingOperations, bestMaxBagSize != (std::size_t)-1 && bestMaxBagSize > 0 ? bestMaxBagSize - 1 : (std::size_t)-1);
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
-                }
-            }
+        if (currentDecomposition != nullptr)
+        {
+            implementation_->postProcess(graph, *currentDecomposition, labelingFunctions, postProcessingOperations);
 
             if (!managementInstance.isTerminated())
             {
@@ -280,6 +532,8 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
 
                         bestEvaluation = currentEvaluation;
 
+                        bestMaxBagSize = ret->maximumBagSize();
+
                         nonImprovementCount = 0;
                     }
                     else
@@ -307,6 +561,8 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
         {
             ++nonImprovementCount;
         }
+
+        planner.recordIterations(1);
     }
 
     for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
@@ -402,6 +658,17 @@ void htd::IterativeImprovementTreeDecompositionAlgorithm::addManipulationOperati
     }
 }
 
+std::vector<htd::ILabelingFunction *> htd::IterativeImprovementTreeDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret = implementation_->algorithm_->releaseLabelingFunctions();
+
+    ret.insert(ret.end(), implementation_->labelingFunctions_.begin(), implementation_->labelingFunctions_.end());
+
+    implementation_->labelingFunctions_.clear();
+
+    return ret;
+}
+
 bool htd::IterativeImprovementTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return true;
@@ -437,6 +704,18 @@ void htd::IterativeImprovementTreeDecompositionAlgorithm::setNonImprovementLimit
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::IterativeImprovementTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 const htd::LibraryInstance * htd::IterativeImprovementTreeDecompositionAlgorithm::managementInstance(void) const noexcept
 {
     return implementation_->managementInstance_;
@@ -473,6 +752,7 @@ htd::IterativeImprovementTreeDecompositionAlgorithm * htd::IterativeImprovementT
 
     ret->setIterationCount(implementation_->iterationCount_);
     ret->setNonImprovementLimit(implementation_->nonImprovementLimit_);
+    ret->setThreadCount(implementation_->threadCount_);
 
     return ret;
 }
@@ -30,8 +30,9 @@
 #include <htd/JoinNodeReplacementOperation.hpp>
 
 #include <algorithm>
-#include <stack>
+#include <iterator>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 /**
@@ -80,27 +81,23 @@ struct HistoryEntry
     htd::vertex_t vertex;
 
     /**
-     *  The number of times how often the node was visited.
+     *  The position of the next child of the node which shall be visited.
      */
-    std::size_t visits;
+    htd::index_t nextChild;
 
     /**
-     *  The collection of vertices which are still required by another child of a join node.
+     *  The position within the collection of added vertices at which the vertices start which were added to the
+     *  required vertices when the node was visited.
      */
-    std::vector<htd::vertex_t> requiredVertices;
-
-    /**
-     *  The collection of children which are available to be assigned as new child of the resulting path node.
-     */
-    std::unordered_set<htd::vertex_t> availableChildren;
+    std::size_t firstAddedVertex;
 
     /**
      *  Constructor of a history entry for the tree traversal.
      *
      *  @param[in] currentVertex    The decomposition node under focus.
-     *  @param[in] visits           The number of times how often the node was visited.
+     *  @param[in] firstAddedVertex The position at which the vertices added to the required vertices by the node start.
      */
-    HistoryEntry(htd::vertex_t currentVertex, std::size_t visits) : vertex(currentVertex), visits(visits), requiredVertices(), availableChildren()
+    HistoryEntry(htd::vertex_t currentVertex, std::size_t firstAddedVertex) : vertex(currentVertex), nextChild(0), firstAddedVertex(firstAddedVertex)
     {
 
     }
@@ -132,234 +129,149 @@ void htd::JoinNodeReplacementOperation::apply(const htd::IMultiHypergraph & grap
 
     if (decomposition.vertexCount() > 0)
     {
-        std::size_t currentVisits = 0;
+        htd::vertex_t maximumVertex = 0;
 
-        htd::vertex_t currentNode = decomposition.root();
+        for (htd::vertex_t node : decomposition.vertices())
+        {
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
 
-        htd::vertex_t attachmentPoint = htd::Vertex::UNKNOWN;
+            if (!bag.empty() && bag.back() > maximumVertex)
+            {
+                maximumVertex = bag.back();
+            }
+        }
 
-        std::stack<HistoryEntry> parentStack;
+        /* The last node which found the vertex in the bag of one of its children. */
+        std::vector<htd::vertex_t> lastMarkingNode(maximumVertex + 1, htd::Vertex::UNKNOWN);
 
+        /* The vertices which have to be retained in all bags until the subtree of the node which requires them is finished. */
         std::vector<htd::vertex_t> requiredVertices;
 
-        const htd::ConstCollection<htd::vertex_t> & childCollection = decomposition.children(currentNode);
+        /* The vertices which were added to the required vertices by the nodes on the stack, grouped by node. */
+        std::vector<htd::vertex_t> addedVertices;
 
-        std::unordered_set<htd::vertex_t> availableChildren(childCollection.begin(), childCollection.end());
+        std::vector<htd::vertex_t> candidateVertices;
 
-        while (parentStack.size() > 0 || currentNode != htd::Vertex::UNKNOWN)
-        {
-            if (currentNode != htd::Vertex::UNKNOWN)
-            {
-                DEBUGGING_CODE(std::cout << std::endl << std::endl << "NODE: " << currentNode << std::endl;)
+        std::vector<htd::vertex_t> newContent;
 
-                if (currentVisits == 0)
-                {
-                    if (attachmentPoint != htd::Vertex::UNKNOWN && decomposition.parent(currentNode) != attachmentPoint)
-                    {
-                        DEBUGGING_CODE(std::cout << "   ATTACH " << currentNode << " TO " << attachmentPoint << std::endl;)
+        /* The nodes which have to be attached to the node visited before them in pre-order. */
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> newParents;
 
-                        decomposition.setParent(currentNode, attachmentPoint);
-                    }
+        std::vector<HistoryEntry> parentStack;
 
-                    attachmentPoint = currentNode;
-                }
+        htd::vertex_t attachmentPoint = htd::Vertex::UNKNOWN;
+
+        htd::vertex_t currentNode = decomposition.root();
 
-                if (!availableChildren.empty())
+        while (currentNode != htd::Vertex::UNKNOWN || !parentStack.empty())
+        {
+            if (currentNode != htd::Vertex::UNKNOWN)
+            {
+                if (attachmentPoint != htd::Vertex::UNKNOWN && decomposition.parent(currentNode) != attachmentPoint)
                 {
-                    htd::vertex_t selectedChild = *(availableChildren.begin());
+                    newParents.emplace_back(currentNode, attachmentPoint);
+                }
 
-                    std::unordered_set<htd::vertex_t> newAvailableChildren(availableChildren);
+                attachmentPoint = currentNode;
 
-                    newAvailableChildren.erase(selectedChild);
+                if (!requiredVertices.empty())
+                {
+                    const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(currentNode);
 
-                    availableChildren.erase(selectedChild);
+                    newContent.clear();
 
-                    DEBUGGING_CODE(
-                    std::cout << "   SELECTED CHILD: " << selectedChild << std::endl;
-                    std::cout << "   REMAINING CHILDREN: ";
-                    htd::print(availableChildren, true);
-                    std::cout << std::endl;
+                    std::set_union(bagContent.begin(), bagContent.end(), requiredVertices.begin(), requiredVertices.end(), std::back_inserter(newContent));
 
-                    std::cout << "OLD REQUIRED VERTICES " << currentNode << ": ";
-                    htd::print(requiredVertices, false);
-                    std::cout << std::endl << std::endl;
-                    )
+                    if (newContent.size() > bagContent.size())
+                    {
+                        decomposition.mutableBagContent(currentNode) = newContent;
+                    }
 
-                    std::vector<htd::vertex_t> newRequiredVertices;
+                    for (auto & labelingFunction : labelingFunctions)
+                    {
+                        htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(currentNode);
 
-                    const htd::ConstCollection<htd::vertex_t> & rememberedVertexCollection = decomposition.rememberedVertices(currentNode);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(newContent, *labelCollection);
 
-                    std::set_union(requiredVertices.begin(), requiredVertices.end(), rememberedVertexCollection.begin(), rememberedVertexCollection.end(), std::back_inserter(newRequiredVertices));
+                        delete labelCollection;
 
-                    DEBUGGING_CODE(
-                    std::cout << "NEW REQUIRED VERTICES " << currentNode << ": ";
-                    htd::print(newRequiredVertices, false);
-                    std::cout << std::endl << std::endl;
-                    )
+                        decomposition.setVertexLabel(labelingFunction->name(), currentNode, newLabel);
+                    }
+                }
 
-                    std::swap(requiredVertices, newRequiredVertices);
+                std::size_t firstAddedVertex = addedVertices.size();
 
-                    //TODO Fix!
-                    /*
-                    if (availableChildren.empty())
+                /* The vertices of the node which occur in one of its children have to be retained in the bags of all
+                   nodes which are visited before the last child of the node is finished. */
+                if (decomposition.childCount(currentNode) > 0)
+                {
+                    for (htd::vertex_t child : decomposition.children(currentNode))
                     {
-                        if (attachmentPoint == decomposition.parent(selectedChild))
+                        for (htd::vertex_t vertex : decomposition.bagContent(child))
                         {
-                            htd::Collection<htd::vertex_t> introducedVertexCollection = decomposition.introducedVertices(currentNode, selectedChild);
-
-                            std::cout << "   INTRODUCED VERTICES: ";
-                            htd::print(introducedVertexCollection, false);
-                            std::cout << std::endl;
-
-                            std::vector<htd::vertex_t> newRequiredVertices2;
-
-                            std::set_difference(requiredVertices.begin(), requiredVertices.end(), introducedVertexCollection.begin(), introducedVertexCollection.end(), std::back_inserter(newRequiredVertices));
-
-                            std::swap(requiredVertices, newRequiredVertices2);
+                            lastMarkingNode[vertex] = currentNode;
                         }
                     }
-                    */
-
-                    parentStack.push(HistoryEntry(currentNode, currentVisits + 1));
-
-                    parentStack.top().availableChildren = newAvailableChildren;
-
-                    parentStack.top().requiredVertices = requiredVertices;
 
-                    currentNode = selectedChild;
+                    candidateVertices.clear();
 
-                    availableChildren.clear();
-
-                    const htd::ConstCollection<htd::vertex_t> & newChildCollection = decomposition.children(currentNode);
-
-                    availableChildren.insert(newChildCollection.begin(), newChildCollection.end());
-
-                    if (requiredVertices.size() > 0)
+                    for (htd::vertex_t vertex : decomposition.bagContent(currentNode))
                     {
-                        const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(currentNode);
-
-                        std::vector<htd::vertex_t> newBagContent;
-
-                        DEBUGGING_CODE(
-                        std::cout << "OLD BAG CONTENT " << currentNode << ": ";
-                        htd::print(bagContent, false);
-                        std::cout << std::endl << std::endl;
-                        )
-
-                        std::set_union(bagContent.begin(), bagContent.end(), requiredVertices.begin(), requiredVertices.end(), std::back_inserter(newBagContent));
-
-                        DEBUGGING_CODE(
-                        std::cout << "NEW BAG CONTENT " << currentNode << ": ";
-                        htd::print(newBagContent, false);
-                        std::cout << std::endl << std::endl;
-                        )
-
-                        decomposition.mutableBagContent(currentNode) = newBagContent;
-
-                        for (auto & labelingFunction : labelingFunctions)
+                        if (lastMarkingNode[vertex] == currentNode)
                         {
-                            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(currentNode);
-
-                            htd::ILabel * newLabel = labelingFunction->computeLabel(newBagContent, *labelCollection);
-
-                            delete labelCollection;
-
-                            decomposition.setVertexLabel(labelingFunction->name(), currentNode, newLabel);
+                            candidateVertices.push_back(vertex);
                         }
                     }
 
-                    currentVisits = 0;
-                }
-                else
-                {
-                    currentNode = htd::Vertex::UNKNOWN;
-                }
-            }
-            else
-            {
-                DEBUGGING_CODE(
-                std::cout << "   BACKTRACKING TO " << parentStack.top().vertex << std::endl;
-
-                std::cout << "   REQUIRED VERTICES 1: ";
-                htd::print(requiredVertices, false);
-                std::cout << std::endl;
-                )
-
-                currentNode = parentStack.top().vertex;
-
-                currentVisits = parentStack.top().visits;
-
-                requiredVertices = parentStack.top().requiredVertices;
-
-                availableChildren = parentStack.top().availableChildren;
-
-                parentStack.pop();
-
-                DEBUGGING_CODE(
-                std::cout << "   REQUIRED VERTICES 2: ";
-                htd::print(requiredVertices, false);
-                std::cout << std::endl;
-                )
+                    std::set_difference(candidateVertices.begin(), candidateVertices.end(), requiredVertices.begin(), requiredVertices.end(), std::back_inserter(addedVertices));
 
-                if (currentNode != decomposition.root())
-                {
-                    std::vector<htd::vertex_t> potentiallyUnneededVertices;
-
-                    std::set_difference(requiredVertices.begin(), requiredVertices.end(), parentStack.top().requiredVertices.begin(), parentStack.top().requiredVertices.end(), std::back_inserter(potentiallyUnneededVertices));
-
-                    DEBUGGING_CODE(
-                    std::cout << "POTENTIALLY UNNEEDED VERTICES: ";
-                    htd::print(potentiallyUnneededVertices, false);
-                    std::cout << std::endl;
-                    )
-
-                    std::unordered_set<htd::vertex_t> unneededVertices(potentiallyUnneededVertices.begin(), potentiallyUnneededVertices.end());
-
-                    for (htd::vertex_t child : availableChildren)
+                    if (addedVertices.size() > firstAddedVertex)
                     {
-                        const std::vector<htd::vertex_t> & childBagContent = decomposition.bagContent(child);
+                        newContent.clear();
 
-                        DEBUGGING_CODE(
-                        std::cout << "   SIBLING: " << child << std::endl;
-                        std::cout << "      CONTENT: ";
-                        htd::print(childBagContent);
-                        std::cout << std::endl;
-                        )
+                        std::merge(requiredVertices.begin(), requiredVertices.end(), addedVertices.begin() + firstAddedVertex, addedVertices.end(), std::back_inserter(newContent));
 
-                        for (htd::vertex_t requiredVertex : childBagContent)
-                        {
-                            unneededVertices.erase(requiredVertex);
-                        }
+                        std::swap(requiredVertices, newContent);
                     }
+                }
 
-                    std::vector<htd::vertex_t> unneededVertices2(unneededVertices.begin(), unneededVertices.end());
+                parentStack.emplace_back(currentNode, firstAddedVertex);
 
-                    std::sort(unneededVertices2.begin(), unneededVertices2.end());
+                currentNode = htd::Vertex::UNKNOWN;
+            }
+            else
+            {
+                HistoryEntry & entry = parentStack.back();
 
-                    DEBUGGING_CODE(
-                    std::cout << "   REQUIRED VERTICES: ";
-                    htd::print(requiredVertices, false);
-                    std::cout << std::endl;
+                if (entry.nextChild < decomposition.childCount(entry.vertex))
+                {
+                    currentNode = decomposition.childAtPosition(entry.vertex, entry.nextChild);
 
-                    std::cout << "   UNNEEDED VERTICES: ";
-                    htd::print(unneededVertices2, false);
-                    std::cout << std::endl;
-                    )
+                    ++(entry.nextChild);
+                }
+                else
+                {
+                    if (addedVertices.size() > entry.firstAddedVertex)
+                    {
+                        newContent.clear();
 
-                    std::vector<htd::vertex_t> newRequiredVertices;
+                        std::set_difference(requiredVertices.begin(), requiredVertices.end(), addedVertices.begin() + entry.firstAddedVertex, addedVertices.end(), std::back_inserter(newContent));
 
-                    std::set_difference(requiredVertices.begin(), requiredVertices.end(), unneededVertices2.begin(), unneededVertices2.end(), std::back_inserter(newRequiredVertices));
+                        std::swap(requiredVertices, newContent);
 
-                    DEBUGGING_CODE(
-                    std::cout << "   NEW REQUIRED VERTICES: ";
-                    htd::print(newRequiredVertices, false);
-                    std::cout << std::endl;
-                    )
+                        addedVertices.resize(entry.firstAddedVertex);
+                    }
 
-                    requiredVertices = newRequiredVertices;
+                    parentStack.pop_back();
                 }
             }
         }
+
+        /* The tree structure is changed after the traversal so that the children of each node remain unchanged while it is visited. */
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & newParent : newParents)
+        {
+            decomposition.setParent(newParent.first, newParent.second);
+        }
     }
 }
 
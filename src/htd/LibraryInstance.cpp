@@ -56,6 +56,8 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/GraphSeparatorAlgorithmFactory.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <csignal>
 
 /**
@@ -68,7 +70,7 @@ struct htd::LibraryInstance::Implementation
      *
      *  @param[in] id   The identifier of the management instance.
      */
-    Implementation(htd::id_t id) : id_(id), nextHandlerId_(htd::Id::FIRST), terminated_(false)
+    Implementation(htd::id_t id) : id_(id), nextHandlerId_(htd::Id::FIRST), terminated_(false), deadline_(std::chrono::steady_clock::time_point::max().time_since_epoch().count())
     {
 
     }
@@ -130,8 +132,17 @@ struct htd::LibraryInstance::Implementation
 
     /**
      *  A boolean flag indicating whether the current management instance was terminated.
+     *
+     *  The flag is atomic because it is polled by worker threads of parallel algorithms.
      */
-    bool terminated_;
+    std::atomic<bool> terminated_;
+
+    /**
+     *  The deadline of the current management instance, stored as the number of ticks of std::chrono::steady_clock.
+     *
+     *  The maximum representable point in time indicates that no deadline is set.
+     */
+    std::atomic<std::chrono::steady_clock::rep> deadline_;
 
     /**
      *  The factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
@@ -309,6 +320,45 @@ void htd::LibraryInstance::reset(void)
     implementation_->terminated_ = false;
 }
 
+void htd::LibraryInstance::setDeadline(const std::chrono::steady_clock::time_point & deadline)
+{
+    implementation_->deadline_ = deadline.time_since_epoch().count();
+}
+
+void htd::LibraryInstance::setTimeLimit(const std::chrono::steady_clock::duration & timeLimit)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    if (timeLimit < std::chrono::steady_clock::time_point::max() - now)
+    {
+        setDeadline(now + timeLimit);
+    }
+    else
+    {
+        removeDeadline();
+    }
+}
+
+void htd::LibraryInstance::removeDeadline(void)
+{
+    implementation_->deadline_ = std::chrono::steady_clock::time_point::max().time_since_epoch().count();
+}
+
+bool htd::LibraryInstance::hasDeadline(void) const
+{
+    return implementation_->deadline_ != std::chrono::steady_clock::time_point::max().time_since_epoch().count();
+}
+
+std::chrono::steady_clock::time_point htd::LibraryInstance::deadline(void) const
+{
+    return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(implementation_->deadline_.load()));
+}
+
+bool htd::LibraryInstance::isDeadlineReached(void) const
+{
+    return hasDeadline() && std::chrono::steady_clock::now() >= deadline();
+}
+
 htd::ConnectedComponentAlgorithmFactory & htd::LibraryInstance::connectedComponentAlgorithmFactory(void)
 {
     return *(implementation_->connectedComponentAlgorithmFactory_);
@@ -125,7 +125,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
 
                 std::set_difference(childBag.begin(), childBag.end(), forgottenVertices.begin(), forgottenVertices.begin() + index, std::back_inserter(newBagContent));
 
-                htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(node);
+                htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(attachmentPoint);
 
                 newInducedHyperedges.restrictTo(newBagContent);
 
@@ -192,7 +192,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
 
                     std::set_difference(childBag.begin(), childBag.end(), forgottenVertices.begin(), forgottenVertices.begin() + index, std::back_inserter(newBagContent));
 
-                    htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(vertex);
+                    htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(attachmentPoint);
 
                     newInducedHyperedges.restrictTo(newBagContent);
 
@@ -275,7 +275,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
 
                 std::set_difference(childBag.begin(), childBag.end(), forgottenVertices.begin(), forgottenVertices.begin() + index, std::back_inserter(newBagContent));
 
-                htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(node);
+                htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(attachmentPoint);
 
                 newInducedHyperedges.restrictTo(newBagContent);
 
@@ -344,7 +344,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
 
                     std::set_difference(childBag.begin(), childBag.end(), forgottenVertices.begin(), forgottenVertices.begin() + index, std::back_inserter(newBagContent));
 
-                    htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(vertex);
+                    htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(attachmentPoint);
 
                     newInducedHyperedges.restrictTo(newBagContent);
 
@@ -31,10 +31,10 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 
 #include <algorithm>
-#include <unordered_set>
+#include <atomic>
 
 /**
  *  Private implementation details of class htd::MinDegreeOrderingAlgorithm.
@@ -67,10 +67,11 @@ struct htd::MinDegreeOrderingAlgorithm::Implementation
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
      *  @param[out] target              The target vector to which the computed ordering shall be appended.
      *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *  @param[in] sharedMaxBagSize     The upper bound for the maximum bag size which may be tightened concurrently by other threads.
      *
      *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
      */
-    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const noexcept;
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize, const std::atomic<std::size_t> & sharedMaxBagSize) const noexcept;
 };
 
 htd::MinDegreeOrderingAlgorithm::MinDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -108,6 +109,13 @@ htd::IVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const ht
 }
 
 htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const noexcept
+{
+    std::atomic<std::size_t> sharedMaxBagSize((std::size_t)-1);
+
+    return computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount, sharedMaxBagSize);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const noexcept
 {
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
@@ -122,7 +130,7 @@ htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrder
     {
         ordering.clear();
 
-        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, ordering, maxBagSize);
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, ordering, maxBagSize, sharedMaxBagSize);
 
         ++iterations;
     }
@@ -138,21 +146,17 @@ htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrder
     return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
 }
 
-std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const noexcept
+std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize, const std::atomic<std::size_t> & sharedMaxBagSize) const noexcept
 {
     std::size_t ret = 0;
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
-
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
-
     std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
 
     std::vector<htd::vertex_t> difference;
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    htd::BucketPriorityQueue priorityQueue(neighborhood.size(), neighborhood.size() + 1);
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
@@ -160,7 +164,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     ret = preprocessedGraph.minTreeWidth() + 1;
 
-    for (htd::vertex_t vertex : vertices)
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
     {
         std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
@@ -169,11 +173,11 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
         priorityQueue.push(vertex, currentNeighborhood.size());
     }
 
-    while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    while (size > 0 && ret <= maxBagSize && ret <= sharedMaxBagSize.load(std::memory_order_relaxed) && !managementInstance_->isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        htd::vertex_t selectedVertex = priorityQueue.selectRandomTopElement();
 
-        priorityQueue.eraseFromTopCollection(selectedVertex);
+        priorityQueue.erase(selectedVertex);
 
         std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
 
@@ -182,16 +186,12 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
             ret = selectedNeighborhood.size();
         }
 
-        vertices.erase(selectedVertex);
-
         selectedNeighborhood.erase(std::lower_bound(selectedNeighborhood.begin(), selectedNeighborhood.end(), selectedVertex));
 
         for (htd::vertex_t neighbor : selectedNeighborhood)
         {
             std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
 
-            std::size_t oldNeighborhoodSize = currentNeighborhood.size();
-
             /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
             // coverity[use_iterator]
             currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
@@ -207,7 +207,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
                 difference.clear();
             }
 
-            priorityQueue.updatePriority(neighbor, oldNeighborhoodSize, currentNeighborhood.size());
+            priorityQueue.updatePriority(neighbor, currentNeighborhood.size());
         }
 
         std::vector<htd::vertex_t>().swap(selectedNeighborhood);
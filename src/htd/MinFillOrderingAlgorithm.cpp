@@ -31,10 +31,10 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 
 #include <algorithm>
-#include <unordered_set>
+#include <atomic>
 
 /**
  *  Private implementation details of class htd::AdvancedMinFillOrderingAlgorithm.
@@ -104,7 +104,7 @@ struct htd::MinFillOrderingAlgorithm::Implementation
          *  @param[in] managementInstance   The management instance to which the new algorithm belongs.
          *  @param[in] preprocessedGraph    The input graph in preprocessed format.
          */
-        PreparedInput(const htd::LibraryInstance & managementInstance, const htd::IPreprocessedGraph & preprocessedGraph) : minFill((std::size_t)-1), totalFill(0), fillValue()
+        PreparedInput(const htd::LibraryInstance & managementInstance, const htd::IPreprocessedGraph & preprocessedGraph) : minFill((std::size_t)-1), totalFill(0), fillValue(), neighborhoodOffsets(), neighborhoodArena()
         {
             HTD_UNUSED(managementInstance)
 
@@ -112,6 +112,8 @@ struct htd::MinFillOrderingAlgorithm::Implementation
 
             fillValue.resize(size, 0);
 
+            std::vector<bool> remaining(size, false);
+
             for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
             {
                 const std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
@@ -121,6 +123,42 @@ struct htd::MinFillOrderingAlgorithm::Implementation
                 fillValue[vertex] = currentFillValue;
 
                 totalFill += currentFillValue;
+
+                remaining[vertex] = true;
+            }
+
+            const std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
+
+            std::size_t arenaSize = preprocessedGraph.remainingVertices().size();
+
+            for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
+            {
+                arenaSize += currentNeighborhood.size();
+            }
+
+            neighborhoodOffsets.reserve(neighborhood.size() + 1);
+            neighborhoodArena.reserve(arenaSize);
+
+            neighborhoodOffsets.push_back(0);
+
+            for (htd::vertex_t vertex = 0; vertex < neighborhood.size(); ++vertex)
+            {
+                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+                if (vertex < size && remaining[vertex])
+                {
+                    auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
+
+                    neighborhoodArena.insert(neighborhoodArena.end(), currentNeighborhood.begin(), position);
+                    neighborhoodArena.push_back(vertex);
+                    neighborhoodArena.insert(neighborhoodArena.end(), position, currentNeighborhood.end());
+                }
+                else
+                {
+                    neighborhoodArena.insert(neighborhoodArena.end(), currentNeighborhood.begin(), currentNeighborhood.end());
+                }
+
+                neighborhoodOffsets.push_back(neighborhoodArena.size());
             }
         }
 
@@ -143,6 +181,185 @@ struct htd::MinFillOrderingAlgorithm::Implementation
          *  A vector containing the fill value for each vertex.
          */
         std::vector<std::size_t> fillValue;
+
+        /**
+         *  The offsets of the initial neighborhoods within the neighborhood arena. The neighborhood of vertex i is
+         *  stored in the range [neighborhoodOffsets[i], neighborhoodOffsets[i + 1]) of the arena.
+         */
+        std::vector<std::size_t> neighborhoodOffsets;
+
+        /**
+         *  A flat array containing the initial neighborhoods of all vertices. The neighborhood of each remaining
+         *  vertex already contains the vertex itself.
+         */
+        std::vector<htd::vertex_t> neighborhoodArena;
+    };
+
+    /**
+     *  Structure holding the buffers which are required for computing a single vertex ordering.
+     *
+     *  A workspace is allocated once per call of computeOrdering() and it is reset in bulk from the prepared input
+     *  before each iteration. This way, repeated iterations re-use the capacity of all neighborhoods and auxiliary
+     *  vectors instead of re-allocating them.
+     */
+    struct Workspace
+    {
+        /**
+         *  Constructor for the Workspace data structure.
+         *
+         *  @param[in] size The number of vertices of the input graph.
+         */
+        Workspace(std::size_t size) : priorityQueue(size, size + 1), neighborhood(size), fillValue(size, 0), updateStatus(size, 0), existingNeighbors(size), additionalNeighbors(size), unaffectedNeighbors(size), affectedVertices(), vertices(), vertexPosition(size, 0)
+        {
+            affectedVertices.reserve(size);
+        }
+
+        ~Workspace()
+        {
+
+        }
+
+        /**
+         *  Restore the initial state of the workspace based on the prepared input.
+         *
+         *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+         *  @param[in] input                The preprocessed, algorithm-specific input data.
+         */
+        void reset(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input)
+        {
+            std::size_t count = std::min(neighborhood.size(), input.neighborhoodOffsets.size() - 1);
+
+            const htd::vertex_t * arena = input.neighborhoodArena.data();
+
+            for (htd::vertex_t vertex = 0; vertex < count; ++vertex)
+            {
+                neighborhood[vertex].assign(arena + input.neighborhoodOffsets[vertex], arena + input.neighborhoodOffsets[vertex + 1]);
+
+                existingNeighbors[vertex].clear();
+                additionalNeighbors[vertex].clear();
+                unaffectedNeighbors[vertex].clear();
+            }
+
+            std::copy(input.fillValue.begin(), input.fillValue.end(), fillValue.begin());
+
+            std::fill(updateStatus.begin(), updateStatus.end(), 0);
+
+            affectedVertices.clear();
+
+            priorityQueue.clear();
+
+            const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+            vertices.assign(remainingVertices.begin(), remainingVertices.end());
+
+            for (htd::index_t index = 0; index < vertices.size(); ++index)
+            {
+                htd::vertex_t vertex = vertices[index];
+
+                vertexPosition[vertex] = index;
+
+                priorityQueue.push(vertex, fillValue[vertex]);
+            }
+        }
+
+        /**
+         *  Remove a vertex from the collection of vertices which are not yet eliminated.
+         *
+         *  @param[in] vertex   The vertex which shall be removed.
+         */
+        void eraseVertex(htd::vertex_t vertex)
+        {
+            htd::index_t position = vertexPosition[vertex];
+
+            htd::vertex_t lastVertex = vertices.back();
+
+            vertices[position] = lastVertex;
+
+            vertexPosition[lastVertex] = position;
+
+            vertices.pop_back();
+        }
+
+        /**
+         *  Merge a sorted set of vertices into another sorted set of vertices.
+         *
+         *  In contrast to std::inplace_merge, the merge is performed from the back of the target vector so that no
+         *  temporary buffer is needed and the capacity of the target vector is the only memory which is used.
+         *
+         *  @param[in,out] set1 The target set into which the vertices shall be merged.
+         *  @param[in] set2     The set of vertices which shall be merged into the target set. The set must be disjoint from the target set.
+         */
+        static void merge(std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+        {
+            std::size_t index1 = set1.size();
+            std::size_t index2 = set2.size();
+
+            set1.resize(index1 + index2);
+
+            std::size_t target = set1.size();
+
+            while (index2 > 0)
+            {
+                if (index1 > 0 && set1[index1 - 1] > set2[index2 - 1])
+                {
+                    set1[--target] = set1[--index1];
+                }
+                else
+                {
+                    set1[--target] = set2[--index2];
+                }
+            }
+        }
+
+        /**
+         *  The priority queue containing the vertices which are not yet eliminated, prioritized by their fill value.
+         */
+        htd::BucketPriorityQueue priorityQueue;
+
+        /**
+         *  The current neighborhood of each vertex.
+         */
+        std::vector<std::vector<htd::vertex_t>> neighborhood;
+
+        /**
+         *  The current fill value of each vertex.
+         */
+        std::vector<std::size_t> fillValue;
+
+        /**
+         *  The update status of each vertex.
+         */
+        std::vector<htd::state_t> updateStatus;
+
+        /**
+         *  The existing neighbors of each vertex affected by the current elimination step.
+         */
+        std::vector<std::vector<htd::vertex_t>> existingNeighbors;
+
+        /**
+         *  The additional neighbors of each vertex affected by the current elimination step.
+         */
+        std::vector<std::vector<htd::vertex_t>> additionalNeighbors;
+
+        /**
+         *  The unaffected neighbors of each vertex affected by the current elimination step.
+         */
+        std::vector<std::vector<htd::vertex_t>> unaffectedNeighbors;
+
+        /**
+         *  The vertices which are affected indirectly by the current elimination step.
+         */
+        std::vector<htd::vertex_t> affectedVertices;
+
+        /**
+         *  The vertices which are not yet eliminated.
+         */
+        std::vector<htd::vertex_t> vertices;
+
+        /**
+         *  The position of each vertex which is not yet eliminated within the vector of remaining vertices.
+         */
+        std::vector<htd::index_t> vertexPosition;
     };
 
     /**
@@ -150,12 +367,14 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      *
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
      *  @param[in] input                The preprocessed, algorithm-specific input data.
+     *  @param[in] workspace            The workspace which shall be used for storing intermediate results.
      *  @param[out] target              The target vector to which the computed ordering shall be appended.
      *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *  @param[in] sharedMaxBagSize     The upper bound for the maximum bag size which may be tightened concurrently by other threads.
      *
      *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
      */
-    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const noexcept;
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, Workspace & workspace, std::vector<htd::vertex_t> & target, std::size_t maxBagSize, const std::atomic<std::size_t> & sharedMaxBagSize) const noexcept;
 };
 
 htd::MinFillOrderingAlgorithm::MinFillOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -193,6 +412,13 @@ htd::IVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd:
 }
 
 htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const noexcept
+{
+    std::atomic<std::size_t> sharedMaxBagSize((std::size_t)-1);
+
+    return computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount, sharedMaxBagSize);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount, const std::atomic<std::size_t> & sharedMaxBagSize) const noexcept
 {
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
@@ -201,6 +427,8 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
 
     htd::MinFillOrderingAlgorithm::Implementation::PreparedInput input(managementInstance, preprocessedGraph);
 
+    htd::MinFillOrderingAlgorithm::Implementation::Workspace workspace(preprocessedGraph.inputGraphVertexCount());
+
     std::size_t iterations = 0;
 
     std::size_t currentMaxBagSize = (std::size_t)-1;
@@ -209,7 +437,7 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
     {
         ordering.clear();
 
-        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, input, ordering, maxBagSize);
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, input, workspace, ordering, maxBagSize, sharedMaxBagSize);
 
         ++iterations;
     }
@@ -225,32 +453,29 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
     return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
 }
 
-std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const noexcept
+std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, Workspace & workspace, std::vector<htd::vertex_t> & target, std::size_t maxBagSize, const std::atomic<std::size_t> & sharedMaxBagSize) const noexcept
 {
     std::size_t ret = 0;
 
-    std::size_t size = preprocessedGraph.inputGraphVertexCount();
+    workspace.reset(preprocessedGraph, input);
 
-    std::unordered_set<htd::vertex_t> vertices(size);
+    std::vector<htd::vertex_t> & vertices = workspace.vertices;
 
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
+    std::vector<std::size_t> & fillValue = workspace.fillValue;
 
-    std::vector<std::size_t> fillValue(input.fillValue.begin(), input.fillValue.end());
+    htd::BucketPriorityQueue & priorityQueue = workspace.priorityQueue;
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
-
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    std::vector<std::vector<htd::vertex_t>> & neighborhood = workspace.neighborhood;
 
     std::size_t totalFill = input.totalFill;
 
-    std::vector<htd::state_t> updateStatus(size, 0);
+    std::vector<htd::state_t> & updateStatus = workspace.updateStatus;
 
-    std::vector<std::vector<htd::vertex_t>> existingNeighbors(size);
-    std::vector<std::vector<htd::vertex_t>> additionalNeighbors(size);
-    std::vector<std::vector<htd::vertex_t>> unaffectedNeighbors(size);
+    std::vector<std::vector<htd::vertex_t>> & existingNeighbors = workspace.existingNeighbors;
+    std::vector<std::vector<htd::vertex_t>> & additionalNeighbors = workspace.additionalNeighbors;
+    std::vector<std::vector<htd::vertex_t>> & unaffectedNeighbors = workspace.unaffectedNeighbors;
 
-    std::vector<htd::vertex_t> affectedVertices;
-    affectedVertices.reserve(size);
+    std::vector<htd::vertex_t> & affectedVertices = workspace.affectedVertices;
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
@@ -258,22 +483,13 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
     ret = preprocessedGraph.minTreeWidth() + 1;
 
-    size = preprocessedGraph.remainingVertices().size();
-
-    for (htd::vertex_t vertex : vertices)
-    {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
-
-        currentNeighborhood.insert(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), vertex);
-
-        priorityQueue.push(vertex, fillValue[vertex]);
-    }
+    std::size_t size = vertices.size();
 
-    while (totalFill > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    while (totalFill > 0 && ret <= maxBagSize && ret <= sharedMaxBagSize.load(std::memory_order_relaxed) && !managementInstance_->isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        htd::vertex_t selectedVertex = priorityQueue.selectRandomTopElement();
 
-        priorityQueue.eraseFromTopCollection(selectedVertex);
+        priorityQueue.erase(selectedVertex);
 
         std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
 
@@ -282,7 +498,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
             ret = selectedNeighborhood.size();
         }
 
-        vertices.erase(selectedVertex);
+        workspace.eraseVertex(selectedVertex);
 
         affectedVertices.clear();
 
@@ -313,7 +529,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill -= fillReduction;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -387,7 +603,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                 if (additionalNeighborCount > 0)
                 {
-                    htd::inplace_merge(neighborhood[vertex], currentAdditionalNeighborhood);
+                    Workspace::merge(neighborhood[vertex], currentAdditionalNeighborhood);
                 }
 
                 std::size_t tmp = fillValue[vertex];
@@ -454,7 +670,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill += fillUpdate;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -463,7 +679,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                 {
                     totalFill -= tmp;
 
-                    priorityQueue.updatePriority(vertex, fillValue[vertex], 0);
+                    priorityQueue.updatePriority(vertex, 0);
 
                     fillValue[vertex] = 0;
                 }
@@ -518,7 +734,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill -= fillReduction;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -537,10 +753,11 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
             }
         }
 
-        std::vector<htd::vertex_t>().swap(selectedNeighborhood);
-        std::vector<htd::vertex_t>().swap(additionalNeighbors[selectedVertex]);
-        std::vector<htd::vertex_t>().swap(unaffectedNeighbors[selectedVertex]);
-        std::vector<htd::vertex_t>().swap(existingNeighbors[selectedVertex]);
+        /* The buffers of the eliminated vertex keep their capacity so that the next iteration can re-use them. */
+        selectedNeighborhood.clear();
+        additionalNeighbors[selectedVertex].clear();
+        unaffectedNeighbors[selectedVertex].clear();
+        existingNeighbors[selectedVertex].clear();
 
         target.push_back(preprocessedGraph.vertexName(selectedVertex));
 
@@ -639,7 +856,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 #endif
     }
 
-    while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    while (size > 0 && ret <= maxBagSize && ret <= sharedMaxBagSize.load(std::memory_order_relaxed) && !managementInstance_->isTerminated())
     {
         htd::vertex_t vertex = htd::selectRandomElement<htd::vertex_t>(vertices);
 
@@ -652,7 +869,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
         target.push_back(preprocessedGraph.vertexName(vertex));
 
-        vertices.erase(vertex);
+        workspace.eraseVertex(vertex);
 
         --size;
 
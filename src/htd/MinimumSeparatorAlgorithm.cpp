@@ -29,10 +29,13 @@
 
 #include <htd/FlowNetworkStructure.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
+#include <htd/ResidualNetwork.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
 
 /**
  *  Private implementation details of class htd::MinimumSeparatorAlgorithm.
@@ -44,7 +47,7 @@ struct htd::MinimumSeparatorAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), threadCount_(1)
     {
 
     }
@@ -58,6 +61,83 @@ struct htd::MinimumSeparatorAlgorithm::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of worker threads which compute maximum flows concurrently.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Structure holding the state of a separator search which is shared between the worker threads.
+     */
+    struct SearchState
+    {
+        /**
+         *  Constructor for the SearchState data structure.
+         *
+         *  @param[in] vertices The vertices of the input graph.
+         */
+        SearchState(const std::vector<htd::vertex_t> & vertices) : mutex(), nextRow(0), bestSize(vertices.size()), bestSource((htd::index_t)-1), bestTarget((htd::index_t)-1), separator(vertices)
+        {
+
+        }
+
+        /**
+         *  Check whether the pair of vertices with the given indices precedes the pair for which the best separator was found.
+         *
+         *  @param[in] source   The index of the first vertex.
+         *  @param[in] target   The index of the second vertex.
+         *
+         *  @return True if the pair of vertices precedes the pair for which the best separator was found, false otherwise.
+         */
+        bool precedesBestPair(htd::index_t source, htd::index_t target) const
+        {
+            return source < bestSource || (source == bestSource && target < bestTarget);
+        }
+
+        /**
+         *  The mutex protecting the best separator.
+         */
+        std::mutex mutex;
+
+        /**
+         *  The index of the next row of vertex pairs which shall be processed.
+         */
+        std::atomic<std::size_t> nextRow;
+
+        /**
+         *  The size of the best separator found so far.
+         */
+        std::size_t bestSize;
+
+        /**
+         *  The index of the first vertex of the pair for which the best separator was found.
+         */
+        htd::index_t bestSource;
+
+        /**
+         *  The index of the second vertex of the pair for which the best separator was found.
+         */
+        htd::index_t bestTarget;
+
+        /**
+         *  The best separator found so far.
+         */
+        std::vector<htd::vertex_t> separator;
+    };
+
+    /**
+     *  Process rows of vertex pairs until all rows are processed.
+     *
+     *  For each row i, the minimum separator of vertex i and each non-adjacent vertex j > i is computed. Vertex k of
+     *  the input graph is represented by an incoming vertex k and an outgoing vertex k + n in the flow network.
+     *
+     *  @param[in] graph        The input graph.
+     *  @param[in] vertices     The vertices of the input graph.
+     *  @param[in] flowNetwork  The flow network of the input graph.
+     *  @param[in] state        The shared state of the search.
+     */
+    void processRows(const htd::IGraphStructure & graph, const std::vector<htd::vertex_t> & vertices, const htd::FlowNetworkStructure & flowNetwork, SearchState & state) const;
 };
 
 htd::MinimumSeparatorAlgorithm::MinimumSeparatorAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -72,24 +152,23 @@ htd::MinimumSeparatorAlgorithm::~MinimumSeparatorAlgorithm(void)
 
 std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(const htd::IGraphStructure & graph) const
 {
-    std::vector<htd::vertex_t> * ret = new std::vector<htd::vertex_t>();
-
     std::size_t n = graph.vertexCount();
 
-    htd::index_t index = 0;
+    std::vector<htd::vertex_t> vertices;
+    vertices.reserve(n);
+
+    graph.copyVerticesTo(vertices);
 
     std::unordered_map<htd::vertex_t, htd::index_t> indices;
 
-    for (htd::vertex_t vertex : graph.vertices())
+    for (htd::index_t index = 0; index < n; ++index)
     {
-        indices.emplace(vertex, index);
-
-        ++index;
+        indices.emplace(vertices[index], index);
     }
 
     htd::FlowNetworkStructure flowNetwork(n * 2);
 
-    for (htd::vertex_t vertex : graph.vertices())
+    for (htd::vertex_t vertex : vertices)
     {
         htd::index_t vertexIndex = indices.at(vertex);
 
@@ -104,52 +183,138 @@ std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(co
         }
     }
 
-    graph.copyVerticesTo(*ret);
+    htd::MinimumSeparatorAlgorithm::Implementation::SearchState state(vertices);
+
+    std::size_t threadCount = std::min(implementation_->threadCount_, n);
 
-    for (htd::index_t i = 0; i < n; ++i)
+    if (threadCount <= 1)
+    {
+        implementation_->processRows(graph, vertices, flowNetwork, state);
+    }
+    else
     {
-        htd::vertex_t vertex1 = graph.vertexAtPosition(i);
+        std::vector<std::thread> threads;
 
-        for (htd::index_t j = i + 1; j < n; ++j)
+        for (htd::index_t index = 0; index < threadCount; ++index)
         {
-            htd::vertex_t vertex2 = graph.vertexAtPosition(j);
+            threads.emplace_back(&htd::MinimumSeparatorAlgorithm::Implementation::processRows, implementation_.get(), std::cref(graph), std::cref(vertices), std::cref(flowNetwork), std::ref(state));
+        }
+
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    std::vector<htd::vertex_t> * ret = new std::vector<htd::vertex_t>(std::move(state.separator));
+
+    std::sort(ret->begin(), ret->end());
+
+    return ret;
+}
+
+void htd::MinimumSeparatorAlgorithm::Implementation::processRows(const htd::IGraphStructure & graph, const std::vector<htd::vertex_t> & vertices, const htd::FlowNetworkStructure & flowNetwork, SearchState & state) const
+{
+    std::size_t n = vertices.size();
+
+    htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(managementInstance_);
+
+    htd::ResidualNetwork network(flowNetwork);
+
+    std::vector<bool> reachable(2 * n);
+
+    std::vector<htd::vertex_t> queue;
+    queue.reserve(2 * n);
+
+    std::vector<htd::vertex_t> candidate;
+
+    for (htd::index_t i = state.nextRow++; i < n && !managementInstance_->isTerminated(); i = state.nextRow++)
+    {
+        htd::vertex_t vertex1 = vertices[i];
+
+        for (htd::index_t j = i + 1; j < n && !managementInstance_->isTerminated(); ++j)
+        {
+            htd::vertex_t vertex2 = vertices[j];
 
             if (!graph.isNeighbor(vertex1, vertex2))
             {
-                htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(implementation_->managementInstance_);
+                std::size_t limit = 0;
 
-                htd::IFlow * flow = maxFlowAlgorithm.determineMaximumFlow(flowNetwork, i + n, j);
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+
+                    /* A separator of the same size only replaces the best one if it was found for a preceding pair. */
+                    limit = state.precedesBestPair(i, j) ? state.bestSize + 1 : state.bestSize;
+                }
 
-                std::unordered_set<htd::vertex_t> candidate;
+                network.reset();
 
-                for(htd::index_t k = 0; k < n; ++k)
+                std::size_t value = maxFlowAlgorithm.increaseFlow(network, i + n, j, limit);
+
+                if (value < limit && !managementInstance_->isTerminated())
                 {
-                    if (k != i && k != j)
+                    /* The minimum separator consists of all vertices whose incoming vertex is reachable from the source in the residual network while their outgoing vertex is not. */
+                    std::fill(reachable.begin(), reachable.end(), false);
+
+                    queue.clear();
+
+                    queue.push_back(i + n);
+
+                    reachable[i + n] = true;
+
+                    for (htd::index_t index = 0; index < queue.size(); ++index)
                     {
-                        std::size_t capacity = flowNetwork.capacity(k, k + n);
+                        htd::vertex_t current = queue[index];
 
-                        if (static_cast<std::size_t>(flow->flow(k, k + n)) == capacity && capacity > 0 && capacity < (std::size_t)-1)
+                        for (htd::index_t edge = network.firstEdge(current); edge < network.lastEdge(current); ++edge)
                         {
-                            candidate.insert(graph.vertexAtPosition(k));
+                            htd::vertex_t neighbor = network.target(edge);
+
+                            if (!reachable[neighbor] && network.residualCapacity(edge) > 0)
+                            {
+                                reachable[neighbor] = true;
+
+                                queue.push_back(neighbor);
+                            }
                         }
                     }
-                }
 
-                if (candidate.size() < ret->size())
-                {
-                    ret->clear();
+                    candidate.clear();
 
-                    ret->insert(ret->end(), candidate.begin(), candidate.end());
+                    for (htd::index_t k = 0; k < n; ++k)
+                    {
+                        if (k != i && k != j && reachable[k] && !reachable[k + n])
+                        {
+                            candidate.push_back(vertices[k]);
+                        }
+                    }
 
-                    std::sort(ret->begin(), ret->end());
-                }
+                    std::lock_guard<std::mutex> lock(state.mutex);
 
-                delete flow;
+                    if (candidate.size() < state.bestSize || (candidate.size() == state.bestSize && state.precedesBestPair(i, j)))
+                    {
+                        state.bestSize = candidate.size();
+                        state.bestSource = i;
+                        state.bestTarget = j;
+
+                        state.separator = candidate;
+                    }
+                }
             }
         }
     }
+}
 
-    return ret;
+std::size_t htd::MinimumSeparatorAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::MinimumSeparatorAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
 }
 
 const htd::LibraryInstance * htd::MinimumSeparatorAlgorithm::managementInstance(void) const noexcept
@@ -166,7 +331,11 @@ void htd::MinimumSeparatorAlgorithm::setManagementInstance(const htd::LibraryIns
 
 htd::MinimumSeparatorAlgorithm * htd::MinimumSeparatorAlgorithm::clone(void) const
 {
-    return new htd::MinimumSeparatorAlgorithm(managementInstance());
+    htd::MinimumSeparatorAlgorithm * ret = new htd::MinimumSeparatorAlgorithm(managementInstance());
+
+    ret->setThreadCount(implementation_->threadCount_);
+
+    return ret;
 }
 
 #endif /* HTD_HTD_MINIMUMSEPARATORALGORITHM_CPP */
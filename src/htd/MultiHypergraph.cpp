@@ -111,6 +111,65 @@ struct htd::MultiHypergraph::Implementation
         neighborhood_.clear();
     }
 
+    /**
+     *  Remove duplicates from the sorted endpoints of a hyperedge. Each vertex which occurs more than once is
+     *  registered as a vertex with a self-loop.
+     *
+     *  @param[in,out] sortedElements   The sorted endpoints of the hyperedge.
+     */
+    void eraseDuplicates(std::vector<htd::vertex_t> & sortedElements)
+    {
+        auto position = std::adjacent_find(sortedElements.begin(), sortedElements.end());
+
+        if (position != sortedElements.end())
+        {
+            for (auto it = position; it + 1 != sortedElements.end(); ++it)
+            {
+                if (*it == *(it + 1))
+                {
+                    selfLoops_.insert(*it);
+                }
+            }
+
+            sortedElements.erase(std::unique(position, sortedElements.end()), sortedElements.end());
+        }
+    }
+
+    /**
+     *  Restore the invariants of the neighborhood of a vertex after new neighbors were appended to it.
+     *
+     *  The appended neighbors are sorted and merged with the existing, sorted neighbors, duplicates are removed
+     *  and the vertex itself is removed from its neighborhood unless it has a self-loop.
+     *
+     *  @param[in] vertex           The vertex whose neighborhood shall be updated.
+     *  @param[in] sortedPrefixSize The number of neighbors which were stored in the neighborhood before new neighbors were appended.
+     */
+    void sortNeighborhood(htd::vertex_t vertex, std::size_t sortedPrefixSize)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex - htd::Vertex::FIRST];
+
+        auto middle = currentNeighborhood.begin() + sortedPrefixSize;
+
+        std::sort(middle, currentNeighborhood.end());
+
+        if (sortedPrefixSize > 0)
+        {
+            std::inplace_merge(currentNeighborhood.begin(), middle, currentNeighborhood.end());
+        }
+
+        currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+
+        if (selfLoops_.count(vertex) == 0)
+        {
+            auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
+
+            if (position != currentNeighborhood.end() && *position == vertex)
+            {
+                currentNeighborhood.erase(position);
+            }
+        }
+    }
+
     /**
      *  The management instance to which the current object instance belongs.
      */
@@ -448,6 +507,13 @@ htd::ConstCollection<htd::vertex_t> htd::MultiHypergraph::neighbors(htd::vertex_
     return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->neighborhood_[vertex - htd::Vertex::FIRST]);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::MultiHypergraph::neighborSpan(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return htd::ConstSpan<htd::vertex_t>(implementation_->neighborhood_[vertex - htd::Vertex::FIRST]);
+}
+
 void htd::MultiHypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -818,16 +884,12 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
 
     std::vector<htd::vertex_t> sortedElements(elements);
 
-    auto elementsBegin = sortedElements.begin();
-    auto elementsEnd = sortedElements.end();
-
-    std::sort(elementsBegin, elementsEnd);
-
-    auto position = std::unique(elementsBegin, elementsEnd);
+    std::sort(sortedElements.begin(), sortedElements.end());
 
-    implementation_->selfLoops_.insert(position, elementsEnd);
+    implementation_->eraseDuplicates(sortedElements);
 
-    elementsEnd = sortedElements.erase(position, elementsEnd);
+    auto elementsBegin = sortedElements.begin();
+    auto elementsEnd = sortedElements.end();
 
     for (htd::vertex_t vertex : sortedElements)
     {
@@ -904,14 +966,7 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
 
     std::sort(sortedElements.begin(), sortedElements.end());
 
-    auto position = std::unique(sortedElements.begin(), sortedElements.end());
-
-    for (auto it = position; it != sortedElements.end(); it++)
-    {
-        implementation_->selfLoops_.insert(*it);
-    }
-
-    sortedElements.erase(position, sortedElements.end());
+    implementation_->eraseDuplicates(sortedElements);
 
     std::vector<htd::vertex_t> newNeighborhood;
 
@@ -979,14 +1034,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
 
     std::sort(sortedElements.begin(), sortedElements.end());
 
-    auto position = std::unique(sortedElements.begin(), sortedElements.end());
-
-    for (auto it = position; it != sortedElements.end(); it++)
-    {
-        implementation_->selfLoops_.insert(*it);
-    }
-
-    sortedElements.erase(position, sortedElements.end());
+    implementation_->eraseDuplicates(sortedElements);
 
     std::vector<htd::vertex_t> newNeighborhood;
 
@@ -1011,6 +1059,133 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
     return implementation_->next_edge_++;
 }
 
+htd::id_t htd::MultiHypergraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+{
+    htd::id_t ret = implementation_->next_edge_;
+
+    std::vector<std::size_t> additionalNeighbors(implementation_->neighborhood_.size(), 0);
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        HTD_ASSERT(isVertex(edge.first) && isVertex(edge.second))
+
+        ++additionalNeighbors[edge.first - htd::Vertex::FIRST];
+
+        if (edge.first != edge.second)
+        {
+            ++additionalNeighbors[edge.second - htd::Vertex::FIRST];
+        }
+    }
+
+    for (htd::index_t index = 0; index < additionalNeighbors.size(); ++index)
+    {
+        if (additionalNeighbors[index] > 0)
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[index];
+
+            currentNeighborhood.reserve(currentNeighborhood.size() + additionalNeighbors[index]);
+        }
+    }
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        implementation_->edges_->emplace_back(implementation_->next_edge_++, edge.first, edge.second);
+
+        implementation_->neighborhood_[edge.first - htd::Vertex::FIRST].push_back(edge.second);
+
+        if (edge.first != edge.second)
+        {
+            implementation_->neighborhood_[edge.second - htd::Vertex::FIRST].push_back(edge.first);
+        }
+        else
+        {
+            implementation_->selfLoops_.insert(edge.first);
+        }
+    }
+
+    for (htd::index_t index = 0; index < additionalNeighbors.size(); ++index)
+    {
+        if (additionalNeighbors[index] > 0)
+        {
+            implementation_->sortNeighborhood(static_cast<htd::vertex_t>(index + htd::Vertex::FIRST),
+                                              implementation_->neighborhood_[index].size() - additionalNeighbors[index]);
+        }
+    }
+
+    return ret;
+}
+
+htd::id_t htd::MultiHypergraph::addEdges(const std::vector<htd::vertex_t> & elements, const std::vector<htd::index_t> & offsets)
+{
+    HTD_ASSERT(!offsets.empty() && offsets.front() == 0 && offsets.back() == elements.size())
+
+    htd::id_t ret = implementation_->next_edge_;
+
+    /* The number of neighbors of each vertex before the first hyperedge was added or (std::size_t)-1 if the vertex is not affected. */
+    std::vector<std::size_t> sortedPrefixSize(implementation_->neighborhood_.size(), (std::size_t)-1);
+
+    std::vector<htd::vertex_t> sortedElements;
+
+    for (htd::index_t edge = 0; edge + 1 < offsets.size(); ++edge)
+    {
+        auto elementsBegin = elements.begin() + offsets[edge];
+        auto elementsEnd = elements.begin() + offsets[edge + 1];
+
+        HTD_ASSERT(elementsBegin < elementsEnd)
+
+        #ifndef NDEBUG
+        for (auto it = elementsBegin; it != elementsEnd; ++it)
+        {
+            HTD_ASSERT(isVertex(*it))
+        }
+        #endif
+
+        if (elementsEnd - elementsBegin == 1)
+        {
+            implementation_->edges_->emplace_back(implementation_->next_edge_++, *elementsBegin);
+        }
+        else
+        {
+            sortedElements.assign(elementsBegin, elementsEnd);
+
+            std::sort(sortedElements.begin(), sortedElements.end());
+
+            implementation_->eraseDuplicates(sortedElements);
+
+            if (elementsEnd - elementsBegin == 2)
+            {
+                implementation_->edges_->emplace_back(implementation_->next_edge_++, *elementsBegin, *(elementsBegin + 1));
+            }
+            else
+            {
+                implementation_->edges_->emplace_back(implementation_->next_edge_++, std::vector<htd::vertex_t>(elementsBegin, elementsEnd), std::vector<htd::vertex_t>(sortedElements));
+            }
+
+            for (htd::vertex_t vertex : sortedElements)
+            {
+                std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+
+                if (sortedPrefixSize[vertex - htd::Vertex::FIRST] == (std::size_t)-1)
+                {
+                    sortedPrefixSize[vertex - htd::Vertex::FIRST] = currentNeighborhood.size();
+                }
+
+                currentNeighborhood.insert(currentNeighborhood.end(), sortedElements.begin(), sortedElements.end());
+            }
+        }
+    }
+
+    for (htd::index_t index = 0; index < sortedPrefixSize.size(); ++index)
+    {
+        if (sortedPrefixSize[index] != (std::size_t)-1)
+        {
+            implementation_->sortNeighborhood(static_cast<htd::vertex_t>(index + htd::Vertex::FIRST), sortedPrefixSize[index]);
+        }
+    }
+
+    return ret;
+}
+
 void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
 {
     bool found = false;
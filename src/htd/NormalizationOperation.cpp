@@ -31,6 +31,11 @@
 #include <htd/ExchangeNodeReplacementOperation.hpp>
 #include <htd/LimitMaximumForgottenVertexCountOperation.hpp>
 #include <htd/LimitMaximumIntroducedVertexCountOperation.hpp>
+#include <htd/TreeDecomposition.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <typeinfo>
 
 /**
  *  Private implementation details of class htd::NormalizationOperation.
@@ -56,6 +61,300 @@ struct htd::NormalizationOperation::Implementation
      *  A boolean flag whether leaf nodes shall be treated as introduce nodes in the context of this operation.
      */
     bool treatLeafNodesAsIntroduceNodes_;
+
+    /**
+     *  Normalize the given tree decomposition in a single top-down traversal.
+     *
+     *  The result is structurally identical to the one of the sequence of semi-normalization, exchange node replacement
+     *  and the limitation of the forgotten and introduced vertices to one per node: Every join node has exactly two
+     *  children with the same bag content and two adjacent nodes differ in at most one vertex. Instead of inserting the
+     *  new nodes one after the other into the existing decomposition, which requires several traversals and costly
+     *  updates of the tree structure, the normalized decomposition is built from scratch and assigned to the given
+     *  decomposition afterwards. The labels of the original nodes are retained, but the node identifiers change.
+     *
+     *  @note The dynamic type of the given decomposition must be htd::TreeDecomposition, the additional state of derived
+     *  decompositions would be lost when assigning the normalized decomposition to them.
+     *
+     *  @param[in] managementInstance       The management instance of the operation.
+     *  @param[in] decomposition            The tree decomposition which shall be normalized.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied to the created nodes.
+     *  @param[in] emptyRoot                A boolean flag whether the decomposition shall have a root node with empty bag.
+     *  @param[in] emptyLeaves              A boolean flag whether the decomposition's leave nodes shall have an empty bag.
+     *  @param[in] identicalJoinNodeParent  A boolean flag whether each join node shall have a parent with equal bag content.
+     */
+    void normalize(const htd::LibraryInstance & managementInstance, htd::TreeDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions, bool emptyRoot, bool emptyLeaves, bool identicalJoinNodeParent) const
+    {
+        HTD_ASSERT(typeid(decomposition) == typeid(htd::TreeDecomposition))
+
+        if (decomposition.vertexCount() == 0)
+        {
+            return;
+        }
+
+        htd::TreeDecomposition result(&managementInstance);
+
+        /* Pairs of original nodes and their counterparts in the normalized decomposition. */
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> originalNodes;
+
+        originalNodes.reserve(decomposition.vertexCount());
+
+        std::vector<htd::vertex_t> createdNodes;
+
+        /* Original nodes which still have to be processed together with the node of the normalized decomposition below which they shall be attached. */
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> pendingNodes;
+
+        std::vector<htd::vertex_t> children;
+
+        htd::vertex_t root = decomposition.root();
+
+        htd::vertex_t attachmentPoint = htd::Vertex::UNKNOWN;
+
+        if (emptyRoot && decomposition.bagSize(root) > 0)
+        {
+            attachmentPoint = result.insertRoot(std::vector<htd::vertex_t>(), htd::FilteredHyperedgeCollection());
+
+            createdNodes.push_back(attachmentPoint);
+        }
+
+        pendingNodes.emplace_back(root, attachmentPoint);
+
+        while (!pendingNodes.empty() && !managementInstance.isTerminated())
+        {
+            htd::vertex_t node = pendingNodes.back().first;
+
+            attachmentPoint = pendingNodes.back().second;
+
+            pendingNodes.pop_back();
+
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+
+            const htd::FilteredHyperedgeCollection & inducedHyperedges = decomposition.inducedHyperedges(node);
+
+            std::size_t childCount = decomposition.childCount(node);
+
+            if (attachmentPoint != htd::Vertex::UNKNOWN)
+            {
+                attachmentPoint = addTransition(result, attachmentPoint, bag, inducedHyperedges, createdNodes);
+            }
+
+            if (childCount > 1 && identicalJoinNodeParent && (attachmentPoint == htd::Vertex::UNKNOWN || result.bagContent(attachmentPoint) != bag))
+            {
+                attachmentPoint = addNode(result, attachmentPoint, bag, inducedHyperedges);
+
+                createdNodes.push_back(attachmentPoint);
+            }
+
+            htd::vertex_t newNode = addNode(result, attachmentPoint, bag, inducedHyperedges);
+
+            originalNodes.emplace_back(node, newNode);
+
+            if (childCount == 0)
+            {
+                if (!bag.empty() && (emptyLeaves || treatLeafNodesAsIntroduceNodes_))
+                {
+                    /* The bags below a leaf introduce its vertices one after the other in ascending order. */
+                    htd::vertex_t current = newNode;
+
+                    for (std::size_t size = bag.size() - 1; size > 0; --size)
+                    {
+                        std::vector<htd::vertex_t> newBagContent(bag.begin(), bag.begin() + size);
+
+                        htd::FilteredHyperedgeCollection newInducedHyperedges(inducedHyperedges);
+
+                        newInducedHyperedges.restrictTo(newBagContent);
+
+                        current = result.addChild(current, std::move(newBagContent), std::move(newInducedHyperedges));
+
+                        createdNodes.push_back(current);
+                    }
+
+                    if (emptyLeaves)
+                    {
+                        createdNodes.push_back(result.addChild(current, std::vector<htd::vertex_t>(), htd::FilteredHyperedgeCollection()));
+                    }
+                }
+            }
+            else if (childCount == 1)
+            {
+                pendingNodes.emplace_back(decomposition.childAtPosition(node, 0), newNode);
+            }
+            else
+            {
+                /* Children with the same bag content are attached directly, all other children via an intermediate node with the bag of the join node. */
+                children.clear();
+
+                for (htd::vertex_t child : decomposition.children(node))
+                {
+                    if (decomposition.bagContent(child) == bag)
+                    {
+                        children.push_back(child);
+                    }
+                }
+
+                std::size_t identicalChildCount = children.size();
+
+                for (htd::vertex_t child : decomposition.children(node))
+                {
+                    if (decomposition.bagContent(child) != bag)
+                    {
+                        children.push_back(child);
+                    }
+                }
+
+                htd::vertex_t joinNode = newNode;
+
+                for (htd::index_t index = 0; index < childCount; ++index)
+                {
+                    if (index > 0 && index + 1 < childCount)
+                    {
+                        joinNode = result.addChild(joinNode, bag, inducedHyperedges);
+
+                        createdNodes.push_back(joinNode);
+                    }
+
+                    if (index < identicalChildCount)
+                    {
+                        pendingNodes.emplace_back(children[index], joinNode);
+                    }
+                    else
+                    {
+                        htd::vertex_t intermediateNode = result.addChild(joinNode, bag, inducedHyperedges);
+
+                        createdNodes.push_back(intermediateNode);
+
+                        pendingNodes.emplace_back(children[index], intermediateNode);
+                    }
+                }
+            }
+        }
+
+        if (!managementInstance.isTerminated())
+        {
+            std::vector<std::string> labelNames;
+
+            const htd::ConstCollection<std::string> & labelNameCollection = decomposition.labelings().labelNames();
+
+            std::copy(labelNameCollection.begin(), labelNameCollection.end(), std::back_inserter(labelNames));
+
+            for (const std::string & labelName : labelNames)
+            {
+                const htd::IGraphLabeling & labeling = decomposition.labelings().labeling(labelName);
+
+                for (const std::pair<htd::vertex_t, htd::vertex_t> & originalNode : originalNodes)
+                {
+                    if (labeling.isLabeledVertex(originalNode.first))
+                    {
+                        result.setVertexLabel(labelName, originalNode.second, decomposition.transferVertexLabel(labelName, originalNode.first));
+                    }
+                }
+            }
+
+            for (htd::vertex_t node : createdNodes)
+            {
+                for (auto & labelingFunction : labelingFunctions)
+                {
+                    htd::ILabelCollection * labelCollection = result.labelings().exportVertexLabelCollection(node);
+
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(result.bagContent(node), *labelCollection);
+
+                    delete labelCollection;
+
+                    result.setVertexLabel(labelingFunction->name(), node, newLabel);
+                }
+            }
+
+            decomposition = result;
+        }
+    }
+
+    /**
+     *  Add a new node to the given decomposition.
+     *
+     *  @param[in] decomposition        The decomposition to which the node shall be added.
+     *  @param[in] parent               The parent of the new node or htd::Vertex::UNKNOWN if the new node shall be the root.
+     *  @param[in] bagContent           The bag content of the new node.
+     *  @param[in] inducedHyperedges    The induced hyperedges of the new node.
+     *
+     *  @return The new node.
+     */
+    static htd::vertex_t addNode(htd::TreeDecomposition & decomposition, htd::vertex_t parent, const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedHyperedges)
+    {
+        if (parent == htd::Vertex::UNKNOWN)
+        {
+            return decomposition.insertRoot(bagContent, inducedHyperedges);
+        }
+
+        return decomposition.addChild(parent, bagContent, inducedHyperedges);
+    }
+
+    /**
+     *  Add the chain of nodes which is needed below a node of the normalized decomposition such that the given bag
+     *  content can be attached to it, i.e., the vertices which are not part of the bag of the parent are introduced
+     *  one after the other and the vertices which are not part of the given bag are forgotten one after the other,
+     *  both in ascending order when traversing the chain bottom-up.
+     *
+     *  @param[in] decomposition        The normalized decomposition.
+     *  @param[in] parent               The node of the normalized decomposition below which the chain shall be added.
+     *  @param[in] bagContent           The bag content of the node which shall be attached below the chain.
+     *  @param[in] inducedHyperedges    The induced hyperedges of the node which shall be attached below the chain.
+     *  @param[out] createdNodes        The vector to which the nodes of the chain shall be appended.
+     *
+     *  @return The lowest node of the chain or the given parent if the bags are equal or differ in one vertex only.
+     */
+    static htd::vertex_t addTransition(htd::TreeDecomposition & decomposition, htd::vertex_t parent, const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedHyperedges, std::vector<htd::vertex_t> & createdNodes)
+    {
+        const std::vector<htd::vertex_t> & parentBagContent = decomposition.bagContent(parent);
+
+        std::vector<htd::vertex_t> forgottenVertices;
+        std::vector<htd::vertex_t> introducedVertices;
+
+        std::set_difference(bagContent.begin(), bagContent.end(), parentBagContent.begin(), parentBagContent.end(), std::back_inserter(forgottenVertices));
+        std::set_difference(parentBagContent.begin(), parentBagContent.end(), bagContent.begin(), bagContent.end(), std::back_inserter(introducedVertices));
+
+        std::size_t stepCount = forgottenVertices.size() + introducedVertices.size();
+
+        if (stepCount < 2)
+        {
+            return parent;
+        }
+
+        std::vector<htd::vertex_t> rememberedVertices;
+
+        std::set_intersection(bagContent.begin(), bagContent.end(), parentBagContent.begin(), parentBagContent.end(), std::back_inserter(rememberedVertices));
+
+        htd::FilteredHyperedgeCollection parentInducedHyperedges(decomposition.inducedHyperedges(parent));
+
+        htd::vertex_t ret = parent;
+
+        /* Bottom-up, step i of the chain leads to the bag with the first i forgotten vertices removed or, after all forgotten vertices, to the bag with the first introduced vertices added. */
+        for (std::size_t step = stepCount - 1; step > 0; --step)
+        {
+            std::vector<htd::vertex_t> newBagContent;
+
+            htd::FilteredHyperedgeCollection newInducedHyperedges;
+
+            if (step <= forgottenVertices.size())
+            {
+                std::set_difference(bagContent.begin(), bagContent.end(), forgottenVertices.begin(), forgottenVertices.begin() + step, std::back_inserter(newBagContent));
+
+                newInducedHyperedges = inducedHyperedges;
+            }
+            else
+            {
+                std::set_union(rememberedVertices.begin(), rememberedVertices.end(), introducedVertices.begin(), introducedVertices.begin() + (step - forgottenVertices.size()), std::back_inserter(newBagContent));
+
+                newInducedHyperedges = parentInducedHyperedges;
+            }
+
+            newInducedHyperedges.restrictTo(newBagContent);
+
+            ret = decomposition.addChild(ret, std::move(newBagContent), std::move(newInducedHyperedges));
+
+            createdNodes.push_back(ret);
+        }
+
+        return ret;
+    }
 };
 
 htd::NormalizationOperation::NormalizationOperation(const htd::LibraryInstance * const manager)
@@ -164,6 +463,16 @@ void htd::NormalizationOperation::apply(const htd::IMultiHypergraph & graph, htd
 
 void htd::NormalizationOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
 {
+    htd::TreeDecomposition * treeDecomposition = dynamic_cast<htd::TreeDecomposition *>(&decomposition);
+
+    /* Derived decompositions carry information which would be lost when assigning a rebuilt tree decomposition. */
+    if (treeDecomposition != nullptr && typeid(*treeDecomposition) == typeid(htd::TreeDecomposition))
+    {
+        implementation_->normalize(*managementInstance(), *treeDecomposition, labelingFunctions, emptyRootRequired(), emptyLeavesRequired(), identicalJoinNodeParentRequired());
+
+        return;
+    }
+
     htd::SemiNormalizationOperation::apply(graph, decomposition, labelingFunctions);
 
     htd::ExchangeNodeReplacementOperation exchangeNodeReplacementOperation(managementInstance());
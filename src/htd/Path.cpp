@@ -30,14 +30,14 @@
 #include <htd/Path.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/VectorAdapter.hpp>
-#include <htd/HyperedgePointerDeque.hpp>
-#include <htd/ConstPointerIteratorWrapper.hpp>
+#include <htd/HyperedgeDeque.hpp>
 
 #include <htd/Algorithm.hpp>
 
 #include <algorithm>
 #include <deque>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <utility>
@@ -53,9 +53,9 @@ struct htd::Path::Implementation
     struct Node
     {
         /**
-         *  The ID of the path node.
+         *  The ID of the path node or htd::Vertex::UNKNOWN if the slot of the node is currently unused.
          */
-        htd::id_t id;
+        htd::vertex_t id;
 
         /**
          *  The parent of the path node.
@@ -78,7 +78,7 @@ struct htd::Path::Implementation
          *  @param[in] id       The ID of the constructed path node.
          *  @param[in] parent   The parent of the constructed path node.
          */
-        Node(htd::id_t id, htd::vertex_t parent) : id(id), parent(parent), child(htd::Vertex::UNKNOWN), edges()
+        Node(htd::vertex_t id, htd::vertex_t parent) : id(id), parent(parent), child(htd::Vertex::UNKNOWN), edges()
         {
 
         }
@@ -89,24 +89,14 @@ struct htd::Path::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), slots_(), freeSlots_(), edges_(std::make_shared<std::deque<htd::Hyperedge>>())
     {
 
     }
 
     virtual ~Implementation()
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
 
-        for (htd::Hyperedge * edge : *edges_)
-        {
-            delete edge;
-        }
-
-        edges_->clear();
     }
 
     /**
@@ -121,15 +111,12 @@ struct htd::Path::Implementation
           next_edge_(original.next_edge_),
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
-          nodes_(),
-          edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+          nodes_(original.nodes_),
+          slots_(original.slots_),
+          freeSlots_(original.freeSlots_),
+          edges_(std::make_shared<std::deque<htd::Hyperedge>>(*(original.edges_)))
     {
-        nodes_.reserve(original.nodes_.size());
 
-        for (const auto & node : original.nodes_)
-        {
-            nodes_.insert(std::make_pair(node.first, new Node(*(node.second))));
-        }
     }
 
     /**
@@ -137,22 +124,13 @@ struct htd::Path::Implementation
      */
     void reset(void)
     {
-        if (root_ != htd::Vertex::UNKNOWN)
-        {
-            for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-            {
-                delete it->second;
-            }
+        nodes_.clear();
 
-            nodes_.clear();
+        slots_.clear();
 
-            for (htd::Hyperedge * edge : *edges_)
-            {
-                delete edge;
-            }
+        freeSlots_.clear();
 
-            edges_->clear();
-        }
+        edges_->clear();
 
         size_ = 0;
 
@@ -165,6 +143,46 @@ struct htd::Path::Implementation
         vertices_.clear();
     }
 
+    /**
+     *  Check whether the given vertex is a node of the path.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return True if the given vertex is a node of the path, false otherwise.
+     */
+    bool contains(htd::vertex_t vertex) const
+    {
+        return vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < slots_.size() && slots_[vertex - htd::Vertex::FIRST] != UNUSED_SLOT;
+    }
+
+    /**
+     *  Access the information of an existing node of the path.
+     *
+     *  @param[in] vertex   The node of the path.
+     *
+     *  @return The information of the given node.
+     */
+    Node & nodeAt(htd::vertex_t vertex)
+    {
+        HTD_ASSERT(contains(vertex))
+
+        return nodes_[slots_[vertex - htd::Vertex::FIRST]];
+    }
+
+    /**
+     *  Access the information of an existing node of the path.
+     *
+     *  @param[in] vertex   The node of the path.
+     *
+     *  @return The information of the given node.
+     */
+    const Node & nodeAt(htd::vertex_t vertex) const
+    {
+        HTD_ASSERT(contains(vertex))
+
+        return nodes_[slots_[vertex - htd::Vertex::FIRST]];
+    }
+
     /**
      *  The management instance to which the current object instance belongs.
      */
@@ -181,7 +199,7 @@ struct htd::Path::Implementation
     htd::vertex_t root_;
 
     /**
-     *  The ID the next edge added to the tree will get.
+     *  The ID the next edge added to the path will get.
      */
     htd::id_t next_edge_;
 
@@ -196,21 +214,44 @@ struct htd::Path::Implementation
     std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The map of pointers to all path nodes. It maps vertex IDs to the corresponding node information.
+     *  The arena holding the information of all path nodes. Slots of removed nodes are recorded in freeSlots_ and reused for new nodes.
      */
-    std::unordered_map<htd::id_t, Node *> nodes_;
+    std::vector<Node> nodes_;
 
     /**
-     *  The collection of all hyperedges which exist in the path.
+     *  The position of each node within the arena. The position of vertex i is stored at index i - htd::Vertex::FIRST.
      */
-    std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
+    std::vector<htd::index_t> slots_;
+
+    /**
+     *  The positions of the unused slots of the arena.
+     */
+    std::vector<htd::index_t> freeSlots_;
+
+    /**
+     *  The collection of all hyperedges which exist in the path, sorted by their IDs.
+     */
+    std::shared_ptr<std::deque<htd::Hyperedge>> edges_;
+
+    /**
+     *  Marker for vertices which are not contained in the arena.
+     */
+    static const htd::index_t UNUSED_SLOT;
+
+    /**
+     *  Store a new node in the arena, re-using the slot of a previously removed node if possible.
+     *
+     *  @param[in] vertex   The ID of the new node.
+     *  @param[in] parent   The parent of the new node.
+     */
+    void allocateNode(htd::vertex_t vertex, htd::vertex_t parent);
 
     /**
      *  Delete a node of the path and perform an update of the internal state.
      *
-     *  @param[in] node The node of the path which shall be removed.
+     *  @param[in] vertex   The node of the path which shall be removed.
      */
-    void deleteNode(Node * node);
+    void deleteNode(htd::vertex_t vertex);
 
     /**
      *  Updates the edge information for the nodes affected by a call to swapWithParent(htd::vertex_t).
@@ -222,6 +263,8 @@ struct htd::Path::Implementation
     void updateEdgesAfterSwapWithParent(Node & node, Node & parentNode, Node & grandParentNode);
 };
 
+const htd::index_t htd::Path::Implementation::UNUSED_SLOT = std::numeric_limits<htd::index_t>::max();
+
 htd::Path::Path(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
 {
 
@@ -259,7 +302,7 @@ std::size_t htd::Path::vertexCount(htd::vertex_t subPathRoot) const
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->child;
+        currentVertex = implementation_->nodeAt(currentVertex).child;
     }
 
     return ret;
@@ -279,7 +322,7 @@ std::size_t htd::Path::edgeCount(htd::vertex_t vertex) const
 
 bool htd::Path::isVertex(htd::vertex_t vertex) const
 {
-    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->nodes_.count(vertex) == 1;
+    return implementation_->contains(vertex);
 }
 
 bool htd::Path::isEdge(htd::id_t edgeId) const
@@ -372,9 +415,9 @@ bool htd::Path::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
     
     if (isVertex(vertex) && isVertex(neighbor))
     {
-        const auto & node = implementation_->nodes_.at(vertex);
+        const auto & node = implementation_->nodeAt(vertex);
 
-        ret = node->parent == neighbor || node->child == neighbor;
+        ret = node.parent == neighbor || node.child == neighbor;
     }
     
     return ret;
@@ -396,14 +439,14 @@ std::size_t htd::Path::neighborCount(htd::vertex_t vertex) const
     
     if (isVertex(vertex))
     {
-        const auto & node = implementation_->nodes_.at(vertex);
+        const auto & node = implementation_->nodeAt(vertex);
 
-        if (node->parent != htd::Vertex::UNKNOWN)
+        if (node.parent != htd::Vertex::UNKNOWN)
         {
             ++ret;
         }
 
-        if (node->child != htd::Vertex::UNKNOWN)
+        if (node.child != htd::Vertex::UNKNOWN)
         {
             ++ret;
         }
@@ -420,16 +463,16 @@ htd::ConstCollection<htd::vertex_t> htd::Path::neighbors(htd::vertex_t vertex) c
 
     auto & result = ret.container();
 
-    const auto & node = implementation_->nodes_.at(vertex);
+    const auto & node = implementation_->nodeAt(vertex);
 
-    if (node->parent != htd::Vertex::UNKNOWN)
+    if (node.parent != htd::Vertex::UNKNOWN)
     {
-        result.push_back(node->parent);
+        result.push_back(node.parent);
     }
 
-    if (node->child != htd::Vertex::UNKNOWN)
+    if (node.child != htd::Vertex::UNKNOWN)
     {
-        result.push_back(node->child);
+        result.push_back(node.child);
     }
 
     std::sort(result.begin(), result.end());
@@ -443,16 +486,16 @@ void htd::Path::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 
     std::size_t size = target.size();
 
-    const auto & node = implementation_->nodes_.at(vertex);
+    const auto & node = implementation_->nodeAt(vertex);
 
-    if (node->parent != htd::Vertex::UNKNOWN)
+    if (node.parent != htd::Vertex::UNKNOWN)
     {
-        target.push_back(node->parent);
+        target.push_back(node.parent);
     }
 
-    if (node->child != htd::Vertex::UNKNOWN)
+    if (node.child != htd::Vertex::UNKNOWN)
     {
-        target.push_back(node->child);
+        target.push_back(node.child);
     }
 
     std::sort(target.begin() + size, target.end());
@@ -535,8 +578,7 @@ bool htd::Path::isIsolatedVertex(htd::vertex_t vertex) const
 
 htd::ConstCollection<htd::Hyperedge> htd::Path::hyperedges(void) const
 {
-    return htd::ConstCollection<htd::Hyperedge>(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new htd::ConstPointerIteratorWrapper<std::deque<htd::Hyperedge *>::const_iterator, htd::Hyperedge>(implementation_->edges_->begin())),
-                                                static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new htd::ConstPointerIteratorWrapper<std::deque<htd::Hyperedge *>::const_iterator, htd::Hyperedge>(implementation_->edges_->end())));
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->edges_));
 }
 
 htd::ConstCollection<htd::Hyperedge> htd::Path::hyperedges(htd::vertex_t vertex) const
@@ -547,11 +589,11 @@ htd::ConstCollection<htd::Hyperedge> htd::Path::hyperedges(htd::vertex_t vertex)
 
     auto & result = ret.container();
 
-    for (auto & edge : *(implementation_->edges_))
+    for (const htd::Hyperedge & edge : *(implementation_->edges_))
     {
-        if (edge->contains(vertex))
+        if (edge.contains(vertex))
         {
-            result.emplace_back(*edge);
+            result.emplace_back(edge);
         }
     }
 
@@ -560,43 +602,27 @@ htd::ConstCollection<htd::Hyperedge> htd::Path::hyperedges(htd::vertex_t vertex)
 
 const htd::Hyperedge & htd::Path::hyperedge(htd::id_t edgeId) const
 {
-    const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = hyperedges();
-
-    bool found = false;
-
-    auto position = hyperedgeCollection.begin();
-
-    for (auto it = hyperedgeCollection.begin(); !found && it != hyperedgeCollection.end(); ++it)
-    {
-        if (it->id() == edgeId)
-        {
-            position = it;
-
-            found = true;
-        }
-    }
+    auto it = htd::hyperedgePosition(implementation_->edges_->begin(), implementation_->edges_->end(), edgeId);
 
-    if (!found)
+    if (it == implementation_->edges_->end())
     {
         throw std::logic_error("const htd::Hyperedge & htd::Path::hyperedge(htd::id_t) const");
     }
 
-    return *position;
+    return *it;
 }
 
 const htd::Hyperedge & htd::Path::hyperedgeAtPosition(htd::index_t index) const
 {
     HTD_ASSERT(index < implementation_->edges_->size())
 
-    return *(implementation_->edges_->at(index));
+    return implementation_->edges_->at(index);
 }
 
 const htd::Hyperedge & htd::Path::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
-    for (auto it = implementation_->edges_->begin(); it != implementation_->edges_->end(); ++it)
+    for (const htd::Hyperedge & hyperedge : *(implementation_->edges_))
     {
-        const htd::Hyperedge & hyperedge = **it;
-
         if (hyperedge.contains(vertex))
         {
             if (index == 0)
@@ -620,7 +646,7 @@ htd::FilteredHyperedgeCollection htd::Path::hyperedgesAtPositions(const std::vec
     }
     #endif
 
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgePointerDeque(implementation_->edges_), indices);
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), indices);
 }
 
 htd::FilteredHyperedgeCollection htd::Path::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
@@ -632,7 +658,7 @@ htd::FilteredHyperedgeCollection htd::Path::hyperedgesAtPositions(std::vector<ht
     }
     #endif
 
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgePointerDeque(implementation_->edges_), std::move(indices));
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), std::move(indices));
 }
 
 htd::vertex_t htd::Path::root(void) const
@@ -653,7 +679,7 @@ htd::vertex_t htd::Path::parent(htd::vertex_t vertex) const
     
     if (isVertex(vertex))
     {
-        ret = implementation_->nodes_.at(vertex)->parent;
+        ret = implementation_->nodeAt(vertex).parent;
     }
     
     return ret;
@@ -664,7 +690,7 @@ bool htd::Path::isParent(htd::vertex_t vertex, htd::vertex_t parent) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(parent))
 
-    return implementation_->nodes_.at(vertex)->parent == parent;
+    return implementation_->nodeAt(vertex).parent == parent;
 }
 
 std::size_t htd::Path::childCount(htd::vertex_t vertex) const
@@ -673,7 +699,7 @@ std::size_t htd::Path::childCount(htd::vertex_t vertex) const
     
     if (isVertex(vertex))
     {
-        if (implementation_->nodes_.at(vertex)->child != htd::Vertex::UNKNOWN)
+        if (implementation_->nodeAt(vertex).child != htd::Vertex::UNKNOWN)
         {
             ++ret;
         }
@@ -688,9 +714,9 @@ htd::ConstCollection<htd::vertex_t> htd::Path::children(htd::vertex_t vertex) co
 
     htd::VectorAdapter<htd::vertex_t> ret;
 
-    if (implementation_->nodes_.at(vertex)->child != htd::Vertex::UNKNOWN)
+    if (implementation_->nodeAt(vertex).child != htd::Vertex::UNKNOWN)
     {
-        ret.container().emplace_back(implementation_->nodes_.at(vertex)->child);
+        ret.container().emplace_back(implementation_->nodeAt(vertex).child);
     }
 
     return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
@@ -700,9 +726,9 @@ void htd::Path::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 {
     HTD_ASSERT(isVertex(vertex))
 
-    if (implementation_->nodes_.at(vertex)->child != htd::Vertex::UNKNOWN)
+    if (implementation_->nodeAt(vertex).child != htd::Vertex::UNKNOWN)
     {
-        target.emplace_back(implementation_->nodes_.at(vertex)->child);
+        target.emplace_back(implementation_->nodeAt(vertex).child);
     }
 }
 
@@ -710,7 +736,7 @@ htd::vertex_t htd::Path::child(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t child = implementation_->nodes_.at(vertex)->child;
+    htd::vertex_t child = implementation_->nodeAt(vertex).child;
 
     HTD_ASSERT(child != htd::Vertex::UNKNOWN)
 
@@ -723,7 +749,7 @@ htd::vertex_t htd::Path::childAtPosition(htd::vertex_t vertex, htd::index_t inde
 
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t child = implementation_->nodes_.at(vertex)->child;
+    htd::vertex_t child = implementation_->nodeAt(vertex).child;
 
     HTD_ASSERT(index == 0 && child != htd::Vertex::UNKNOWN)
     
@@ -735,7 +761,7 @@ bool htd::Path::isChild(htd::vertex_t vertex, htd::vertex_t child) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    return implementation_->nodes_.at(vertex)->child == child;
+    return implementation_->nodeAt(vertex).child == child;
 }
 
 std::size_t htd::Path::height(void) const
@@ -749,13 +775,13 @@ std::size_t htd::Path::height(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->child;
+    htd::vertex_t currentVertex = implementation_->nodeAt(vertex).child;
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->child;
+        currentVertex = implementation_->nodeAt(currentVertex).child;
     }
 
     return ret;
@@ -767,13 +793,13 @@ std::size_t htd::Path::depth(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t currentVertex = implementation_->nodeAt(vertex).parent;
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->parent;
+        currentVertex = implementation_->nodeAt(currentVertex).parent;
     }
 
     return ret;
@@ -793,19 +819,19 @@ void htd::Path::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = implementation_->nodeAt(vertex);
 
     auto end = implementation_->edges_->end();
 
     for (auto it = node.edges.rbegin(); it != node.edges.rend(); ++it)
     {
-        auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), end, *it);
+        auto position = htd::hyperedgePosition(implementation_->edges_->begin(), end, *it);
 
-        for (htd::vertex_t currentVertex : (*position)->sortedElements())
+        for (htd::vertex_t currentVertex : position->sortedElements())
         {
             if (currentVertex != vertex)
             {
-                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex)->edges;
+                std::vector<htd::id_t> & currentEdges = implementation_->nodeAt(currentVertex).edges;
 
                 /* Because 'currentVertex' is a neighbor of 'vertex' and 'position' points to the
                  * edge connecting the two vertices, std::lower_bound will always find the edge
@@ -815,30 +841,29 @@ void htd::Path::removeVertex(htd::vertex_t vertex)
             }
         }
 
-        delete *position;
 
         end = implementation_->edges_->erase(position);
     }
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
-        auto & parentNode = *(implementation_->nodes_.at(node.parent));
+        auto & parentNode = implementation_->nodeAt(node.parent);
 
         parentNode.child = node.child;
 
         if (node.child != htd::Vertex::UNKNOWN)
         {
-            auto & childNode = *(implementation_->nodes_.at(node.child));
+            auto & childNode = implementation_->nodeAt(node.child);
 
             childNode.parent = node.parent;
 
             if (node.parent < node.child)
             {
-                implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, node.child));
+                implementation_->edges_->emplace_back(implementation_->next_edge_, node.parent, node.child);
             }
             else
             {
-                implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.child, node.parent));
+                implementation_->edges_->emplace_back(implementation_->next_edge_, node.child, node.parent);
             }
 
             childNode.edges.emplace_back(implementation_->next_edge_);
@@ -848,19 +873,19 @@ void htd::Path::removeVertex(htd::vertex_t vertex)
             ++implementation_->next_edge_;
         }
 
-        implementation_->deleteNode(&node);
+        implementation_->deleteNode(vertex);
     }
     else
     {
         if (node.child != htd::Vertex::UNKNOWN)
         {
-            auto & child = *(implementation_->nodes_.at(node.child));
+            auto & child = implementation_->nodeAt(node.child);
 
             child.parent = htd::Vertex::UNKNOWN;
 
             implementation_->root_ = node.child;
 
-            implementation_->deleteNode(&node);
+            implementation_->deleteNode(vertex);
         }
         else
         {
@@ -869,11 +894,11 @@ void htd::Path::removeVertex(htd::vertex_t vertex)
             implementation_->size_ = 0;
 
             implementation_->nodes_.clear();
+            implementation_->slots_.clear();
+            implementation_->freeSlots_.clear();
             implementation_->edges_->clear();
 
             implementation_->vertices_.clear();
-
-            delete &node;
         }
     }
 }
@@ -901,7 +926,7 @@ htd::vertex_t htd::Path::insertRoot(void)
 
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->allocateNode(implementation_->root_, htd::Vertex::UNKNOWN);
 
         implementation_->vertices_.push_back(implementation_->root_);
 
@@ -917,19 +942,18 @@ htd::vertex_t htd::Path::addChild(htd::vertex_t vertex)
 
     htd::vertex_t ret = htd::Vertex::UNKNOWN;
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
-
     ret = implementation_->next_vertex_;
 
-    htd::vertex_t child = node.child;
+    implementation_->allocateNode(ret, vertex);
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
+    Implementation::Node & node = implementation_->nodeAt(vertex);
+    Implementation::Node & newNode = implementation_->nodeAt(ret);
 
-    implementation_->nodes_.emplace(ret, newNode);
+    htd::vertex_t child = node.child;
 
     if (child != htd::Vertex::UNKNOWN)
     {
-        Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+        Implementation::Node & childNode = implementation_->nodeAt(child);
 
         htd::id_t oldHyperedge = htd::Id::UNKNOWN;
 
@@ -937,15 +961,13 @@ htd::vertex_t htd::Path::addChild(htd::vertex_t vertex)
 
         while (it != node.edges.end())
         {
-            auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
+            auto position = htd::hyperedgePosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
 
             HTD_ASSERT(position != implementation_->edges_->end())
 
-            if ((*position)->contains(child))
+            if (position->contains(child))
             {
-                oldHyperedge = (*position)->id();
-
-                delete *position;
+                oldHyperedge = position->id();
 
                 implementation_->edges_->erase(position);
 
@@ -961,11 +983,11 @@ htd::vertex_t htd::Path::addChild(htd::vertex_t vertex)
         childNode.edges.erase(std::lower_bound(childNode.edges.begin(), childNode.edges.end(), oldHyperedge));
 
         childNode.parent = ret;
-        newNode->child = child;
+        newNode.child = child;
 
-        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, ret));
+        implementation_->edges_->emplace_back(implementation_->next_edge_, child, ret);
 
-        newNode->edges.push_back(implementation_->next_edge_);
+        newNode.edges.push_back(implementation_->next_edge_);
         childNode.edges.push_back(implementation_->next_edge_);
 
         implementation_->next_edge_++;
@@ -973,10 +995,10 @@ htd::vertex_t htd::Path::addChild(htd::vertex_t vertex)
 
     node.child = ret;
 
-    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
+    implementation_->edges_->emplace_back(implementation_->next_edge_, vertex, ret);
 
     node.edges.push_back(implementation_->next_edge_);
-    newNode->edges.push_back(implementation_->next_edge_);
+    newNode.edges.push_back(implementation_->next_edge_);
 
     implementation_->vertices_.emplace_back(ret);
 
@@ -993,7 +1015,7 @@ void htd::Path::removeChild(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t child = implementation_->nodes_.at(vertex)->child;
+    htd::vertex_t child = implementation_->nodeAt(vertex).child;
 
     HTD_ASSERT(child != htd::Vertex::UNKNOWN)
 
@@ -1005,9 +1027,9 @@ void htd::Path::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    const auto & node = implementation_->nodes_.at(vertex);
+    const auto & node = implementation_->nodeAt(vertex);
 
-    if (node->child == child)
+    if (node.child == child)
     {
         removeVertex(child);
     }
@@ -1021,17 +1043,16 @@ htd::vertex_t htd::Path::addParent(htd::vertex_t vertex)
 
     if (isRoot(vertex))
     {
-        auto & node = *(implementation_->nodes_.at(vertex));
-
         ret = implementation_->next_vertex_;
 
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
+        implementation_->allocateNode(ret, htd::Vertex::UNKNOWN);
 
-        node.parent = ret;
+        auto & node = implementation_->nodeAt(vertex);
+        auto & newRootNode = implementation_->nodeAt(ret);
 
-        newRootNode->child = vertex;
+        node.parent = ret;
 
-        implementation_->nodes_.emplace(ret, newRootNode);
+        newRootNode.child = vertex;
 
         implementation_->vertices_.push_back(ret);
 
@@ -1041,10 +1062,10 @@ htd::vertex_t htd::Path::addParent(htd::vertex_t vertex)
 
         implementation_->root_ = ret;
 
-        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
+        implementation_->edges_->emplace_back(implementation_->next_edge_, vertex, ret);
 
-        implementation_->nodes_.at(vertex)->edges.push_back(implementation_->next_edge_);
-        newRootNode->edges.push_back(implementation_->next_edge_);
+        node.edges.push_back(implementation_->next_edge_);
+        newRootNode.edges.push_back(implementation_->next_edge_);
 
         implementation_->next_edge_++;
     }
@@ -1054,8 +1075,8 @@ htd::vertex_t htd::Path::addParent(htd::vertex_t vertex)
 
         ret = addChild(parentVertex);
 
-        auto & selectedNode = *(implementation_->nodes_.at(vertex));
-        auto & intermediateNode = *(implementation_->nodes_.at(ret));
+        auto & selectedNode = implementation_->nodeAt(vertex);
+        auto & intermediateNode = implementation_->nodeAt(ret);
 
         intermediateNode.parent = parentVertex;
 
@@ -1092,9 +1113,9 @@ void htd::Path::copyLeavesTo(std::vector<htd::vertex_t> & target) const
 {
     for (const auto & node : implementation_->nodes_)
     {
-        if (node.second->child == htd::Vertex::UNKNOWN)
+        if (node.id != htd::Vertex::UNKNOWN && node.child == htd::Vertex::UNKNOWN)
         {
-            target.push_back(node.first);
+            target.push_back(node.id);
         }
     }
 
@@ -1107,9 +1128,9 @@ htd::vertex_t htd::Path::leaf(void) const
 
     for (const auto & node : implementation_->nodes_)
     {
-        if (node.second->child == htd::Vertex::UNKNOWN)
+        if (node.id != htd::Vertex::UNKNOWN && node.child == htd::Vertex::UNKNOWN)
         {
-            return node.first;
+            return node.id;
         }
     }
 
@@ -1129,63 +1150,73 @@ bool htd::Path::isLeaf(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->child == htd::Vertex::UNKNOWN;
+    return implementation_->nodeAt(vertex).child == htd::Vertex::UNKNOWN;
 }
 
-void htd::Path::Implementation::deleteNode(Node * node)
+void htd::Path::Implementation::allocateNode(htd::vertex_t vertex, htd::vertex_t parent)
 {
-    if (node != nullptr)
+    htd::index_t slot = nodes_.size();
+
+    if (freeSlots_.empty())
     {
-        auto & parent = node->parent;
+        nodes_.emplace_back(vertex, parent);
+    }
+    else
+    {
+        slot = freeSlots_.back();
 
-        htd::id_t nodeIdentifier = node->id;
+        freeSlots_.pop_back();
 
-        if (parent != htd::Vertex::UNKNOWN)
-        {
-            auto & parentNode = nodes_.at(parent);
+        Node & node = nodes_[slot];
 
-            htd::vertex_t child = parentNode->child;
+        node.id = vertex;
+        node.parent = parent;
+    }
 
-            if (child != htd::Vertex::UNKNOWN)
-            {
-                auto & childNode = nodes_.at(child);
+    htd::index_t index = vertex - htd::Vertex::FIRST;
 
-                parentNode->child = child;
-                childNode->parent = parent;
-            }
+    if (index >= slots_.size())
+    {
+        slots_.resize(index + 1, UNUSED_SLOT);
+    }
 
-            size_--;
+    slots_[index] = slot;
+}
 
-            delete nodes_.at(nodeIdentifier);
+void htd::Path::Implementation::deleteNode(htd::vertex_t vertex)
+{
+    HTD_ASSERT(contains(vertex))
 
-            nodes_.erase(nodeIdentifier);
+    htd::index_t slot = slots_[vertex - htd::Vertex::FIRST];
 
-            vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), nodeIdentifier));
-        }
-        else
-        {
-            size_--;
+    Node & node = nodes_[slot];
 
-            delete nodes_.at(nodeIdentifier);
+    vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), vertex));
 
-            nodes_.erase(nodeIdentifier);
+    /* The slot keeps the memory allocated for the edges so that it can be re-used by the next node stored in it. */
+    node.id = htd::Vertex::UNKNOWN;
+    node.parent = htd::Vertex::UNKNOWN;
+    node.child = htd::Vertex::UNKNOWN;
+    node.edges.clear();
 
-            vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), nodeIdentifier));
-        }
-    }
+    slots_[vertex - htd::Vertex::FIRST] = UNUSED_SLOT;
+
+    freeSlots_.push_back(slot);
+
+    size_--;
 }
 
 void htd::Path::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = implementation_->nodeAt(vertex);
 
     htd::vertex_t parent = node.parent;
 
     HTD_ASSERT(parent != htd::Vertex::UNKNOWN)
 
-    Implementation::Node & parentNode = *(implementation_->nodes_.at(parent));
+    Implementation::Node & parentNode = implementation_->nodeAt(parent);
 
     std::swap(node.child, parentNode.child);
 
@@ -1201,7 +1232,7 @@ void htd::Path::swapWithParent(htd::vertex_t vertex)
 
         if (parentNode.child != htd::Vertex::UNKNOWN)
         {
-            Implementation::Node & childNode = *(implementation_->nodes_.at(parentNode.child));
+            Implementation::Node & childNode = implementation_->nodeAt(parentNode.child);
 
             implementation_->updateEdgesAfterSwapWithParent(parentNode, node, childNode);
 
@@ -1212,7 +1243,7 @@ void htd::Path::swapWithParent(htd::vertex_t vertex)
     {
         htd::vertex_t grandParent = node.parent;
 
-        Implementation::Node & grandParentNode = *(implementation_->nodes_.at(grandParent));
+        Implementation::Node & grandParentNode = implementation_->nodeAt(grandParent);
 
         grandParentNode.child = vertex;
 
@@ -1285,17 +1316,18 @@ htd::Path & htd::Path::operator=(const htd::Path & original)
     {
         implementation_->reset();
 
-        implementation_->nodes_.reserve(original.implementation_->nodes_.size());
+        implementation_->nodes_ = original.implementation_->nodes_;
 
-        for (const auto & node : original.implementation_->nodes_)
-        {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
-        }
+        implementation_->slots_ = original.implementation_->slots_;
+
+        implementation_->freeSlots_ = original.implementation_->freeSlots_;
 
         implementation_->root_ = original.implementation_->root_;
 
         implementation_->size_ = original.implementation_->size_;
 
+        implementation_->vertices_ = original.implementation_->vertices_;
+
         if (original.implementation_->next_vertex_ >= htd::Vertex::FIRST)
         {
             implementation_->next_vertex_ = original.implementation_->next_vertex_;
@@ -1304,6 +1336,10 @@ htd::Path & htd::Path::operator=(const htd::Path & original)
         {
             implementation_->next_vertex_ = htd::Vertex::FIRST;
         }
+
+        *(implementation_->edges_) = *(original.implementation_->edges_);
+
+        implementation_->next_edge_ = original.implementation_->next_edge_;
     }
 
     return *this;
@@ -1329,24 +1365,20 @@ htd::Path & htd::Path::operator=(const htd::IPath & original)
 
             for (htd::vertex_t vertex : implementation_->vertices_)
             {
-                Implementation::Node * newNode = nullptr;
-
                 if (original.isRoot(vertex))
                 {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
+                    implementation_->allocateNode(vertex, htd::Vertex::UNKNOWN);
                 }
                 else
                 {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
+                    implementation_->allocateNode(vertex, original.parent(vertex));
                 }
 
                 if (!original.isLeaf(vertex))
                 {
-                    newNode->child = original.child(vertex);
+                    implementation_->nodeAt(vertex).child = original.child(vertex);
                 }
 
-                implementation_->nodes_.emplace(vertex, newNode);
-
                 if (vertex > maximumVertex)
                 {
                     maximumVertex = vertex;
@@ -1384,15 +1416,15 @@ void htd::Path::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node
 
     for (auto it = grandParentNode.edges.begin(); it != grandParentNode.edges.end() && relevantEdgePosition == edges_->end(); ++it)
     {
-        auto edgePosition = htd::hyperedgePointerPosition(edges_->begin(), edges_->end(), *it);
+        auto edgePosition = htd::hyperedgePosition(edges_->begin(), edges_->end(), *it);
 
-        if ((*edgePosition)->contains(parent))
+        if (edgePosition->contains(parent))
         {
             relevantEdgePosition = edgePosition;
         }
     }
 
-    htd::id_t oldEdgeId = (*relevantEdgePosition)->id();
+    htd::id_t oldEdgeId = relevantEdgePosition->id();
 
     parentNode.edges.erase(std::lower_bound(parentNode.edges.begin(), parentNode.edges.end(), oldEdgeId));
 
@@ -1402,15 +1434,15 @@ void htd::Path::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node
 
     grandParentNode.edges.emplace_back(next_edge_);
 
-    (*relevantEdgePosition)->setId(next_edge_);
+    relevantEdgePosition->setId(next_edge_);
 
     if (vertex < grandParent)
     {
-        (*relevantEdgePosition)->setElements(vertex, grandParent);
+        relevantEdgePosition->setElements(vertex, grandParent);
     }
     else
     {
-        (*relevantEdgePosition)->setElements(grandParent, vertex);
+        relevantEdgePosition->setElements(grandParent, vertex);
     }
 
     ++next_edge_;
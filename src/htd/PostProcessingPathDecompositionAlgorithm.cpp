@@ -365,6 +365,15 @@ void htd::PostProcessingPathDecompositionAlgorithm::addManipulationOperations(co
     }
 }
 
+std::vector<htd::ILabelingFunction *> htd::PostProcessingPathDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    ret.swap(implementation_->labelingFunctions_);
+
+    return ret;
+}
+
 bool htd::PostProcessingPathDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return false;
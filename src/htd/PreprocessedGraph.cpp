@@ -272,6 +272,13 @@ htd::ConstCollection<htd::vertex_t> htd::PreprocessedGraph::neighbors(htd::verte
     return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->neighborhood_[vertex]);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::PreprocessedGraph::neighborSpan(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return htd::ConstSpan<htd::vertex_t>(implementation_->neighborhood_[vertex]);
+}
+
 void htd::PreprocessedGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -358,6 +358,15 @@ void htd::SeparatorBasedTreeDecompositionAlgorithm::addManipulationOperations(co
     }
 }
 
+std::vector<htd::ILabelingFunction *> htd::SeparatorBasedTreeDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    ret.swap(implementation_->labelingFunctions_);
+
+    return ret;
+}
+
 bool htd::SeparatorBasedTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return false;
@@ -28,12 +28,12 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/SetCoverAlgorithm.hpp>
-#include <htd/VectorAdapter.hpp>
 
-#include <deque>
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include <cstdint>
 #include <iterator>
-#include <queue>
-#include <unordered_map>
 #include <vector>
 
 /**
@@ -42,58 +42,47 @@
 struct htd::SetCoverAlgorithm::Implementation
 {
     /**
-     *  Structure for historical entries needed for backtracking.
+     *  The data type of the words storing the bitsets.
      */
-    struct HistoryEntry
+    typedef std::uint64_t word_t;
+
+    /**
+     *  The number of bits per word.
+     */
+    static constexpr std::size_t WORD_SIZE = sizeof(word_t) * CHAR_BIT;
+
+    /**
+     *  Structure representing a node of the search tree on the explicit search stack.
+     */
+    struct Frame
     {
         /**
-         *  The index of the selected container.
+         *  The position of the first candidate container of the node on the candidate stack.
          */
-        htd::index_t selectedIndex;
+        std::size_t candidateBegin;
 
         /**
-         *  The remaining elements which still need to be covered.
+         *  The position after the last candidate container of the node on the candidate stack.
          */
-        std::vector<htd::id_t> remainder;
+        std::size_t candidateEnd;
 
         /**
-         *  The containers which have a non-empty set intersection with the remaining elements.
+         *  The position of the next candidate container which shall be selected.
          */
-        std::vector<htd::id_t> containers;
+        std::size_t next;
 
         /**
-         *  Constructor for a new history entry.
+         *  Constructor for a new frame.
          *
-         *  @param[in] selectedIndex    The index of the selected container.
-         *  @param[in] remainder        The remaining elements which still need to be covered.
-         *  @param[in] containers       The containers which have a non-empty set intersection with the remaining elements.
+         *  @param[in] candidateBegin   The position of the first candidate container of the node on the candidate stack.
+         *  @param[in] candidateEnd     The position after the last candidate container of the node on the candidate stack.
          */
-        HistoryEntry(htd::index_t selectedIndex, const std::vector<htd::id_t> & remainder, const std::vector<htd::id_t> & containers) : selectedIndex(selectedIndex), remainder(remainder), containers(containers)
+        Frame(std::size_t candidateBegin, std::size_t candidateEnd) : candidateBegin(candidateBegin), candidateEnd(candidateEnd), next(candidateBegin)
         {
 
         }
     };
 
-    /**
-     *  The comparison operator used to rank the quality of solutions.
-     */
-    class Compare
-    {
-        public:
-            /**
-             *  Check whether one solution is better than another.
-             *
-             *  @param[in] solution1    The first solution which shall be compared.
-             *  @param[in] solution2    The second solution which shall be compared.
-             *
-             *  @return True if solution1 is better than solution2, false otherwise.
-             */
-            bool operator() (const std::vector<htd::index_t> & solution1, const std::vector<htd::index_t> & solution2)
-            {
-                return solution1.size() < solution2.size();
-            }
-    };
-
     /**
      *  Constructor for the implementation details structure.
      *
@@ -113,309 +102,427 @@ struct htd::SetCoverAlgorithm::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
-};
-
-htd::SetCoverAlgorithm::SetCoverAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
-    
-}
-            
-htd::SetCoverAlgorithm::~SetCoverAlgorithm()
-{
-    
-}
-
-void htd::SetCoverAlgorithm::computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
-{
-    computeSetCover(htd::ConstCollection<htd::id_t>::getInstance(elements), htd::ConstCollection<std::vector<htd::id_t>>::getInstance(containers), target);
-}
-
-void htd::SetCoverAlgorithm::computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
-{
-    htd::id_t next = 0;
-    
-    std::deque<Implementation::HistoryEntry> history;
 
-    std::vector<htd::id_t> relevantContainers;
-    
-    std::vector<htd::id_t> oldRelevantContainers;
-    
-    std::vector<std::vector<htd::index_t>> solutions;
-    
-    std::vector<htd::id_t> remainder(elements.begin(), elements.end());
-
-    std::unordered_map<htd::id_t, std::size_t> additionalCoverage;
-
-    std::size_t minimumCoverSize = (std::size_t)-1;
+    /**
+     *  Count the set bits of a word.
+     *
+     *  @param[in] word The word.
+     *
+     *  @return The number of set bits of the given word.
+     */
+    static std::size_t popcount(word_t word)
+    {
+        return std::bitset<WORD_SIZE>(word).count();
+    }
 
-    for (htd::index_t index = 0; index < containers.size(); index++)
+    /**
+     *  Count the elements of the set intersection of two bitsets.
+     *
+     *  @param[in] bitset1      The first bitset.
+     *  @param[in] bitset2      The second bitset.
+     *  @param[in] wordCount    The number of words of both bitsets.
+     *
+     *  @return The number of bits which are set in both bitsets.
+     */
+    static std::size_t intersectionSize(const word_t * bitset1, const word_t * bitset2, std::size_t wordCount)
     {
-        std::size_t coverage = htd::set_intersection_size(remainder.begin(), remainder.end(), containers[index].begin(), containers[index].end());
+        std::size_t ret = 0;
 
-        if (coverage > 0)
+        for (std::size_t index = 0; index < wordCount; ++index)
         {
-            relevantContainers.push_back(static_cast<htd::id_t>(index));
-
-            additionalCoverage[static_cast<htd::id_t>(index)] = coverage;
+            ret += popcount(bitset1[index] & bitset2[index]);
         }
-    }
-
-    std::sort(relevantContainers.begin(), relevantContainers.end(), [&](htd::id_t container1, htd::id_t container2) { return containers[container1].size() > containers[container2].size(); });
 
-    std::unordered_set<htd::id_t> dominatedContainers;
+        return ret;
+    }
 
-    for (auto it1 = relevantContainers.begin(); it1 < relevantContainers.end(); it1++)
+    /**
+     *  Check whether a bitset is a subset of another bitset.
+     *
+     *  @param[in] subset       The potential subset.
+     *  @param[in] superset     The potential superset.
+     *  @param[in] wordCount    The number of words of both bitsets.
+     *
+     *  @return True if each bit set in the first bitset is also set in the second bitset, false otherwise.
+     */
+    static bool isSubset(const word_t * subset, const word_t * superset, std::size_t wordCount)
     {
-        htd::id_t container = *it1;
-
-        for (auto it2 = it1 + 1; it2 < relevantContainers.end(); it2++)
+        for (std::size_t index = 0; index < wordCount; ++index)
         {
-            if (std::includes(containers[container].begin(), containers[container].end(), containers[*it2].begin(), containers[*it2].end()))
+            if ((subset[index] & ~superset[index]) != 0)
             {
-                dominatedContainers.insert(*it2);
+                return false;
             }
         }
+
+        return true;
     }
 
-    std::sort(relevantContainers.begin(), relevantContainers.end());
+    /**
+     *  Compute a minimum set cover via depth-first branch-and-bound search.
+     *
+     *  @param[in] containerBits    The bitsets of the containers, restricted to the elements which must be covered.
+     *  @param[in] containerCount   The number of containers.
+     *  @param[in] elementCount     The number of elements which must be covered.
+     *  @param[out] target          The target vector to which the positions of the selected containers shall be appended.
+     */
+    static void computeMinimumSetCover(const std::vector<word_t> & containerBits, std::size_t containerCount, std::size_t elementCount, std::vector<htd::index_t> & target);
+};
 
-    for (htd::id_t dominatedContainer : dominatedContainers)
-    {
-        auto position = std::lower_bound(relevantContainers.begin(), relevantContainers.end(), dominatedContainer);
+constexpr std::size_t htd::SetCoverAlgorithm::Implementation::WORD_SIZE;
+
+void htd::SetCoverAlgorithm::Implementation::computeMinimumSetCover(const std::vector<word_t> & containerBits, std::size_t containerCount, std::size_t elementCount, std::vector<htd::index_t> & target)
+{
+    std::size_t wordCount = (elementCount + WORD_SIZE - 1) / WORD_SIZE;
 
-        if (position != relevantContainers.end())
+    /* For each element, the containers in which it occurs, stored contiguously and delimited by offsets. */
+    std::vector<std::size_t> elementOffsets(elementCount + 1, 0);
+
+    std::vector<htd::index_t> elementContainers;
+
+    for (std::size_t element = 0; element < elementCount; ++element)
+    {
+        for (htd::index_t container = 0; container < containerCount; ++container)
         {
-            relevantContainers.erase(position);
+            if (((containerBits[container * wordCount + element / WORD_SIZE] >> (element % WORD_SIZE)) & 1) != 0)
+            {
+                elementContainers.push_back(container);
+            }
         }
+
+        elementOffsets[element + 1] = elementContainers.size();
     }
 
-    DEBUGGING_CODE(
-    std::cout << "Set cover: " << std::endl << "   ";
-    htd::print(vertices, false);
-    std::cout << std::endl << std::endl;
+    std::vector<word_t> stateStack(wordCount, 0);
 
-    for (htd::index_t container : relevantContainers)
+    for (std::size_t element = 0; element < elementCount; ++element)
     {
-        std::cout << "   Relevant container: " << container << "   (";
-        htd::print(containers[container], false);
-        std::cout << std::endl;
-    })
+        stateStack[element / WORD_SIZE] |= (word_t)1 << (element % WORD_SIZE);
+    }
 
-    std::sort(relevantContainers.begin(), relevantContainers.end(), [&](htd::id_t left, htd::id_t right) { return additionalCoverage[left] > additionalCoverage[right]; });
+    /* The greedy solution serves as initial upper bound. */
+    std::vector<htd::index_t> bestSolution;
 
-    while (relevantContainers.size() > 0)
     {
-        std::swap(relevantContainers, oldRelevantContainers);
-        
-        relevantContainers.clear();
-        additionalCoverage.clear();
+        std::vector<word_t> uncovered(stateStack);
 
-        if (history.size() < minimumCoverSize && next < oldRelevantContainers.size())
-        {
-            htd::id_t selected = next;
+        std::size_t remainingElements = elementCount;
 
-            history.push_back(Implementation::HistoryEntry(selected, remainder, oldRelevantContainers));
+        while (remainingElements > 0)
+        {
+            htd::index_t selectedContainer = 0;
 
-            DEBUGGING_CODE(
-            std::cout << "Selected: " << oldRelevantContainers[selected] << std::endl << "   ";
-            htd::print(containers[oldRelevantContainers[selected]], false);
-            std::cout << std::endl << std::endl;)
+            std::size_t maximumCoverage = 0;
 
-            for (htd::id_t vertex : containers[oldRelevantContainers[selected]])
+            for (htd::index_t container = 0; container < containerCount; ++container)
             {
-                std::vector<htd::id_t>::iterator position = std::find(remainder.begin(), remainder.end(), vertex);
+                std::size_t coverage = intersectionSize(uncovered.data(), containerBits.data() + container * wordCount, wordCount);
 
-                if (position != remainder.end())
+                if (coverage > maximumCoverage)
                 {
-                    /* Iterator 'position' is no longer used after erasing the underlying element. Therefore, invalidating the iterator does no harm. */
-                    // coverity[use_iterator]
-                    remainder.erase(position);
+                    selectedContainer = container;
+
+                    maximumCoverage = coverage;
                 }
             }
 
-            next = 0;
-
-            if (remainder.size() > 0)
+            for (std::size_t index = 0; index < wordCount; ++index)
             {
-                DEBUGGING_CODE(
-                for (htd::id_t vertex : remainder)
-                {
-                    std::cout << "Remaining: " << vertex << std::endl;
-                }
+                uncovered[index] &= ~containerBits[selectedContainer * wordCount + index];
+            }
 
-                std::cout << std::endl;)
+            bestSolution.push_back(selectedContainer);
 
-                htd::index_t index = 0;
+            remainingElements -= maximumCoverage;
+        }
+    }
 
-                for (htd::id_t container : oldRelevantContainers)
-                {
-                    DEBUGGING_CODE(
-                    std::cout << "Container: " << container << "   ";
-                    htd::print(containers[container], false);
-                    std::cout << std::endl;)
+    std::vector<Frame> frames;
 
-                    std::size_t coverage = htd::set_intersection_size(remainder.begin(), remainder.end(), containers[container].begin(), containers[container].end());
+    std::vector<htd::index_t> candidateStack;
 
-                    if (index > selected && coverage > 0)
-                    {
-                        DEBUGGING_CODE(
-                        std::cout << "Relevant container: " << container << "   ";
-                        htd::print(containers[container], false);
-                        std::cout << std::endl;)
+    std::vector<std::size_t> candidateCoverage(containerCount, 0);
 
-                        relevantContainers.push_back(container);
+    std::vector<htd::index_t> selection;
 
-                        additionalCoverage[container] = coverage;
-                    }
+    /* Expand the search node at the given depth. A frame is pushed if and only if the node has to be branched on. */
+    auto expand = [&](std::size_t depth)
+    {
+        const word_t * uncovered = stateStack.data() + depth * wordCount;
 
-                    index++;
-                }
+        std::size_t remainingElements = 0;
 
-                if (relevantContainers.size() > 0)
-                {
-                    std::sort(relevantContainers.begin(), relevantContainers.end(), [&](htd::id_t left, htd::id_t right) { return additionalCoverage[left] > additionalCoverage[right]; });
+        for (std::size_t index = 0; index < wordCount; ++index)
+        {
+            remainingElements += popcount(uncovered[index]);
+        }
 
-                    DEBUGGING_CODE(std::cout << std::endl;)
-                
-                    next = 0;
-                }
-                else
-                {
-                    DEBUGGING_CODE(std::cout << "Backtracking ..." << std::endl;)
-
-                    if (!history.empty())
-                    {
-                        next = static_cast<htd::id_t>(history.back().selectedIndex) + 1;
-
-                        remainder = history.back().remainder;
-
-                        relevantContainers = history.back().containers;
-
-                        history.pop_back();
-
-                        DEBUGGING_CODE(
-                        std::cout << "   Next container: " << next << std::endl;
-                        std::cout << "   Current remainder: ";
-                        htd::print(remainder, false);
-                        std::cout << std::endl;
-                        std::cout << "   Relevant containers: ";
-                        htd::print(relevantContainers, false);
-                        std::cout << std::endl << std::endl;)
-                    }
-                    else
-                    {
-                        DEBUGGING_CODE(std::cout << "   No backtracking history found ..." << std::endl << std::endl;)
-                    }
-                }
+        if (remainingElements == 0)
+        {
+            if (selection.size() < bestSolution.size())
+            {
+                bestSolution = selection;
+            }
+
+            return;
+        }
+
+        if (depth + 1 >= bestSolution.size())
+        {
+            return;
+        }
+
+        std::size_t maximumCoverage = 0;
+
+        for (htd::index_t container = 0; container < containerCount; ++container)
+        {
+            std::size_t coverage = intersectionSize(uncovered, containerBits.data() + container * wordCount, wordCount);
+
+            candidateCoverage[container] = coverage;
+
+            if (coverage > maximumCoverage)
+            {
+                maximumCoverage = coverage;
             }
-            else
+        }
+
+        /* Each further container covers at most 'maximumCoverage' of the remaining elements. */
+        if (depth + (remainingElements + maximumCoverage - 1) / maximumCoverage >= bestSolution.size())
+        {
+            return;
+        }
+
+        /* Branch on the uncovered element which occurs in the smallest number of containers. */
+        std::size_t selectedElement = elementCount;
+
+        std::size_t minimumOccurrences = (std::size_t)-1;
+
+        for (std::size_t index = 0; index < wordCount; ++index)
+        {
+            word_t word = uncovered[index];
+
+            while (word != 0)
             {
-                std::vector<htd::index_t> newSolution;
+                word_t lowestBit = word & (~word + 1);
+
+                std::size_t element = index * WORD_SIZE + popcount(lowestBit - 1);
 
-                newSolution.reserve(history.size());
+                std::size_t occurrences = elementOffsets[element + 1] - elementOffsets[element];
 
-                for (const Implementation::HistoryEntry & entry : history)
+                if (occurrences < minimumOccurrences)
                 {
-                    newSolution.push_back(entry.containers[entry.selectedIndex]);
+                    selectedElement = element;
+
+                    minimumOccurrences = occurrences;
                 }
 
-                std::sort(newSolution.begin(), newSolution.end());
+                word ^= lowestBit;
+            }
+        }
+
+        std::size_t candidateBegin = candidateStack.size();
 
-                DEBUGGING_CODE(
-                std::cout << "Solution:   ";
-                htd::print(newSolution, false);
-                std::cout << std::endl << std::endl;
-                std::cout << "Backtracking ..." << std::endl;)
+        candidateStack.insert(candidateStack.end(),
+                              elementContainers.begin() + elementOffsets[selectedElement],
+                              elementContainers.begin() + elementOffsets[selectedElement + 1]);
 
-                solutions.push_back(newSolution);
+        std::stable_sort(candidateStack.begin() + candidateBegin, candidateStack.end(), [&](htd::index_t container1, htd::index_t container2)
+        {
+            return candidateCoverage[container1] > candidateCoverage[container2];
+        });
 
-                if (history.size() < minimumCoverSize)
-                {
-                    minimumCoverSize = history.size();
-                }
+        frames.emplace_back(candidateBegin, candidateStack.size());
+    };
 
-                next = static_cast<htd::id_t>(history.back().selectedIndex) + 1;
+    expand(0);
 
-                remainder = history.back().remainder;
+    while (!frames.empty())
+    {
+        Frame & frame = frames.back();
 
-                relevantContainers = history.back().containers;
+        std::size_t depth = frames.size() - 1;
 
-                history.pop_back();
+        if (frame.next == frame.candidateEnd || depth + 1 >= bestSolution.size())
+        {
+            candidateStack.resize(frame.candidateBegin);
 
-                DEBUGGING_CODE(
-                std::cout << "   Next container: " << next << std::endl;
-                std::cout << "   Current remainder: ";
-                htd::print(remainder, false);
-                std::cout << std::endl;
-                std::cout << "   Relevant containers: ";
-                htd::print(relevantContainers, false);
-                std::cout << std::endl << std::endl;)
+            frames.pop_back();
+
+            if (!selection.empty())
+            {
+                selection.pop_back();
             }
         }
         else
         {
-            DEBUGGING_CODE(std::cout << "Backtracking ..." << std::endl;)
+            htd::index_t container = candidateStack[frame.next];
 
-            if (!history.empty())
-            {
-                next = static_cast<htd::id_t>(history.back().selectedIndex) + 1;
+            ++frame.next;
 
-                remainder = history.back().remainder;
+            stateStack.resize((depth + 2) * wordCount);
 
-                relevantContainers = history.back().containers;
+            const word_t * uncovered = stateStack.data() + depth * wordCount;
 
-                history.pop_back();
+            word_t * remainder = stateStack.data() + (depth + 1) * wordCount;
 
-                DEBUGGING_CODE(
-                std::cout << "   Next container: " << next << std::endl;
-                std::cout << "   Current remainder: ";
-                htd::print(remainder, false);
-                std::cout << std::endl;
-                std::cout << "   Relevant containers: ";
-                htd::print(relevantContainers, false);
-                std::cout << std::endl << std::endl;)
+            const word_t * containerBitset = containerBits.data() + container * wordCount;
+
+            for (std::size_t index = 0; index < wordCount; ++index)
+            {
+                remainder[index] = uncovered[index] & ~containerBitset[index];
             }
-            else
+
+            selection.push_back(container);
+
+            std::size_t frameCount = frames.size();
+
+            expand(depth + 1);
+
+            if (frames.size() == frameCount)
             {
-                DEBUGGING_CODE(std::cout << "   No backtracking history found ..." << std::endl << std::endl;)
+                selection.pop_back();
             }
         }
     }
+
+    target.insert(target.end(), bestSolution.begin(), bestSolution.end());
+}
+
+htd::SetCoverAlgorithm::SetCoverAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+    
+}
+            
+htd::SetCoverAlgorithm::~SetCoverAlgorithm()
+{
     
-    if (solutions.size() > 0)
+}
+
+void htd::SetCoverAlgorithm::computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
+{
+    computeSetCover(htd::ConstCollection<htd::id_t>::getInstance(elements), htd::ConstCollection<std::vector<htd::id_t>>::getInstance(containers), target);
+}
+
+void htd::SetCoverAlgorithm::computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
+{
+    typedef Implementation::word_t word_t;
+
+    std::vector<htd::id_t> elementVector(elements.begin(), elements.end());
+
+    if (elementVector.empty())
+    {
+        return;
+    }
+
+    std::size_t wordCount = (elementVector.size() + Implementation::WORD_SIZE - 1) / Implementation::WORD_SIZE;
+
+    /* Remap the elements to bit positions and represent each relevant container by the bitset of the elements it covers. */
+    std::vector<htd::index_t> relevantContainers;
+
+    std::vector<word_t> containerBits;
+
+    std::vector<word_t> coveredElements(wordCount, 0);
+
+    for (htd::index_t index = 0; index < containers.size(); ++index)
     {
-        std::sort(solutions.begin(), solutions.end(), Implementation::Compare());
+        const std::vector<htd::id_t> & container = containers[index];
+
+        std::size_t offset = containerBits.size();
+
+        containerBits.resize(offset + wordCount, 0);
 
-        DEBUGGING_CODE(
-        std::size_t count = 0;
-        
-        for (const std::vector<htd::id_t>& solution : solutions)
+        bool relevant = false;
+
+        auto position = elementVector.begin();
+
+        for (htd::id_t element : container)
         {
-            if (solution.size() == minimumCoverSize)
+            position = std::lower_bound(position, elementVector.end(), element);
+
+            if (position == elementVector.end())
             {
-                std::cout << "Solution: ";
-                htd::print(solution, false);
-                std::cout << std::endl;
+                break;
+            }
 
-                for (htd::id_t container : solution)
-                {
-                    std::cout << "   " << container << ":   Content: ";
+            if (*position == element)
+            {
+                std::size_t bit = static_cast<std::size_t>(std::distance(elementVector.begin(), position));
 
-                    htd::print(containers[container], false);
-                    std::cout << std::endl;
-                }
+                containerBits[offset + bit / Implementation::WORD_SIZE] |= (word_t)1 << (bit % Implementation::WORD_SIZE);
+
+                relevant = true;
+            }
+        }
+
+        if (relevant)
+        {
+            relevantContainers.push_back(index);
+
+            for (std::size_t word = 0; word < wordCount; ++word)
+            {
+                coveredElements[word] |= containerBits[offset + word];
+            }
+        }
+        else
+        {
+            containerBits.resize(offset);
+        }
+    }
+
+    std::size_t coveredElementCount = 0;
+
+    for (word_t word : coveredElements)
+    {
+        coveredElementCount += Implementation::popcount(word);
+    }
+
+    if (coveredElementCount < elementVector.size())
+    {
+        return;
+    }
+
+    /* Remove containers whose relevant elements are also covered by another single container. */
+    std::vector<htd::index_t> dominatingContainers;
+
+    std::vector<word_t> dominatingContainerBits;
+
+    for (htd::index_t container1 = 0; container1 < relevantContainers.size(); ++container1)
+    {
+        const word_t * bitset1 = containerBits.data() + container1 * wordCount;
+
+        bool dominated = false;
 
-                std::cout << std::endl;
-                
-                count++;
+        for (htd::index_t container2 = 0; !dominated && container2 < relevantContainers.size(); ++container2)
+        {
+            const word_t * bitset2 = containerBits.data() + container2 * wordCount;
+
+            if (container1 != container2 && Implementation::isSubset(bitset1, bitset2, wordCount))
+            {
+                /* Among containers with identical relevant elements, the one with the smallest index is kept. */
+                dominated = container2 < container1 || !Implementation::isSubset(bitset2, bitset1, wordCount);
             }
         }
-        
-        std::cout << "Total solutions: " << count << std::endl << std::endl;
-        )
 
-        std::copy(solutions[0].begin(), solutions[0].end(), std::back_inserter(target));
+        if (!dominated)
+        {
+            dominatingContainers.push_back(relevantContainers[container1]);
+
+            dominatingContainerBits.insert(dominatingContainerBits.end(), bitset1, bitset1 + wordCount);
+        }
     }
+
+    std::vector<htd::index_t> solution;
+
+    Implementation::computeMinimumSetCover(dominatingContainerBits, dominatingContainers.size(), elementVector.size(), solution);
+
+    for (htd::index_t & container : solution)
+    {
+        container = dominatingContainers[container];
+    }
+
+    std::sort(solution.begin(), solution.end());
+
+    std::copy(solution.begin(), solution.end(), std::back_inserter(target));
 }
 
 const htd::LibraryInstance * htd::SetCoverAlgorithm::managementInstance(void) const noexcept
@@ -0,0 +1,986 @@
+/*
+ * File:   StaticGraph.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_STATICGRAPH_CPP
+#define HTD_HTD_STATICGRAPH_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/StaticGraph.hpp>
+#include <htd/HyperedgeVector.hpp>
+#include <htd/VectorAdapter.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+
+/**
+ *  Private implementation details of class htd::StaticGraph.
+ */
+struct htd::StaticGraph::Implementation
+{
+    /**
+     *  Lightweight view of a contiguous range of one of the flat arrays which can be wrapped by a ConstCollection.
+     */
+    template <typename T>
+    struct Range
+    {
+        /**
+         *  The type of the iterators of the range.
+         */
+        typedef typename std::vector<T>::const_iterator const_iterator;
+
+        /**
+         *  Constructor for a range.
+         *
+         *  @param[in] first    An iterator to the first element of the range.
+         *  @param[in] last     An iterator past the last element of the range.
+         */
+        Range(const_iterator first, const_iterator last) : first_(first), last_(last)
+        {
+
+        }
+
+        /**
+         *  Getter for an iterator to the first element of the range.
+         *
+         *  @return An iterator to the first element of the range.
+         */
+        const_iterator begin(void) const
+        {
+            return first_;
+        }
+
+        /**
+         *  Getter for an iterator past the last element of the range.
+         *
+         *  @return An iterator past the last element of the range.
+         */
+        const_iterator end(void) const
+        {
+            return last_;
+        }
+
+        /**
+         *  Getter for the number of elements of the range.
+         *
+         *  @return The number of elements of the range.
+         */
+        std::size_t size(void) const
+        {
+            return static_cast<std::size_t>(std::distance(first_, last_));
+        }
+
+        /**
+         *  An iterator to the first element of the range.
+         */
+        const_iterator first_;
+
+        /**
+         *  An iterator past the last element of the range.
+         */
+        const_iterator last_;
+    };
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager)
+        : managementInstance_(manager),
+          vertices_(),
+          existingVertices_(),
+          endpoints_(),
+          edgeIds_(),
+          neighborOffsets_(1, 0),
+          neighbors_(),
+          incidenceOffsets_(1, 0),
+          incidentEdges_(),
+          hyperedgeInitialization_(),
+          hyperedges_()
+    {
+
+    }
+
+    /**
+     *  Copy constructor of the implementation details structure.
+     *
+     *  The hyperedges of the original are not copied, they are re-created on demand.
+     *
+     *  @param[in] original  The original implementation details structure.
+     */
+    Implementation(const Implementation & original)
+        : managementInstance_(original.managementInstance_),
+          vertices_(original.vertices_),
+          existingVertices_(original.existingVertices_),
+          endpoints_(original.endpoints_),
+          edgeIds_(original.edgeIds_),
+          neighborOffsets_(original.neighborOffsets_),
+          neighbors_(original.neighbors_),
+          incidenceOffsets_(original.incidenceOffsets_),
+          incidentEdges_(original.incidentEdges_),
+          hyperedgeInitialization_(),
+          hyperedges_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The vector of all vertices in the graph sorted in ascending order.
+     */
+    std::vector<htd::vertex_t> vertices_;
+
+    /**
+     *  Bitmap indicating for each vertex ID, shifted by htd::Vertex::FIRST, whether it is a vertex of the graph.
+     */
+    std::vector<bool> existingVertices_;
+
+    /**
+     *  The endpoints of all edges in the order of their IDs. The endpoints of the edge at position i are stored at the indices 2 * i and 2 * i + 1.
+     */
+    std::vector<htd::vertex_t> endpoints_;
+
+    /**
+     *  The IDs of all edges in ascending order. The vector is empty if the edge IDs are htd::Id::FIRST, htd::Id::FIRST + 1, ...
+     */
+    std::vector<htd::id_t> edgeIds_;
+
+    /**
+     *  The offsets of the neighborhoods. The neighbors of vertex v are stored at the indices neighborOffsets_[v - htd::Vertex::FIRST], ..., neighborOffsets_[v - htd::Vertex::FIRST + 1] - 1.
+     */
+    std::vector<htd::index_t> neighborOffsets_;
+
+    /**
+     *  The sorted neighborhoods of all vertices.
+     */
+    std::vector<htd::vertex_t> neighbors_;
+
+    /**
+     *  The offsets of the incidence lists. The incidence list of vertex v is stored at the indices incidenceOffsets_[v - htd::Vertex::FIRST], ..., incidenceOffsets_[v - htd::Vertex::FIRST + 1] - 1.
+     */
+    std::vector<htd::index_t> incidenceOffsets_;
+
+    /**
+     *  The positions of the edges incident to each vertex in ascending order.
+     */
+    std::vector<htd::index_t> incidentEdges_;
+
+    /**
+     *  Flag ensuring that the hyperedges are created exactly once, even if the graph is accessed concurrently.
+     */
+    std::once_flag hyperedgeInitialization_;
+
+    /**
+     *  The hyperedges of the graph in the order of their IDs. The hyperedges are created on first access.
+     */
+    std::shared_ptr<std::vector<htd::Hyperedge>> hyperedges_;
+
+    /**
+     *  Getter for the number of edges.
+     *
+     *  @return The number of edges.
+     */
+    std::size_t edgeCount(void) const
+    {
+        return endpoints_.size() / 2;
+    }
+
+    /**
+     *  Getter for the ID of the edge at the given position.
+     *
+     *  @param[in] position The position of the edge.
+     *
+     *  @return The ID of the edge at the given position.
+     */
+    htd::id_t edgeId(htd::index_t position) const
+    {
+        return edgeIds_.empty() ? htd::Id::FIRST + position : edgeIds_[position];
+    }
+
+    /**
+     *  Getter for the position of the edge with the given ID.
+     *
+     *  @param[in] edgeId   The ID of the edge.
+     *
+     *  @return The position of the edge with the given ID or the number of edges if no such edge exists.
+     */
+    htd::index_t edgePosition(htd::id_t edgeId) const
+    {
+        htd::index_t ret = edgeCount();
+
+        if (edgeIds_.empty())
+        {
+            if (edgeId >= htd::Id::FIRST && edgeId - htd::Id::FIRST < ret)
+            {
+                ret = edgeId - htd::Id::FIRST;
+            }
+        }
+        else
+        {
+            auto position = std::lower_bound(edgeIds_.begin(), edgeIds_.end(), edgeId);
+
+            if (position != edgeIds_.end() && *position == edgeId)
+            {
+                ret = static_cast<htd::index_t>(std::distance(edgeIds_.begin(), position));
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Access the neighborhood of a vertex.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return The neighborhood of the vertex.
+     */
+    Range<htd::vertex_t> neighborhood(htd::vertex_t vertex) const
+    {
+        htd::index_t index = vertex - htd::Vertex::FIRST;
+
+        return Range<htd::vertex_t>(neighbors_.begin() + neighborOffsets_[index], neighbors_.begin() + neighborOffsets_[index + 1]);
+    }
+
+    /**
+     *  Access the positions of the edges incident to a vertex.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return The positions of the edges incident to the vertex.
+     */
+    Range<htd::index_t> incidentEdges(htd::vertex_t vertex) const
+    {
+        htd::index_t index = vertex - htd::Vertex::FIRST;
+
+        return Range<htd::index_t>(incidentEdges_.begin() + incidenceOffsets_[index], incidentEdges_.begin() + incidenceOffsets_[index + 1]);
+    }
+
+    /**
+     *  Access the hyperedges of the graph, creating them if necessary.
+     *
+     *  @return The hyperedges of the graph in the order of their IDs.
+     */
+    const std::shared_ptr<std::vector<htd::Hyperedge>> & hyperedges(void)
+    {
+        std::call_once(hyperedgeInitialization_, [&]()
+        {
+            std::shared_ptr<std::vector<htd::Hyperedge>> edges = std::make_shared<std::vector<htd::Hyperedge>>();
+
+            std::size_t count = edgeCount();
+
+            edges->reserve(count);
+
+            for (htd::index_t position = 0; position < count; ++position)
+            {
+                edges->emplace_back(edgeId(position), endpoints_[2 * position], endpoints_[2 * position + 1]);
+            }
+
+            hyperedges_ = std::move(edges);
+        });
+
+        return hyperedges_;
+    }
+
+    /**
+     *  Remove all but the first occurrence of each edge from the endpoint array.
+     *
+     *  Two edges are considered equal if their endpoints are equal and occur in the same order.
+     */
+    void eraseDuplicateEdges(void);
+
+    /**
+     *  Create the neighborhoods and the incidence lists of all vertices from the endpoint array.
+     */
+    void buildAdjacency(void);
+};
+
+htd::StaticGraph::StaticGraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) : implementation_(new Implementation(manager))
+{
+    implementation_->vertices_.resize(vertexCount);
+
+    std::iota(implementation_->vertices_.begin(), implementation_->vertices_.end(), htd::Vertex::FIRST);
+
+    implementation_->existingVertices_.assign(vertexCount, true);
+
+    implementation_->endpoints_.reserve(2 * edges.size());
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        HTD_ASSERT(isVertex(edge.first) && isVertex(edge.second))
+
+        implementation_->endpoints_.push_back(edge.first);
+        implementation_->endpoints_.push_back(edge.second);
+    }
+
+    implementation_->eraseDuplicateEdges();
+
+    implementation_->buildAdjacency();
+}
+
+htd::StaticGraph::StaticGraph(const htd::StaticGraph & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::StaticGraph::StaticGraph(const htd::IGraph & original) : implementation_(new Implementation(original.managementInstance()))
+{
+    original.copyVerticesTo(implementation_->vertices_);
+
+    if (!implementation_->vertices_.empty())
+    {
+        implementation_->existingVertices_.resize(implementation_->vertices_.back() - htd::Vertex::FIRST + 1, false);
+
+        for (htd::vertex_t vertex : implementation_->vertices_)
+        {
+            implementation_->existingVertices_[vertex - htd::Vertex::FIRST] = true;
+        }
+    }
+
+    implementation_->endpoints_.reserve(2 * original.edgeCount());
+
+    bool consecutiveIds = true;
+
+    for (const htd::Hyperedge & edge : original.hyperedges())
+    {
+        HTD_ASSERT(edge.size() == 2)
+
+        consecutiveIds = consecutiveIds && edge.id() == htd::Id::FIRST + implementation_->edgeIds_.size();
+
+        implementation_->edgeIds_.push_back(edge.id());
+
+        implementation_->endpoints_.push_back(edge[0]);
+        implementation_->endpoints_.push_back(edge[1]);
+    }
+
+    if (consecutiveIds)
+    {
+        std::vector<htd::id_t>().swap(implementation_->edgeIds_);
+    }
+
+    implementation_->buildAdjacency();
+}
+
+htd::StaticGraph::~StaticGraph()
+{
+
+}
+
+std::size_t htd::StaticGraph::vertexCount(void) const
+{
+    return implementation_->vertices_.size();
+}
+
+std::size_t htd::StaticGraph::edgeCount(void) const
+{
+    return implementation_->edgeCount();
+}
+
+std::size_t htd::StaticGraph::edgeCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->incidentEdges(vertex).size();
+}
+
+bool htd::StaticGraph::isVertex(htd::vertex_t vertex) const
+{
+    return vertex != htd::Vertex::UNKNOWN &&
+           vertex - htd::Vertex::FIRST < implementation_->existingVertices_.size() &&
+           implementation_->existingVertices_[vertex - htd::Vertex::FIRST];
+}
+
+bool htd::StaticGraph::isEdge(htd::id_t edgeId) const
+{
+    return implementation_->edgePosition(edgeId) < implementation_->edgeCount();
+}
+
+bool htd::StaticGraph::isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    bool ret = false;
+
+    if (isVertex(vertex1) && isVertex(vertex2))
+    {
+        const std::vector<htd::vertex_t> & endpoints = implementation_->endpoints_;
+
+        for (htd::index_t position : implementation_->incidentEdges(vertex1))
+        {
+            ret = ret || (endpoints[2 * position] == vertex1 && endpoints[2 * position + 1] == vertex2);
+        }
+    }
+
+    return ret;
+}
+
+bool htd::StaticGraph::isEdge(const std::vector<htd::vertex_t> & elements) const
+{
+    return elements.size() == 2 && isEdge(elements[0], elements[1]);
+}
+
+bool htd::StaticGraph::isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    return elements.size() == 2 && isEdge(elements[0], elements[1]);
+}
+
+htd::ConstCollection<htd::id_t> htd::StaticGraph::associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    if (isVertex(vertex1) && isVertex(vertex2))
+    {
+        auto & result = ret.container();
+
+        const std::vector<htd::vertex_t> & endpoints = implementation_->endpoints_;
+
+        for (htd::index_t position : implementation_->incidentEdges(vertex1))
+        {
+            if (endpoints[2 * position] == vertex1 && endpoints[2 * position + 1] == vertex2)
+            {
+                result.push_back(implementation_->edgeId(position));
+            }
+        }
+    }
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::id_t> htd::StaticGraph::associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const
+{
+    if (elements.size() == 2)
+    {
+        return associatedEdgeIds(elements[0], elements[1]);
+    }
+
+    return htd::ConstCollection<htd::id_t>();
+}
+
+htd::ConstCollection<htd::id_t> htd::StaticGraph::associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    if (elements.size() == 2)
+    {
+        return associatedEdgeIds(elements[0], elements[1]);
+    }
+
+    return htd::ConstCollection<htd::id_t>();
+}
+
+bool htd::StaticGraph::isConnected(void) const
+{
+    bool ret = true;
+
+    const std::vector<htd::vertex_t> & vertices = implementation_->vertices_;
+
+    if (!vertices.empty())
+    {
+        std::vector<bool> visitedVertices(implementation_->existingVertices_.size(), false);
+
+        std::vector<htd::vertex_t> stack;
+
+        std::size_t visitedVertexCount = 1;
+
+        visitedVertices[vertices[0] - htd::Vertex::FIRST] = true;
+
+        stack.push_back(vertices[0]);
+
+        while (!stack.empty())
+        {
+            htd::vertex_t currentVertex = stack.back();
+
+            stack.pop_back();
+
+            for (htd::vertex_t neighbor : implementation_->neighborhood(currentVertex))
+            {
+                if (!visitedVertices[neighbor - htd::Vertex::FIRST])
+                {
+                    visitedVertices[neighbor - htd::Vertex::FIRST] = true;
+
+                    ++visitedVertexCount;
+
+                    stack.push_back(neighbor);
+                }
+            }
+        }
+
+        ret = visitedVertexCount == vertices.size();
+    }
+
+    return ret;
+}
+
+bool htd::StaticGraph::isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
+
+    bool ret = vertex1 == vertex2;
+
+    if (!ret)
+    {
+        std::vector<bool> visitedVertices(implementation_->existingVertices_.size(), false);
+
+        std::vector<htd::vertex_t> stack;
+
+        visitedVertices[vertex1 - htd::Vertex::FIRST] = true;
+
+        stack.push_back(vertex1);
+
+        while (!ret && !stack.empty())
+        {
+            htd::vertex_t currentVertex = stack.back();
+
+            stack.pop_back();
+
+            for (htd::vertex_t neighbor : implementation_->neighborhood(currentVertex))
+            {
+                if (!visitedVertices[neighbor - htd::Vertex::FIRST])
+                {
+                    visitedVertices[neighbor - htd::Vertex::FIRST] = true;
+
+                    ret = ret || neighbor == vertex2;
+
+                    stack.push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool htd::StaticGraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
+{
+    HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
+
+    const Implementation::Range<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood(vertex);
+
+    return std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), neighbor);
+}
+
+std::size_t htd::StaticGraph::neighborCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->neighborhood(vertex).size();
+}
+
+htd::ConstCollection<htd::vertex_t> htd::StaticGraph::neighbors(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->neighborhood(vertex));
+}
+
+void htd::StaticGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const Implementation::Range<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood(vertex);
+
+    target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
+}
+
+htd::ConstSpan<htd::vertex_t> htd::StaticGraph::neighborSpan(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    htd::index_t index = vertex - htd::Vertex::FIRST;
+
+    htd::index_t offset = implementation_->neighborOffsets_[index];
+
+    return htd::ConstSpan<htd::vertex_t>(implementation_->neighbors_.data() + offset, implementation_->neighborOffsets_[index + 1] - offset);
+}
+
+htd::vertex_t htd::StaticGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const Implementation::Range<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood(vertex);
+
+    HTD_ASSERT(index < currentNeighborhood.size())
+
+    return *(currentNeighborhood.begin() + index);
+}
+
+htd::ConstCollection<htd::vertex_t> htd::StaticGraph::vertices(void) const
+{
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertices_);
+}
+
+void htd::StaticGraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
+{
+    target.insert(target.end(), implementation_->vertices_.begin(), implementation_->vertices_.end());
+}
+
+htd::vertex_t htd::StaticGraph::vertexAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->vertices_.size())
+
+    return implementation_->vertices_[index];
+}
+
+const std::vector<htd::vertex_t> & htd::StaticGraph::vertexVector(void) const
+{
+    return implementation_->vertices_;
+}
+
+std::size_t htd::StaticGraph::isolatedVertexCount(void) const
+{
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex : implementation_->vertices_)
+    {
+        if (implementation_->neighborhood(vertex).size() == 0)
+        {
+            ++ret;
+        }
+    }
+
+    return ret;
+}
+
+htd::ConstCollection<htd::vertex_t> htd::StaticGraph::isolatedVertices(void) const
+{
+    htd::VectorAdapter<htd::vertex_t> ret;
+
+    auto & result = ret.container();
+
+    for (htd::vertex_t vertex : implementation_->vertices_)
+    {
+        if (implementation_->neighborhood(vertex).size() == 0)
+        {
+            result.push_back(vertex);
+        }
+    }
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
+}
+
+htd::vertex_t htd::StaticGraph::isolatedVertexAtPosition(htd::index_t index) const
+{
+    for (htd::vertex_t vertex : implementation_->vertices_)
+    {
+        if (implementation_->neighborhood(vertex).size() == 0)
+        {
+            if (index == 0)
+            {
+                return vertex;
+            }
+
+            --index;
+        }
+    }
+
+    throw std::out_of_range("htd::vertex_t htd::StaticGraph::isolatedVertexAtPosition(htd::index_t) const");
+}
+
+bool htd::StaticGraph::isIsolatedVertex(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->neighborhood(vertex).size() == 0;
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::StaticGraph::hyperedges(void) const
+{
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->hyperedges()));
+}
+
+htd::ConstSpan<htd::Hyperedge> htd::StaticGraph::hyperedgeSpan(void) const
+{
+    return htd::ConstSpan<htd::Hyperedge>(*(implementation_->hyperedges()));
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::StaticGraph::hyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    htd::VectorAdapter<htd::Hyperedge> ret;
+
+    auto & result = ret.container();
+
+    const std::vector<htd::vertex_t> & endpoints = implementation_->endpoints_;
+
+    for (htd::index_t position : implementation_->incidentEdges(vertex))
+    {
+        result.emplace_back(implementation_->edgeId(position), endpoints[2 * position], endpoints[2 * position + 1]);
+    }
+
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
+}
+
+const htd::Hyperedge & htd::StaticGraph::hyperedge(htd::id_t edgeId) const
+{
+    htd::index_t position = implementation_->edgePosition(edgeId);
+
+    if (position == implementation_->edgeCount())
+    {
+        throw std::logic_error("const htd::Hyperedge & htd::StaticGraph::hyperedge(htd::id_t) const");
+    }
+
+    return (*(implementation_->hyperedges()))[position];
+}
+
+const htd::Hyperedge & htd::StaticGraph::hyperedgeAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->edgeCount())
+
+    return (*(implementation_->hyperedges()))[index];
+}
+
+const htd::Hyperedge & htd::StaticGraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const Implementation::Range<htd::index_t> & incidentEdges = implementation_->incidentEdges(vertex);
+
+    if (index >= incidentEdges.size())
+    {
+        throw std::out_of_range("const htd::Hyperedge & htd::StaticGraph::hyperedgeAtPosition(htd::index_t, htd::vertex_t) const");
+    }
+
+    return (*(implementation_->hyperedges()))[*(incidentEdges.begin() + index)];
+}
+
+htd::FilteredHyperedgeCollection htd::StaticGraph::hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const
+{
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeVector(implementation_->hyperedges()), indices);
+}
+
+htd::FilteredHyperedgeCollection htd::StaticGraph::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
+{
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeVector(implementation_->hyperedges()), std::move(indices));
+}
+
+const htd::LibraryInstance * htd::StaticGraph::managementInstance(void) const noexcept
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::StaticGraph::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::StaticGraph * htd::StaticGraph::clone(void) const
+{
+    return new htd::StaticGraph(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IGraph * htd::StaticGraph::cloneGraph(void) const
+{
+    return clone();
+}
+
+htd::IMultiGraph * htd::StaticGraph::cloneMultiGraph(void) const
+{
+    return clone();
+}
+
+htd::IHypergraph * htd::StaticGraph::cloneHypergraph(void) const
+{
+    return clone();
+}
+
+htd::IGraphStructure * htd::StaticGraph::cloneGraphStructure(void) const
+{
+    return clone();
+}
+
+htd::IMultiHypergraph * htd::StaticGraph::cloneMultiHypergraph(void) const
+{
+    return clone();
+}
+#endif
+
+htd::StaticGraph & htd::StaticGraph::operator=(const htd::StaticGraph & original)
+{
+    if (this != &original)
+    {
+        implementation_.reset(new Implementation(*(original.implementation_)));
+    }
+
+    return *this;
+}
+
+void htd::StaticGraph::Implementation::eraseDuplicateEdges(void)
+{
+    std::size_t vertexRange = existingVertices_.size();
+
+    std::size_t count = edgeCount();
+
+    /* Group the edges by their first endpoint with a counting sort, which keeps the edges of each group in input order. */
+    std::vector<htd::index_t> offsets(vertexRange + 1, 0);
+
+    for (htd::index_t position = 0; position < count; ++position)
+    {
+        ++offsets[endpoints_[2 * position] - htd::Vertex::FIRST + 1];
+    }
+
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<htd::index_t> groupedEdges(count);
+
+    for (htd::index_t position = 0; position < count; ++position)
+    {
+        groupedEdges[offsets[endpoints_[2 * position] - htd::Vertex::FIRST]++] = position;
+    }
+
+    /* Within each group, an edge is a duplicate if its second endpoint was already seen in the same group. */
+    std::vector<htd::vertex_t> lastFirstEndpoint(vertexRange, htd::Vertex::UNKNOWN);
+
+    std::vector<bool> duplicates(count, false);
+
+    bool duplicateFound = false;
+
+    for (htd::index_t position : groupedEdges)
+    {
+        htd::vertex_t firstEndpoint = endpoints_[2 * position];
+
+        htd::vertex_t & lastOccurrence = lastFirstEndpoint[endpoints_[2 * position + 1] - htd::Vertex::FIRST];
+
+        if (lastOccurrence == firstEndpoint)
+        {
+            duplicates[position] = true;
+
+            duplicateFound = true;
+        }
+
+        lastOccurrence = firstEndpoint;
+    }
+
+    if (duplicateFound)
+    {
+        htd::index_t target = 0;
+
+        for (htd::index_t position = 0; position < count; ++position)
+        {
+            if (!duplicates[position])
+            {
+                endpoints_[2 * target] = endpoints_[2 * position];
+                endpoints_[2 * target + 1] = endpoints_[2 * position + 1];
+
+                ++target;
+            }
+        }
+
+        endpoints_.resize(2 * target);
+
+        endpoints_.shrink_to_fit();
+    }
+}
+
+void htd::StaticGraph::Implementation::buildAdjacency(void)
+{
+    std::size_t vertexRange = existingVertices_.size();
+
+    std::size_t count = edgeCount();
+
+    incidenceOffsets_.assign(vertexRange + 1, 0);
+
+    for (htd::index_t position = 0; position < count; ++position)
+    {
+        htd::vertex_t vertex1 = endpoints_[2 * position];
+        htd::vertex_t vertex2 = endpoints_[2 * position + 1];
+
+        ++incidenceOffsets_[vertex1 - htd::Vertex::FIRST + 1];
+
+        if (vertex1 != vertex2)
+        {
+            ++incidenceOffsets_[vertex2 - htd::Vertex::FIRST + 1];
+        }
+    }
+
+    std::partial_sum(incidenceOffsets_.begin(), incidenceOffsets_.end(), incidenceOffsets_.begin());
+
+    incidentEdges_.resize(incidenceOffsets_.back());
+
+    neighbors_.resize(incidenceOffsets_.back());
+
+    std::vector<htd::index_t> nextPosition(incidenceOffsets_.begin(), incidenceOffsets_.end() - 1);
+
+    for (htd::index_t position = 0; position < count; ++position)
+    {
+        htd::vertex_t vertex1 = endpoints_[2 * position];
+        htd::vertex_t vertex2 = endpoints_[2 * position + 1];
+
+        htd::index_t & nextPosition1 = nextPosition[vertex1 - htd::Vertex::FIRST];
+
+        incidentEdges_[nextPosition1] = position;
+        neighbors_[nextPosition1] = vertex2;
+
+        ++nextPosition1;
+
+        if (vertex1 != vertex2)
+        {
+            htd::index_t & nextPosition2 = nextPosition[vertex2 - htd::Vertex::FIRST];
+
+            incidentEdges_[nextPosition2] = position;
+            neighbors_[nextPosition2] = vertex1;
+
+            ++nextPosition2;
+        }
+    }
+
+    /* Sort the neighborhoods and compact them in place after removing neighbors shared by parallel edges. */
+    neighborOffsets_.assign(vertexRange + 1, 0);
+
+    htd::index_t target = 0;
+
+    for (htd::index_t index = 0; index < vertexRange; ++index)
+    {
+        auto first = neighbors_.begin() + incidenceOffsets_[index];
+        auto last = neighbors_.begin() + incidenceOffsets_[index + 1];
+
+        std::sort(first, last);
+
+        last = std::unique(first, last);
+
+        neighborOffsets_[index] = target;
+
+        target = static_cast<htd::index_t>(std::distance(neighbors_.begin(), std::copy(first, last, neighbors_.begin() + target)));
+    }
+
+    neighborOffsets_[vertexRange] = target;
+
+    neighbors_.resize(target);
+
+    neighbors_.shrink_to_fit();
+}
+
+#endif /* HTD_HTD_STATICGRAPH_CPP */
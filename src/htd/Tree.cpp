@@ -31,17 +31,16 @@
 #include <htd/VectorAdapter.hpp>
 #include <htd/PreOrderTreeTraversal.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
-#include <htd/HyperedgePointerDeque.hpp>
-#include <htd/ConstPointerIteratorWrapper.hpp>
+#include <htd/HyperedgeDeque.hpp>
 
 #include <htd/Algorithm.hpp>
 
 #include <algorithm>
 #include <deque>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
 
 /**
@@ -55,9 +54,9 @@ struct htd::Tree::Implementation
     struct Node
     {
         /**
-         *  The ID of the tree node.
+         *  The ID of the tree node or htd::Vertex::UNKNOWN if the slot of the node is currently unused.
          */
-        htd::id_t id;
+        htd::vertex_t id;
 
         /**
          *  The parent of the tree node.
@@ -65,9 +64,9 @@ struct htd::Tree::Implementation
         htd::vertex_t parent;
 
         /**
-         *  The collection of all edge identifiers containing the tree node.
+         *  The ID of the edge connecting the tree node with its parent or htd::Id::UNKNOWN if the tree node is the root.
          */
-        std::vector<htd::id_t> edges;
+        htd::id_t parentEdge;
 
         /**
          *  The collection of all children of the tree node.
@@ -80,27 +79,7 @@ struct htd::Tree::Implementation
          *  @param[in] id       The ID of the constructed tree node.
          *  @param[in] parent   The parent of the constructed tree node.
          */
-        Node(htd::id_t id, htd::vertex_t parent) : id(id), parent(parent), edges(), children()
-        {
-
-        }
-
-        /**
-         *  Copy constructor for a tree node.
-         *
-         *  @param[in] original  The original tree node.
-         */
-        Node(const Node & original) : id(original.id), parent(original.parent), edges(original.edges), children(original.children)
-        {
-
-        }
-
-        /**
-         *  Move constructor for a tree node.
-         *
-         *  @param[in] original  The original tree node.
-         */
-        Node(Node && original) : id(original.id), parent(original.parent), edges(std::move(original.edges)), children(std::move(original.children))
+        Node(htd::vertex_t id, htd::vertex_t parent) : id(id), parent(parent), parentEdge(htd::Id::UNKNOWN), children()
         {
 
         }
@@ -111,22 +90,14 @@ struct htd::Tree::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), slots_(), freeSlots_(), edges_(std::make_shared<std::deque<htd::Hyperedge>>())
     {
 
     }
 
     virtual ~Implementation()
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
 
-        for (htd::Hyperedge * edge : *edges_)
-        {
-            delete edge;
-        }
     }
 
     /**
@@ -141,20 +112,12 @@ struct htd::Tree::Implementation
           next_edge_(original.next_edge_),
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
-          nodes_(),
-          edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+          nodes_(original.nodes_),
+          slots_(original.slots_),
+          freeSlots_(original.freeSlots_),
+          edges_(std::make_shared<std::deque<htd::Hyperedge>>(*(original.edges_)))
     {
-        nodes_.reserve(original.nodes_.size());
 
-        for (const auto & node : original.nodes_)
-        {
-            nodes_.emplace(node.first, new Node(*(node.second)));
-        }
-
-        for (const htd::Hyperedge * edge : *(original.edges_))
-        {
-            edges_->emplace_back(new htd::Hyperedge(*edge));
-        }
     }
 
     /**
@@ -162,17 +125,11 @@ struct htd::Tree::Implementation
      */
     void reset(void)
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         nodes_.clear();
 
-        for (htd::Hyperedge * edge : *edges_)
-        {
-            delete edge;
-        }
+        slots_.clear();
+
+        freeSlots_.clear();
 
         edges_->clear();
 
@@ -187,6 +144,46 @@ struct htd::Tree::Implementation
         vertices_.clear();
     }
 
+    /**
+     *  Check whether the given vertex is a node of the tree.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return True if the given vertex is a node of the tree, false otherwise.
+     */
+    bool contains(htd::vertex_t vertex) const
+    {
+        return vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < slots_.size() && slots_[vertex - htd::Vertex::FIRST] != UNUSED_SLOT;
+    }
+
+    /**
+     *  Access the information of an existing node of the tree.
+     *
+     *  @param[in] vertex   The node of the tree.
+     *
+     *  @return The information of the given node.
+     */
+    Node & nodeAt(htd::vertex_t vertex)
+    {
+        HTD_ASSERT(contains(vertex))
+
+        return nodes_[slots_[vertex - htd::Vertex::FIRST]];
+    }
+
+    /**
+     *  Access the information of an existing node of the tree.
+     *
+     *  @param[in] vertex   The node of the tree.
+     *
+     *  @return The information of the given node.
+     */
+    const Node & nodeAt(htd::vertex_t vertex) const
+    {
+        HTD_ASSERT(contains(vertex))
+
+        return nodes_[slots_[vertex - htd::Vertex::FIRST]];
+    }
+
     /**
      *  The management instance to which the current object instance belongs.
      */
@@ -218,21 +215,71 @@ struct htd::Tree::Implementation
     std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The map of pointers to all tree nodes. It maps vertex IDs to the corresponding node information.
+     *  The arena holding the information of all tree nodes. Slots of removed nodes are recorded in freeSlots_ and reused for new nodes.
      */
-    std::unordered_map<htd::id_t, Node *> nodes_;
+    std::vector<Node> nodes_;
 
     /**
-     *  The collection of all hyperedges which exist in the tree.
+     *  The position of each node within the arena. The position of vertex i is stored at index i - htd::Vertex::FIRST.
      */
-    std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
+    std::vector<htd::index_t> slots_;
+
+    /**
+     *  The positions of the unused slots of the arena.
+     */
+    std::vector<htd::index_t> freeSlots_;
+
+    /**
+     *  The collection of all hyperedges which exist in the tree, sorted by their IDs.
+     */
+    std::shared_ptr<std::deque<htd::Hyperedge>> edges_;
+
+    /**
+     *  Marker for vertices which are not contained in the arena.
+     */
+    static const htd::index_t UNUSED_SLOT;
+
+    /**
+     *  Store a new node in the arena, re-using the slot of a previously removed node if possible.
+     *
+     *  @param[in] vertex   The ID of the new node.
+     *  @param[in] parent   The parent of the new node.
+     */
+    void allocateNode(htd::vertex_t vertex, htd::vertex_t parent);
 
     /**
      *  Delete a node of the tree and perform an update of the internal state.
      *
-     *  @param[in] node The node of the tree which shall be removed.
+     *  @param[in] vertex   The node of the tree which shall be removed.
+     */
+    void deleteNode(htd::vertex_t vertex);
+
+    /**
+     *  Add a new edge between a node and its parent.
+     *
+     *  @param[in] parent   The parent node.
+     *  @param[in] child    The child node.
      */
-    void deleteNode(Node * node);
+    void addEdge(htd::vertex_t parent, htd::vertex_t child);
+
+    /**
+     *  Remove the edge with the given ID.
+     *
+     *  @param[in] edgeId   The ID of the edge which shall be removed.
+     */
+    void removeEdge(htd::id_t edgeId);
+
+    /**
+     *  Let the edge with the given ID connect the given parent and child.
+     *
+     *  The edge keeps its ID and therefore its position in the edge collection, which avoids
+     *  erasing it from the middle of the collection when a node is attached to a new parent.
+     *
+     *  @param[in] edgeId   The ID of the edge which shall be updated.
+     *  @param[in] parent   The new parent vertex of the edge.
+     *  @param[in] child    The new child vertex of the edge.
+     */
+    void updateEdge(htd::id_t edgeId, htd::vertex_t parent, htd::vertex_t child);
 
     /**
      *  Updates the edge information for the nodes affected by a call to swapWithParent(htd::vertex_t).
@@ -244,6 +291,8 @@ struct htd::Tree::Implementation
     void updateEdgesAfterSwapWithParent(Node & node, Node & parentNode, Node & grandParentNode);
 };
 
+const htd::index_t htd::Tree::Implementation::UNUSED_SLOT = std::numeric_limits<htd::index_t>::max();
+
 htd::Tree::Tree(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
 {
 
@@ -303,7 +352,7 @@ std::size_t htd::Tree::edgeCount(htd::vertex_t vertex) const
 
 bool htd::Tree::isVertex(htd::vertex_t vertex) const
 {
-    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->nodes_.count(vertex) == 1;
+    return implementation_->contains(vertex);
 }
 
 bool htd::Tree::isEdge(htd::id_t edgeId) const
@@ -397,7 +446,7 @@ bool htd::Tree::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(neighbor))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->nodeAt(vertex);
 
     const auto & children = node.children;
 
@@ -445,7 +494,7 @@ std::size_t htd::Tree::neighborCount(htd::vertex_t vertex) const
     
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->nodeAt(vertex);
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
@@ -472,7 +521,7 @@ void htd::Tree::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 
     std::size_t size = target.size();
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->nodeAt(vertex);
 
     const auto & children = node.children;
 
@@ -563,8 +612,7 @@ bool htd::Tree::isIsolatedVertex(htd::vertex_t vertex) const
 
 htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(void) const
 {
-    return htd::ConstCollection<htd::Hyperedge>(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new htd::ConstPointerIteratorWrapper<std::deque<htd::Hyperedge *>::const_iterator, htd::Hyperedge>(implementation_->edges_->begin())),
-                                                static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new htd::ConstPointerIteratorWrapper<std::deque<htd::Hyperedge *>::const_iterator, htd::Hyperedge>(implementation_->edges_->end())));
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->edges_));
 }
 
 htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(htd::vertex_t vertex) const
@@ -575,11 +623,11 @@ htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(htd::vertex_t vertex)
 
     auto & result = ret.container();
 
-    for (auto & edge : *(implementation_->edges_))
+    for (const htd::Hyperedge & edge : *(implementation_->edges_))
     {
-        if (edge->contains(vertex))
+        if (edge.contains(vertex))
         {
-            result.emplace_back(*edge);
+            result.emplace_back(edge);
         }
     }
 
@@ -588,29 +636,27 @@ htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(htd::vertex_t vertex)
 
 const htd::Hyperedge & htd::Tree::hyperedge(htd::id_t edgeId) const
 {
-    auto it = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), edgeId);
+    auto it = htd::hyperedgePosition(implementation_->edges_->begin(), implementation_->edges_->end(), edgeId);
 
     if (it == implementation_->edges_->end())
     {
         throw std::logic_error("const htd::Hyperedge & htd::Tree::hyperedge(htd::id_t) const");
     }
 
-    return **it;
+    return *it;
 }
 
 const htd::Hyperedge & htd::Tree::hyperedgeAtPosition(htd::index_t index) const
 {
     HTD_ASSERT(index < implementation_->edges_->size())
 
-    return *(implementation_->edges_->at(index));
+    return implementation_->edges_->at(index);
 }
 
 const htd::Hyperedge & htd::Tree::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
-    for (auto it = implementation_->edges_->begin(); it != implementation_->edges_->end(); ++it)
+    for (const htd::Hyperedge & hyperedge : *(implementation_->edges_))
     {
-        const htd::Hyperedge & hyperedge = **it;
-
         if (hyperedge.contains(vertex))
         {
             if (index == 0)
@@ -634,7 +680,7 @@ htd::FilteredHyperedgeCollection htd::Tree::hyperedgesAtPositions(const std::vec
     }
     #endif
 
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgePointerDeque(implementation_->edges_), indices);
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), indices);
 }
 
 htd::FilteredHyperedgeCollection htd::Tree::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
@@ -646,7 +692,7 @@ htd::FilteredHyperedgeCollection htd::Tree::hyperedgesAtPositions(std::vector<ht
     }
     #endif
 
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgePointerDeque(implementation_->edges_), std::move(indices));
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), std::move(indices));
 }
 
 htd::vertex_t htd::Tree::root(void) const
@@ -665,7 +711,7 @@ htd::vertex_t htd::Tree::parent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t ret = implementation_->nodeAt(vertex).parent;
 
     HTD_ASSERT(ret != htd::Vertex::UNKNOWN)
     
@@ -677,28 +723,28 @@ bool htd::Tree::isParent(htd::vertex_t vertex, htd::vertex_t parent) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(parent))
 
-    return implementation_->nodes_.at(vertex)->parent == parent;
+    return implementation_->nodeAt(vertex).parent == parent;
 }
 
 std::size_t htd::Tree::childCount(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.size();
+    return implementation_->nodeAt(vertex).children.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::Tree::children(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodes_.at(vertex)->children);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodeAt(vertex).children);
 }
 
 void htd::Tree::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & childCollection = implementation_->nodes_.at(vertex)->children;
+    const std::vector<htd::vertex_t> & childCollection = implementation_->nodeAt(vertex).children;
 
     target.insert(target.end(), childCollection.begin(), childCollection.end());
 }
@@ -707,7 +753,7 @@ htd::vertex_t htd::Tree::childAtPosition(htd::vertex_t vertex, htd::index_t inde
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->nodeAt(vertex).children;
 
     HTD_ASSERT(index < children.size())
 
@@ -719,7 +765,7 @@ bool htd::Tree::isChild(htd::vertex_t vertex, htd::vertex_t child) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->nodeAt(vertex).children;
 
     return std::find(children.begin(), children.end(), child) != children.end();
 }
@@ -757,13 +803,13 @@ std::size_t htd::Tree::depth(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t currentVertex = implementation_->nodeAt(vertex).parent;
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->parent;
+        currentVertex = implementation_->nodeAt(currentVertex).parent;
     }
 
     return ret;
@@ -783,188 +829,90 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
-
-    auto end = implementation_->edges_->end();
+    Implementation::Node & node = implementation_->nodeAt(vertex);
 
-    for (auto it = node.edges.rbegin(); it != node.edges.rend(); ++it)
+    if (node.parentEdge != htd::Id::UNKNOWN)
     {
-        auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), end, *it);
+        implementation_->removeEdge(node.parentEdge);
 
-        for (htd::vertex_t currentVertex : (*position)->sortedElements())
-        {
-            if (currentVertex != vertex)
-            {
-                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex)->edges;
+        node.parentEdge = htd::Id::UNKNOWN;
+    }
 
-                /* Because 'currentVertex' is a neighbor of 'vertex' and 'position' points to the
-                 * edge connecting the two vertices, std::lower_bound will always find the edge
-                 * with ID '*it' in the collection 'currentEdges'. */
-                // coverity[use_iterator]
-                currentEdges.erase(std::lower_bound(currentEdges.begin(), currentEdges.end(), *it));
-            }
-        }
+    const auto & children = node.children;
 
-        delete *position;
+    for (htd::vertex_t child : children)
+    {
+        Implementation::Node & childNode = implementation_->nodeAt(child);
 
-        end = implementation_->edges_->erase(position);
-    }
+        implementation_->removeEdge(childNode.parentEdge);
 
-    const auto & children = node.children;
+        childNode.parentEdge = htd::Id::UNKNOWN;
+    }
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(node.parent));
+        Implementation::Node & parentNode = implementation_->nodeAt(node.parent);
 
         auto & siblings = parentNode.children;
 
-        switch (children.size())
+        for (htd::vertex_t child : children)
         {
-            case 0:
-            {
-                break;
-            }
-            case 1:
-            {
-                htd::vertex_t child = children[0];
-
-                Implementation::Node & childNode = *(implementation_->nodes_.at(child));
-
-                childNode.parent = node.parent;
+            implementation_->nodeAt(child).parent = node.parent;
 
-                auto position = std::lower_bound(siblings.begin(), siblings.end(), child);
+            auto position = std::lower_bound(siblings.begin(), siblings.end(), child);
 
-                if (position == siblings.end() || *position != child)
-                {
-                    siblings.insert(position, child);
-                }
-
-                if (node.parent < child)
-                {
-                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, child));
-                }
-                else
-                {
-                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, node.parent));
-                }
-
-                childNode.edges.emplace_back(implementation_->next_edge_);
-
-                parentNode.edges.emplace_back(implementation_->next_edge_);
-
-                ++implementation_->next_edge_;
-
-                break;
-            }
-            default:
+            if (position == siblings.end() || *position != child)
             {
-                for (htd::vertex_t child : children)
-                {
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
-
-                    childNode.parent = node.parent;
-
-                    auto position = std::lower_bound(siblings.begin(), siblings.end(), child);
-
-                    if (position == siblings.end() || *position != child)
-                    {
-                        siblings.insert(position, child);
-                    }
-
-                    if (node.parent < child)
-                    {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, child));
-                    }
-                    else
-                    {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, node.parent));
-                    }
-
-                    childNode.edges.emplace_back(implementation_->next_edge_);
-
-                    parentNode.edges.emplace_back(implementation_->next_edge_);
-
-                    implementation_->next_edge_++;
-                }
-
-                break;
+                siblings.insert(position, child);
             }
+
+            implementation_->addEdge(node.parent, child);
         }
 
-        implementation_->deleteNode(implementation_->nodes_.at(vertex));
+        implementation_->deleteNode(vertex);
     }
     else
     {
-        switch (children.size())
+        if (children.empty())
         {
-            case 0:
-            {
-                implementation_->root_ = htd::Vertex::UNKNOWN;
+            implementation_->root_ = htd::Vertex::UNKNOWN;
 
-                implementation_->size_ = 0;
+            implementation_->size_ = 0;
 
-                implementation_->nodes_.clear();
-                implementation_->edges_->clear();
+            implementation_->nodes_.clear();
+            implementation_->slots_.clear();
+            implementation_->freeSlots_.clear();
+            implementation_->edges_->clear();
 
-                implementation_->vertices_.clear();
+            implementation_->vertices_.clear();
+        }
+        else
+        {
+            implementation_->root_ = children[0];
 
-                break;
-            }
-            case 1:
-            {
-                implementation_->root_ = children[0];
+            Implementation::Node & rootNode = implementation_->nodeAt(implementation_->root_);
 
-                implementation_->nodes_.at(implementation_->root_)->parent = htd::Vertex::UNKNOWN;
+            rootNode.parent = htd::Vertex::UNKNOWN;
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+            std::vector<htd::vertex_t> & newRootChildren = rootNode.children;
 
-                break;
-            }
-            default:
+            for (auto it = children.begin() + 1; it != children.end(); ++it)
             {
-                implementation_->root_ = children[0];
-
-                Implementation::Node & rootNode = *(implementation_->nodes_.at(implementation_->root_));
+                htd::vertex_t child = *it;
 
-                rootNode.parent = htd::Vertex::UNKNOWN;
+                implementation_->nodeAt(child).parent = implementation_->root_;
 
-                std::vector<htd::vertex_t> & newRootChildren = rootNode.children;
+                auto position = std::lower_bound(newRootChildren.begin(), newRootChildren.end(), child);
 
-                for (auto it = children.begin() + 1; it != children.end(); ++it)
+                if (position == newRootChildren.end() || *position != child)
                 {
-                    htd::vertex_t child = *it;
-
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
-
-                    childNode.parent = implementation_->root_;
-
-                    auto position = std::lower_bound(newRootChildren.begin(), newRootChildren.end(), child);
-
-                    if (position == newRootChildren.end() || *position != child)
-                    {
-                        newRootChildren.insert(position, child);
-                    }
-
-                    if (implementation_->root_ < child)
-                    {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, implementation_->root_, child));
-                    }
-                    else
-                    {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, implementation_->root_));
-                    }
-
-                    childNode.edges.emplace_back(implementation_->next_edge_);
-
-                    rootNode.edges.emplace_back(implementation_->next_edge_);
-
-                    implementation_->next_edge_++;
+                    newRootChildren.insert(position, child);
                 }
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
-
-                break;
+                implementation_->addEdge(implementation_->root_, child);
             }
+
+            implementation_->deleteNode(vertex);
         }
     }
 }
@@ -995,7 +943,10 @@ htd::vertex_t htd::Tree::insertRoot(void)
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
         implementation_->nodes_.clear();
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->slots_.clear();
+        implementation_->freeSlots_.clear();
+
+        implementation_->allocateNode(implementation_->root_, htd::Vertex::UNKNOWN);
 
         implementation_->vertices_.emplace_back(implementation_->root_);
 
@@ -1016,12 +967,17 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
         htd::vertex_t lastVertex = htd::Vertex::UNKNOWN;
         htd::vertex_t nextVertex = htd::Vertex::UNKNOWN;
 
+        htd::id_t lastEdge = htd::Id::UNKNOWN;
+        htd::id_t nextEdge = htd::Id::UNKNOWN;
+
         while (vertex != htd::Vertex::UNKNOWN)
         {
-            Implementation::Node & node = *(implementation_->nodes_[vertex]);
+            Implementation::Node & node = implementation_->nodeAt(vertex);
 
             nextVertex = node.parent;
 
+            nextEdge = node.parentEdge;
+
             std::vector<htd::vertex_t> & currentChildren = node.children;
 
             if (lastVertex != htd::Vertex::UNKNOWN)
@@ -1036,8 +992,12 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
 
             node.parent = lastVertex;
 
+            node.parentEdge = lastEdge;
+
             lastVertex = vertex;
 
+            lastEdge = nextEdge;
+
             vertex = nextVertex;
         }
     }
@@ -1047,17 +1007,11 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = htd::Vertex::UNKNOWN;
-
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
-
-    ret = implementation_->next_vertex_;
-
-    node.children.emplace_back(ret);
+    htd::vertex_t ret = implementation_->next_vertex_;
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
+    implementation_->allocateNode(ret, vertex);
 
-    implementation_->nodes_.emplace(ret, newNode);
+    implementation_->nodeAt(vertex).children.emplace_back(ret);
 
     implementation_->vertices_.emplace_back(ret);
 
@@ -1065,13 +1019,7 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     implementation_->size_++;
 
-    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
-
-    node.edges.push_back(implementation_->next_edge_);
-
-    newNode->edges.push_back(implementation_->next_edge_);
-
-    implementation_->next_edge_++;
+    implementation_->addEdge(vertex, ret);
 
     return ret;
 }
@@ -1081,7 +1029,7 @@ void htd::Tree::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = implementation_->nodeAt(vertex);
 
     auto & children = node.children;
 
@@ -1112,17 +1060,13 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
     if (isRoot(vertex))
     {
-        auto & node = implementation_->nodes_.at(vertex);
-
         ret = implementation_->next_vertex_;
 
-        node->parent = ret;
-
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
+        implementation_->allocateNode(ret, htd::Vertex::UNKNOWN);
 
-        newRootNode->children.emplace_back(vertex);
+        implementation_->nodeAt(vertex).parent = ret;
 
-        implementation_->nodes_.emplace(ret, newRootNode);
+        implementation_->nodeAt(ret).children.emplace_back(vertex);
 
         implementation_->vertices_.emplace_back(ret);
 
@@ -1136,43 +1080,13 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
     {
         htd::vertex_t parentVertex = parent(vertex);
 
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(parentVertex));
-        Implementation::Node & selectedNode = *(implementation_->nodes_.at(vertex));
-
-        htd::id_t oldHyperedge = htd::Id::UNKNOWN;
-
-        auto it = selectedNode.edges.begin();
-
-        while (it != selectedNode.edges.end())
-        {
-            auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
-
-            HTD_ASSERT(position != implementation_->edges_->end())
-
-            if ((*position)->contains(parentVertex))
-            {
-                oldHyperedge = (*position)->id();
-
-                delete *position;
-
-                implementation_->edges_->erase(position);
-
-                it = selectedNode.edges.end();
-            }
-            else
-            {
-                ++it;
-            }
-        }
-
-        parentNode.edges.erase(std::lower_bound(parentNode.edges.begin(), parentNode.edges.end(), oldHyperedge));
-        selectedNode.edges.erase(std::lower_bound(selectedNode.edges.begin(), selectedNode.edges.end(), oldHyperedge));
+        implementation_->removeEdge(implementation_->nodeAt(vertex).parentEdge);
 
         ret = htd::Tree::addChild(parentVertex);
 
-        auto & intermediateNode = *(implementation_->nodes_.at(ret));
-
-        intermediateNode.parent = parentVertex;
+        Implementation::Node & parentNode = implementation_->nodeAt(parentVertex);
+        Implementation::Node & selectedNode = implementation_->nodeAt(vertex);
+        Implementation::Node & intermediateNode = implementation_->nodeAt(ret);
 
         intermediateNode.children.emplace_back(vertex);
 
@@ -1186,12 +1100,7 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
         selectedNode.parent = ret;
     }
 
-    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
-
-    implementation_->nodes_.at(vertex)->edges.push_back(implementation_->next_edge_);
-    implementation_->nodes_.at(ret)->edges.push_back(implementation_->next_edge_);
-
-    implementation_->next_edge_++;
+    implementation_->addEdge(ret, vertex);
 
     return ret;
 }
@@ -1202,118 +1111,58 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
     HTD_ASSERT(isVertex(newParent))
     HTD_ASSERT(vertex != newParent)
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = implementation_->nodeAt(vertex);
 
     htd::vertex_t oldParent = node.parent;
 
     if (oldParent != newParent)
     {
-        auto & newParentNode = *(implementation_->nodes_.at(newParent));
+        auto & newParentNode = implementation_->nodeAt(newParent);
 
         if (oldParent != htd::Vertex::UNKNOWN)
         {
-            auto & oldParentNode = *(implementation_->nodes_.at(oldParent));
+            auto & oldParentNode = implementation_->nodeAt(oldParent);
 
             oldParentNode.children.erase(std::find(oldParentNode.children.begin(), oldParentNode.children.end(), vertex));
-
-            htd::id_t oldHyperedge = htd::Id::UNKNOWN;
-
-            auto it = oldParentNode.edges.begin();
-
-            while (it != oldParentNode.edges.end())
-            {
-                auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
-
-                HTD_ASSERT(position != implementation_->edges_->end())
-
-                if ((*position)->contains(vertex))
-                {
-                    oldHyperedge = (*position)->id();
-
-                    delete *position;
-
-                    implementation_->edges_->erase(position);
-
-                    it = oldParentNode.edges.end();
-                }
-                else
-                {
-                    ++it;
-                }
-            }
-
-            node.edges.erase(std::lower_bound(node.edges.begin(), node.edges.end(), oldHyperedge));
-            oldParentNode.edges.erase(std::lower_bound(oldParentNode.edges.begin(), oldParentNode.edges.end(), oldHyperedge));
         }
         else
         {
             htd::vertex_t relevantVertex = newParent;
 
-            while (implementation_->nodes_.at(relevantVertex)->parent != vertex)
+            while (implementation_->nodeAt(relevantVertex).parent != vertex)
             {
-                relevantVertex = implementation_->nodes_.at(relevantVertex)->parent;
+                relevantVertex = implementation_->nodeAt(relevantVertex).parent;
             }
 
             std::cout << "RELEVANT: " << relevantVertex << std::endl;
 
             implementation_->root_ = relevantVertex;
 
-            auto & relevantNode = *(implementation_->nodes_.at(relevantVertex));
+            auto & relevantNode = implementation_->nodeAt(relevantVertex);
 
             relevantNode.parent = htd::Vertex::UNKNOWN;
 
             node.children.erase(std::find(node.children.begin(), node.children.end(), relevantVertex));
 
-            htd::id_t oldHyperedge = htd::Id::UNKNOWN;
-
-            auto it = relevantNode.edges.begin();
-
-            while (it != relevantNode.edges.end())
-            {
-                auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
-
-                HTD_ASSERT(position != implementation_->edges_->end())
+            implementation_->removeEdge(relevantNode.parentEdge);
 
-                if ((*position)->contains(vertex))
-                {
-                    oldHyperedge = (*position)->id();
-
-                    delete *position;
-
-                    implementation_->edges_->erase(position);
-
-                    it = relevantNode.edges.end();
-                }
-                else
-                {
-                    ++it;
-                }
-            }
-
-            node.edges.erase(std::lower_bound(node.edges.begin(), node.edges.end(), oldHyperedge));
-            relevantNode.edges.erase(std::lower_bound(relevantNode.edges.begin(), relevantNode.edges.end(), oldHyperedge));
+            relevantNode.parentEdge = htd::Id::UNKNOWN;
         }
 
         auto position = std::lower_bound(newParentNode.children.begin(), newParentNode.children.end(), vertex);
 
         newParentNode.children.insert(position, vertex);
 
-        newParentNode.edges.emplace_back(implementation_->next_edge_);
-
-        node.edges.emplace_back(implementation_->next_edge_);
-
         node.parent = newParent;
 
-        if (vertex < newParent)
+        if (oldParent != htd::Vertex::UNKNOWN)
         {
-            implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, newParent));
+            implementation_->updateEdge(node.parentEdge, newParent, vertex);
         }
         else
         {
-            implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, newParent, vertex));
+            implementation_->addEdge(newParent, vertex);
         }
-
-        implementation_->next_edge_++;
     }
 }
 
@@ -1323,7 +1172,7 @@ std::size_t htd::Tree::leafCount(void) const noexcept
 
     for (const auto & node : implementation_->nodes_)
     {
-        if (node.second->children.empty())
+        if (node.id != htd::Vertex::UNKNOWN && node.children.empty())
         {
             ret++;
         }
@@ -1345,9 +1194,9 @@ void htd::Tree::copyLeavesTo(std::vector<htd::vertex_t> & target) const
 {
     for (const auto & node : implementation_->nodes_)
     {
-        if (node.second->children.empty())
+        if (node.id != htd::Vertex::UNKNOWN && node.children.empty())
         {
-            target.emplace_back(node.first);
+            target.emplace_back(node.id);
         }
     }
 
@@ -1371,20 +1220,20 @@ bool htd::Tree::isLeaf(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.empty();
+    return implementation_->nodeAt(vertex).children.empty();
 }
 
 void htd::Tree::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = implementation_->nodeAt(vertex);
 
     htd::vertex_t parent = node.parent;
 
     HTD_ASSERT(parent != htd::Vertex::UNKNOWN)
 
-    Implementation::Node & parentNode = *(implementation_->nodes_.at(parent));
+    Implementation::Node & parentNode = implementation_->nodeAt(parent);
 
     node.parent = parentNode.parent;
 
@@ -1397,12 +1246,16 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     if (node.parent == htd::Vertex::UNKNOWN)
     {
         implementation_->root_ = vertex;
+
+        parentNode.parentEdge = node.parentEdge;
+
+        node.parentEdge = htd::Id::UNKNOWN;
     }
     else
     {
         htd::vertex_t grandParent = node.parent;
 
-        Implementation::Node & grandParentNode = *(implementation_->nodes_.at(grandParent));
+        Implementation::Node & grandParentNode = implementation_->nodeAt(grandParent);
 
         implementation_->updateEdgesAfterSwapWithParent(node, parentNode, grandParentNode);
 
@@ -1412,30 +1265,108 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     }
 }
 
-void htd::Tree::Implementation::deleteNode(Node * node)
+void htd::Tree::Implementation::allocateNode(htd::vertex_t vertex, htd::vertex_t parent)
 {
-    HTD_ASSERT(node != nullptr)
+    htd::index_t slot = nodes_.size();
 
-    auto & parent = node->parent;
+    if (freeSlots_.empty())
+    {
+        nodes_.emplace_back(vertex, parent);
+    }
+    else
+    {
+        slot = freeSlots_.back();
+
+        freeSlots_.pop_back();
+
+        Node & node = nodes_[slot];
+
+        node.id = vertex;
+        node.parent = parent;
+        node.parentEdge = htd::Id::UNKNOWN;
+    }
+
+    htd::index_t index = vertex - htd::Vertex::FIRST;
+
+    if (index >= slots_.size())
+    {
+        slots_.resize(index + 1, UNUSED_SLOT);
+    }
 
-    htd::vertex_t vertex = node->id;
+    slots_[index] = slot;
+}
+
+void htd::Tree::Implementation::deleteNode(htd::vertex_t vertex)
+{
+    HTD_ASSERT(contains(vertex))
 
-    if (parent != htd::Vertex::UNKNOWN)
+    htd::index_t slot = slots_[vertex - htd::Vertex::FIRST];
+
+    Node & node = nodes_[slot];
+
+    if (node.parent != htd::Vertex::UNKNOWN)
     {
-        auto & children = nodes_.at(parent)->children;
+        auto & children = nodeAt(node.parent).children;
 
         children.erase(std::lower_bound(children.begin(), children.end(), vertex));
     }
 
     vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), vertex));
 
-    nodes_.erase(vertex);
+    /* The slot keeps the memory allocated for the children so that it can be re-used by the next node stored in it. */
+    node.id = htd::Vertex::UNKNOWN;
+    node.parent = htd::Vertex::UNKNOWN;
+    node.parentEdge = htd::Id::UNKNOWN;
+    node.children.clear();
+
+    slots_[vertex - htd::Vertex::FIRST] = UNUSED_SLOT;
 
-    delete node;
+    freeSlots_.push_back(slot);
 
     size_--;
 }
 
+void htd::Tree::Implementation::addEdge(htd::vertex_t parent, htd::vertex_t child)
+{
+    if (parent < child)
+    {
+        edges_->emplace_back(next_edge_, parent, child);
+    }
+    else
+    {
+        edges_->emplace_back(next_edge_, child, parent);
+    }
+
+    nodeAt(child).parentEdge = next_edge_;
+
+    ++next_edge_;
+}
+
+void htd::Tree::Implementation::removeEdge(htd::id_t edgeId)
+{
+    auto position = htd::hyperedgePosition(edges_->begin(), edges_->end(), edgeId);
+
+    HTD_ASSERT(position != edges_->end())
+
+    edges_->erase(position);
+}
+
+void htd::Tree::Implementation::updateEdge(htd::id_t edgeId, htd::vertex_t parent, htd::vertex_t child)
+{
+    auto position = htd::hyperedgePosition(edges_->begin(), edges_->end(), edgeId);
+
+    HTD_ASSERT(position != edges_->end())
+
+    if (parent < child)
+    {
+        position->setElements(parent, child);
+    }
+    else
+    {
+        position->setElements(child, parent);
+    }
+}
+
 const htd::LibraryInstance * htd::Tree::managementInstance(void) const noexcept
 {
     return implementation_->managementInstance_;
@@ -1496,20 +1427,17 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
     {
         implementation_->reset();
 
-        implementation_->nodes_.reserve(original.implementation_->nodes_.size());
+        implementation_->nodes_ = original.implementation_->nodes_;
 
-        for (const auto & node : original.implementation_->nodes_)
-        {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
-        }
+        implementation_->slots_ = original.implementation_->slots_;
+
+        implementation_->freeSlots_ = original.implementation_->freeSlots_;
 
         implementation_->root_ = original.implementation_->root_;
 
         implementation_->size_ = original.implementation_->size_;
 
-        implementation_->vertices_.clear();
-
-        std::copy(original.implementation_->vertices_.begin(), original.implementation_->vertices_.end(), std::back_inserter(implementation_->vertices_));
+        implementation_->vertices_ = original.implementation_->vertices_;
 
         if (original.implementation_->next_vertex_ >= htd::Vertex::FIRST)
         {
@@ -1520,10 +1448,7 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
             implementation_->next_vertex_ = htd::Vertex::FIRST;
         }
 
-        for (htd::Hyperedge * edge : *(original.implementation_->edges_))
-        {
-            implementation_->edges_->push_back(new htd::Hyperedge(*edge));
-        }
+        *(implementation_->edges_) = *(original.implementation_->edges_);
 
         implementation_->next_edge_ = original.implementation_->next_edge_;
     }
@@ -1549,24 +1474,22 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
             std::copy(vertexCollection.begin(), vertexCollection.end(), std::back_inserter(implementation_->vertices_));
 
+            implementation_->nodes_.reserve(implementation_->vertices_.size());
+
             for (htd::vertex_t vertex : implementation_->vertices_)
             {
-                Implementation::Node * newNode = nullptr;
-
                 if (original.isRoot(vertex))
                 {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
+                    implementation_->allocateNode(vertex, htd::Vertex::UNKNOWN);
                 }
                 else
                 {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
+                    implementation_->allocateNode(vertex, original.parent(vertex));
                 }
 
                 const htd::ConstCollection<htd::vertex_t> & childCollection = original.children(vertex);
 
-                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(newNode->children));
-
-                implementation_->nodes_.emplace(vertex, newNode);
+                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(implementation_->nodeAt(vertex).children));
 
                 if (vertex > maximumVertex)
                 {
@@ -1587,12 +1510,25 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
             for (auto it = originalEdges.begin(); it != originalEdges.end(); ++it)
             {
-                implementation_->edges_->push_back(new htd::Hyperedge(*it));
+                const htd::Hyperedge & edge = *it;
+
+                Implementation::Node & node = implementation_->nodeAt(edge[0]);
+
+                if (node.parent == edge[1])
+                {
+                    node.parentEdge = edge.id();
+                }
+                else
+                {
+                    implementation_->nodeAt(edge[1]).parentEdge = edge.id();
+                }
+
+                implementation_->edges_->push_back(edge);
             }
 
             if (!implementation_->edges_->empty())
             {
-                implementation_->next_edge_ = (*(implementation_->edges_->rbegin()))->id() + 1;
+                implementation_->next_edge_ = implementation_->edges_->back().id() + 1;
             }
         }
     }
@@ -1610,40 +1546,26 @@ void htd::Tree::assign(const htd::ITree & original)
 void htd::Tree::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node & parentNode, Node & grandParentNode)
 {
     htd::vertex_t vertex = node.id;
-    htd::vertex_t parent = parentNode.id;
     htd::vertex_t grandParent = grandParentNode.id;
 
-    auto relevantEdgePosition = edges_->end();
-
-    for (auto it = grandParentNode.edges.begin(); it != grandParentNode.edges.end() && relevantEdgePosition == edges_->end(); ++it)
-    {
-        auto edgePosition = htd::hyperedgePointerPosition(edges_->begin(), edges_->end(), *it);
-
-        if ((*edgePosition)->contains(parent))
-        {
-            relevantEdgePosition = edgePosition;
-        }
-    }
-
-    htd::id_t oldEdgeId = (*relevantEdgePosition)->id();
-
-    parentNode.edges.erase(std::lower_bound(parentNode.edges.begin(), parentNode.edges.end(), oldEdgeId));
+    auto relevantEdgePosition = htd::hyperedgePosition(edges_->begin(), edges_->end(), parentNode.parentEdge);
 
-    grandParentNode.edges.erase(std::lower_bound(grandParentNode.edges.begin(), grandParentNode.edges.end(), oldEdgeId));
+    HTD_ASSERT(relevantEdgePosition != edges_->end())
 
-    node.edges.emplace_back(next_edge_);
+    /* The edge between the node and its former parent now connects the former parent with its new parent. */
+    parentNode.parentEdge = node.parentEdge;
 
-    grandParentNode.edges.emplace_back(next_edge_);
+    node.parentEdge = next_edge_;
 
-    (*relevantEdgePosition)->setId(next_edge_);
+    relevantEdgePosition->setId(next_edge_);
 
     if (vertex < grandParent)
     {
-        (*relevantEdgePosition)->setElements(vertex, grandParent);
+        relevantEdgePosition->setElements(vertex, grandParent);
     }
     else
     {
-        (*relevantEdgePosition)->setElements(grandParent, vertex);
+        relevantEdgePosition->setElements(grandParent, vertex);
     }
 
     ++next_edge_;
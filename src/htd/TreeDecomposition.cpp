@@ -36,17 +36,35 @@
 #include <stdexcept>
 #include <unordered_set>
 
-htd::TreeDecomposition::TreeDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledTree::LabeledTree(manager), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledTree::LabeledTree(manager), bagContent_(), inducedEdges_(), minimumBagSize_(0), maximumBagSize_(0), joinNodes_(), forgetNodes_(), introduceNodes_(), exchangeNodes_(), bagSizeStatisticsValid_(true), nodeTypeStatisticsValid_(true), statisticsCachingSuspended_(false), statisticsMutex_()
 {
 
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::TreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_)
+htd::TreeDecomposition::TreeDecomposition(const htd::TreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_), minimumBagSize_(0), maximumBagSize_(0), joinNodes_(), forgetNodes_(), introduceNodes_(), exchangeNodes_(), bagSizeStatisticsValid_(false), nodeTypeStatisticsValid_(false), statisticsCachingSuspended_(false), statisticsMutex_()
 {
+    std::lock_guard<std::mutex> lock(original.statisticsMutex_);
 
+    if (original.bagSizeStatisticsValid_)
+    {
+        minimumBagSize_ = original.minimumBagSize_;
+        maximumBagSize_ = original.maximumBagSize_;
+
+        bagSizeStatisticsValid_ = true;
+    }
+
+    if (original.nodeTypeStatisticsValid_)
+    {
+        joinNodes_ = original.joinNodes_;
+        forgetNodes_ = original.forgetNodes_;
+        introduceNodes_ = original.introduceNodes_;
+        exchangeNodes_ = original.exchangeNodes_;
+
+        nodeTypeStatisticsValid_ = true;
+    }
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::ITree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::ITree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_(), minimumBagSize_(0), maximumBagSize_(0), joinNodes_(), forgetNodes_(), introduceNodes_(), exchangeNodes_(), bagSizeStatisticsValid_(false), nodeTypeStatisticsValid_(false), statisticsCachingSuspended_(false), statisticsMutex_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
@@ -56,7 +74,7 @@ htd::TreeDecomposition::TreeDecomposition(const htd::ITree & original) : htd::La
     }
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::ILabeledTree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::ILabeledTree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_(), minimumBagSize_(0), maximumBagSize_(0), joinNodes_(), forgetNodes_(), introduceNodes_(), exchangeNodes_(), bagSizeStatisticsValid_(false), nodeTypeStatisticsValid_(false), statisticsCachingSuspended_(false), statisticsMutex_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
@@ -66,7 +84,7 @@ htd::TreeDecomposition::TreeDecomposition(const htd::ILabeledTree & original) :
     }
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::ITreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::ITreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_(), minimumBagSize_(0), maximumBagSize_(0), joinNodes_(), forgetNodes_(), introduceNodes_(), exchangeNodes_(), bagSizeStatisticsValid_(false), nodeTypeStatisticsValid_(false), statisticsCachingSuspended_(false), statisticsMutex_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
@@ -88,6 +106,8 @@ void htd::TreeDecomposition::removeVertex(htd::vertex_t vertex)
     bagContent_.erase(vertex);
 
     inducedEdges_.erase(vertex);
+
+    invalidateStatistics(true);
 }
 
 void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
@@ -107,6 +127,8 @@ void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
     }, subtreeRoot);
 
     htd::Tree::removeSubtree(subtreeRoot);
+
+    invalidateStatistics(true);
 }
 
 htd::vertex_t htd::TreeDecomposition::insertRoot(void)
@@ -120,6 +142,8 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(void)
         bagContent_.emplace(ret, std::vector<htd::vertex_t>());
 
         inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+
+        registerNewNode(0);
     }
 
     return ret;
@@ -136,6 +160,8 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(const std::vector<htd::vertex_t
         bagContent_[ret] = bagContent;
 
         inducedEdges_[ret] = inducedEdges;
+
+        registerNewNode(bagContent.size());
     }
 
     return ret;
@@ -149,6 +175,8 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(std::vector<htd::vertex_t> && b
 
     if (inserted)
     {
+        registerNewNode(bagContent.size());
+
         bagContent_.emplace(ret, std::move(bagContent));
 
         inducedEdges_.emplace(ret, std::move(inducedEdges));
@@ -157,6 +185,13 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(std::vector<htd::vertex_t> && b
     return ret;
 }
 
+void htd::TreeDecomposition::makeRoot(htd::vertex_t vertex)
+{
+    htd::Tree::makeRoot(vertex);
+
+    invalidateStatistics(false);
+}
+
 htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
@@ -165,6 +200,8 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex)
 
     inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
 
+    registerNewNode(0);
+
     return ret;
 }
 
@@ -176,6 +213,8 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, const std::
 
     inducedEdges_[ret] = inducedEdges;
 
+    registerNewNode(bagContent.size());
+
     return ret;
 }
 
@@ -183,6 +222,8 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, std::vector
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
+    registerNewNode(bagContent.size());
+
     bagContent_.emplace(ret, std::move(bagContent));
 
     inducedEdges_.emplace(ret, std::move(inducedEdges));
@@ -198,6 +239,8 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex)
 
     inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
 
+    registerNewNode(0);
+
     return ret;
 }
 
@@ -209,6 +252,8 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, const std:
 
     inducedEdges_[ret] = inducedEdges;
 
+    registerNewNode(bagContent.size());
+
     return ret;
 }
 
@@ -216,6 +261,8 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, std::vecto
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
+    registerNewNode(bagContent.size());
+
     bagContent_.emplace(ret, std::move(bagContent));
 
     inducedEdges_.emplace(ret, std::move(inducedEdges));
@@ -230,21 +277,29 @@ void htd::TreeDecomposition::removeChild(htd::vertex_t vertex, htd::vertex_t chi
     bagContent_.erase(child);
 
     inducedEdges_.erase(child);
+
+    invalidateStatistics(true);
 }
 
-std::size_t htd::TreeDecomposition::joinNodeCount(void) const
+void htd::TreeDecomposition::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
 {
-    std::size_t ret = 0;
+    htd::Tree::setParent(vertex, newParent);
 
-    for (htd::vertex_t node : vertexVector())
-    {
-        if (childCount(node) > 1)
-        {
-            ret++;
-        }
-    }
+    invalidateStatistics(false);
+}
 
-    return ret;
+void htd::TreeDecomposition::swapWithParent(htd::vertex_t vertex)
+{
+    htd::Tree::swapWithParent(vertex);
+
+    invalidateStatistics(false);
+}
+
+std::size_t htd::TreeDecomposition::joinNodeCount(void) const
+{
+    updateNodeTypeStatistics();
+
+    return joinNodes_.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::joinNodes(void) const
@@ -258,26 +313,18 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::joinNodes(void) cons
 
 void htd::TreeDecomposition::copyJoinNodesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (htd::vertex_t node : vertexVector())
-    {
-        if (childCount(node) > 1)
-        {
-            target.push_back(node);
-        }
-    }
+    updateNodeTypeStatistics();
+
+    target.insert(target.end(), joinNodes_.begin(), joinNodes_.end());
 }
 
 htd::vertex_t htd::TreeDecomposition::joinNodeAtPosition(htd::index_t index) const
 {
-    const htd::ConstCollection<htd::vertex_t> & joinNodeCollection = joinNodes();
+    updateNodeTypeStatistics();
 
-    HTD_ASSERT(index < joinNodeCollection.size())
+    HTD_ASSERT(index < joinNodes_.size())
 
-    htd::ConstIterator<htd::vertex_t> it = joinNodeCollection.begin();
-
-    std::advance(it, index);
-
-    return *it;
+    return joinNodes_[index];
 }
 
 bool htd::TreeDecomposition::isJoinNode(htd::vertex_t vertex) const
@@ -289,23 +336,9 @@ bool htd::TreeDecomposition::isJoinNode(htd::vertex_t vertex) const
 
 std::size_t htd::TreeDecomposition::forgetNodeCount(void) const
 {
-    std::size_t ret = 0;
-
-    for (htd::vertex_t node : vertexVector())
-    {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+    updateNodeTypeStatistics();
 
-        std::vector<htd::vertex_t> childBagContent;
-
-        getChildBagSetUnion(node, childBagContent);
-
-        if (htd::has_non_empty_set_difference(childBagContent.begin(), childBagContent.end(), bag.begin(), bag.end()))
-        {
-            ret++;
-        }
-    }
-
-    return ret;
+    return forgetNodes_.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::forgetNodes(void) const
@@ -319,32 +352,18 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::forgetNodes(void) co
 
 void htd::TreeDecomposition::copyForgetNodesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (htd::vertex_t node : vertexVector())
-    {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
-
-        std::vector<htd::vertex_t> childBagContent;
+    updateNodeTypeStatistics();
 
-        getChildBagSetUnion(node, childBagContent);
-
-        if (htd::has_non_empty_set_difference(childBagContent.begin(), childBagContent.end(), bag.begin(), bag.end()))
-        {
-            target.push_back(node);
-        }
-    }
+    target.insert(target.end(), forgetNodes_.begin(), forgetNodes_.end());
 }
 
 htd::vertex_t htd::TreeDecomposition::forgetNodeAtPosition(htd::index_t index) const
 {
-    const htd::ConstCollection<htd::vertex_t> & forgetNodeCollection = forgetNodes();
-
-    HTD_ASSERT(index < forgetNodeCollection.size())
-
-    htd::ConstIterator<htd::vertex_t> it = forgetNodeCollection.begin();
+    updateNodeTypeStatistics();
 
-    std::advance(it, index);
+    HTD_ASSERT(index < forgetNodes_.size())
 
-    return *it;
+    return forgetNodes_[index];
 }
 
 bool htd::TreeDecomposition::isForgetNode(htd::vertex_t vertex) const
@@ -362,23 +381,9 @@ bool htd::TreeDecomposition::isForgetNode(htd::vertex_t vertex) const
 
 std::size_t htd::TreeDecomposition::introduceNodeCount(void) const
 {
-    std::size_t ret = 0;
-
-    for (htd::vertex_t node : vertexVector())
-    {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
-
-        std::vector<htd::vertex_t> childBagContent;
-
-        getChildBagSetUnion(node, childBagContent);
-
-        if (htd::has_non_empty_set_difference(bag.begin(), bag.end(), childBagContent.begin(), childBagContent.end()))
-        {
-            ret++;
-        }
-    }
+    updateNodeTypeStatistics();
 
-    return ret;
+    return introduceNodes_.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::introduceNodes(void) const
@@ -392,32 +397,18 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::introduceNodes(void)
 
 void htd::TreeDecomposition::copyIntroduceNodesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (htd::vertex_t node : vertexVector())
-    {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+    updateNodeTypeStatistics();
 
-        std::vector<htd::vertex_t> childBagContent;
-
-        getChildBagSetUnion(node, childBagContent);
-
-        if (htd::has_non_empty_set_difference(bag.begin(), bag.end(), childBagContent.begin(), childBagContent.end()))
-        {
-            target.push_back(node);
-        }
-    }
+    target.insert(target.end(), introduceNodes_.begin(), introduceNodes_.end());
 }
 
 htd::vertex_t htd::TreeDecomposition::introduceNodeAtPosition(htd::index_t index) const
 {
-    const htd::ConstCollection<htd::vertex_t> & introduceNodeCollection = introduceNodes();
-
-    HTD_ASSERT(index < introduceNodeCollection.size())
+    updateNodeTypeStatistics();
 
-    htd::ConstIterator<htd::vertex_t> it = introduceNodeCollection.begin();
+    HTD_ASSERT(index < introduceNodes_.size())
 
-    std::advance(it, index);
-
-    return *it;
+    return introduceNodes_[index];
 }
 
 bool htd::TreeDecomposition::isIntroduceNode(htd::vertex_t vertex) const
@@ -435,25 +426,9 @@ bool htd::TreeDecomposition::isIntroduceNode(htd::vertex_t vertex) const
 
 std::size_t htd::TreeDecomposition::exchangeNodeCount(void) const
 {
-    std::size_t ret = 0;
+    updateNodeTypeStatistics();
 
-    for (htd::vertex_t node : vertexVector())
-    {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
-
-        std::vector<htd::vertex_t> childBagContent;
-
-        getChildBagSetUnion(node, childBagContent);
-
-        std::pair<std::size_t, std::size_t> symmetricDifference = htd::symmetric_difference_sizes(bag, childBagContent);
-
-        if (symmetricDifference.first > 0 && symmetricDifference.second > 0)
-        {
-            ret++;
-        }
-    }
-
-    return ret;
+    return exchangeNodes_.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::exchangeNodes(void) const
@@ -467,34 +442,18 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::exchangeNodes(void)
 
 void htd::TreeDecomposition::copyExchangeNodesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (htd::vertex_t node : vertexVector())
-    {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
-
-        std::vector<htd::vertex_t> childBagContent;
+    updateNodeTypeStatistics();
 
-        getChildBagSetUnion(node, childBagContent);
-
-        std::pair<std::size_t, std::size_t> symmetricDifference = htd::symmetric_difference_sizes(bag, childBagContent);
-
-        if (symmetricDifference.first > 0 && symmetricDifference.second > 0)
-        {
-            target.push_back(node);
-        }
-    }
+    target.insert(target.end(), exchangeNodes_.begin(), exchangeNodes_.end());
 }
 
 htd::vertex_t htd::TreeDecomposition::exchangeNodeAtPosition(htd::index_t index) const
 {
-    const htd::ConstCollection<htd::vertex_t> & exchangeNodeCollection = exchangeNodes();
-
-    HTD_ASSERT(index < exchangeNodeCollection.size())
+    updateNodeTypeStatistics();
 
-    htd::ConstIterator<htd::vertex_t> it = exchangeNodeCollection.begin();
+    HTD_ASSERT(index < exchangeNodes_.size())
 
-    std::advance(it, index);
-
-    return *it;
+    return exchangeNodes_[index];
 }
 
 bool htd::TreeDecomposition::isExchangeNode(htd::vertex_t vertex) const
@@ -523,6 +482,8 @@ std::vector<htd::vertex_t> & htd::TreeDecomposition::mutableBagContent(htd::vert
 {
     HTD_ASSERT(isVertex(vertex))
 
+    suspendStatistics();
+
     return bagContent_.at(vertex);
 }
 
@@ -549,40 +510,16 @@ const htd::FilteredHyperedgeCollection & htd::TreeDecomposition::inducedHyperedg
 
 std::size_t htd::TreeDecomposition::minimumBagSize(void) const
 {
-    bool start = true;
-
-    std::size_t ret = 0;
-
-    for (htd::vertex_t vertex : vertexVector())
-    {
-        std::size_t currentBagSize = bagSize(vertex);
-
-        if (start || currentBagSize < ret)
-        {
-            ret = currentBagSize;
-
-            start = false;
-        }
-    }
+    updateBagSizeStatistics();
 
-    return ret;
+    return minimumBagSize_;
 }
 
 std::size_t htd::TreeDecomposition::maximumBagSize(void) const
 {
-    std::size_t ret = 0;
-
-    for (htd::vertex_t vertex : vertexVector())
-    {
-        std::size_t currentBagSize = bagSize(vertex);
-
-        if (currentBagSize > ret)
-        {
-            ret = currentBagSize;
-        }
-    }
+    updateBagSizeStatistics();
 
-    return ret;
+    return maximumBagSize_;
 }
 
 std::size_t htd::TreeDecomposition::forgottenVertexCount(htd::vertex_t vertex) const
@@ -999,6 +936,133 @@ void htd::TreeDecomposition::getChildBagSetUnion(htd::vertex_t vertex, std::vect
     }
 }
 
+void htd::TreeDecomposition::updateBagSizeStatistics(void) const
+{
+    if (!bagSizeStatisticsValid_)
+    {
+        std::lock_guard<std::mutex> lock(statisticsMutex_);
+
+        if (!bagSizeStatisticsValid_)
+        {
+            bool start = true;
+
+            std::size_t minimumBagSize = 0;
+            std::size_t maximumBagSize = 0;
+
+            for (htd::vertex_t vertex : vertexVector())
+            {
+                std::size_t currentBagSize = bagSize(vertex);
+
+                if (start || currentBagSize < minimumBagSize)
+                {
+                    minimumBagSize = currentBagSize;
+
+                    start = false;
+                }
+
+                if (currentBagSize > maximumBagSize)
+                {
+                    maximumBagSize = currentBagSize;
+                }
+            }
+
+            minimumBagSize_ = minimumBagSize;
+            maximumBagSize_ = maximumBagSize;
+
+            bagSizeStatisticsValid_ = !statisticsCachingSuspended_;
+        }
+    }
+}
+
+void htd::TreeDecomposition::updateNodeTypeStatistics(void) const
+{
+    if (!nodeTypeStatisticsValid_)
+    {
+        std::lock_guard<std::mutex> lock(statisticsMutex_);
+
+        if (!nodeTypeStatisticsValid_)
+        {
+            joinNodes_.clear();
+            forgetNodes_.clear();
+            introduceNodes_.clear();
+            exchangeNodes_.clear();
+
+            std::vector<htd::vertex_t> childBagContent;
+
+            for (htd::vertex_t node : vertexVector())
+            {
+                if (childCount(node) > 1)
+                {
+                    joinNodes_.push_back(node);
+                }
+
+                childBagContent.clear();
+
+                getChildBagSetUnion(node, childBagContent);
+
+                std::pair<std::size_t, std::size_t> symmetricDifference = htd::symmetric_difference_sizes(bagContent(node), childBagContent);
+
+                if (symmetricDifference.first > 0)
+                {
+                    introduceNodes_.push_back(node);
+                }
+
+                if (symmetricDifference.second > 0)
+                {
+                    forgetNodes_.push_back(node);
+                }
+
+                if (symmetricDifference.first > 0 && symmetricDifference.second > 0)
+                {
+                    exchangeNodes_.push_back(node);
+                }
+            }
+
+            nodeTypeStatisticsValid_ = !statisticsCachingSuspended_;
+        }
+    }
+}
+
+void htd::TreeDecomposition::registerNewNode(std::size_t bagSize)
+{
+    statisticsCachingSuspended_ = false;
+
+    if (bagSizeStatisticsValid_)
+    {
+        if (vertexCount() == 1)
+        {
+            minimumBagSize_ = bagSize;
+            maximumBagSize_ = bagSize;
+        }
+        else
+        {
+            minimumBagSize_ = std::min(minimumBagSize_, bagSize);
+            maximumBagSize_ = std::max(maximumBagSize_, bagSize);
+        }
+    }
+
+    nodeTypeStatisticsValid_ = false;
+}
+
+void htd::TreeDecomposition::invalidateStatistics(bool bagSizes)
+{
+    statisticsCachingSuspended_ = false;
+
+    if (bagSizes)
+    {
+        bagSizeStatisticsValid_ = false;
+    }
+
+    nodeTypeStatisticsValid_ = false;
+}
+
+void htd::TreeDecomposition::suspendStatistics(void)
+{
+    invalidateStatistics(true);
+
+    statisticsCachingSuspended_ = true;
+}
+
 htd::TreeDecomposition * htd::TreeDecomposition::clone(void) const
 {
     return new htd::TreeDecomposition(*this);
@@ -1087,12 +1151,18 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::TreeDecomp
     {
         htd::LabeledTree::operator=(original);
 
+        bagContent_.clear();
+
+        inducedEdges_.clear();
+
         for (htd::vertex_t vertex : original.vertexVector())
         {
             bagContent_[vertex] = original.bagContent(vertex);
 
             inducedEdges_[vertex] = original.inducedHyperedges(vertex);
         }
+
+        invalidateStatistics(true);
     }
 
     return *this;
@@ -1104,12 +1174,18 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITree & or
     {
         htd::LabeledTree::operator=(original);
 
+        bagContent_.clear();
+
+        inducedEdges_.clear();
+
         for (htd::vertex_t vertex : original.vertices())
         {
             bagContent_[vertex] = std::vector<htd::vertex_t>();
 
             inducedEdges_[vertex] = htd::FilteredHyperedgeCollection();
         }
+
+        invalidateStatistics(true);
     }
 
     return *this;
@@ -1121,12 +1197,18 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ILabeledTr
     {
         htd::LabeledTree::operator=(original);
 
+        bagContent_.clear();
+
+        inducedEdges_.clear();
+
         for (htd::vertex_t vertex : original.vertices())
         {
             bagContent_[vertex] = std::vector<htd::vertex_t>();
 
             inducedEdges_[vertex] = htd::FilteredHyperedgeCollection();
         }
+
+        invalidateStatistics(true);
     }
 
     return *this;
@@ -1138,12 +1220,18 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITreeDecom
     {
         htd::LabeledTree::operator=(original);
 
+        bagContent_.clear();
+
+        inducedEdges_.clear();
+
         for (htd::vertex_t vertex : original.vertices())
         {
             bagContent_[vertex] = original.bagContent(vertex);
 
             inducedEdges_[vertex] = original.inducedHyperedges(vertex);
         }
+
+        invalidateStatistics(true);
     }
 
     return *this;
@@ -512,6 +512,15 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::intelligentOpt
 
     std::vector<htd::ITreeDecompositionManipulationOperation *> clonedManipulationOperations;
 
+    std::vector<htd::vertex_t> createdVertices;
+    std::vector<htd::vertex_t> removedVertices;
+
+    /* The operations are applied to all nodes via their local variant because only this variant guarantees that the
+       identifiers of the existing nodes are retained, which the remainder of the optimization relies on. */
+    const htd::ConstCollection<htd::vertex_t> & vertexCollection = decomposition.vertices();
+
+    std::vector<htd::vertex_t> relevantVertices(vertexCollection.begin(), vertexCollection.end());
+
     for (const htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations_)
     {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
@@ -524,7 +533,17 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::intelligentOpt
 
         clonedManipulationOperations.push_back(clone);
 
-        clone->apply(graph, decomposition, labelingFunctions);
+        std::size_t oldCreatedVerticesCount = createdVertices.size();
+        std::size_t oldRemovedVerticesCount = removedVertices.size();
+
+        clone->apply(graph, decomposition, relevantVertices, labelingFunctions, createdVertices, removedVertices);
+
+        relevantVertices.insert(relevantVertices.end(), createdVertices.begin() + oldCreatedVerticesCount, createdVertices.end());
+
+        if (removedVertices.size() > oldRemovedVerticesCount)
+        {
+            relevantVertices.erase(std::remove_if(relevantVertices.begin(), relevantVertices.end(), [&](htd::vertex_t vertex) { return !decomposition.isVertex(vertex); }), relevantVertices.end());
+        }
     }
 
     htd::vertex_t optimalRoot = initialRoot;
@@ -533,9 +552,6 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::intelligentOpt
 
     HTD_ASSERT(optimalFitness != nullptr)
 
-    std::vector<htd::vertex_t> createdVertices;
-    std::vector<htd::vertex_t> removedVertices;
-
     for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
     {
         htd::vertex_t vertex = *it;
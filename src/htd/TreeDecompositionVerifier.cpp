@@ -28,15 +28,15 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/TreeDecompositionVerifier.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/VectorAdapter.hpp>
 
-#include <map>
 #include <algorithm>
-#include <unordered_set>
-#include <unordered_map>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <vector>
 
-htd::TreeDecompositionVerifier::TreeDecompositionVerifier(void)
+htd::TreeDecompositionVerifier::TreeDecompositionVerifier(void) : threadCount_(1)
 {
     
 }
@@ -69,31 +69,70 @@ bool htd::TreeDecompositionVerifier::verifyConnectednessCriterion(const htd::IMu
     return violationsConnectednessCriterion(graph, decomposition).empty();
 }
 
+std::size_t htd::TreeDecompositionVerifier::threadCount(void) const
+{
+    return threadCount_;
+}
+
+void htd::TreeDecompositionVerifier::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    threadCount_ = threadCount;
+}
+
 htd::ConstCollection<htd::vertex_t> htd::TreeDecompositionVerifier::violationsVertexExistence(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const
 {
     htd::VectorAdapter<htd::vertex_t> ret;
 
     auto & result = ret.container();
 
-    bool ok = false;
+    const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
 
-    std::unordered_set<htd::vertex_t> missingVertices(graph.vertices().begin(), graph.vertices().end());
-    
-    for (auto it1 = decomposition.vertices().begin(); !ok && it1 != decomposition.vertices().end(); it1++)
+    htd::vertex_t maximumVertex = htd::Vertex::UNKNOWN;
+
+    for (htd::vertex_t vertex : vertexCollection)
     {
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(*it1);
+        maximumVertex = std::max(maximumVertex, vertex);
+    }
+
+    /* Only the vertices of the graph are marked as missing, all other positions are never set. */
+    std::vector<bool> missingVertices(maximumVertex + 1, false);
 
-        for (auto it2 = bag.begin(); !ok && it2 != bag.end(); it2++)
+    for (htd::vertex_t vertex : vertexCollection)
+    {
+        missingVertices[vertex] = true;
+    }
+
+    std::size_t missingVertexCount = graph.vertexCount();
+
+    const htd::ConstCollection<htd::vertex_t> & nodeCollection = decomposition.vertices();
+
+    for (auto it = nodeCollection.begin(); missingVertexCount > 0 && it != nodeCollection.end(); ++it)
+    {
+        for (htd::vertex_t vertex : decomposition.bagContent(*it))
         {
-            missingVertices.erase(*it2);
-            
-            ok = missingVertices.empty();
+            if (vertex <= maximumVertex && missingVertices[vertex])
+            {
+                missingVertices[vertex] = false;
+
+                --missingVertexCount;
+            }
         }
     }
 
-    std::copy(missingVertices.begin(), missingVertices.end(), std::back_inserter(result));
+    if (missingVertexCount > 0)
+    {
+        for (htd::vertex_t vertex : vertexCollection)
+        {
+            if (missingVertices[vertex])
+            {
+                result.push_back(vertex);
+            }
+        }
 
-    std::sort(result.begin(), result.end());
+        std::sort(result.begin(), result.end());
+    }
 
     return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
 }
@@ -104,132 +143,196 @@ htd::ConstCollection<htd::Hyperedge> htd::TreeDecompositionVerifier::violationsH
 
     auto & result = ret.container();
 
-    bool ok = false;
+    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
 
-    std::size_t edgeCount = graph.edgeCount();
+    std::vector<htd::Hyperedge> allHyperedges(hyperedges.begin(), hyperedges.end());
 
-    std::unordered_set<htd::id_t> missingEdges(edgeCount);
+    htd::vertex_t maximumVertex = htd::Vertex::UNKNOWN;
 
-    std::vector<htd::id_t> identifiers(edgeCount);
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        maximumVertex = std::max(maximumVertex, vertex);
+    }
 
-    std::vector<std::vector<htd::vertex_t>> sortedEdges(edgeCount);
+    std::vector<const std::vector<htd::vertex_t> *> bags;
 
-    htd::index_t index = 0;
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        bags.push_back(&(decomposition.bagContent(node)));
+    }
 
-    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
+    /* The occurrences of each vertex, i.e., the indices of the bags containing it, are stored consecutively. */
+    std::vector<std::size_t> occurrenceOffsets(maximumVertex + 2, 0);
 
-    for (const htd::Hyperedge & hyperedge : hyperedges)
+    for (const std::vector<htd::vertex_t> * bag : bags)
     {
-        std::vector<htd::vertex_t> & elements = sortedEdges[index];
+        for (htd::vertex_t vertex : *bag)
+        {
+            if (vertex <= maximumVertex)
+            {
+                ++occurrenceOffsets[vertex + 1];
+            }
+        }
+    }
 
-        std::copy(hyperedge.sortedElements().begin(), hyperedge.sortedElements().end(), std::back_inserter(elements));
+    for (std::size_t index = 1; index < occurrenceOffsets.size(); ++index)
+    {
+        occurrenceOffsets[index] += occurrenceOffsets[index - 1];
+    }
 
-        identifiers[index] = hyperedge.id();
+    std::vector<htd::index_t> occurrences(occurrenceOffsets.back());
 
-        missingEdges.insert(hyperedge.id());
+    std::vector<std::size_t> insertionPositions(occurrenceOffsets.begin(), occurrenceOffsets.end() - 1);
 
-        index++;
+    for (htd::index_t index = 0; index < bags.size(); ++index)
+    {
+        for (htd::vertex_t vertex : *(bags[index]))
+        {
+            if (vertex <= maximumVertex)
+            {
+                occurrences[insertionPositions[vertex]++] = index;
+            }
+        }
     }
 
-    htd::PostOrderTreeTraversal treeTraversal;
+    std::vector<char> missingHyperedges(allHyperedges.size(), 0);
 
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
-    {
-        HTD_UNUSED(parent)
-        HTD_UNUSED(distanceToSubtreeRoot)
+    /* Each hyperedge only needs to be compared with the bags containing its least frequent vertex. */
+    const std::size_t chunkSize = 1024;
 
-        if (!ok)
-        {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+    std::atomic<std::size_t> nextChunk(0);
 
-            index = 0;
+    auto checkHyperedges = [&]()
+    {
+        for (std::size_t begin = chunkSize * nextChunk++; begin < allHyperedges.size(); begin = chunkSize * nextChunk++)
+        {
+            std::size_t end = std::min(begin + chunkSize, allHyperedges.size());
 
-            while (!ok && index < edgeCount)
+            for (std::size_t index = begin; index < end; ++index)
             {
-                htd::id_t id = identifiers[index];
+                const std::vector<htd::vertex_t> & elements = allHyperedges[index].sortedElements();
 
-                const std::vector<htd::vertex_t> & edge = sortedEdges[index];
+                bool covered = false;
 
-                if (missingEdges.count(id) > 0 && std::includes(bag.begin(), bag.end(), edge.begin(), edge.end()))
+                if (elements.empty())
                 {
-                    missingEdges.erase(id);
+                    covered = !bags.empty();
+                }
+                else if (elements.back() <= maximumVertex)
+                {
+                    htd::vertex_t rarestVertex = elements[0];
+
+                    for (htd::vertex_t vertex : elements)
+                    {
+                        if (occurrenceOffsets[vertex + 1] - occurrenceOffsets[vertex] < occurrenceOffsets[rarestVertex + 1] - occurrenceOffsets[rarestVertex])
+                        {
+                            rarestVertex = vertex;
+                        }
+                    }
+
+                    for (std::size_t position = occurrenceOffsets[rarestVertex]; !covered && position < occurrenceOffsets[rarestVertex + 1]; ++position)
+                    {
+                        const std::vector<htd::vertex_t> & bag = *(bags[occurrences[position]]);
+
+                        covered = std::includes(bag.begin(), bag.end(), elements.begin(), elements.end());
+                    }
                 }
 
-                ok = missingEdges.empty();
-
-                ++index;
+                missingHyperedges[index] = covered ? 0 : 1;
             }
         }
-    });
+    };
+
+    std::size_t threadCount = std::max(std::min(threadCount_, (allHyperedges.size() + chunkSize - 1) / chunkSize), (std::size_t)1);
 
-    if (!ok)
+    if (threadCount == 1)
     {
-        index = 0;
+        checkHyperedges();
+    }
+    else
+    {
+        std::vector<std::thread> threads;
 
-        for (const htd::Hyperedge & hyperedge : hyperedges)
+        for (htd::index_t index = 0; index < threadCount; ++index)
         {
-            if (missingEdges.count(static_cast<htd::id_t>(index)) > 0)
-            {
-                result.push_back(hyperedge);
-            }
+            threads.emplace_back(checkHyperedges);
+        }
 
-            ++index;
+        for (std::thread & thread : threads)
+        {
+            thread.join();
         }
+    }
 
-        std::sort(result.begin(), result.end());
+    for (htd::index_t index = 0; index < allHyperedges.size(); ++index)
+    {
+        if (missingHyperedges[index] != 0)
+        {
+            result.push_back(allHyperedges[index]);
+        }
     }
 
+    std::sort(result.begin(), result.end());
+
     return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
 }
 
 htd::ConstCollection<htd::vertex_t> htd::TreeDecompositionVerifier::violationsConnectednessCriterion(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const
 {
+    HTD_UNUSED(graph)
+
     htd::VectorAdapter<htd::vertex_t> ret;
 
     auto & result = ret.container();
 
-    std::unordered_set<htd::vertex_t> forgottenVertices(graph.vertexCount());
+    const htd::ConstCollection<htd::vertex_t> & nodeCollection = decomposition.vertices();
 
-    htd::PostOrderTreeTraversal treeTraversal;
+    htd::vertex_t maximumVertex = htd::Vertex::UNKNOWN;
 
-    std::vector<htd::vertex_t> forgottenBagContent;
-
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    for (htd::vertex_t node : nodeCollection)
     {
-        HTD_UNUSED(distanceToSubtreeRoot)
-
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
 
-        if (parent != htd::Vertex::UNKNOWN)
+        if (!bag.empty())
         {
-            decomposition.copyForgottenVerticesTo(parent, forgottenBagContent, vertex);
+            maximumVertex = std::max(maximumVertex, bag.back());
+        }
+    }
 
-            for (htd::vertex_t bagElement : bag)
-            {
-                if (forgottenVertices.count(bagElement) > 0)
-                {
-                    result.push_back(bagElement);
-                }
-            }
+    /* The nodes containing a vertex are connected if and only if exactly one of them is the root or has a parent whose bag does not contain the vertex. */
+    std::vector<bool> topmostOccurrenceFound(maximumVertex + 1, false);
 
-            for (htd::vertex_t forgottenVertex : forgottenBagContent)
-            {
-                forgottenVertices.insert(forgottenVertex);
-            }
+    std::vector<htd::vertex_t> topmostVertices;
+
+    for (htd::vertex_t node : nodeCollection)
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
 
-            forgottenBagContent.clear();
+        topmostVertices.clear();
+
+        if (decomposition.isRoot(node))
+        {
+            topmostVertices.assign(bag.begin(), bag.end());
         }
         else
         {
-            for (htd::vertex_t bagElement : bag)
+            const std::vector<htd::vertex_t> & parentBag = decomposition.bagContent(decomposition.parent(node));
+
+            std::set_difference(bag.begin(), bag.end(), parentBag.begin(), parentBag.end(), std::back_inserter(topmostVertices));
+        }
+
+        for (htd::vertex_t vertex : topmostVertices)
+        {
+            if (topmostOccurrenceFound[vertex])
             {
-                if (forgottenVertices.count(bagElement) > 0)
-                {
-                    result.push_back(bagElement);
-                }
+                result.push_back(vertex);
+            }
+            else
+            {
+                topmostOccurrenceFound[vertex] = true;
             }
         }
-    });
+    }
 
     std::sort(result.begin(), result.end());
 
@@ -342,6 +342,15 @@ void htd::TrivialTreeDecompositionAlgorithm::addManipulationOperations(const std
     }
 }
 
+std::vector<htd::ILabelingFunction *> htd::TrivialTreeDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    ret.swap(implementation_->labelingFunctions_);
+
+    return ret;
+}
+
 bool htd::TrivialTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return false;
@@ -30,6 +30,7 @@
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/IterationPlanner.hpp>
 
 #include <cstdarg>
 #include <algorithm>
@@ -279,7 +280,9 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
 
     htd::index_t iteration = 0;
 
-    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && !managementInstance.isTerminated())
+    htd::IterationPlanner planner(implementation_->managementInstance_);
+
+    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && !managementInstance.isTerminated() && (iteration == 0 || planner.allowsIteration()))
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -299,8 +302,12 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
             remainingIterations = std::min(remainingIterations, implementation_->nonImprovementLimit_);
         }
 
+        remainingIterations = std::min(remainingIterations, std::max(planner.plannedIterationCount(remainingIterations), (std::size_t)1));
+
         std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult = implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, bestMaxBagSize - 1, remainingIterations);
 
+        planner.recordIterations(decompositionResult.second);
+
         htd::ITreeDecomposition * currentDecomposition = decompositionResult.first;
 
         if (decompositionResult.second < implementation_->nonImprovementLimit_)
@@ -409,6 +416,11 @@ void htd::WidthMinimizingTreeDecompositionAlgorithm::addManipulationOperations(c
     implementation_->algorithm_->addManipulationOperations(manipulationOperations);
 }
 
+std::vector<htd::ILabelingFunction *> htd::WidthMinimizingTreeDecompositionAlgorithm::releaseLabelingFunctions(void)
+{
+    return implementation_->algorithm_->releaseLabelingFunctions();
+}
+
 bool htd::WidthMinimizingTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
     return true;
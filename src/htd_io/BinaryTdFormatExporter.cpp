@@ -0,0 +1,181 @@
+/*
+ * File:   BinaryTdFormatExporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTDFORMATEXPORTER_CPP
+#define HTD_IO_BINARYTDFORMATEXPORTER_CPP
+
+#include <htd_io/BinaryTdFormatExporter.hpp>
+
+#include <htd_io/OutputBuffer.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Write a tree decomposition in the format 'btd' to a given stream.
+     *
+     *  @param[in] decomposition    The tree decomposition which shall be exported.
+     *  @param[in] vertexCount      The number of vertices of the graph from which the given decomposition was constructed.
+     *  @param[out] outputStream    The output stream to which the information shall be written.
+     */
+    void writeBinaryTdFormat(const htd::ITreeDecomposition & decomposition, std::size_t vertexCount, std::ostream & outputStream)
+    {
+        std::size_t nodeCount = decomposition.vertexCount();
+
+        std::size_t edgeCount = decomposition.edgeCount();
+
+        std::vector<htd::vertex_t> nodes;
+
+        nodes.reserve(nodeCount);
+
+        /* Dense mapping from node identifiers to the consecutive indices used in the output. */
+        std::vector<std::size_t> indices;
+
+        /* The offset table has to precede the bags, so the encoded size of each bag is determined in a first pass. */
+        std::vector<std::uint64_t> offsets;
+
+        offsets.reserve(nodeCount + 1);
+
+        offsets.push_back(0);
+
+        std::vector<htd::vertex_t> sortedBag;
+
+        for (htd::vertex_t node : decomposition.vertices())
+        {
+            if (node >= indices.size())
+            {
+                indices.resize(node + 1 > indices.size() * 2 ? node + 1 : indices.size() * 2, 0);
+            }
+
+            nodes.push_back(node);
+
+            indices[node] = nodes.size();
+
+            const std::vector<htd::vertex_t> * bag = &(decomposition.bagContent(node));
+
+            if (!std::is_sorted(bag->begin(), bag->end()))
+            {
+                sortedBag.assign(bag->begin(), bag->end());
+
+                std::sort(sortedBag.begin(), sortedBag.end());
+
+                bag = &sortedBag;
+            }
+
+            std::uint64_t size = htd_io::OutputBuffer::varintSize(bag->size());
+
+            htd::vertex_t previous = 0;
+
+            for (htd::vertex_t vertex : *bag)
+            {
+                size += htd_io::OutputBuffer::varintSize(vertex - previous);
+
+                previous = vertex;
+            }
+
+            offsets.push_back(offsets.back() + size);
+        }
+
+        htd_io::OutputBuffer buffer(outputStream);
+
+        buffer.append("HTDBTD\0\1", 8);
+
+        buffer.appendFixed64(nodeCount);
+        buffer.appendFixed64(decomposition.maximumBagSize());
+        buffer.appendFixed64(vertexCount);
+        buffer.appendFixed64(edgeCount);
+
+        for (std::uint64_t offset : offsets)
+        {
+            buffer.appendFixed64(offset);
+        }
+
+        for (htd::vertex_t node : nodes)
+        {
+            const std::vector<htd::vertex_t> * bag = &(decomposition.bagContent(node));
+
+            if (!std::is_sorted(bag->begin(), bag->end()))
+            {
+                sortedBag.assign(bag->begin(), bag->end());
+
+                std::sort(sortedBag.begin(), sortedBag.end());
+
+                bag = &sortedBag;
+            }
+
+            buffer.appendVarint(bag->size());
+
+            htd::vertex_t previous = 0;
+
+            for (htd::vertex_t vertex : *bag)
+            {
+                buffer.appendVarint(vertex - previous);
+
+                previous = vertex;
+            }
+        }
+
+        if (edgeCount > 0)
+        {
+            const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
+
+            auto it = hyperedgeCollection.begin();
+
+            for (htd::index_t index = 0; index < edgeCount; ++index)
+            {
+                const htd::Hyperedge & edge = *it;
+
+                buffer.appendVarint(indices[edge[0]]);
+                buffer.appendVarint(indices[edge[1]]);
+
+                ++it;
+            }
+        }
+    }
+}
+
+htd_io::BinaryTdFormatExporter::BinaryTdFormatExporter(void)
+{
+
+}
+
+htd_io::BinaryTdFormatExporter::~BinaryTdFormatExporter()
+{
+
+}
+
+void htd_io::BinaryTdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    writeBinaryTdFormat(decomposition, graph.vertexCount(), outputStream);
+}
+
+void htd_io::BinaryTdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    writeBinaryTdFormat(decomposition, graph.vertexCount(), outputStream);
+}
+
+#endif /* HTD_IO_BINARYTDFORMATEXPORTER_CPP */
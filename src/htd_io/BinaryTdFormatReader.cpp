@@ -0,0 +1,236 @@
+/*
+ * File:   BinaryTdFormatReader.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTDFORMATREADER_CPP
+#define HTD_IO_BINARYTDFORMATREADER_CPP
+
+#include <htd_io/BinaryTdFormatReader.hpp>
+
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    /**
+     *  The size of the header of the format 'btd' in bytes.
+     */
+    const std::size_t headerSize = 40;
+
+    /**
+     *  Decode a varint and move the given position past it.
+     *
+     *  @param[in,out] position The position of the varint. The position is only modified if the decoding succeeds.
+     *  @param[in] end          The position one past the last byte of the available data.
+     *  @param[out] value       The decoded value.
+     *
+     *  @return True if the decoding succeeded, false otherwise.
+     */
+    bool readVarint(const unsigned char * & position, const unsigned char * end, std::uint64_t & value)
+    {
+        std::uint64_t result = 0;
+
+        const unsigned char * current = position;
+
+        for (unsigned int shift = 0; current != end && shift < 64; shift += 7)
+        {
+            unsigned char byte = *current;
+
+            ++current;
+
+            result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                value = result;
+
+                position = current;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+htd_io::BinaryTdFormatReader::BinaryTdFormatReader(const char * begin, const char * end) : data_(reinterpret_cast<const unsigned char *>(begin)), size_(static_cast<std::size_t>(end - begin)), good_(false), nodeCount_(0), maximumBagSize_(0), vertexCount_(0), edgeCount_(0), bagSectionOffset_(0)
+{
+    if (size_ >= headerSize && std::memcmp(begin, "HTDBTD\0\1", 8) == 0)
+    {
+        std::uint64_t nodeCount = readFixed64(8);
+
+        if (nodeCount < (size_ - headerSize) / 8)
+        {
+            std::size_t bagSectionOffset = headerSize + 8 * (static_cast<std::size_t>(nodeCount) + 1);
+
+            bool ok = readFixed64(headerSize) == 0;
+
+            for (std::size_t index = 1; ok && index <= nodeCount; ++index)
+            {
+                ok = readFixed64(headerSize + 8 * index) >= readFixed64(headerSize + 8 * (index - 1));
+            }
+
+            if (ok && readFixed64(bagSectionOffset - 8) <= size_ - bagSectionOffset)
+            {
+                good_ = true;
+
+                nodeCount_ = static_cast<std::size_t>(nodeCount);
+                maximumBagSize_ = static_cast<std::size_t>(readFixed64(16));
+                vertexCount_ = static_cast<std::size_t>(readFixed64(24));
+                edgeCount_ = static_cast<std::size_t>(readFixed64(32));
+
+                bagSectionOffset_ = bagSectionOffset;
+            }
+        }
+    }
+}
+
+htd_io::BinaryTdFormatReader::~BinaryTdFormatReader()
+{
+
+}
+
+bool htd_io::BinaryTdFormatReader::good(void) const
+{
+    return good_;
+}
+
+std::size_t htd_io::BinaryTdFormatReader::nodeCount(void) const
+{
+    return nodeCount_;
+}
+
+std::size_t htd_io::BinaryTdFormatReader::maximumBagSize(void) const
+{
+    return maximumBagSize_;
+}
+
+std::size_t htd_io::BinaryTdFormatReader::vertexCount(void) const
+{
+    return vertexCount_;
+}
+
+std::size_t htd_io::BinaryTdFormatReader::edgeCount(void) const
+{
+    return edgeCount_;
+}
+
+bool htd_io::BinaryTdFormatReader::bagContent(std::size_t node, std::vector<htd::vertex_t> & target) const
+{
+    target.clear();
+
+    if (!good_ || node == 0 || node > nodeCount_)
+    {
+        return false;
+    }
+
+    const unsigned char * position = data_ + bagSectionOffset_ + readFixed64(headerSize + 8 * (node - 1));
+
+    const unsigned char * end = data_ + bagSectionOffset_ + readFixed64(headerSize + 8 * node);
+
+    std::uint64_t size = 0;
+
+    bool ret = readVarint(position, end, size) && size <= static_cast<std::size_t>(end - position);
+
+    if (ret)
+    {
+        target.reserve(static_cast<std::size_t>(size));
+
+        std::uint64_t vertex = 0;
+
+        for (std::uint64_t index = 0; ret && index < size; ++index)
+        {
+            std::uint64_t difference = 0;
+
+            ret = readVarint(position, end, difference) && difference <= std::numeric_limits<htd::vertex_t>::max() - vertex;
+
+            vertex += difference;
+
+            target.push_back(static_cast<htd::vertex_t>(vertex));
+        }
+
+        ret = ret && position == end;
+    }
+
+    if (!ret)
+    {
+        target.clear();
+    }
+
+    return ret;
+}
+
+bool htd_io::BinaryTdFormatReader::edges(std::vector<std::pair<std::size_t, std::size_t>> & target) const
+{
+    target.clear();
+
+    if (!good_)
+    {
+        return false;
+    }
+
+    const unsigned char * position = data_ + bagSectionOffset_ + readFixed64(bagSectionOffset_ - 8);
+
+    const unsigned char * end = data_ + size_;
+
+    bool ret = edgeCount_ <= static_cast<std::size_t>(end - position) / 2;
+
+    if (ret)
+    {
+        target.reserve(edgeCount_);
+    }
+
+    for (std::size_t index = 0; ret && index < edgeCount_; ++index)
+    {
+        std::uint64_t node1 = 0;
+        std::uint64_t node2 = 0;
+
+        ret = readVarint(position, end, node1) && readVarint(position, end, node2) &&
+              node1 >= 1 && node1 <= nodeCount_ && node2 >= 1 && node2 <= nodeCount_;
+
+        target.emplace_back(static_cast<std::size_t>(node1), static_cast<std::size_t>(node2));
+    }
+
+    if (!ret)
+    {
+        target.clear();
+    }
+
+    return ret;
+}
+
+std::uint64_t htd_io::BinaryTdFormatReader::readFixed64(std::size_t position) const
+{
+    std::uint64_t ret = 0;
+
+    for (std::size_t index = 8; index > 0; --index)
+    {
+        ret = (ret << 8) | data_[position + index - 1];
+    }
+
+    return ret;
+}
+
+#endif /* HTD_IO_BINARYTDFORMATREADER_CPP */
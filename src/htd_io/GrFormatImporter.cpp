@@ -26,12 +26,14 @@
 #define HTD_IO_GRFORMATIMPORTER_CPP
 
 #include <htd_io/GrFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 
 #include <htd/MultiGraphFactory.hpp>
 
-#include <fstream>
+#include <algorithm>
 #include <string>
-#include <stdexcept>
+#include <utility>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::GrFormatImporter.
@@ -57,6 +59,15 @@ struct htd_io::GrFormatImporter::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Create a new IMultiGraph instance based on the information stored in a given buffer.
+     *
+     *  @param[in] buffer   The buffer from which the information can be read.
+     *
+     *  @return A new IMultiGraph instance based on the information stored in the given buffer or nullptr in case of a parsing error.
+     */
+    htd::IMultiGraph * import(const htd_io::InputBuffer & buffer) const;
 };
 
 htd_io::GrFormatImporter::GrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -71,119 +82,88 @@ htd_io::GrFormatImporter::~GrFormatImporter(void)
 
 htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) const
 {
-    std::ifstream stream(path);
-
-    return import(stream);
+    return implementation_->import(htd_io::InputBuffer(path));
 }
 
 htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
+{
+    return implementation_->import(htd_io::InputBuffer(stream));
+}
+
+htd::IMultiGraph * htd_io::GrFormatImporter::Implementation::import(const htd_io::InputBuffer & buffer) const
 {
     std::size_t vertexCount = 0;
     std::size_t edgeCount = 0;
 
     bool firstLine = true;
 
-    bool error = false;
+    bool error = !buffer.good();
 
-    htd::IMutableMultiGraph * ret = implementation_->managementInstance_->multiGraphFactory().createInstance();
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
-
-    if (stream.good())
-    {
-        std::string line;
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
 
-        std::size_t pos = 0;
+    htd_io::InputCursor cursor(buffer.begin(), buffer.end());
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+    while (!error && !cursor.atEnd() && !managementInstance.isTerminated())
+    {
+        if (cursor.atLineEnd())
         {
-            if (line.empty())
-            {
-                error = true;
-            }
-            else
+            error = true;
+        }
+        else if (cursor.peek() != 'c')
+        {
+            if (firstLine)
             {
-                if (line[line.size() - 1] == '\r')
-                {
-                    line.pop_back();
-                }
+                error = !(cursor.consume("p tw ") &&
+                          cursor.parseUnsigned(vertexCount) &&
+                          cursor.consume(' ') &&
+                          cursor.parseUnsigned(edgeCount) &&
+                          cursor.atLineEnd());
 
-                if (line[0] != 'c')
+                if (!error)
                 {
-                    if (firstLine)
-                    {
-                        if (line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
-
-                        line = line.substr(5);
-
-                        vertexCount = std::stol(line, &pos);
-
-                        if (line[pos] != ' ')
-                        {
-                            error = true;
-                        }
-
-                        line = line.substr(pos + 1);
-
-                        edgeCount = std::stol(line, &pos);
-
-                        if (pos != line.length())
-                        {
-                            error = true;
-                        }
-
-                        ret->addVertices(vertexCount);
-
-                        firstLine = false;
-                    }
-                    else
-                    {
-                        htd::vertex_t vertex1 = std::stoul(line, &pos);
-
-                        if (line[pos] != ' ')
-                        {
-                            error = true;
-                        }
-                        else
-                        {
-                            line = line.substr(pos + 1);
-
-                            htd::vertex_t vertex2 = std::stoul(line, &pos);
+                    /* Each edge occupies at least four bytes, so a bogus header cannot trigger a huge allocation. */
+                    edges.reserve(std::min(edgeCount, buffer.size() / 4));
+                }
 
-                            if (pos != line.length())
-                            {
-                                error = true;
-                            }
+                firstLine = false;
+            }
+            else
+            {
+                std::size_t vertex1 = 0;
+                std::size_t vertex2 = 0;
 
-                            ret->addEdge(vertex1, vertex2);
+                error = !(cursor.parseUnsigned(vertex1) &&
+                          cursor.consume(' ') &&
+                          cursor.parseUnsigned(vertex2) &&
+                          cursor.atLineEnd()) ||
+                        vertex1 == 0 || vertex1 > vertexCount ||
+                        vertex2 == 0 || vertex2 > vertexCount;
 
-                            edgeCount--;
-                        }
-                    }
-                }
+                edges.emplace_back(static_cast<htd::vertex_t>(vertex1), static_cast<htd::vertex_t>(vertex2));
             }
         }
 
-        if (edgeCount != 0 && !managementInstance.isTerminated())
-        {
-            error = true;
-        }
+        cursor.skipLine();
     }
-    else
+
+    if (!error && !managementInstance.isTerminated() && edges.size() != edgeCount)
     {
         error = true;
     }
 
-    if (firstLine || error)
+    htd::IMutableMultiGraph * ret = nullptr;
+
+    if (!firstLine && !error)
     {
-        delete ret;
+        ret = managementInstance.multiGraphFactory().createInstance();
 
-        ret = nullptr;
+        ret->addVertices(vertexCount);
+
+        ret->addEdges(edges);
     }
-    
+
     return ret;
 }
 
@@ -26,12 +26,13 @@
 #define HTD_IO_HGRFORMATIMPORTER_CPP
 
 #include <htd_io/HgrFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 
 #include <htd/MultiHypergraphFactory.hpp>
 
-#include <fstream>
+#include <algorithm>
 #include <string>
-#include <stdexcept>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::HgrFormatImporter.
@@ -57,6 +58,15 @@ struct htd_io::HgrFormatImporter::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Create a new IMultiHypergraph instance based on the information stored in a given buffer.
+     *
+     *  @param[in] buffer   The buffer from which the information can be read.
+     *
+     *  @return A new IMultiHypergraph instance based on the information stored in the given buffer or nullptr in case of a parsing error.
+     */
+    htd::IMultiHypergraph * import(const htd_io::InputBuffer & buffer) const;
 };
 
 htd_io::HgrFormatImporter::HgrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -71,124 +81,98 @@ htd_io::HgrFormatImporter::~HgrFormatImporter(void)
 
 htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(const std::string & path) const
 {
-    std::ifstream stream(path);
-
-    return import(stream);
+    return implementation_->import(htd_io::InputBuffer(path));
 }
 
 htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream) const
+{
+    return implementation_->import(htd_io::InputBuffer(stream));
+}
+
+htd::IMultiHypergraph * htd_io::HgrFormatImporter::Implementation::import(const htd_io::InputBuffer & buffer) const
 {
     std::size_t vertexCount = 0;
     std::size_t edgeCount = 0;
 
     bool firstLine = true;
 
-    bool error = false;
+    bool error = !buffer.good();
 
-    htd::IMutableMultiHypergraph * ret = implementation_->managementInstance_->multiHypergraphFactory().createInstance();
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+    /* The elements of all hyperedges, stored consecutively in the order of appearance. */
+    std::vector<htd::vertex_t> elements;
 
-    if (stream.good())
-    {
-        std::string line;
+    /* The hyperedge i consists of the elements at the positions edgeOffsets[i], ..., edgeOffsets[i + 1] - 1. */
+    std::vector<htd::index_t> edgeOffsets(1, 0);
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+    htd_io::InputCursor cursor(buffer.begin(), buffer.end());
+
+    while (!error && !cursor.atEnd() && !managementInstance.isTerminated())
+    {
+        if (cursor.atLineEnd())
+        {
+            error = true;
+        }
+        else if (cursor.peek() != 'c')
         {
-            if (line.empty())
+            if (firstLine)
             {
-                error = true;
+                error = !(cursor.consume("p tw ") &&
+                          cursor.parseUnsigned(vertexCount) &&
+                          cursor.consume(' ') &&
+                          cursor.parseUnsigned(edgeCount) &&
+                          cursor.atLineEnd());
+
+                if (!error)
+                {
+                    /* Each hyperedge occupies at least two bytes, so a bogus header cannot trigger a huge allocation. */
+                    edgeOffsets.reserve(std::min(edgeCount, buffer.size() / 2) + 1);
+                }
+
+                firstLine = false;
             }
             else
             {
-                if (line[line.size() - 1] == '\r')
-                {
-                    line.pop_back();
-                }
+                bool lineEnd = false;
 
-                if (line[0] != 'c')
+                while (!error && !lineEnd)
                 {
-                    if (firstLine)
-                    {
-                        if (line.length() < 5 || line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
-                        else
-                        {
-                            line = line.substr(5);
-
-                            std::size_t pos = 0;
-
-                            vertexCount = std::stol(line, &pos);
-
-                            if (line[pos] != ' ')
-                            {
-                                error = true;
-                            }
+                    std::size_t vertex = 0;
 
-                            line = line.substr(pos + 1);
+                    error = !cursor.parseUnsigned(vertex) || vertex == 0 || vertex > vertexCount;
 
-                            edgeCount = std::stol(line, &pos);
+                    elements.push_back(static_cast<htd::vertex_t>(vertex));
 
-                            if (pos != line.length())
-                            {
-                                error = true;
-                            }
+                    lineEnd = cursor.atLineEnd();
 
-                            ret->addVertices(vertexCount);
-
-                            firstLine = false;
-                        }
-                    }
-                    else
+                    if (!lineEnd && !cursor.consume(' '))
                     {
-                        std::size_t pos = 0;
-
-                        std::vector<htd::vertex_t> vertices;
-
-                        while (!error && pos != line.length())
-                        {
-                            vertices.push_back(std::stoul(line, &pos));
-
-                            if (pos != line.length())
-                            {
-                                if (line[pos] != ' ')
-                                {
-                                    error = true;
-                                }
-                                else
-                                {
-                                    line = line.substr(pos + 1);
-
-                                    pos = 0;
-                                }
-                            }
-                        }
-
-                        ret->addEdge(std::move(vertices));
-
-                        edgeCount--;
+                        error = true;
                     }
                 }
+
+                edgeOffsets.push_back(elements.size());
             }
         }
 
-        if (edgeCount != 0 && !managementInstance.isTerminated())
-        {
-            error = true;
-        }
+        cursor.skipLine();
     }
-    else
+
+    if (!error && !managementInstance.isTerminated() && edgeOffsets.size() != edgeCount + 1)
     {
         error = true;
     }
 
-    if (firstLine || error)
+    htd::IMutableMultiHypergraph * ret = nullptr;
+
+    if (!firstLine && !error)
     {
-        delete ret;
+        ret = managementInstance.multiHypergraphFactory().createInstance();
+
+        ret->addVertices(vertexCount);
 
-        ret = nullptr;
+        ret->addEdges(elements, edgeOffsets);
     }
 
     return ret;
@@ -0,0 +1,222 @@
+/*
+ * File:   InputBuffer.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_INPUTBUFFER_CPP
+#define HTD_IO_INPUTBUFFER_CPP
+
+#include <htd_io/InputBuffer.hpp>
+
+#include <fstream>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define HTD_IO_USE_MEMORY_MAPPING
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/**
+ *  Private implementation details of class htd_io::InputBuffer.
+ */
+struct htd_io::InputBuffer::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void) : good_(false), begin_(nullptr), size_(0), mapping_(nullptr), mappingSize_(0), content_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+#ifdef HTD_IO_USE_MEMORY_MAPPING
+        if (mapping_ != nullptr)
+        {
+            munmap(mapping_, mappingSize_);
+        }
+#endif
+    }
+
+    /**
+     *  Boolean flag indicating whether the input could be read successfully.
+     */
+    bool good_;
+
+    /**
+     *  The first character of the input.
+     */
+    const char * begin_;
+
+    /**
+     *  The size of the input in bytes.
+     */
+    std::size_t size_;
+
+    /**
+     *  The memory-mapped content of the input file or nullptr if the file is not memory-mapped.
+     */
+    void * mapping_;
+
+    /**
+     *  The size of the memory mapping in bytes.
+     */
+    std::size_t mappingSize_;
+
+    /**
+     *  The content of the input if it is not memory-mapped.
+     */
+    std::vector<char> content_;
+
+    /**
+     *  Try to memory-map the given file.
+     *
+     *  @param[in] path The path to the file which shall be memory-mapped.
+     *
+     *  @return True if the file is a regular file and could be memory-mapped, false otherwise.
+     */
+    bool map(const std::string & path);
+
+    /**
+     *  Read the remaining content of the given stream into the buffer.
+     *
+     *  @param[in] stream   The input stream which shall be read.
+     */
+    void read(std::istream & stream);
+};
+
+htd_io::InputBuffer::InputBuffer(const std::string & path) : implementation_(new Implementation())
+{
+    if (!implementation_->map(path))
+    {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+
+        implementation_->read(stream);
+    }
+}
+
+htd_io::InputBuffer::InputBuffer(std::istream & stream) : implementation_(new Implementation())
+{
+    implementation_->read(stream);
+}
+
+htd_io::InputBuffer::~InputBuffer()
+{
+
+}
+
+bool htd_io::InputBuffer::good(void) const
+{
+    return implementation_->good_;
+}
+
+const char * htd_io::InputBuffer::begin(void) const
+{
+    return implementation_->begin_;
+}
+
+const char * htd_io::InputBuffer::end(void) const
+{
+    return implementation_->begin_ + implementation_->size_;
+}
+
+std::size_t htd_io::InputBuffer::size(void) const
+{
+    return implementation_->size_;
+}
+
+bool htd_io::InputBuffer::Implementation::map(const std::string & path)
+{
+    bool ret = false;
+
+#ifdef HTD_IO_USE_MEMORY_MAPPING
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+
+    if (fileDescriptor >= 0)
+    {
+        struct stat fileStatus;
+
+        if (fstat(fileDescriptor, &fileStatus) == 0 && S_ISREG(fileStatus.st_mode) && fileStatus.st_size > 0)
+        {
+            std::size_t fileSize = static_cast<std::size_t>(fileStatus.st_size);
+
+            void * mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                madvise(mapping, fileSize, MADV_SEQUENTIAL);
+
+                mapping_ = mapping;
+                mappingSize_ = fileSize;
+
+                begin_ = static_cast<const char *>(mapping);
+                size_ = fileSize;
+
+                good_ = true;
+
+                ret = true;
+            }
+        }
+
+        close(fileDescriptor);
+    }
+#else
+    HTD_UNUSED(path)
+#endif
+
+    return ret;
+}
+
+void htd_io::InputBuffer::Implementation::read(std::istream & stream)
+{
+    if (stream.good())
+    {
+        std::size_t chunkSize = 1 << 16;
+
+        std::size_t length = 0;
+
+        do
+        {
+            content_.resize(length + chunkSize);
+
+            stream.read(content_.data() + length, static_cast<std::streamsize>(chunkSize));
+
+            length += static_cast<std::size_t>(stream.gcount());
+
+            chunkSize = content_.size();
+        }
+        while (stream.good());
+
+        content_.resize(length);
+
+        begin_ = content_.data();
+        size_ = content_.size();
+
+        good_ = true;
+    }
+}
+
+#endif /* HTD_IO_INPUTBUFFER_CPP */
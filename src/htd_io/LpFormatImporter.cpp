@@ -26,10 +26,11 @@
 #define HTD_IO_LPFORMATIMPORTER_CPP
 
 #include <htd_io/LpFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 
-#include <fstream>
-#include <iostream>
+#include <cstring>
 #include <string>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::LpFormatImporter.
@@ -57,11 +58,31 @@ struct htd_io::LpFormatImporter::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Remove all leading and trailing whitespaces from a given string.
+     *  Create a new NamedMultiHypergraph instance based on the information stored in a given buffer.
      *
-     *  @param[in] value    The string which shall be trimmed.
+     *  @param[in] buffer   The buffer from which the information can be read.
+     *
+     *  @return A new NamedMultiHypergraph instance based on the information stored in the given buffer or nullptr in case of an error.
      */
-    void trim(std::string & value);
+    htd::NamedMultiHypergraph<std::string, std::string> * import(const htd_io::InputBuffer & buffer) const;
+
+    /**
+     *  Find the end of the arguments of a fact, i.e., the closing parenthesis of the terminating ")." sequence.
+     *
+     *  @param[in] begin    The first character after the opening parenthesis.
+     *  @param[in] end      The end of the line.
+     *
+     *  @return A pointer to the closing parenthesis if the first occurrence of ")." terminates the line, nullptr otherwise.
+     */
+    static const char * argumentsEnd(const char * begin, const char * end);
+
+    /**
+     *  Remove all leading and trailing whitespaces from a given range of characters.
+     *
+     *  @param[in,out] begin    The first character of the range.
+     *  @param[in,out] end      The position one past the last character of the range.
+     */
+    static void trim(const char * & begin, const char * & end);
 };
 
 htd_io::LpFormatImporter::LpFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -76,118 +97,140 @@ htd_io::LpFormatImporter::~LpFormatImporter(void)
 
 htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::import(const std::string & path) const
 {
-    std::ifstream stream(path);
-
-    return import(stream);
+    return implementation_->import(htd_io::InputBuffer(path));
 }
 
 htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::import(std::istream & stream) const
 {
-    bool error = false;
-
-    htd::NamedMultiHypergraph<std::string, std::string> * ret = new htd::NamedMultiHypergraph<std::string, std::string>(implementation_->managementInstance_);
+    return implementation_->import(htd_io::InputBuffer(stream));
+}
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::Implementation::import(const htd_io::InputBuffer & buffer) const
+{
+    htd::NamedMultiHypergraph<std::string, std::string> * ret = nullptr;
 
-    if (stream.good())
+    if (buffer.good())
     {
-        std::string line;
-
-        std::size_t nextPosition = 0;
-        
-        std::size_t startPosition = 0;
-        
-        std::size_t finishPosition = 0;
-        
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        ret = new htd::NamedMultiHypergraph<std::string, std::string>(managementInstance_);
+
+        /* The endpoints of the pending hyperedges, stored consecutively in the order of appearance. The names are resolved to
+           vertices while reading them, so that only the vertex IDs have to be kept until the hyperedges are added. */
+        std::vector<htd::vertex_t> elements;
+
+        /* The pending hyperedge i consists of the elements at the positions edgeOffsets[i], ..., edgeOffsets[i + 1] - 1. */
+        std::vector<htd::index_t> edgeOffsets(1, 0);
+
+        /* The name which was read last. The string is reused for all names, so that reading a name only allocates memory
+           if it is longer than all names before. */
+        std::string name;
+
+        htd_io::InputCursor cursor(buffer.begin(), buffer.end());
+
+        while (!cursor.atEnd() && !managementInstance.isTerminated())
         {
-            finishPosition = 0;
-            
-            startPosition = line.find("edge(");
-            
-            if (startPosition == 0)
+            const char * lineEnd = cursor.lineEnd();
+
+            if (cursor.consume("edge("))
             {
-                startPosition = startPosition + std::string("edge(").length();
-                
-                finishPosition = line.find(").", startPosition);
-                
-                if (finishPosition == line.length() - 2)
+                const char * finish = argumentsEnd(cursor.position(), lineEnd);
+
+                if (finish != nullptr)
                 {
-                    line.erase(finishPosition, std::string(").").length());
-                    line.erase(0, startPosition);
-                    
-                    std::vector<std::string> hyperedge;
-                    
-                    nextPosition = line.find(",");
-                    
-                    while (nextPosition != std::string::npos)
+                    const char * elementBegin = cursor.position();
+
+                    const char * separator = static_cast<const char *>(std::memchr(elementBegin, ',', static_cast<std::size_t>(finish - elementBegin)));
+
+                    while (separator != nullptr)
                     {
-                        std::string element = line.substr(0, nextPosition);
+                        const char * elementEnd = separator;
+
+                        trim(elementBegin, elementEnd);
+
+                        name.assign(elementBegin, elementEnd);
 
-                        this->implementation_->trim(element);
+                        elements.push_back(ret->addVertex(name));
 
-                        hyperedge.push_back(element);
-                        
-                        line.erase(0, nextPosition + 1);
-                        
-                        nextPosition = line.find(",");
+                        elementBegin = separator + 1;
+
+                        separator = static_cast<const char *>(std::memchr(elementBegin, ',', static_cast<std::size_t>(finish - elementBegin)));
                     }
 
-                    this->implementation_->trim(line);
+                    const char * elementEnd = finish;
+
+                    trim(elementBegin, elementEnd);
 
-                    if (line.length() > 0)
+                    if (elementBegin != elementEnd)
                     {
-                        hyperedge.push_back(line);
+                        name.assign(elementBegin, elementEnd);
+
+                        elements.push_back(ret->addVertex(name));
                     }
 
-                    if (hyperedge.size() > 0)
+                    if (elements.size() > edgeOffsets.back())
                     {
-                        ret->addEdge(hyperedge);
+                        edgeOffsets.push_back(elements.size());
                     }
                 }
             }
-            else
+            else if (cursor.consume("vertex("))
             {
-                startPosition = line.find("vertex(");
+                const char * finish = argumentsEnd(cursor.position(), lineEnd);
 
-                if (startPosition == 0)
+                if (finish != nullptr)
                 {
-                    startPosition = startPosition + std::string("vertex(").length();
+                    const char * nameBegin = cursor.position();
 
-                    finishPosition = line.find(").", startPosition);
+                    trim(nameBegin, finish);
 
-                    if (finishPosition == line.length() - 2)
-                    {
-                        line.erase(finishPosition, std::string(").").length());
-                        line.erase(0, startPosition);
+                    name.assign(nameBegin, finish);
 
-                        this->implementation_->trim(line);
-
-                        ret->addVertex(line);
-                    }
+                    ret->addVertex(name);
                 }
             }
+
+            cursor.skipLine();
         }
+
+        ret->addEdgesBetweenVertices(elements, edgeOffsets);
     }
-    else
-    {
-        error = true;
-    }
 
-    if (error)
+    return ret;
+}
+
+const char * htd_io::LpFormatImporter::Implementation::argumentsEnd(const char * begin, const char * end)
+{
+    const char * ret = nullptr;
+
+    if (end - begin >= 2 && *(end - 2) == ')' && *(end - 1) == '.')
     {
-        delete ret;
+        ret = end - 2;
 
-        ret = nullptr;
+        for (const char * position = begin; position < end - 2 && ret != nullptr; ++position)
+        {
+            if (*position == ')' && *(position + 1) == '.')
+            {
+                ret = nullptr;
+            }
+        }
     }
-    
+
     return ret;
 }
 
-void htd_io::LpFormatImporter::Implementation::trim(std::string & value)
+void htd_io::LpFormatImporter::Implementation::trim(const char * & begin, const char * & end)
 {
-    value.erase(0, value.find_first_not_of(" \t\n\r\f\v"));
-    value.erase(value.find_last_not_of(" \t\n\r\f\v") + 1);
+    /* The whitespace characters '\t', '\n', '\v', '\f' and '\r' occupy the consecutive codes 9 to 13. */
+    while (begin != end && (*begin == ' ' || (*begin >= '\t' && *begin <= '\r')))
+    {
+        ++begin;
+    }
+
+    while (end != begin && (*(end - 1) == ' ' || (*(end - 1) >= '\t' && *(end - 1) <= '\r')))
+    {
+        --end;
+    }
 }
 
 #endif /* HTD_IO_LPFORMATIMPORTER_CPP */
@@ -27,117 +27,103 @@
 
 #include <htd_io/TdFormatExporter.hpp>
 
-#include <sstream>
-#include <unordered_map>
+#include <htd_io/OutputBuffer.hpp>
 
-htd_io::TdFormatExporter::TdFormatExporter(void)
-{
-
-}
+#include <vector>
 
-htd_io::TdFormatExporter::~TdFormatExporter()
+namespace
 {
-
-}
-
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
-{
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
-
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
-
-    if (decomposition.vertexCount() > 0)
+    /**
+     *  Write a tree decomposition in the format 'td' to a given stream.
+     *
+     *  Nodes are renumbered consecutively, starting with 1, in the order in which they are returned by the decomposition.
+     *
+     *  @param[in] decomposition    The tree decomposition which shall be exported.
+     *  @param[in] vertexCount      The number of vertices of the graph from which the given decomposition was constructed.
+     *  @param[out] outputStream    The output stream to which the information shall be written.
+     */
+    void writeTdFormat(const htd::ITreeDecomposition & decomposition, std::size_t vertexCount, std::ostream & outputStream)
     {
-        std::size_t index = 1;
+        htd_io::OutputBuffer buffer(outputStream);
 
-        std::stringstream tmpStream;
+        buffer.append("s td ", 5);
+        buffer.appendDecimal(decomposition.vertexCount());
+        buffer.append(' ');
+        buffer.appendDecimal(decomposition.maximumBagSize());
+        buffer.append(' ');
+        buffer.appendDecimal(vertexCount);
+        buffer.append('\n');
 
-        for (htd::vertex_t node : decomposition.vertices())
+        if (decomposition.vertexCount() > 0)
         {
-            tmpStream << "b " << index << " ";
+            /* Dense mapping from node identifiers to the consecutive indices used in the output. */
+            std::vector<std::size_t> indices;
 
-            indices.emplace(node, index);
+            std::size_t index = 1;
 
-            for (htd::vertex_t vertex : decomposition.bagContent(node))
+            for (htd::vertex_t node : decomposition.vertices())
             {
-                tmpStream << vertex << " ";
-            }
+                if (node >= indices.size())
+                {
+                    indices.resize(node + 1 > indices.size() * 2 ? node + 1 : indices.size() * 2, 0);
+                }
 
-            tmpStream << "\n" << std::flush;
+                indices[node] = index;
 
-            outputStream << tmpStream.rdbuf();
+                buffer.append("b ", 2);
+                buffer.appendDecimal(index);
+                buffer.append(' ');
 
-            tmpStream.clear();
+                for (htd::vertex_t vertex : decomposition.bagContent(node))
+                {
+                    buffer.appendDecimal(vertex);
+                    buffer.append(' ');
+                }
 
-            ++index;
-        }
+                buffer.append('\n');
 
-        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
+                ++index;
+            }
 
-        std::size_t edgeCount = decomposition.edgeCount();
+            const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
 
-        auto it = hyperedgeCollection.begin();
+            std::size_t edgeCount = decomposition.edgeCount();
 
-        for (htd::index_t index = 0; index < edgeCount; ++index)
-        {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
+            auto it = hyperedgeCollection.begin();
 
-            outputStream << vertex1 << " " << vertex2 << "\n";
+            for (htd::index_t edgeIndex = 0; edgeIndex < edgeCount; ++edgeIndex)
+            {
+                const htd::Hyperedge & edge = *it;
+
+                buffer.appendDecimal(indices[edge[0]]);
+                buffer.append(' ');
+                buffer.appendDecimal(indices[edge[1]]);
+                buffer.append('\n');
 
-            ++it;
+                ++it;
+            }
         }
     }
 }
 
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+htd_io::TdFormatExporter::TdFormatExporter(void)
 {
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
-
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
-
-    if (decomposition.vertexCount() > 0)
-    {
-        std::size_t index = 1;
-
-        std::stringstream tmpStream;
 
-        for (htd::vertex_t node : decomposition.vertices())
-        {
-            tmpStream << "b " << index << " ";
-
-            indices.emplace(node, index);
-
-            for (htd::vertex_t vertex : decomposition.bagContent(node))
-            {
-                tmpStream << vertex << " ";
-            }
-
-            tmpStream << "\n" << std::flush;
-
-            outputStream << tmpStream.rdbuf();
-
-            tmpStream.clear();
-
-            ++index;
-        }
-
-        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
-
-        std::size_t edgeCount = decomposition.edgeCount();
+}
 
-        auto it = hyperedgeCollection.begin();
+htd_io::TdFormatExporter::~TdFormatExporter()
+{
 
-        for (htd::index_t index = 0; index < edgeCount; ++index)
-        {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
+}
 
-            outputStream << vertex1 << " " << vertex2 << "\n";
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    writeTdFormat(decomposition, graph.vertexCount(), outputStream);
+}
 
-            ++it;
-        }
-    }
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    writeTdFormat(decomposition, graph.vertexCount(), outputStream);
 }
 
 #endif /* HTD_IO_TDFORMATEXPORTER_CPP */
@@ -26,11 +26,25 @@
 #include <htd_io/main.hpp>
 #include <htd_cli/main.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <csignal>
 #include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define HTD_MAIN_USE_DIRECTORY_LISTING
+    #include <dirent.h>
+    #include <sys/stat.h>
+#endif
 
 htd::LibraryInstance * const libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
 
@@ -78,6 +92,7 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::Choice * outputFormatChoice = new htd_cli::Choice("output", "Set the output format of the decomposition to <format>.\n  (See https://github.com/mabseher/htd/blob/master/FORMATS.md for information about the available output formats.)", "format");
 
         outputFormatChoice->addPossibility("td", "Use the output format 'td'.");
+        outputFormatChoice->addPossibility("btd", "Use the binary output format 'btd'.");
         outputFormatChoice->addPossibility("human", "Provide a human-readable output of the decomposition.");
         outputFormatChoice->addPossibility("width", "Provide only the maximum bag size of the decomposition.");
 
@@ -134,6 +149,22 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::SingleValueOption * patienceOption = new htd_cli::SingleValueOption("patience", "Terminate the algorithm if more than <amount> iterations did not lead to an improvement (-1 = infinite). (Default: -1)", "amount");
 
         manager->registerOption(patienceOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * timeLimitOption = new htd_cli::SingleValueOption("time-limit", "Output the best decomposition found once <seconds> seconds have passed; optimization runs until then unless --iterations is set.", "seconds");
+
+        manager->registerOption(timeLimitOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * batchOption = new htd_cli::SingleValueOption("batch", "Decompose all instances listed in file <manifest> (one path per line, '-' = read the list from standard input) or, if <manifest> is a directory, all files in it with the extension of the input format.", "manifest");
+
+        manager->registerOption(batchOption, "Batch Options");
+
+        htd_cli::SingleValueOption * outputDirectoryOption = new htd_cli::SingleValueOption("output-directory", "Write the decompositions of the batch to directory <directory>. (Default: directory of the instance)", "directory");
+
+        manager->registerOption(outputDirectoryOption, "Batch Options");
+
+        htd_cli::SingleValueOption * threadOption = new htd_cli::SingleValueOption("threads", "Decompose up to <count> instances of the batch concurrently. (Default: number of hardware threads)", "count");
+
+        manager->registerOption(threadOption, "Batch Options");
     }
     catch (const std::runtime_error & exception)
     {
@@ -147,6 +178,19 @@ htd_cli::OptionManager * createOptionManager(void)
     return manager;
 }
 
+bool isDirectory(const std::string & path)
+{
+#ifdef HTD_MAIN_USE_DIRECTORY_LISTING
+    struct stat status;
+
+    return stat(path.c_str(), &status) == 0 && S_ISDIR(status.st_mode);
+#else
+    HTD_UNUSED(path)
+
+    return false;
+#endif
+}
+
 bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionManager & optionManager, htd::LibraryInstance * const manager)
 {
     bool ret = true;
@@ -182,8 +226,18 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::SingleValueOption & patienceOption = optionManager.accessSingleValueOption("patience");
 
+    const htd_cli::SingleValueOption & timeLimitOption = optionManager.accessSingleValueOption("time-limit");
+
     const htd_cli::Option & triangulationMinimizationOption = optionManager.accessOption("triangulation-minimization");
 
+    const htd_cli::Option & printProgressOption = optionManager.accessOption("print-progress");
+
+    const htd_cli::SingleValueOption & batchOption = optionManager.accessSingleValueOption("batch");
+
+    const htd_cli::SingleValueOption & outputDirectoryOption = optionManager.accessSingleValueOption("output-directory");
+
+    const htd_cli::SingleValueOption & threadOption = optionManager.accessSingleValueOption("threads");
+
     if (ret && helpOption.used())
     {
         std::cout << "VERSION: htd_main " << htd_version() << std::endl << std::endl;
@@ -313,9 +367,9 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     if (ret && decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree")
     {
-        if (outputFormatChoice.used() && std::string(outputFormatChoice.value()) == "td")
+        if (outputFormatChoice.used() && (std::string(outputFormatChoice.value()) == "td" || std::string(outputFormatChoice.value()) == "btd"))
         {
-            std::cerr << "INVALID OUTPUT FORMAT: Format 'td' only supports tree decompositions!" << std::endl;
+            std::cerr << "INVALID OUTPUT FORMAT: Format '" << outputFormatChoice.value() << "' only supports tree decompositions!" << std::endl;
 
             ret = false;
         }
@@ -404,6 +458,93 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
+    if (ret && timeLimitOption.used())
+    {
+        const std::string & value = timeLimitOption.value();
+
+        std::size_t separatorPosition = value.find('.');
+
+        if (value.empty() || value == "." || value.find_first_not_of("0123456789.") != std::string::npos || (separatorPosition != std::string::npos && value.find('.', separatorPosition + 1) != std::string::npos))
+        {
+            std::cerr << "INVALID TIME LIMIT: " << value << std::endl;
+
+            ret = false;
+        }
+        else if (std::stod(value) <= 0)
+        {
+            std::cerr << "INVALID TIME LIMIT: " << value << " (The time limit must be positive.)" << std::endl;
+
+            ret = false;
+        }
+        else if (batchOption.used())
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --time-limit may not be used together with option --batch!" << std::endl;
+
+            ret = false;
+        }
+    }
+
+    if (ret && batchOption.used())
+    {
+        if (instanceOption.used())
+        {
+            std::cerr << "INVALID PROGRAM CALL: Options --batch and --instance may not be used together!" << std::endl;
+
+            ret = false;
+        }
+
+        if (ret && printProgressOption.used())
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --print-progress may not be used together with option --batch!" << std::endl;
+
+            ret = false;
+        }
+
+        if (ret && decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree")
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --batch may only be used when option --type is set to \"tree\"!" << std::endl;
+
+            ret = false;
+        }
+
+        if (ret && std::string(batchOption.value()) != "-" && !isDirectory(batchOption.value()))
+        {
+            std::ifstream manifestStream(batchOption.value());
+
+            if (!manifestStream.good())
+            {
+                std::cerr << "INVALID MANIFEST FILE: " << batchOption.value() << std::endl;
+
+                ret = false;
+            }
+        }
+
+        if (ret && threadOption.used())
+        {
+            const std::string & value = threadOption.value();
+
+            if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos || std::stoul(value, nullptr, 10) == 0)
+            {
+                std::cerr << "INVALID NUMBER OF THREADS: " << threadOption.value() << std::endl;
+
+                ret = false;
+            }
+        }
+    }
+    else if (ret && (outputDirectoryOption.used() || threadOption.used()))
+    {
+        std::cerr << "INVALID PROGRAM CALL: Options --output-directory and --threads may only be used together with option --batch!" << std::endl;
+
+        ret = false;
+    }
+
+    if (ret && printProgressOption.used() && outputFormatChoice.used() && std::string(outputFormatChoice.value()) == "btd")
+    {
+        std::cerr << "INVALID PROGRAM CALL: Option --print-progress may not be used together with the binary output format 'btd'!" << std::endl;
+
+        ret = false;
+    }
+
     if (ret && triangulationMinimizationOption.used())
     {
         htd::TriangulationMinimizationOrderingAlgorithm * algorithm =
@@ -417,6 +558,27 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
     return ret;
 }
 
+void reportDeadline(const htd::LibraryInstance & instance)
+{
+    if (instance.hasDeadline())
+    {
+        double difference = std::chrono::duration<double>(std::chrono::steady_clock::now() - instance.deadline()).count();
+
+        std::ios::fmtflags oldflags(std::cerr.flags());
+
+        if (difference > 0)
+        {
+            std::cerr << "Time limit exceeded by " << std::fixed << std::setprecision(3) << difference << " s." << std::endl;
+        }
+        else
+        {
+            std::cerr << "Decomposition finished " << std::fixed << std::setprecision(3) << -difference << " s before the time limit." << std::endl;
+        }
+
+        std::cerr.flags(oldflags);
+    }
+}
+
 template <typename DecompositionAlgorithm, typename GraphType, typename Exporter>
 void decompose(const htd::LibraryInstance & instance, const DecompositionAlgorithm & algorithm, GraphType * graph, const Exporter & exporter)
 {
@@ -429,6 +591,8 @@ void decompose(const htd::LibraryInstance & instance, const DecompositionAlgorit
             if (!instance.isTerminated() || algorithm.isSafelyInterruptible())
             {
                 exporter.write(*decomposition, *graph, std::cout);
+
+                reportDeadline(instance);
             }
             else
             {
@@ -476,6 +640,8 @@ void decomposeNamed(const htd::LibraryInstance & instance, const DecompositionAl
             if (!instance.isTerminated() || algorithm.isSafelyInterruptible())
             {
                 exporter.write(*decomposition, *graph, std::cout);
+
+                reportDeadline(instance);
             }
             else
             {
@@ -562,6 +728,412 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     }
 }
 
+htd::GraphPreprocessor * createPreprocessor(const htd::LibraryInstance * const manager, const std::string & strategy, std::size_t threadCount)
+{
+    htd::GraphPreprocessor * ret = new htd::GraphPreprocessor(manager);
+
+    if (strategy == "none")
+    {
+        ret->setPreprocessingStrategy(0);
+    }
+    else if (strategy == "simple")
+    {
+        ret->setPreprocessingStrategy(1);
+    }
+    else if (strategy == "advanced")
+    {
+        ret->setPreprocessingStrategy(2);
+    }
+    else if (strategy == "full")
+    {
+        ret->setPreprocessingStrategy(3);
+
+        ret->setIterationCount(256);
+        ret->setNonImprovementLimit(64);
+        ret->setThreadCount(threadCount);
+    }
+
+    return ret;
+}
+
+htd_io::ITreeDecompositionExporter * createTreeDecompositionExporter(const std::string & outputFormat)
+{
+    htd_io::ITreeDecompositionExporter * ret = nullptr;
+
+    if (outputFormat == "td")
+    {
+        ret = new htd_io::TdFormatExporter();
+    }
+    else if (outputFormat == "btd")
+    {
+        ret = new htd_io::BinaryTdFormatExporter();
+    }
+    else if (outputFormat == "human")
+    {
+        ret = new htd_io::HumanReadableExporter();
+    }
+    else if (outputFormat == "width")
+    {
+        ret = new htd_io::WidthExporter();
+    }
+
+    return ret;
+}
+
+htd_io::IGraphToTreeDecompositionProcessor * createProcessor(const htd::LibraryInstance * const manager, const std::string & inputFormat)
+{
+    htd_io::IGraphToTreeDecompositionProcessor * ret = nullptr;
+
+    if (inputFormat == "gr")
+    {
+        ret = new htd_io::GrFormatGraphToTreeDecompositionProcessor(manager);
+    }
+    else if (inputFormat == "hgr")
+    {
+        ret = new htd_io::HgrFormatGraphToTreeDecompositionProcessor(manager);
+    }
+    else if (inputFormat == "lp")
+    {
+        ret = new htd_io::LpFormatGraphToTreeDecompositionProcessor(manager);
+    }
+
+    return ret;
+}
+
+bool readDirectory(const std::string & directory, const std::string & inputFormat, std::vector<std::string> & instances)
+{
+#ifdef HTD_MAIN_USE_DIRECTORY_LISTING
+    DIR * directoryStream = opendir(directory.c_str());
+
+    if (directoryStream == nullptr)
+    {
+        return false;
+    }
+
+    std::string prefix = directory.back() == '/' ? directory : directory + "/";
+
+    std::string extension = "." + inputFormat;
+
+    std::vector<std::string> entries;
+
+    for (struct dirent * entry = readdir(directoryStream); entry != nullptr; entry = readdir(directoryStream))
+    {
+        std::string name(entry->d_name);
+
+        if (name.size() > extension.size() && name[0] != '.' && name.compare(name.size() - extension.size(), extension.size(), extension) == 0)
+        {
+            struct stat status;
+
+            if (stat((prefix + name).c_str(), &status) == 0 && S_ISREG(status.st_mode))
+            {
+                entries.push_back(prefix + name);
+            }
+        }
+    }
+
+    closedir(directoryStream);
+
+    /* The order of readdir() is unspecified, so sort the entries to give every instance a stable index and seed. */
+    std::sort(entries.begin(), entries.end());
+
+    instances.insert(instances.end(), entries.begin(), entries.end());
+
+    return true;
+#else
+    HTD_UNUSED(directory)
+    HTD_UNUSED(inputFormat)
+    HTD_UNUSED(instances)
+
+    return false;
+#endif
+}
+
+bool readManifest(const std::string & manifest, const std::string & inputFormat, std::vector<std::string> & instances)
+{
+    if (manifest != "-" && isDirectory(manifest))
+    {
+        return readDirectory(manifest, inputFormat, instances);
+    }
+
+    std::ifstream manifestFile;
+
+    if (manifest != "-")
+    {
+        manifestFile.open(manifest);
+
+        if (!manifestFile.good())
+        {
+            return false;
+        }
+    }
+
+    std::istream & manifestStream = manifest != "-" ? manifestFile : std::cin;
+
+    std::string line;
+
+    while (std::getline(manifestStream, line))
+    {
+        std::size_t first = line.find_first_not_of(" \t\r");
+
+        if (first != std::string::npos && line[first] != '#')
+        {
+            std::size_t last = line.find_last_not_of(" \t\r");
+
+            instances.push_back(line.substr(first, last - first + 1));
+        }
+    }
+
+    return true;
+}
+
+std::string outputFileName(const std::string & instance, const std::string & outputDirectory, const std::string & outputFormat, const std::string & suffix)
+{
+    if (outputDirectory.empty())
+    {
+        return instance + suffix + "." + outputFormat;
+    }
+
+    std::size_t separatorPosition = instance.find_last_of("/\\");
+
+    std::string baseName = separatorPosition == std::string::npos ? instance : instance.substr(separatorPosition + 1);
+
+    if (outputDirectory.back() == '/' || outputDirectory.back() == '\\')
+    {
+        return outputDirectory + baseName + suffix + "." + outputFormat;
+    }
+
+    return outputDirectory + "/" + baseName + suffix + "." + outputFormat;
+}
+
+/**
+ *  Determine the output file of each instance of a batch.
+ *
+ *  Instances which would share an output file, e.g. a/g.gr and b/g.gr with an output directory or an instance which is
+ *  listed twice, get the 1-based index of the instance within the batch appended to the name of their output file. The
+ *  collisions are reported on standard error. If the output file of an instance is still not unique afterwards, its
+ *  output file is left empty and the instance is not decomposed.
+ */
+std::vector<std::string> outputFileNames(const std::vector<std::string> & instances, const std::string & outputDirectory, const std::string & outputFormat)
+{
+    std::vector<std::string> ret;
+
+    std::unordered_map<std::string, std::size_t> occurrences;
+
+    for (const std::string & instance : instances)
+    {
+        ret.push_back(outputFileName(instance, outputDirectory, outputFormat, ""));
+
+        ++occurrences[ret.back()];
+    }
+
+    for (std::size_t index = 0; index < instances.size(); ++index)
+    {
+        if (occurrences.at(outputFileName(instances[index], outputDirectory, outputFormat, "")) > 1)
+        {
+            ret[index] = outputFileName(instances[index], outputDirectory, outputFormat, "." + std::to_string(index + 1));
+
+            std::cerr << "OUTPUT FILE COLLISION: " << instances[index] << " IS WRITTEN TO " << ret[index] << std::endl;
+        }
+    }
+
+    occurrences.clear();
+
+    for (const std::string & fileName : ret)
+    {
+        ++occurrences[fileName];
+    }
+
+    for (std::string & fileName : ret)
+    {
+        if (occurrences.at(fileName) > 1)
+        {
+            fileName.clear();
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Structure representing the outcome of decomposing a single instance of a batch.
+ */
+struct BatchResult
+{
+    /**
+     *  The status of the instance.
+     */
+    std::string status;
+
+    /**
+     *  The maximum bag size of the exported decomposition.
+     */
+    std::size_t maximumBagSize;
+
+    /**
+     *  The time in seconds spent on parsing, decomposing and exporting the instance.
+     */
+    double duration;
+};
+
+bool processBatch(const htd::LibraryInstance * const manager, const std::vector<std::string> & instances, const std::string & inputFormat, const std::string & outputFormat, const std::string & preprocessingStrategy, const std::string & outputDirectory, std::size_t threadCount)
+{
+    std::vector<BatchResult> results(instances.size(), BatchResult { "SKIPPED", 0, 0.0 });
+
+    std::vector<std::string> outputFiles = outputFileNames(instances, outputDirectory, outputFormat);
+
+    std::atomic<std::size_t> nextInstance(0);
+
+    unsigned int baseSeed = static_cast<unsigned int>(htd::randomNumber());
+
+    std::chrono::steady_clock::time_point batchStart = std::chrono::steady_clock::now();
+
+    auto processInstances = [&]()
+    {
+        /* The algorithm stack is shared via the management instance, every worker only owns its processor. */
+        std::unique_ptr<htd_io::IGraphToTreeDecompositionProcessor> processor(createProcessor(manager, inputFormat));
+
+        processor->setExporter(createTreeDecompositionExporter(outputFormat));
+
+        processor->setPreprocessor(createPreprocessor(manager, preprocessingStrategy, 1));
+
+        htd_io::parsing_result_t parsingResult = htd_io::ParsingResult::ERROR;
+
+        std::size_t maximumBagSize = (std::size_t)-1;
+
+        processor->registerParsingCallback([&](htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount)
+        {
+            HTD_UNUSED(vertexCount)
+            HTD_UNUSED(edgeCount)
+
+            parsingResult = result;
+        });
+
+        processor->registerDecompositionCallback([&](const htd::FitnessEvaluation & fitness)
+        {
+            maximumBagSize = std::min(maximumBagSize, static_cast<std::size_t>(-fitness.at(0)));
+        });
+
+        for (std::size_t index = nextInstance++; index < instances.size() && !manager->isTerminated(); index = nextInstance++)
+        {
+            BatchResult & result = results[index];
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            std::ifstream inputStream(instances[index]);
+
+            if (!inputStream.good())
+            {
+                result.status = "INVALID INSTANCE FILE";
+            }
+            else if (outputFiles[index].empty())
+            {
+                result.status = "OUTPUT FILE COLLISION";
+            }
+            else
+            {
+                std::ofstream outputStream(outputFiles[index]);
+
+                if (!outputStream.good())
+                {
+                    result.status = "INVALID OUTPUT FILE";
+                }
+                else
+                {
+                    parsingResult = htd_io::ParsingResult::ERROR;
+
+                    maximumBagSize = (std::size_t)-1;
+
+                    htd::seedThreadLocalRandomNumberGenerator(baseSeed + static_cast<unsigned int>(index));
+
+                    processor->process(inputStream, outputStream);
+
+                    if (manager->isTerminated())
+                    {
+                        result.status = "TERMINATED";
+                    }
+                    else if (parsingResult != htd_io::ParsingResult::OK)
+                    {
+                        result.status = "PARSING FAILED";
+                    }
+                    else if (maximumBagSize == (std::size_t)-1)
+                    {
+                        result.status = "NO TREE DECOMPOSITION COMPUTED";
+                    }
+                    else
+                    {
+                        result.status = "OK";
+
+                        result.maximumBagSize = maximumBagSize;
+                    }
+                }
+            }
+
+            result.duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        htd::resetThreadLocalRandomNumberGenerator();
+    };
+
+    threadCount = std::max(std::min(threadCount, instances.size()), (std::size_t)1);
+
+    if (threadCount == 1)
+    {
+        processInstances();
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+
+        for (std::size_t index = 0; index < threadCount; ++index)
+        {
+            threads.emplace_back(processInstances);
+        }
+
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    double batchDuration = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+
+    std::size_t successCount = 0;
+
+    std::ios::fmtflags oldflags(std::cout.flags());
+
+    std::cout << "Batch summary:" << std::endl;
+
+    for (std::size_t index = 0; index < instances.size(); ++index)
+    {
+        const BatchResult & result = results[index];
+
+        std::cout << "   " << std::left << std::setw(32) << result.status;
+
+        if (result.status == "OK")
+        {
+            std::cout << std::right << std::setw(8) << result.maximumBagSize;
+
+            ++successCount;
+        }
+        else
+        {
+            std::cout << std::right << std::setw(8) << "-";
+        }
+
+        std::cout << std::right << std::setw(12) << std::fixed << std::setprecision(3) << result.duration << " s   " << instances[index] << std::endl;
+    }
+
+    std::cout << "   - - - - - - - - - - - - - - - - - -" << std::endl;
+    std::cout << "   Instances:        " << std::right << std::setw(17) << instances.size() << std::endl;
+    std::cout << "   Decomposed:       " << std::right << std::setw(17) << successCount << std::endl;
+    std::cout << "   Threads:          " << std::right << std::setw(17) << threadCount << std::endl;
+    std::cout << "   Duration:         " << std::right << std::setw(15) << std::fixed << std::setprecision(3) << batchDuration << " s" << std::endl;
+
+    std::cout.flags(oldflags);
+
+    return successCount == instances.size();
+}
+
 void handleSignal(int signal)
 {
     switch (signal)
@@ -600,6 +1172,13 @@ int main(int argc, const char * const * const argv)
 
     if (optionManager != nullptr && handleOptions(argc, argv, *optionManager, libraryInstance))
     {
+        const htd_cli::SingleValueOption & timeLimitOption = optionManager->accessSingleValueOption("time-limit");
+
+        if (timeLimitOption.used())
+        {
+            libraryInstance->setTimeLimit(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(std::min(std::stod(timeLimitOption.value()), 1e9))));
+        }
+
         const htd_cli::Choice & inputFormatChoice = optionManager->accessChoice("input");
 
         const htd_cli::Choice & outputFormatChoice = optionManager->accessChoice("output");
@@ -620,6 +1199,12 @@ int main(int argc, const char * const * const argv)
 
         const htd_cli::Option & printProgressOption = optionManager->accessOption("print-progress");
 
+        const htd_cli::SingleValueOption & batchOption = optionManager->accessSingleValueOption("batch");
+
+        const htd_cli::SingleValueOption & outputDirectoryOption = optionManager->accessSingleValueOption("output-directory");
+
+        const htd_cli::SingleValueOption & threadOption = optionManager->accessSingleValueOption("threads");
+
         const std::string & outputFormat = outputFormatChoice.value();
 
         bool hypertreeDecompositionRequested = decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree";
@@ -628,6 +1213,12 @@ int main(int argc, const char * const * const argv)
         {
             htd::SeparatorBasedTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::SeparatorBasedTreeDecompositionAlgorithm(libraryInstance);
 
+            htd::MinimumSeparatorAlgorithm * separatorAlgorithm = new htd::MinimumSeparatorAlgorithm(libraryInstance);
+
+            separatorAlgorithm->setThreadCount(std::max(std::thread::hardware_concurrency(), 1u));
+
+            treeDecompositionAlgorithm->setGraphSeparatorAlgorithm(separatorAlgorithm);
+
             treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
 
             libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
@@ -645,6 +1236,13 @@ int main(int argc, const char * const * const argv)
         {
             htd::IHypertreeDecompositionAlgorithm * algorithm = libraryInstance->hypertreeDecompositionAlgorithmFactory().createInstance();
 
+            htd::HypertreeDecompositionAlgorithm * hypertreeDecompositionAlgorithm = dynamic_cast<htd::HypertreeDecompositionAlgorithm *>(algorithm);
+
+            if (hypertreeDecompositionAlgorithm != nullptr)
+            {
+                hypertreeDecompositionAlgorithm->setThreadCount(std::max(std::thread::hardware_concurrency(), 1u));
+            }
+
             htd_io::IHypertreeDecompositionExporter * exporter = nullptr;
 
             if (outputFormat == "human")
@@ -680,21 +1278,9 @@ int main(int argc, const char * const * const argv)
         }
         else
         {
-            htd_io::ITreeDecompositionExporter * exporter = nullptr;
+            htd_io::ITreeDecompositionExporter * exporter = createTreeDecompositionExporter(outputFormat);
 
-            if (outputFormat == "td")
-            {
-                exporter = new htd_io::TdFormatExporter();
-            }
-            else if (outputFormat == "human")
-            {
-                exporter = new htd_io::HumanReadableExporter();
-            }
-            else if (outputFormat == "width")
-            {
-                exporter = new htd_io::WidthExporter();
-            }
-            else
+            if (exporter == nullptr)
             {
                 std::cerr << "INVALID OUTPUT FORMAT: " << outputFormat << std::endl;
 
@@ -748,6 +1334,10 @@ int main(int argc, const char * const * const argv)
 
                             adaptiveAlgorithm->setIterationCount(iterations);
                         }
+                        else if (timeLimitOption.used())
+                        {
+                            adaptiveAlgorithm->setIterationCount((std::size_t)-1);
+                        }
                         else
                         {
                             adaptiveAlgorithm->setIterationCount(10);
@@ -786,6 +1376,10 @@ int main(int argc, const char * const * const argv)
 
                             baseAlgorithm->setIterationCount(iterations);
                         }
+                        else if (timeLimitOption.used())
+                        {
+                            baseAlgorithm->setIterationCount((std::size_t)-1);
+                        }
                         else
                         {
                             baseAlgorithm->setIterationCount(10);
@@ -811,194 +1405,204 @@ int main(int argc, const char * const * const argv)
                     libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(algorithm);
                 }
 
-                htd::GraphPreprocessor * preprocessor = new htd::GraphPreprocessor(libraryInstance);
-
-                if (std::string(preprocessingChoice.value()) == "none")
+                if (batchOption.used())
                 {
-                    preprocessor->setPreprocessingStrategy(0);
-                }
-                else if (std::string(preprocessingChoice.value()) == "simple")
-                {
-                    preprocessor->setPreprocessingStrategy(1);
-                }
-                else if (std::string(preprocessingChoice.value()) == "advanced")
-                {
-                    preprocessor->setPreprocessingStrategy(2);
-                }
-                else if (std::string(preprocessingChoice.value()) == "full")
-                {
-                    preprocessor->setPreprocessingStrategy(3);
+                    std::vector<std::string> instances;
 
-                    preprocessor->setIterationCount(256);
-                    preprocessor->setNonImprovementLimit(64);
-                }
+                    if (!readManifest(batchOption.value(), inputFormatChoice.value(), instances))
+                    {
+                        std::cerr << "INVALID MANIFEST FILE: " << batchOption.value() << std::endl;
 
-                htd_io::IGraphToTreeDecompositionProcessor * processor = nullptr;
+                        std::exit(1);
+                    }
 
-                if (std::string(inputFormatChoice.value()) == "gr")
-                {
-                    processor = new htd_io::GrFormatGraphToTreeDecompositionProcessor(libraryInstance);
-                }
-                else if (std::string(inputFormatChoice.value()) == "hgr")
-                {
-                    processor = new htd_io::HgrFormatGraphToTreeDecompositionProcessor(libraryInstance);
-                }
-                else if (std::string(inputFormatChoice.value()) == "lp")
-                {
-                    processor = new htd_io::LpFormatGraphToTreeDecompositionProcessor(libraryInstance);
+                    std::unique_ptr<htd_io::IGraphToTreeDecompositionProcessor> processor(createProcessor(libraryInstance, inputFormatChoice.value()));
+
+                    if (!processor)
+                    {
+                        std::cerr << "INVALID INPUT FORMAT: " << inputFormatChoice.value() << std::endl;
+
+                        std::exit(1);
+                    }
+
+                    std::size_t threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+                    if (threadOption.used())
+                    {
+                        threadCount = std::stoul(threadOption.value(), nullptr, 10);
+                    }
+
+                    std::string outputDirectory = outputDirectoryOption.used() ? outputDirectoryOption.value() : "";
+
+                    if (!processBatch(libraryInstance, instances, inputFormatChoice.value(), outputFormat, preprocessingChoice.value(), outputDirectory, threadCount))
+                    {
+                        ret = 1;
+                    }
+
+                    delete exporter;
                 }
                 else
                 {
-                    std::cerr << "INVALID INPUT FORMAT: " << inputFormatChoice.value() << std::endl;
+                    htd_io::IGraphToTreeDecompositionProcessor * processor = createProcessor(libraryInstance, inputFormatChoice.value());
 
-                    std::exit(1);
-                }
+                    if (processor == nullptr)
+                    {
+                        std::cerr << "INVALID INPUT FORMAT: " << inputFormatChoice.value() << std::endl;
 
-                processor->setExporter(exporter);
+                        std::exit(1);
+                    }
 
-                processor->setPreprocessor(preprocessor);
+                    processor->setExporter(exporter);
 
-                std::chrono::milliseconds::rep start =
-                    std::chrono::duration_cast<std::chrono::milliseconds>
-                        (std::chrono::system_clock::now().time_since_epoch()).count();
+                    processor->setPreprocessor(createPreprocessor(libraryInstance, preprocessingChoice.value(), std::max(std::thread::hardware_concurrency(), 1u)));
 
-                std::chrono::milliseconds::rep lastStepFinished = start;
+                    std::chrono::milliseconds::rep start =
+                        std::chrono::duration_cast<std::chrono::milliseconds>
+                            (std::chrono::system_clock::now().time_since_epoch()).count();
 
-                if (printProgressOption.used())
-                {
-                    processor->registerParsingCallback([&](htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount){
-                        lastStepFinished =
-                            std::chrono::duration_cast<std::chrono::milliseconds>
-                                (std::chrono::system_clock::now().time_since_epoch()).count();
+                    std::chrono::milliseconds::rep lastStepFinished = start;
 
-                        if (result == htd_io::ParsingResult::OK)
-                        {
-                            if (outputFormat == "td")
-                            {
-                                std::cout << "c progress PARSING COMPLETED " << lastStepFinished << std::endl;
-                            }
-                            else
-                            {
-                                std::ios::fmtflags oldflags(std::cout.flags());
-
-                                std::cout << "Parsing completed:" << std::endl;
-                                std::cout << "   Duration:         " << std::right << std::setw(15) << std::fixed << std::setprecision(3) << ((lastStepFinished - start) / 1000.0) << " s" << std::endl;
-                                std::cout << "   - - - - - - - - - - - - - - - - - -" << std::endl;
-                                std::cout << "   Vertices:         " << std::right << std::setw(17) << vertexCount << std::endl;
-                                std::cout << "   Hyperedges:       " << std::right << std::setw(17) << edgeCount << std::endl;
-                                std::cout << std::endl;
+                    if (printProgressOption.used())
+                    {
+                        processor->registerParsingCallback([&](htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount){
+                            lastStepFinished =
+                                std::chrono::duration_cast<std::chrono::milliseconds>
+                                    (std::chrono::system_clock::now().time_since_epoch()).count();
 
-                                std::cout.flags(oldflags);
-                            }
-                        }
-                        else
-                        {
-                            if (outputFormat == "td")
+                            if (result == htd_io::ParsingResult::OK)
                             {
-                                std::cout << "c progress PARSING FAILED " << lastStepFinished << std::endl;
+                                if (outputFormat == "td")
+                                {
+                                    std::cout << "c progress PARSING COMPLETED " << lastStepFinished << std::endl;
+                                }
+                                else
+                                {
+                                    std::ios::fmtflags oldflags(std::cout.flags());
+
+                                    std::cout << "Parsing completed:" << std::endl;
+                                    std::cout << "   Duration:         " << std::right << std::setw(15) << std::fixed << std::setprecision(3) << ((lastStepFinished - start) / 1000.0) << " s" << std::endl;
+                                    std::cout << "   - - - - - - - - - - - - - - - - - -" << std::endl;
+                                    std::cout << "   Vertices:         " << std::right << std::setw(17) << vertexCount << std::endl;
+                                    std::cout << "   Hyperedges:       " << std::right << std::setw(17) << edgeCount << std::endl;
+                                    std::cout << std::endl;
+
+                                    std::cout.flags(oldflags);
+                                }
                             }
                             else
                             {
-                                std::ios::fmtflags oldflags(std::cout.flags());
-
-                                std::cout << "Parsing failed:" << std::endl;
-                                std::cout << "   Duration:         " << std::right << std::setw(15) << std::fixed << std::setprecision(3) << ((lastStepFinished - start) / 1000.0) << " s" << std::endl;
-                                std::cout << "   - - - - - - - - - - - - - - - - - -" << std::endl;
-                                std::cout << std::endl;
-
-                                std::cout.flags(oldflags);
+                                if (outputFormat == "td")
+                                {
+                                    std::cout << "c progress PARSING FAILED " << lastStepFinished << std::endl;
+                                }
+                                else
+                                {
+                                    std::ios::fmtflags oldflags(std::cout.flags());
+
+                                    std::cout << "Parsing failed:" << std::endl;
+                                    std::cout << "   Duration:         " << std::right << std::setw(15) << std::fixed << std::setprecision(3) << ((lastStepFinished - start) / 1000.0) << " s" << std::endl;
+                                    std::cout << "   - - - - - - - - - - - - - - - - - -" << std::endl;
+                                    std::cout << std::endl;
+
+                                    std::cout.flags(oldflags);
+                                }
                             }
+                        });
+
+                        if (std::string(preprocessingChoice.value()) != "none")
+                        {
+                            processor->registerPreprocessingCallback([&](std::size_t vertexCount, std::size_t edgeCount){
+                                std::chrono::milliseconds::rep msSinceEpoch =
+                                    std::chrono::duration_cast<std::chrono::milliseconds>
+                                        (std::chrono::system_clock::now().time_since_epoch()).count();
+
+                                if (outputFormat == "td")
+                                {
+                                    std::cout << "c progress PREPROCESSING FINISHED " << msSinceEpoch << std::endl;
+                                }
+                                else
+                                {
+                                    std::ios::fmtflags oldflags(std::cout.flags());
+
+                                    std::cout << "Preprocessing finished:" << std::endl;
+                                    std::cout << "   Duration:         " << std::right << std::setw(15) << std::fixed << std::setprecision(3) << ((msSinceEpoch - lastStepFinished) / 1000.0) << " s" << std::endl;
+                                    std::cout << "   - - - - - - - - - - - - - - - - - -" << std::endl;
+                                    std::cout << "   Vertices:         " << std::right << std::setw(17) << vertexCount << std::endl;
+                                    std::cout << "   Hyperedges:       " << std::right << std::setw(17) << edgeCount << std::endl;
+                                    std::cout << std::endl;
+
+                                    std::cout.flags(oldflags);
+                                }
+
+                                lastStepFinished = msSinceEpoch;
+                            });
                         }
-                    });
 
-                    if (std::string(preprocessingChoice.value()) != "none")
-                    {
-                        processor->registerPreprocessingCallback([&](std::size_t vertexCount, std::size_t edgeCount){
+                        processor->registerDecompositionCallback([&](const htd::FitnessEvaluation & fitness){
                             std::chrono::milliseconds::rep msSinceEpoch =
                                 std::chrono::duration_cast<std::chrono::milliseconds>
                                     (std::chrono::system_clock::now().time_since_epoch()).count();
 
-                            if (outputFormat == "td")
-                            {
-                                std::cout << "c progress PREPROCESSING FINISHED " << msSinceEpoch << std::endl;
-                            }
-                            else
+                            if (outputFormat != "td")
                             {
                                 std::ios::fmtflags oldflags(std::cout.flags());
 
-                                std::cout << "Preprocessing finished:" << std::endl;
+                                std::cout << "New decomposition computed:" << std::endl;
                                 std::cout << "   Duration:         " << std::right << std::setw(15) << std::fixed << std::setprecision(3) << ((msSinceEpoch - lastStepFinished) / 1000.0) << " s" << std::endl;
                                 std::cout << "   - - - - - - - - - - - - - - - - - -" << std::endl;
-                                std::cout << "   Vertices:         " << std::right << std::setw(17) << vertexCount << std::endl;
-                                std::cout << "   Hyperedges:       " << std::right << std::setw(17) << edgeCount << std::endl;
-                                std::cout << std::endl;
 
                                 std::cout.flags(oldflags);
                             }
 
-                            lastStepFinished = msSinceEpoch;
-                        });
-                    }
-
-                    processor->registerDecompositionCallback([&](const htd::FitnessEvaluation & fitness){
-                        std::chrono::milliseconds::rep msSinceEpoch =
-                            std::chrono::duration_cast<std::chrono::milliseconds>
-                                (std::chrono::system_clock::now().time_since_epoch()).count();
+                            std::size_t maximumBagSize = static_cast<std::size_t>(-fitness.at(0));
 
-                        if (outputFormat != "td")
-                        {
-                            std::ios::fmtflags oldflags(std::cout.flags());
+                            if (maximumBagSize < optimalMaximumBagSize)
+                            {
+                                optimalMaximumBagSize = maximumBagSize;
 
-                            std::cout << "New decomposition computed:" << std::endl;
-                            std::cout << "   Duration:         " << std::right << std::setw(15) << std::fixed << std::setprecision(3) << ((msSinceEpoch - lastStepFinished) / 1000.0) << " s" << std::endl;
-                            std::cout << "   - - - - - - - - - - - - - - - - - -" << std::endl;
+                                std::chrono::milliseconds::rep msSinceEpoch =
+                                    std::chrono::duration_cast<std::chrono::milliseconds>
+                                        (std::chrono::system_clock::now().time_since_epoch()).count();
 
-                            std::cout.flags(oldflags);
-                        }
+                                if (outputFormat == "td")
+                                {
+                                    std::cout << "c status " << optimalMaximumBagSize << " " << msSinceEpoch << std::endl;
+                                }
+                                else
+                                {
+                                    std::ios::fmtflags oldflags(std::cout.flags());
 
-                        std::size_t maximumBagSize = static_cast<std::size_t>(-fitness.at(0));
+                                    std::cout << "   Improved Maximum Bag Size: " << std::right << std::setw(8) << optimalMaximumBagSize << std::endl;
 
-                        if (maximumBagSize < optimalMaximumBagSize)
-                        {
-                            optimalMaximumBagSize = maximumBagSize;
-
-                            std::chrono::milliseconds::rep msSinceEpoch =
-                                std::chrono::duration_cast<std::chrono::milliseconds>
-                                    (std::chrono::system_clock::now().time_since_epoch()).count();
+                                    std::cout.flags(oldflags);
+                                }
+                            }
 
-                            if (outputFormat == "td")
+                            if (outputFormat != "td")
                             {
-                                std::cout << "c status " << optimalMaximumBagSize << " " << msSinceEpoch << std::endl;
+                                std::cout << std::endl;
                             }
-                            else
-                            {
-                                std::ios::fmtflags oldflags(std::cout.flags());
 
-                                std::cout << "   Improved Maximum Bag Size: " << std::right << std::setw(8) << optimalMaximumBagSize << std::endl;
-
-                                std::cout.flags(oldflags);
-                            }
-                        }
+                            lastStepFinished = msSinceEpoch;
+                        });
+                    }
 
-                        if (outputFormat != "td")
-                        {
-                            std::cout << std::endl;
-                        }
+                    if (instanceOption.used())
+                    {
+                        processor->process(instanceOption.value(), std::cout);
+                    }
+                    else
+                    {
+                        processor->process();
+                    }
 
-                        lastStepFinished = msSinceEpoch;
-                    });
-                }
+                    if (!libraryInstance->isTerminated())
+                    {
+                        reportDeadline(*libraryInstance);
+                    }
 
-                if (instanceOption.used())
-                {
-                    processor->process(instanceOption.value(), std::cout);
-                }
-                else
-                {
-                    processor->process();
+                    delete processor;
                 }
-
-                delete processor;
             }
         }
     }
@@ -0,0 +1,177 @@
+/*
+ * File:   BidirectionalGraphNamingTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class BidirectionalGraphNamingTest : public ::testing::Test
+{
+    public:
+        BidirectionalGraphNamingTest(void)
+        {
+
+        }
+
+        virtual ~BidirectionalGraphNamingTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(BidirectionalGraphNamingTest, CheckInsertAndLookup)
+{
+    htd::BidirectionalGraphNaming<std::string, std::string> naming;
+
+    htd::vertex_t nextVertex = 1;
+
+    std::function<htd::vertex_t(void)> vertexCreationFunction = [&]() { return nextVertex++; };
+
+    ASSERT_EQ(std::make_pair((htd::id_t)1, true), naming.insertVertex("a_name_exceeding_the_small_string_buffer", vertexCreationFunction));
+    ASSERT_EQ(std::make_pair((htd::id_t)1, false), naming.insertVertex("a_name_exceeding_the_small_string_buffer", vertexCreationFunction));
+
+    ASSERT_EQ(std::vector<htd::id_t>({ 2, 1, 3, 2 }), naming.insertVertices(std::vector<std::string> { "b", "a_name_exceeding_the_small_string_buffer", "c", "b" }, vertexCreationFunction));
+
+    ASSERT_EQ((htd::vertex_t)4, nextVertex);
+    ASSERT_EQ((std::size_t)3, naming.vertexNameCount());
+
+    ASSERT_TRUE(naming.isVertexName("c"));
+    ASSERT_FALSE(naming.isVertexName("d"));
+
+    ASSERT_TRUE(naming.isNamedVertex(3));
+    ASSERT_FALSE(naming.isNamedVertex(4));
+
+    ASSERT_EQ((htd::vertex_t)2, naming.lookupVertex("b"));
+    ASSERT_EQ("c", naming.vertexName(3));
+
+    std::vector<std::string> buffer { "c", "d", "unused" };
+
+    std::vector<htd::id_t> vertices;
+
+    naming.insertVertices(buffer.begin(), buffer.begin() + 2, vertexCreationFunction, vertices);
+
+    ASSERT_EQ(std::vector<htd::id_t>({ 3, 4 }), vertices);
+    ASSERT_FALSE(naming.isVertexName("unused"));
+
+    naming.setEdgeName(7, "e");
+
+    ASSERT_EQ((std::size_t)1, naming.edgeNameCount());
+    ASSERT_EQ((htd::id_t)7, naming.lookupEdge("e"));
+    ASSERT_EQ("e", naming.edgeName(7));
+    ASSERT_FALSE(naming.isVertexName("e"));
+}
+
+TEST(BidirectionalGraphNamingTest, CheckRenameAndRemove)
+{
+    htd::BidirectionalGraphNaming<std::string, std::string> naming;
+
+    naming.setVertexName(1, "a");
+    naming.setVertexName(2, "b");
+    naming.setVertexName(3, "c");
+
+    naming.setVertexName(2, "renamed");
+
+    ASSERT_EQ((std::size_t)3, naming.vertexNameCount());
+    ASSERT_FALSE(naming.isVertexName("b"));
+    ASSERT_EQ((htd::vertex_t)2, naming.lookupVertex("renamed"));
+    ASSERT_EQ("renamed", naming.vertexName(2));
+
+    naming.removeVertexName(1);
+
+    ASSERT_EQ((std::size_t)2, naming.vertexNameCount());
+    ASSERT_FALSE(naming.isNamedVertex(1));
+    ASSERT_FALSE(naming.isVertexName("a"));
+
+    /* The storage of the removed name is reused by the next name. */
+    naming.setVertexName(4, "d");
+    naming.setVertexName(1, "a");
+
+    ASSERT_EQ((std::size_t)4, naming.vertexNameCount());
+    ASSERT_EQ((htd::vertex_t)1, naming.lookupVertex("a"));
+    ASSERT_EQ((htd::vertex_t)4, naming.lookupVertex("d"));
+    ASSERT_EQ("d", naming.vertexName(4));
+    ASSERT_EQ("c", naming.vertexName(3));
+
+    naming.setEdgeName(1, "e");
+    naming.removeEdgeName(1);
+
+    ASSERT_EQ((std::size_t)0, naming.edgeNameCount());
+    ASSERT_FALSE(naming.isEdgeName("e"));
+}
+
+TEST(BidirectionalGraphNamingTest, CheckCopy)
+{
+    htd::BidirectionalGraphNaming<std::string, std::string> naming;
+
+    naming.setVertexName(1, "a");
+    naming.setVertexName(2, "b");
+    naming.setEdgeName(1, "e");
+
+    htd::BidirectionalGraphNaming<std::string, std::string> copy(naming);
+
+    std::unique_ptr<htd::BidirectionalGraphNaming<std::string, std::string>> clone(naming.clone());
+
+    naming.setVertexName(1, "changed");
+    naming.removeVertexName(2);
+
+    for (const htd::BidirectionalGraphNaming<std::string, std::string> * current : { &copy, clone.get() })
+    {
+        ASSERT_EQ((std::size_t)2, current->vertexNameCount());
+        ASSERT_EQ((std::size_t)1, current->edgeNameCount());
+
+        ASSERT_EQ("a", current->vertexName(1));
+        ASSERT_EQ("b", current->vertexName(2));
+        ASSERT_EQ((htd::vertex_t)1, current->lookupVertex("a"));
+        ASSERT_EQ((htd::id_t)1, current->lookupEdge("e"));
+        ASSERT_FALSE(current->isVertexName("changed"));
+    }
+
+    copy = naming;
+
+    ASSERT_EQ((std::size_t)1, copy.vertexNameCount());
+    ASSERT_EQ((htd::vertex_t)1, copy.lookupVertex("changed"));
+    ASSERT_FALSE(copy.isVertexName("a"));
+    ASSERT_FALSE(copy.isNamedVertex(2));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
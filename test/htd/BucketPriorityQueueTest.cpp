@@ -0,0 +1,206 @@
+/*
+ * File:   BucketPriorityQueueTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <vector>
+
+class BucketPriorityQueueTest : public ::testing::Test
+{
+    public:
+        BucketPriorityQueueTest(void)
+        {
+
+        }
+
+        virtual ~BucketPriorityQueueTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(BucketPriorityQueueTest, CheckEmptyQueue)
+{
+    htd::BucketPriorityQueue queue(10, 5);
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ((std::size_t)0, queue.size());
+
+    for (htd::vertex_t vertex = 0; vertex < 10; ++vertex)
+    {
+        ASSERT_FALSE(queue.contains(vertex));
+    }
+
+    ASSERT_FALSE(queue.contains(10));
+}
+
+TEST(BucketPriorityQueueTest, CheckPushAndErase)
+{
+    htd::BucketPriorityQueue queue(10, 5);
+
+    queue.push(3, 2);
+    queue.push(7, 1);
+    queue.push(1, 1);
+    queue.push(4, 3);
+
+    ASSERT_FALSE(queue.empty());
+    ASSERT_EQ((std::size_t)4, queue.size());
+
+    ASSERT_TRUE(queue.contains(3));
+    ASSERT_TRUE(queue.contains(7));
+    ASSERT_FALSE(queue.contains(2));
+
+    ASSERT_EQ((std::size_t)2, queue.priority(3));
+    ASSERT_EQ((std::size_t)1, queue.topPriority());
+
+    queue.erase(7);
+
+    ASSERT_EQ((std::size_t)1, queue.selectRandomTopElement());
+    ASSERT_EQ((std::size_t)1, queue.topPriority());
+
+    queue.erase(1);
+
+    ASSERT_EQ((std::size_t)3, queue.selectRandomTopElement());
+    ASSERT_EQ((std::size_t)2, queue.topPriority());
+
+    queue.erase(3);
+
+    ASSERT_EQ((std::size_t)4, queue.selectRandomTopElement());
+    ASSERT_EQ((std::size_t)3, queue.topPriority());
+
+    queue.erase(4);
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.contains(4));
+}
+
+TEST(BucketPriorityQueueTest, CheckUpdatePriority)
+{
+    htd::BucketPriorityQueue queue(10, 5);
+
+    for (htd::vertex_t vertex = 0; vertex < 10; ++vertex)
+    {
+        queue.push(vertex, 4);
+    }
+
+    ASSERT_EQ((std::size_t)4, queue.topPriority());
+
+    queue.updatePriority(6, 0);
+
+    ASSERT_EQ((std::size_t)0, queue.topPriority());
+    ASSERT_EQ((htd::vertex_t)6, queue.selectRandomTopElement());
+
+    queue.updatePriority(6, 2);
+    queue.updatePriority(8, 2);
+
+    ASSERT_EQ((std::size_t)2, queue.topPriority());
+
+    for (std::size_t iteration = 0; iteration < 20; ++iteration)
+    {
+        htd::vertex_t vertex = queue.selectRandomTopElement();
+
+        ASSERT_TRUE(vertex == 6 || vertex == 8);
+    }
+
+    queue.updatePriority(6, 3);
+    queue.updatePriority(8, 3);
+
+    ASSERT_EQ((std::size_t)3, queue.topPriority());
+    ASSERT_EQ((std::size_t)10, queue.size());
+}
+
+TEST(BucketPriorityQueueTest, CheckOverflowBucket)
+{
+    htd::BucketPriorityQueue queue(10, 3);
+
+    queue.push(0, 100);
+    queue.push(1, 7);
+    queue.push(2, 42);
+    queue.push(3, 7);
+    queue.push(4, 2);
+
+    ASSERT_EQ((std::size_t)2, queue.topPriority());
+    ASSERT_EQ((htd::vertex_t)4, queue.selectRandomTopElement());
+
+    queue.erase(4);
+
+    ASSERT_EQ((std::size_t)7, queue.topPriority());
+
+    for (std::size_t iteration = 0; iteration < 20; ++iteration)
+    {
+        htd::vertex_t vertex = queue.selectRandomTopElement();
+
+        ASSERT_TRUE(vertex == 1 || vertex == 3);
+    }
+
+    queue.updatePriority(1, 50);
+    queue.updatePriority(3, 60);
+
+    ASSERT_EQ((std::size_t)42, queue.topPriority());
+    ASSERT_EQ((htd::vertex_t)2, queue.selectRandomTopElement());
+
+    queue.updatePriority(0, 1);
+
+    ASSERT_EQ((std::size_t)1, queue.topPriority());
+    ASSERT_EQ((htd::vertex_t)0, queue.selectRandomTopElement());
+}
+
+TEST(BucketPriorityQueueTest, CheckClear)
+{
+    htd::BucketPriorityQueue queue(10, 5);
+
+    queue.push(2, 1);
+    queue.push(5, 9);
+
+    queue.clear();
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.contains(2));
+    ASSERT_FALSE(queue.contains(5));
+
+    queue.push(5, 3);
+
+    ASSERT_EQ((std::size_t)1, queue.size());
+    ASSERT_EQ((std::size_t)3, queue.topPriority());
+    ASSERT_EQ((htd::vertex_t)5, queue.selectRandomTopElement());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,404 @@
+/*
+ * File:   CliqueMinimalSeparatorAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class CliqueMinimalSeparatorAlgorithmTest : public ::testing::Test
+{
+    public:
+        CliqueMinimalSeparatorAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~CliqueMinimalSeparatorAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Add a random graph to the given, empty graph. The graph is built from blocks of new vertices, each of them
+ *  attached to a random clique of at most three vertices of the previous blocks, such that the clique forms a
+ *  separator of the graph. Some random edges are added afterwards to destroy part of these separators again.
+ *
+ *  @param[in] graph        The graph to which the random blocks shall be added.
+ *  @param[in] generator    The random number generator which shall be used.
+ */
+static void addRandomGraph(htd::MultiHypergraph & graph, std::mt19937 & generator)
+{
+    std::size_t blockCount = 1 + generator() % 8;
+
+    for (std::size_t block = 0; block < blockCount; ++block)
+    {
+        std::vector<htd::vertex_t> vertices;
+
+        if (graph.vertexCount() > 0 && generator() % 5 != 0)
+        {
+            htd::vertex_t vertex = (htd::vertex_t)(1 + generator() % graph.vertexCount());
+
+            vertices.push_back(vertex);
+
+            for (htd::vertex_t neighbor : graph.neighbors(vertex))
+            {
+                if (vertices.size() < 3 && generator() % 2 == 0 && std::find(vertices.begin(), vertices.end(), neighbor) == vertices.end() &&
+                    std::all_of(vertices.begin(), vertices.end(), [&](htd::vertex_t member) { return graph.isNeighbor(member, neighbor); }))
+                {
+                    vertices.push_back(neighbor);
+                }
+            }
+        }
+
+        std::size_t attachmentSize = vertices.size();
+
+        std::size_t blockSize = 1 + generator() % 6;
+
+        htd::vertex_t firstVertex = graph.addVertices(blockSize);
+
+        for (htd::vertex_t vertex = firstVertex; vertex < firstVertex + blockSize; ++vertex)
+        {
+            if (!vertices.empty())
+            {
+                graph.addEdge(vertex, vertices[generator() % vertices.size()]);
+            }
+
+            vertices.push_back(vertex);
+        }
+
+        for (htd::index_t index1 = 0; index1 < vertices.size(); ++index1)
+        {
+            for (htd::index_t index2 = std::max(index1 + 1, attachmentSize); index2 < vertices.size(); ++index2)
+            {
+                if (generator() % 3 == 0)
+                {
+                    graph.addEdge(vertices[index1], vertices[index2]);
+                }
+            }
+        }
+    }
+
+    if (generator() % 3 == 0)
+    {
+        std::size_t edgeCount = 1 + generator() % 3;
+
+        for (std::size_t index = 0; index < edgeCount; ++index)
+        {
+            graph.addEdge((htd::vertex_t)(1 + generator() % graph.vertexCount()), (htd::vertex_t)(1 + generator() % graph.vertexCount()));
+        }
+    }
+}
+
+TEST(CliqueMinimalSeparatorAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_NE(separator, nullptr);
+
+    EXPECT_TRUE(separator->empty());
+
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    algorithm.computeAtoms(graph, atoms, separators);
+
+    EXPECT_TRUE(atoms.empty());
+
+    EXPECT_TRUE(separators.empty());
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(CliqueMinimalSeparatorAlgorithmTest, CheckCycle)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+    graph.addEdge(5, 1);
+
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_NE(separator, nullptr);
+
+    EXPECT_TRUE(separator->empty());
+
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    algorithm.computeAtoms(graph, atoms, separators);
+
+    ASSERT_EQ((std::size_t)1, atoms.size());
+    ASSERT_EQ((std::size_t)1, separators.size());
+
+    EXPECT_EQ(graph.vertexVector(), atoms[0]);
+
+    EXPECT_TRUE(separators[0].empty());
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(CliqueMinimalSeparatorAlgorithmTest, CheckCyclesSharingEdge)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(7);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 1);
+
+    graph.addEdge(3, 5);
+    graph.addEdge(5, 6);
+    graph.addEdge(6, 7);
+    graph.addEdge(7, 4);
+
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_NE(separator, nullptr);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 3, 4 }), *separator);
+
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    algorithm.computeAtoms(graph, atoms, separators);
+
+    ASSERT_EQ((std::size_t)2, atoms.size());
+    ASSERT_EQ((std::size_t)2, separators.size());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 3, 4 }), separators[0]);
+
+    EXPECT_TRUE(separators[1].empty());
+
+    std::sort(atoms.begin(), atoms.end());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4 }), atoms[0]);
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 3, 4, 5, 6, 7 }), atoms[1]);
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(CliqueMinimalSeparatorAlgorithmTest, CheckDisconnectedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 1);
+
+    graph.addEdge(4, 5);
+
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    algorithm.computeAtoms(graph, atoms, separators);
+
+    ASSERT_EQ((std::size_t)2, atoms.size());
+
+    EXPECT_TRUE(separators[0].empty());
+    EXPECT_TRUE(separators[1].empty());
+
+    std::sort(atoms.begin(), atoms.end());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), atoms[0]);
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 4, 5 }), atoms[1]);
+
+    delete libraryInstance;
+}
+
+TEST(CliqueMinimalSeparatorAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    std::mt19937 generator(13);
+
+    std::size_t nonEmptySeparatorCount = 0;
+
+    for (std::size_t iteration = 0; iteration < 200; ++iteration)
+    {
+        htd::MultiHypergraph graph(libraryInstance);
+
+        addRandomGraph(graph, generator);
+
+        std::vector<std::vector<htd::vertex_t>> atoms;
+
+        std::vector<std::vector<htd::vertex_t>> separators;
+
+        algorithm.computeAtoms(graph, atoms, separators);
+
+        ASSERT_FALSE(atoms.empty());
+
+        ASSERT_EQ(atoms.size(), separators.size());
+
+        EXPECT_TRUE(separators.back().empty());
+
+        /* The vertices which were split off by one of the previous atoms. */
+        std::vector<bool> removed(graph.vertexCount() + 1, false);
+
+        for (htd::index_t index = 0; index < atoms.size(); ++index)
+        {
+            const std::vector<htd::vertex_t> & atom = atoms[index];
+
+            const std::vector<htd::vertex_t> & separator = separators[index];
+
+            ASSERT_TRUE(std::is_sorted(atom.begin(), atom.end()));
+            ASSERT_TRUE(std::is_sorted(separator.begin(), separator.end()));
+
+            ASSERT_TRUE(std::includes(atom.begin(), atom.end(), separator.begin(), separator.end()));
+
+            if (!separator.empty())
+            {
+                ++nonEmptySeparatorCount;
+            }
+
+            for (auto it = separator.begin(); it != separator.end(); ++it)
+            {
+                for (auto it2 = it + 1; it2 != separator.end(); ++it2)
+                {
+                    EXPECT_TRUE(graph.isNeighbor(*it, *it2));
+                }
+            }
+
+            std::vector<htd::vertex_t> splitVertices;
+
+            std::set_difference(atom.begin(), atom.end(), separator.begin(), separator.end(), std::back_inserter(splitVertices));
+
+            EXPECT_FALSE(splitVertices.empty());
+
+            for (htd::vertex_t vertex : atom)
+            {
+                EXPECT_FALSE(removed[vertex]);
+            }
+
+            for (htd::vertex_t vertex : splitVertices)
+            {
+                for (htd::vertex_t neighbor : graph.neighbors(vertex))
+                {
+                    EXPECT_TRUE(removed[neighbor] || std::binary_search(atom.begin(), atom.end(), neighbor));
+                }
+            }
+
+            for (htd::vertex_t vertex : splitVertices)
+            {
+                removed[vertex] = true;
+            }
+        }
+
+        for (htd::vertex_t vertex : graph.vertices())
+        {
+            EXPECT_TRUE(removed[vertex]);
+        }
+
+        for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+        {
+            const std::vector<htd::vertex_t> & elements = hyperedge.sortedElements();
+
+            EXPECT_TRUE(std::any_of(atoms.begin(), atoms.end(), [&](const std::vector<htd::vertex_t> & atom) { return std::includes(atom.begin(), atom.end(), elements.begin(), elements.end()); }));
+        }
+
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(3);
+
+        htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+        htd::BucketEliminationTreeDecompositionAlgorithm decompositionAlgorithm(libraryInstance);
+
+        htd::ITreeDecomposition * decomposition = decompositionAlgorithm.computeDecomposition(graph, *preprocessedGraph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        delete decomposition;
+
+        delete preprocessedGraph;
+    }
+
+    EXPECT_GT(nonEmptySeparatorCount, (std::size_t)100);
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
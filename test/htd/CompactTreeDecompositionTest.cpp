@@ -0,0 +1,217 @@
+/*
+ * File:   CompactTreeDecompositionTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <memory>
+#include <vector>
+
+class CompactTreeDecompositionTest : public ::testing::Test
+{
+    public:
+        CompactTreeDecompositionTest(void)
+        {
+
+        }
+
+        virtual ~CompactTreeDecompositionTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(CompactTreeDecompositionTest, CheckBagContent)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::CompactTreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot(std::vector<htd::vertex_t> { 1, 2, 3 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t child1 = decomposition.addChild(root, std::vector<htd::vertex_t> { 2, 3, 4 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t child2 = decomposition.addChild(root);
+    htd::vertex_t parent = decomposition.addParent(root);
+
+    decomposition.mutableBagContent(child2) = std::vector<htd::vertex_t> { 1, 5 };
+    decomposition.mutableBagContent(parent) = std::vector<htd::vertex_t> { 1 };
+
+    ASSERT_EQ((std::size_t)4, decomposition.vertexCount());
+
+    EXPECT_EQ(parent, decomposition.root());
+
+    EXPECT_EQ((std::size_t)3, decomposition.bagSize(root));
+    EXPECT_EQ((std::size_t)3, decomposition.bagSize(child1));
+    EXPECT_EQ((std::size_t)2, decomposition.bagSize(child2));
+    EXPECT_EQ((std::size_t)1, decomposition.bagSize(parent));
+
+    EXPECT_EQ((std::size_t)1, decomposition.minimumBagSize());
+    EXPECT_EQ((std::size_t)3, decomposition.maximumBagSize());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), decomposition.bagContent(child1));
+
+    std::vector<htd::vertex_t> introducedVertices;
+    std::vector<htd::vertex_t> forgottenVertices;
+
+    decomposition.copyIntroducedVerticesTo(child1, introducedVertices);
+    decomposition.copyForgottenVerticesTo(parent, forgottenVertices);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), introducedVertices);
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 2, 3 }), forgottenVertices);
+
+    EXPECT_TRUE(decomposition.isJoinNode(root));
+
+    delete libraryInstance;
+}
+
+TEST(CompactTreeDecompositionTest, CheckRemoval)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::CompactTreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot(std::vector<htd::vertex_t> { 1 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t child1 = decomposition.addChild(root, std::vector<htd::vertex_t> { 1, 2 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t child2 = decomposition.addChild(child1, std::vector<htd::vertex_t> { 2, 3 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t child3 = decomposition.addChild(root, std::vector<htd::vertex_t> { 1, 4 }, htd::FilteredHyperedgeCollection());
+
+    decomposition.removeSubtree(child1);
+
+    ASSERT_EQ((std::size_t)2, decomposition.vertexCount());
+
+    EXPECT_FALSE(decomposition.isVertex(child1));
+    EXPECT_FALSE(decomposition.isVertex(child2));
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 4 }), decomposition.bagContent(child3));
+
+    htd::vertex_t child4 = decomposition.addChild(root);
+
+    EXPECT_EQ((std::size_t)0, decomposition.bagSize(child4));
+
+    decomposition.removeVertex(root);
+    decomposition.removeVertex(child3);
+    decomposition.removeVertex(child4);
+
+    ASSERT_EQ((std::size_t)0, decomposition.vertexCount());
+
+    root = decomposition.insertRoot();
+
+    EXPECT_EQ((std::size_t)0, decomposition.bagSize(root));
+
+    delete libraryInstance;
+}
+
+TEST(CompactTreeDecompositionTest, CheckCopy)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecomposition original(libraryInstance);
+
+    htd::vertex_t root = original.insertRoot(std::vector<htd::vertex_t> { 1, 2 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t child = original.addChild(root, std::vector<htd::vertex_t> { 2, 3 }, htd::FilteredHyperedgeCollection());
+
+    htd::CompactTreeDecomposition copy(static_cast<const htd::ITreeDecomposition &>(original));
+
+    ASSERT_EQ((std::size_t)2, copy.vertexCount());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), copy.bagContent(root));
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 2, 3 }), copy.bagContent(child));
+
+    std::unique_ptr<htd::CompactTreeDecomposition> clone(copy.clone());
+
+    clone->mutableBagContent(child).push_back(4);
+
+    EXPECT_EQ((std::size_t)2, copy.bagSize(child));
+    EXPECT_EQ((std::size_t)3, clone->bagSize(child));
+
+    htd::CompactTreeDecomposition tree(static_cast<const htd::ITree &>(original));
+
+    ASSERT_EQ((std::size_t)2, tree.vertexCount());
+
+    EXPECT_EQ((std::size_t)0, tree.bagSize(root));
+    EXPECT_EQ((std::size_t)0, tree.bagSize(child));
+
+    tree = *clone;
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), tree.bagContent(child));
+
+    delete libraryInstance;
+}
+
+TEST(CompactTreeDecompositionTest, CheckFactoryConstructionTemplate)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->treeDecompositionFactory().setConstructionTemplate(new htd::CompactTreeDecomposition(libraryInstance));
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    for (htd::index_t index = 0; index < 10; ++index)
+    {
+        graph.addVertex();
+    }
+
+    for (htd::vertex_t vertex = 1; vertex < 10; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+        graph.addEdge(vertex, (vertex + 3) % 10 + 1);
+    }
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_NE(dynamic_cast<htd::CompactTreeDecomposition *>(decomposition), nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
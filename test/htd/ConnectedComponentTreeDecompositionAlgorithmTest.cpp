@@ -0,0 +1,589 @@
+/*
+ * File:   ConnectedComponentTreeDecompositionAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+class ConnectedComponentTreeDecompositionAlgorithmTest : public ::testing::Test
+{
+    public:
+        ConnectedComponentTreeDecompositionAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~ConnectedComponentTreeDecompositionAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Create a graph consisting of several cycles with chords, a few isolated vertices and a hyperedge of size one.
+ */
+static void createDisconnectedGraph(htd::MultiHypergraph & graph)
+{
+    for (std::size_t component = 0; component < 6; ++component)
+    {
+        std::size_t size = 4 + 3 * component;
+
+        htd::vertex_t first = graph.addVertices(size);
+
+        for (htd::vertex_t offset = 0; offset < size; ++offset)
+        {
+            graph.addEdge(first + offset, first + (offset + 1) % size);
+
+            if (offset % 3 == 0)
+            {
+                graph.addEdge(first + offset, first + (offset + size / 2) % size);
+            }
+        }
+
+        graph.addVertex();
+    }
+
+    graph.addEdge(std::vector<htd::vertex_t> { graph.addVertex() });
+}
+
+static bool isInducedEdgeCoverValid(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition)
+{
+    std::vector<htd::id_t> coveredHyperedges;
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+
+        for (const htd::Hyperedge & hyperedge : decomposition.inducedHyperedges(node))
+        {
+            for (htd::vertex_t vertex : hyperedge)
+            {
+                if (!std::binary_search(bag.begin(), bag.end(), vertex))
+                {
+                    return false;
+                }
+            }
+
+            coveredHyperedges.push_back(hyperedge.id());
+        }
+    }
+
+    std::sort(coveredHyperedges.begin(), coveredHyperedges.end());
+
+    coveredHyperedges.erase(std::unique(coveredHyperedges.begin(), coveredHyperedges.end()), coveredHyperedges.end());
+
+    return coveredHyperedges.size() == graph.edgeCount();
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance));
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_EQ(decomposition->vertexCount(), (std::size_t)1);
+
+    EXPECT_EQ(decomposition->bagSize(decomposition->root()), (std::size_t)0);
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultConnectedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::vertex_t vertex1 = graph.addVertex();
+    htd::vertex_t vertex2 = graph.addVertex();
+    htd::vertex_t vertex3 = graph.addVertex();
+
+    graph.addEdge(vertex1, vertex2);
+    graph.addEdge(vertex2, vertex3);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance));
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    EXPECT_EQ(decomposition->maximumBagSize(), (std::size_t)2);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+    EXPECT_TRUE(isInducedEdgeCoverValid(graph, *decomposition));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createDisconnectedGraph(graph);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance));
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+    EXPECT_TRUE(isInducedEdgeCoverValid(graph, *decomposition));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultWithMultipleThreads)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createDisconnectedGraph(graph);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance));
+
+    algorithm.setThreadCount(4);
+
+    EXPECT_EQ(algorithm.threadCount(), (std::size_t)4);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm * clone = algorithm.clone();
+
+    EXPECT_EQ(clone->threadCount(), (std::size_t)4);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    for (htd::ConnectedComponentTreeDecompositionAlgorithm * currentAlgorithm : { &algorithm, clone })
+    {
+        htd::ITreeDecomposition * decomposition = currentAlgorithm->computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        EXPECT_TRUE(isInducedEdgeCoverValid(graph, *decomposition));
+
+        delete decomposition;
+    }
+
+    delete clone;
+
+    delete libraryInstance;
+}
+
+class BagSizeLabelingFunction : public htd::ILabelingFunction
+{
+    public:
+        BagSizeLabelingFunction(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+        {
+
+        }
+
+        virtual ~BagSizeLabelingFunction()
+        {
+
+        }
+
+        std::string name() const override
+        {
+            return "BAG_SIZE";
+        }
+
+        htd::ILabel * computeLabel(const std::vector<htd::vertex_t> & vertices, const htd::ILabelCollection & labels) const override
+        {
+            HTD_UNUSED(labels)
+
+            return new htd::Label<std::size_t>(vertices.size());
+        }
+
+        htd::ILabel * computeLabel(const htd::ConstCollection<htd::vertex_t> & vertices, const htd::ILabelCollection & labels) const override
+        {
+            HTD_UNUSED(labels)
+
+            return new htd::Label<std::size_t>(vertices.size());
+        }
+
+        const htd::LibraryInstance * managementInstance(void) const noexcept override
+        {
+            return managementInstance_;
+        }
+
+        void setManagementInstance(const htd::LibraryInstance * const manager) override
+        {
+            HTD_ASSERT(manager != nullptr)
+
+            managementInstance_ = manager;
+        }
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        BagSizeLabelingFunction * clone(void) const override
+        {
+            return new BagSizeLabelingFunction(managementInstance_);
+        }
+#else
+        BagSizeLabelingFunction * clone(void) const
+        {
+            return new BagSizeLabelingFunction(managementInstance_);
+        }
+
+        htd::ILabelingFunction * cloneLabelingFunction(void) const override
+        {
+            return new BagSizeLabelingFunction(managementInstance_);
+        }
+
+        htd::IDecompositionManipulationOperation * cloneDecompositionManipulationOperation(void) const override
+        {
+            return new BagSizeLabelingFunction(managementInstance_);
+        }
+#endif
+
+    private:
+        const htd::LibraryInstance * managementInstance_;
+};
+
+/**
+ *  Labeling function whose labels depend on the identifiers of the vertices and not only on the size of the bags.
+ */
+class BagSumLabelingFunction : public htd::ILabelingFunction
+{
+    public:
+        BagSumLabelingFunction(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+        {
+
+        }
+
+        virtual ~BagSumLabelingFunction()
+        {
+
+        }
+
+        std::string name() const override
+        {
+            return "BAG_SUM";
+        }
+
+        htd::ILabel * computeLabel(const std::vector<htd::vertex_t> & vertices, const htd::ILabelCollection & labels) const override
+        {
+            HTD_UNUSED(labels)
+
+            return new htd::Label<std::size_t>(std::accumulate(vertices.begin(), vertices.end(), (std::size_t)0));
+        }
+
+        htd::ILabel * computeLabel(const htd::ConstCollection<htd::vertex_t> & vertices, const htd::ILabelCollection & labels) const override
+        {
+            HTD_UNUSED(labels)
+
+            return new htd::Label<std::size_t>(std::accumulate(vertices.begin(), vertices.end(), (std::size_t)0));
+        }
+
+        const htd::LibraryInstance * managementInstance(void) const noexcept override
+        {
+            return managementInstance_;
+        }
+
+        void setManagementInstance(const htd::LibraryInstance * const manager) override
+        {
+            HTD_ASSERT(manager != nullptr)
+
+            managementInstance_ = manager;
+        }
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        BagSumLabelingFunction * clone(void) const override
+        {
+            return new BagSumLabelingFunction(managementInstance_);
+        }
+#else
+        BagSumLabelingFunction * clone(void) const
+        {
+            return new BagSumLabelingFunction(managementInstance_);
+        }
+
+        htd::ILabelingFunction * cloneLabelingFunction(void) const override
+        {
+            return new BagSumLabelingFunction(managementInstance_);
+        }
+
+        htd::IDecompositionManipulationOperation * cloneDecompositionManipulationOperation(void) const override
+        {
+            return new BagSumLabelingFunction(managementInstance_);
+        }
+#endif
+
+    private:
+        const htd::LibraryInstance * managementInstance_;
+};
+
+static std::size_t bagSum(const htd::ITreeDecomposition & decomposition, htd::vertex_t node)
+{
+    const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+
+    return std::accumulate(bag.begin(), bag.end(), (std::size_t)0);
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraphWithLabelingFunction)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createDisconnectedGraph(graph);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance));
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, 1, new BagSizeLabelingFunction(libraryInstance));
+
+    ASSERT_NE(decomposition, nullptr);
+
+    for (htd::vertex_t vertex : decomposition->vertices())
+    {
+        ASSERT_EQ(decomposition->bagSize(vertex), htd::accessLabel<std::size_t>(decomposition->vertexLabel("BAG_SIZE", vertex)));
+    }
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraphWithLabelingFunctionOfBaseAlgorithm)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createDisconnectedGraph(graph);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance, { new BagSumLabelingFunction(libraryInstance) }));
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm * clone = algorithm.clone();
+
+    htd::TreeDecompositionVerifier verifier;
+
+    for (htd::ConnectedComponentTreeDecompositionAlgorithm * currentAlgorithm : { &algorithm, clone })
+    {
+        htd::ITreeDecomposition * decomposition = currentAlgorithm->computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        /* The labels are computed from the vertices of the input graph, also for the nodes not created by the base algorithm. */
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            ASSERT_TRUE(decomposition->isLabeledVertex("BAG_SUM", vertex));
+
+            ASSERT_EQ(bagSum(*decomposition, vertex), htd::accessLabel<std::size_t>(decomposition->vertexLabel("BAG_SUM", vertex)));
+        }
+
+        delete decomposition;
+    }
+
+    delete clone;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraphWithNormalizationOfBaseAlgorithm)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createDisconnectedGraph(graph);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm =
+        new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance,
+                                                              { new BagSumLabelingFunction(libraryInstance),
+                                                                new htd::NormalizationOperation(libraryInstance, true, false, false, false) });
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, baseAlgorithm);
+
+    algorithm.setThreadCount(2);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+    EXPECT_TRUE(isInducedEdgeCoverValid(graph, *decomposition));
+
+    EXPECT_EQ(decomposition->bagSize(decomposition->root()), (std::size_t)0);
+
+    std::size_t emptyJoinNodeCount = 0;
+
+    for (htd::vertex_t vertex : decomposition->vertices())
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
+
+        ASSERT_TRUE(decomposition->isLabeledVertex("BAG_SUM", vertex));
+
+        ASSERT_EQ(bagSum(*decomposition, vertex), htd::accessLabel<std::size_t>(decomposition->vertexLabel("BAG_SUM", vertex)));
+
+        /* The nodes joining the decompositions of the components are empty join nodes. */
+        if (bag.empty() && decomposition->childCount(vertex) > 1)
+        {
+            ++emptyJoinNodeCount;
+        }
+
+        if (decomposition->childCount(vertex) > 1)
+        {
+            ASSERT_EQ(decomposition->childCount(vertex), (std::size_t)2);
+
+            for (htd::vertex_t child : decomposition->children(vertex))
+            {
+                ASSERT_EQ(bag, decomposition->bagContent(child));
+            }
+        }
+        else
+        {
+            for (htd::vertex_t child : decomposition->children(vertex))
+            {
+                const std::vector<htd::vertex_t> & childBag = decomposition->bagContent(child);
+
+                std::vector<htd::vertex_t> difference;
+
+                std::set_symmetric_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(difference));
+
+                ASSERT_LE(difference.size(), (std::size_t)1);
+            }
+        }
+    }
+
+    /* The graph has thirteen connected components. */
+    EXPECT_EQ(emptyJoinNodeCount, (std::size_t)12);
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraphWithPreprocessedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createDisconnectedGraph(graph);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy((std::size_t)-1);
+
+    std::unique_ptr<htd::IPreprocessedGraph> preprocessedGraph(preprocessor.prepare(graph));
+
+    ASSERT_NE(preprocessedGraph.get(), nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> bags;
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance, { new BagSumLabelingFunction(libraryInstance) }));
+
+        algorithm.setThreadCount(threadCount);
+
+        htd::seedThreadLocalRandomNumberGenerator(42);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+        htd::resetThreadLocalRandomNumberGenerator();
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        EXPECT_TRUE(isInducedEdgeCoverValid(graph, *decomposition));
+
+        bags.emplace_back();
+
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            ASSERT_EQ(bagSum(*decomposition, vertex), htd::accessLabel<std::size_t>(decomposition->vertexLabel("BAG_SUM", vertex)));
+
+            bags.back().push_back(decomposition->bagContent(vertex));
+        }
+
+        delete decomposition;
+    }
+
+    /* The decomposition of each component is seeded by its index, so the result does not depend on the number of threads. */
+    EXPECT_EQ(bags[0], bags[1]);
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
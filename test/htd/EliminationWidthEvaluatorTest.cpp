@@ -0,0 +1,249 @@
+/*
+ * File:   EliminationWidthEvaluatorTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+class EliminationWidthEvaluatorTest : public ::testing::Test
+{
+    public:
+        EliminationWidthEvaluatorTest(void)
+        {
+
+        }
+
+        virtual ~EliminationWidthEvaluatorTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the maximum bag size of the decomposition induced by an elimination ordering by explicitly eliminating
+ *  the vertices one after another.
+ */
+std::size_t computeMaximumBagSizeNaively(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood(graph.vertexCount() + htd::Vertex::FIRST);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        graph.copyNeighborsTo(vertex, neighborhood[vertex]);
+
+        neighborhood[vertex].erase(std::remove(neighborhood[vertex].begin(), neighborhood[vertex].end(), vertex), neighborhood[vertex].end());
+    }
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        ret = std::max(ret, currentNeighborhood.size() + 1);
+
+        for (htd::vertex_t neighbor : currentNeighborhood)
+        {
+            std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+
+            otherNeighborhood.erase(std::remove(otherNeighborhood.begin(), otherNeighborhood.end(), vertex), otherNeighborhood.end());
+
+            for (htd::vertex_t otherNeighbor : currentNeighborhood)
+            {
+                if (otherNeighbor != neighbor && std::find(otherNeighborhood.begin(), otherNeighborhood.end(), otherNeighbor) == otherNeighborhood.end())
+                {
+                    otherNeighborhood.push_back(otherNeighbor);
+                }
+            }
+        }
+
+        currentNeighborhood.clear();
+    }
+
+    return ret;
+}
+
+TEST(EliminationWidthEvaluatorTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::EliminationWidthEvaluator evaluator;
+
+    EXPECT_EQ((std::size_t)0, evaluator.maximumBagSize(graph, std::vector<htd::vertex_t>()));
+
+    delete libraryInstance;
+}
+
+TEST(EliminationWidthEvaluatorTest, CheckSimpleGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::EliminationWidthEvaluator evaluator;
+
+    htd::MultiHypergraph cycle(libraryInstance, 5);
+
+    for (htd::vertex_t vertex = 1; vertex <= 5; ++vertex)
+    {
+        cycle.addEdge(vertex, vertex % 5 + 1);
+    }
+
+    EXPECT_EQ((std::size_t)3, evaluator.maximumBagSize(cycle, std::vector<htd::vertex_t> { 1, 2, 3, 4, 5 }));
+    EXPECT_EQ((std::size_t)3, evaluator.maximumBagSize(cycle, std::vector<htd::vertex_t> { 3, 1, 5, 2, 4 }));
+
+    htd::MultiHypergraph star(libraryInstance, 6);
+
+    for (htd::vertex_t vertex = 2; vertex <= 6; ++vertex)
+    {
+        star.addEdge((htd::vertex_t)1, vertex);
+    }
+
+    EXPECT_EQ((std::size_t)6, evaluator.maximumBagSize(star, std::vector<htd::vertex_t> { 1, 2, 3, 4, 5, 6 }));
+    EXPECT_EQ((std::size_t)2, evaluator.maximumBagSize(star, std::vector<htd::vertex_t> { 2, 3, 4, 5, 6, 1 }));
+
+    htd::MultiHypergraph hypergraph(libraryInstance, 6);
+
+    hypergraph.addEdge(std::vector<htd::vertex_t> { 1, 2, 3, 4 });
+    hypergraph.addEdge((htd::vertex_t)4, (htd::vertex_t)5);
+    hypergraph.addEdge((htd::vertex_t)6, (htd::vertex_t)6);
+
+    EXPECT_EQ((std::size_t)4, evaluator.maximumBagSize(hypergraph, std::vector<htd::vertex_t> { 6, 5, 4, 3, 2, 1 }));
+    EXPECT_EQ((std::size_t)5, evaluator.maximumBagSize(hypergraph, std::vector<htd::vertex_t> { 4, 1, 2, 3, 5, 6 }));
+
+    delete libraryInstance;
+}
+
+TEST(EliminationWidthEvaluatorTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::EliminationWidthEvaluator evaluator;
+
+    std::mt19937 generator(7);
+
+    for (std::size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::size_t vertexCount = 5 + generator() % 40;
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+        std::size_t edgeCount = generator() % (3 * vertexCount);
+
+        for (std::size_t index = 0; index < edgeCount; ++index)
+        {
+            std::vector<htd::vertex_t> elements(1 + generator() % 3);
+
+            for (htd::vertex_t & element : elements)
+            {
+                element = (htd::vertex_t)(1 + generator() % vertexCount);
+            }
+
+            graph.addEdge(elements);
+        }
+
+        std::vector<htd::vertex_t> ordering;
+
+        graph.copyVerticesTo(ordering);
+
+        std::shuffle(ordering.begin(), ordering.end(), generator);
+
+        EXPECT_EQ(computeMaximumBagSizeNaively(graph, ordering), evaluator.maximumBagSize(graph, ordering));
+    }
+
+    delete libraryInstance;
+}
+
+TEST(EliminationWidthEvaluatorTest, CheckConsistencyWithDecompositions)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::EliminationWidthEvaluator evaluator;
+
+    std::mt19937 generator(11);
+
+    for (std::size_t iteration = 0; iteration < 20; ++iteration)
+    {
+        std::size_t vertexCount = 10 + generator() % 50;
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+        for (std::size_t index = 0; index < 2 * vertexCount; ++index)
+        {
+            graph.addEdge((htd::vertex_t)(1 + generator() % vertexCount), (htd::vertex_t)(1 + generator() % vertexCount));
+        }
+
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(2);
+
+        std::unique_ptr<htd::IPreprocessedGraph> preprocessedGraph(preprocessor.prepare(graph));
+
+        htd::MinDegreeOrderingAlgorithm orderingAlgorithm(libraryInstance);
+
+        std::unique_ptr<htd::IWidthLimitedVertexOrdering> ordering(orderingAlgorithm.computeOrdering(graph, *preprocessedGraph, (std::size_t)-1, 1));
+
+        ASSERT_NE(nullptr, ordering.get());
+
+        EXPECT_EQ(ordering->maximumBagSize(), evaluator.maximumBagSize(*preprocessedGraph, ordering->sequence()));
+
+        htd::NaturalOrderingAlgorithm naturalOrderingAlgorithm(libraryInstance);
+
+        std::unique_ptr<htd::IVertexOrdering> naturalOrdering(naturalOrderingAlgorithm.computeOrdering(graph));
+
+        htd::BucketEliminationGraphDecompositionAlgorithm algorithm(libraryInstance);
+
+        algorithm.setOrderingAlgorithm(new htd::NaturalOrderingAlgorithm(libraryInstance));
+
+        std::unique_ptr<htd::IGraphDecomposition> decomposition(algorithm.computeDecomposition(graph));
+
+        ASSERT_NE(nullptr, decomposition.get());
+
+        EXPECT_EQ(decomposition->maximumBagSize(), evaluator.maximumBagSize(graph, *naturalOrdering));
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,298 @@
+/*
+ * File:   FormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class FormatImporterTest : public ::testing::Test
+{
+    public:
+        FormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~FormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+static htd::IMultiGraph * importGr(const htd::LibraryInstance * const manager, const std::string & content)
+{
+    htd_io::GrFormatImporter importer(manager);
+
+    std::istringstream stream(content);
+
+    return importer.import(stream);
+}
+
+static htd::IMultiHypergraph * importHgr(const htd::LibraryInstance * const manager, const std::string & content)
+{
+    htd_io::HgrFormatImporter importer(manager);
+
+    std::istringstream stream(content);
+
+    return importer.import(stream);
+}
+
+TEST(FormatImporterTest, CheckInputCursor)
+{
+    std::string content = "p tw 12 345\r\nc comment\n\n18446744073709551616";
+
+    htd_io::InputCursor cursor(content.data(), content.data() + content.size());
+
+    std::size_t value1 = 0;
+    std::size_t value2 = 0;
+
+    ASSERT_FALSE(cursor.parseUnsigned(value1));
+    ASSERT_TRUE(cursor.consume("p tw "));
+    ASSERT_TRUE(cursor.parseUnsigned(value1));
+    ASSERT_TRUE(cursor.consume(' '));
+    ASSERT_TRUE(cursor.parseUnsigned(value2));
+    ASSERT_TRUE(cursor.atLineEnd());
+
+    ASSERT_EQ((std::size_t)12, value1);
+    ASSERT_EQ((std::size_t)345, value2);
+
+    cursor.skipLine();
+
+    ASSERT_EQ('c', cursor.peek());
+    ASSERT_EQ(std::string("c comment"), std::string(cursor.position(), cursor.lineEnd()));
+
+    cursor.skipLine();
+
+    ASSERT_TRUE(cursor.atLineEnd());
+
+    cursor.skipLine();
+
+    ASSERT_FALSE(cursor.parseUnsigned(value1));
+    ASSERT_EQ((std::size_t)12, value1);
+
+    cursor.skipLine();
+
+    ASSERT_TRUE(cursor.atEnd());
+    ASSERT_EQ('\0', cursor.peek());
+}
+
+TEST(FormatImporterTest, CheckGrImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::unique_ptr<htd::IMultiGraph> graph(importGr(libraryInstance, "c example\np tw 4 3\r\n1 2\r\nc inner comment\n2 3\n3 4"));
+
+    ASSERT_NE(nullptr, graph.get());
+
+    ASSERT_EQ((std::size_t)4, graph->vertexCount());
+    ASSERT_EQ((std::size_t)3, graph->edgeCount());
+
+    ASSERT_TRUE(graph->isEdge(1, 2));
+    ASSERT_TRUE(graph->isEdge(2, 3));
+    ASSERT_TRUE(graph->isEdge(3, 4));
+    ASSERT_FALSE(graph->isEdge(1, 4));
+
+    delete libraryInstance;
+}
+
+TEST(FormatImporterTest, CheckGrImportErrors)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    ASSERT_EQ(nullptr, importGr(libraryInstance, ""));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "c only a comment\n"));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "p td 2 1\n1 2\n"));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "p tw 2\n1 2\n"));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "p tw 2 1\n1 2\n\n"));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "p tw 2 1\n1  2\n"));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "p tw 2 1\n1 x\n"));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "p tw 2 1\n1 3\n"));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "p tw 2 1\n0 2\n"));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "p tw 3 2\n1 2\n"));
+    ASSERT_EQ(nullptr, importGr(libraryInstance, "p tw 3 1\n1 2\n2 3\n"));
+
+    delete libraryInstance;
+}
+
+TEST(FormatImporterTest, CheckGrImportFromFile)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::string path = "FormatImporterTest.gr";
+
+    {
+        std::ofstream stream(path);
+
+        stream << "p tw 3 2\n1 2\n2 3\n";
+    }
+
+    htd_io::GrFormatImporter importer(libraryInstance);
+
+    std::unique_ptr<htd::IMultiGraph> graph(importer.import(path));
+
+    std::remove(path.c_str());
+
+    ASSERT_NE(nullptr, graph.get());
+
+    ASSERT_EQ((std::size_t)3, graph->vertexCount());
+    ASSERT_EQ((std::size_t)2, graph->edgeCount());
+
+    ASSERT_TRUE(graph->isEdge(1, 2));
+    ASSERT_TRUE(graph->isEdge(2, 3));
+
+    ASSERT_EQ(nullptr, importer.import(path));
+
+    delete libraryInstance;
+}
+
+TEST(FormatImporterTest, CheckHgrImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::unique_ptr<htd::IMultiHypergraph> graph(importHgr(libraryInstance, "p tw 5 3\n3 1 2\nc comment\n4\r\n5 4 3 2 1\n"));
+
+    ASSERT_NE(nullptr, graph.get());
+
+    ASSERT_EQ((std::size_t)5, graph->vertexCount());
+    ASSERT_EQ((std::size_t)3, graph->edgeCount());
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 1, 2 }), graph->hyperedgeAtPosition(0).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 4 }), graph->hyperedgeAtPosition(1).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 5, 4, 3, 2, 1 }), graph->hyperedgeAtPosition(2).elements());
+
+    ASSERT_EQ(nullptr, importHgr(libraryInstance, "p tw 3 1\n1 2 \n"));
+    ASSERT_EQ(nullptr, importHgr(libraryInstance, "p tw 3 1\n1 4\n"));
+    ASSERT_EQ(nullptr, importHgr(libraryInstance, "p tw 3 2\n1 2 3\n"));
+    ASSERT_EQ(nullptr, importHgr(libraryInstance, "p tw 3 1\n\n1 2 3\n"));
+
+    delete libraryInstance;
+}
+
+TEST(FormatImporterTest, CheckLpImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd_io::LpFormatImporter importer(libraryInstance);
+
+    std::istringstream stream("vertex(isolated).\r\n"
+                              "edge(a, b ,c).\n"
+                              "% comment\n"
+                              "edge( c,d ).\n"
+                              "edge(e).\n"
+                              "edge(x). edge(y).\n"
+                              "node(z).\n");
+
+    std::unique_ptr<htd::NamedMultiHypergraph<std::string, std::string>> graph(importer.import(stream));
+
+    ASSERT_NE(nullptr, graph.get());
+
+    ASSERT_EQ((std::size_t)6, graph->vertexCount());
+    ASSERT_EQ((std::size_t)3, graph->edgeCount());
+
+    ASSERT_TRUE(graph->isVertexName("isolated"));
+    ASSERT_TRUE(graph->isVertexName("e"));
+    ASSERT_FALSE(graph->isVertexName("x"));
+    ASSERT_FALSE(graph->isVertexName("z"));
+
+    ASSERT_EQ(std::vector<std::string>({ "a", "b", "c" }), graph->hyperedge(1).elements());
+    ASSERT_EQ(std::vector<std::string>({ "c", "d" }), graph->hyperedge(2).elements());
+    ASSERT_EQ(std::vector<std::string>({ "e" }), graph->hyperedge(3).elements());
+
+    delete libraryInstance;
+}
+
+TEST(FormatImporterTest, CheckLpImportLargeInstance)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd_io::LpFormatImporter importer(libraryInstance);
+
+    std::size_t edgeCount = 50000;
+
+    /* The names exceed the small string optimization of std::string and vertex facts are interleaved with the hyperedges. */
+    auto name = [](std::size_t index)
+    {
+        return "a_rather_long_atom_name_" + std::to_string(index);
+    };
+
+    std::ostringstream content;
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        if (index % 1000 == 0)
+        {
+            content << "vertex(" << name(2 * index + 1) << ").\n";
+        }
+
+        content << "edge(" << name(index) << ", " << name(2 * index + 1) << ", " << name(index / 2) << ").\n";
+    }
+
+    std::istringstream stream(content.str());
+
+    std::unique_ptr<htd::NamedMultiHypergraph<std::string, std::string>> graph(importer.import(stream));
+
+    ASSERT_NE(nullptr, graph.get());
+
+    ASSERT_EQ(edgeCount, graph->edgeCount());
+
+    /* The names with index 0, ..., edgeCount - 1 and the odd indices up to 2 * edgeCount occur. The vertices get their IDs in the order of appearance. */
+    ASSERT_EQ(edgeCount + edgeCount / 2, graph->vertexCount());
+
+    ASSERT_EQ((htd::vertex_t)1, graph->lookupVertex(name(1)));
+    ASSERT_EQ((htd::vertex_t)2, graph->lookupVertex(name(0)));
+    ASSERT_EQ((htd::vertex_t)3, graph->lookupVertex(name(3)));
+
+    for (std::size_t index = 1; index < edgeCount; index += 997)
+    {
+        ASSERT_EQ(std::vector<std::string>({ name(index), name(2 * index + 1), name(index / 2) }), graph->hyperedge(index + 1).elements());
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <cstdlib>
 #include <vector>
 
 class GraphPreprocessorTest : public ::testing::Test
@@ -1457,6 +1458,151 @@ TEST(GraphPreprocessorTest, CheckSize50Graph2)
     delete preprocessedGraph;
 }
 
+TEST(GraphPreprocessorTest, CheckCliqueSeparatorDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    /*
+     *  Chain of six complete bipartite graphs K_{4,4}, each with an additional edge within the first two and the
+     *  last two vertices of its left side. Consecutive blocks share the latter edge which forms a clique separator.
+     */
+    std::vector<htd::vertex_t> sharedVertices { graph.addVertex(), graph.addVertex() };
+
+    for (htd::index_t block = 0; block < 6; ++block)
+    {
+        std::vector<htd::vertex_t> leftSide(sharedVertices);
+
+        leftSide.push_back(graph.addVertex());
+        leftSide.push_back(graph.addVertex());
+
+        htd::vertex_t firstRightVertex = graph.addVertices(4);
+
+        for (htd::vertex_t leftVertex : leftSide)
+        {
+            for (htd::vertex_t rightVertex = firstRightVertex; rightVertex < firstRightVertex + 4; ++rightVertex)
+            {
+                graph.addEdge(leftVertex, rightVertex);
+            }
+        }
+
+        graph.addEdge(leftSide[0], leftSide[1]);
+        graph.addEdge(leftSide[2], leftSide[3]);
+
+        sharedVertices = { leftSide[2], leftSide[3] };
+    }
+
+    htd::TreeDecompositionVerifier verifier;
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(3);
+
+        preprocessor.setThreadCount(threadCount);
+
+        ASSERT_EQ(threadCount, preprocessor.threadCount());
+
+        const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+        ASSERT_EQ((std::size_t)8, preprocessedGraph->remainingVertices().size());
+
+        ASSERT_EQ(graph.vertexCount(), preprocessedGraph->remainingVertices().size() +
+                                       preprocessedGraph->eliminationSequence().size());
+
+        std::vector<htd::vertex_t> vertices(preprocessedGraph->eliminationSequence());
+
+        for (htd::vertex_t vertex : preprocessedGraph->remainingVertices())
+        {
+            vertices.push_back(preprocessedGraph->vertexName(vertex));
+
+            for (htd::vertex_t neighbor : preprocessedGraph->neighborhood(vertex))
+            {
+                ASSERT_TRUE(std::binary_search(preprocessedGraph->remainingVertices().begin(), preprocessedGraph->remainingVertices().end(), neighbor));
+            }
+        }
+
+        std::sort(vertices.begin(), vertices.end());
+
+        ASSERT_TRUE(vertices == graph.vertexVector());
+
+        htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        EXPECT_LE(decomposition->maximumBagSize(), (std::size_t)6);
+
+        delete decomposition;
+
+        delete preprocessedGraph;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckThreadCountIndependence)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    std::srand(7);
+
+    for (htd::index_t component = 0; component < 8; ++component)
+    {
+        htd::vertex_t firstVertex = graph.addVertices(16);
+
+        for (htd::vertex_t vertex1 = firstVertex; vertex1 < firstVertex + 16; ++vertex1)
+        {
+            for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 < firstVertex + 16; ++vertex2)
+            {
+                if (std::rand() % 4 == 0)
+                {
+                    graph.addEdge(vertex1, vertex2);
+                }
+            }
+        }
+    }
+
+    std::vector<std::vector<htd::vertex_t>> eliminationSequences;
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(3);
+
+        preprocessor.setThreadCount(threadCount);
+
+        std::srand(42);
+
+        const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+        std::vector<htd::vertex_t> eliminationSequence(preprocessedGraph->eliminationSequence());
+
+        for (htd::vertex_t vertex : preprocessedGraph->remainingVertices())
+        {
+            eliminationSequence.push_back(preprocessedGraph->vertexName(vertex));
+        }
+
+        eliminationSequences.push_back(eliminationSequence);
+
+        delete preprocessedGraph;
+    }
+
+    EXPECT_EQ(graph.vertexCount(), eliminationSequences[0].size());
+
+    EXPECT_EQ(eliminationSequences[0], eliminationSequences[1]);
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -714,6 +714,27 @@ TEST(HelperTest, CheckSymmetricDifferenceSizes3)
     ASSERT_EQ((std::size_t)3, result.second);
 }
 
+TEST(HelperTest, CheckThreadLocalRandomNumberGeneratorGuard)
+{
+    htd::seedThreadLocalRandomNumberGenerator(1);
+
+    int expected = htd::randomNumber();
+
+    htd::seedThreadLocalRandomNumberGenerator(1);
+
+    {
+        htd::ThreadLocalRandomNumberGeneratorGuard guard;
+
+        htd::seedThreadLocalRandomNumberGenerator(2);
+
+        htd::randomNumber();
+    }
+
+    EXPECT_EQ(expected, htd::randomNumber());
+
+    htd::resetThreadLocalRandomNumberGenerator();
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -27,6 +27,8 @@
 #include <htd/main.hpp>
 
 #include <algorithm>
+#include <cstdlib>
+#include <random>
 #include <unordered_set>
 #include <vector>
 
@@ -466,6 +468,83 @@ TEST(HypertreeDecompositionAlgorithmTest, CheckResultSimpleGraphWithLabelingFunc
     delete libraryInstance;
 }
 
+TEST(HypertreeDecompositionAlgorithmTest, CheckResultWithMultipleThreads)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    std::mt19937 generator(42);
+
+    graph.addVertices(80);
+
+    for (htd::index_t index = 0; index < 160; ++index)
+    {
+        std::vector<htd::vertex_t> elements;
+
+        std::size_t edgeSize = 2 + generator() % 3;
+
+        for (htd::index_t position = 0; position < edgeSize; ++position)
+        {
+            elements.push_back(1 + generator() % 80);
+        }
+
+        graph.addEdge(elements);
+    }
+
+    htd::HypertreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    EXPECT_EQ(algorithm.threadCount(), (std::size_t)1);
+
+    std::srand(1);
+
+    htd::IHypertreeDecomposition * decomposition1 = algorithm.computeDecomposition(graph);
+
+    algorithm.setThreadCount(4);
+
+    EXPECT_EQ(algorithm.threadCount(), (std::size_t)4);
+
+    htd::HypertreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    EXPECT_EQ(clonedAlgorithm->threadCount(), (std::size_t)4);
+
+    std::srand(1);
+
+    htd::IHypertreeDecomposition * decomposition2 = clonedAlgorithm->computeDecomposition(graph);
+
+    ASSERT_NE(decomposition1, nullptr);
+    ASSERT_NE(decomposition2, nullptr);
+
+    ASSERT_TRUE(isValidHypertreeDecomposition(graph, *decomposition1));
+    ASSERT_TRUE(isValidHypertreeDecomposition(graph, *decomposition2));
+
+    ASSERT_EQ(decomposition1->vertexCount(), decomposition2->vertexCount());
+
+    for (htd::vertex_t vertex : decomposition1->vertices())
+    {
+        ASSERT_TRUE(decomposition2->isVertex(vertex));
+
+        ASSERT_EQ(decomposition1->bagContent(vertex), decomposition2->bagContent(vertex));
+
+        const std::vector<htd::Hyperedge> & coveringEdges1 = decomposition1->coveringEdges(vertex);
+        const std::vector<htd::Hyperedge> & coveringEdges2 = decomposition2->coveringEdges(vertex);
+
+        ASSERT_EQ(coveringEdges1.size(), coveringEdges2.size());
+
+        for (htd::index_t index = 0; index < coveringEdges1.size(); ++index)
+        {
+            EXPECT_EQ(coveringEdges1[index].id(), coveringEdges2[index].id());
+        }
+    }
+
+    delete decomposition1;
+    delete decomposition2;
+
+    delete clonedAlgorithm;
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <chrono>
+#include <thread>
 #include <vector>
 
 class LibraryInstanceTest : public ::testing::Test
@@ -97,6 +99,65 @@ TEST(LibraryInstanceTest, CheckTermination)
     delete libraryInstance;
 }
 
+TEST(LibraryInstanceTest, CheckDeadline)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    ASSERT_FALSE(libraryInstance->hasDeadline());
+    ASSERT_FALSE(libraryInstance->isDeadlineReached());
+
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+
+    libraryInstance->setDeadline(deadline);
+
+    ASSERT_TRUE(libraryInstance->hasDeadline());
+    ASSERT_TRUE(deadline == libraryInstance->deadline());
+    ASSERT_FALSE(libraryInstance->isDeadlineReached());
+
+    libraryInstance->setTimeLimit(std::chrono::steady_clock::duration::zero());
+
+    ASSERT_TRUE(libraryInstance->hasDeadline());
+    ASSERT_TRUE(libraryInstance->isDeadlineReached());
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    libraryInstance->removeDeadline();
+
+    ASSERT_FALSE(libraryInstance->hasDeadline());
+    ASSERT_FALSE(libraryInstance->isDeadlineReached());
+
+    delete libraryInstance;
+}
+
+TEST(LibraryInstanceTest, CheckIterationPlanner)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IterationPlanner planner(libraryInstance);
+
+    ASSERT_EQ((std::size_t)1000, planner.plannedIterationCount(1000));
+    ASSERT_TRUE(planner.allowsIteration());
+
+    libraryInstance->setTimeLimit(std::chrono::hours(1));
+
+    ASSERT_EQ((std::size_t)1, planner.plannedIterationCount(1000));
+    ASSERT_EQ((std::size_t)0, planner.plannedIterationCount(0));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    planner.recordIterations(1);
+
+    ASSERT_TRUE(planner.iterationDuration() >= std::chrono::milliseconds(10));
+    ASSERT_EQ((std::size_t)1000, planner.plannedIterationCount(1000));
+    ASSERT_TRUE(planner.plannedIterationCount((std::size_t)-1) <= (std::size_t)360000);
+
+    libraryInstance->setTimeLimit(std::chrono::milliseconds(5));
+
+    ASSERT_EQ((std::size_t)0, planner.plannedIterationCount(1000));
+    ASSERT_FALSE(planner.allowsIteration());
+
+    delete libraryInstance;
+}
+
 TEST(LibraryInstanceTest, CheckMultiHypergraphFactory1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -706,6 +709,70 @@ bool isValidInducedEdgeLabel(const htd::IMultiHypergraph & graph, const htd::ITr
     return ret;
 }
 
+std::string normalizedStructure(const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex)
+{
+    std::string ret = "(";
+
+    for (htd::vertex_t bagVertex : decomposition.bagContent(vertex))
+    {
+        ret += std::to_string(bagVertex) + ",";
+    }
+
+    std::vector<htd::id_t> inducedHyperedges;
+
+    for (const htd::Hyperedge & hyperedge : decomposition.inducedHyperedges(vertex))
+    {
+        inducedHyperedges.push_back(hyperedge.id());
+    }
+
+    std::sort(inducedHyperedges.begin(), inducedHyperedges.end());
+
+    ret += "[";
+
+    for (htd::id_t inducedHyperedge : inducedHyperedges)
+    {
+        ret += std::to_string(inducedHyperedge) + ",";
+    }
+
+    ret += "]{";
+
+    const htd::ConstCollection<std::string> & labelNameCollection = decomposition.labelings().labelNames();
+
+    std::vector<std::string> labelNames(labelNameCollection.begin(), labelNameCollection.end());
+
+    std::sort(labelNames.begin(), labelNames.end());
+
+    for (const std::string & labelName : labelNames)
+    {
+        if (decomposition.isLabeledVertex(labelName, vertex))
+        {
+            std::ostringstream label;
+
+            decomposition.vertexLabel(labelName, vertex).print(label);
+
+            ret += labelName + "=" + label.str() + ",";
+        }
+    }
+
+    ret += "}";
+
+    std::vector<std::string> childStructures;
+
+    for (htd::vertex_t child : decomposition.children(vertex))
+    {
+        childStructures.push_back(normalizedStructure(decomposition, child));
+    }
+
+    std::sort(childStructures.begin(), childStructures.end());
+
+    for (const std::string & childStructure : childStructures)
+    {
+        ret += childStructure;
+    }
+
+    return ret + ")";
+}
+
 TEST(ManipulationOperationTest, CheckLimitChildCountOperation1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -1674,6 +1741,103 @@ TEST(ManipulationOperationTest, CheckPathDecompositionExchangeNodeReplacementOpe
     delete libraryInstance;
 }
 
+TEST(ManipulationOperationTest, CheckJoinNodeReplacementOperation1)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMutableMultiHypergraph * graph = libraryInstance->multiHypergraphFactory().createInstance();
+
+    htd::IMutableTreeDecomposition * decomposition = libraryInstance->treeDecompositionFactory().createInstance();
+
+    graph->addVertices(5);
+
+    graph->addEdge(1, 2);
+    graph->addEdge(1, 3);
+    graph->addEdge(1, 4);
+    graph->addEdge(2, 3);
+    graph->addEdge(3, 5);
+
+    htd::vertex_t root = decomposition->insertRoot({ 1, 2, 3 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t node1 = decomposition->addChild(root, { 1, 4 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t node2 = decomposition->addChild(root, { 3, 5 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t node3 = decomposition->addChild(node1, { 1 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t node4 = decomposition->addChild(node1, { 4 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t node5 = decomposition->addChild(node2, { 3 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t node6 = decomposition->addChild(node2, { 5 }, htd::FilteredHyperedgeCollection());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    htd::JoinNodeReplacementOperation operation(libraryInstance);
+
+    operation.apply(*graph, *decomposition);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ((std::size_t)7, decomposition->vertexCount());
+    ASSERT_EQ((std::size_t)0, decomposition->joinNodeCount());
+    ASSERT_EQ((std::size_t)1, decomposition->leafCount());
+
+    ASSERT_EQ(root, decomposition->root());
+
+    ASSERT_EQ(root, decomposition->parent(node1));
+    ASSERT_EQ(node1, decomposition->parent(node3));
+    ASSERT_EQ(node3, decomposition->parent(node4));
+    ASSERT_EQ(node4, decomposition->parent(node2));
+    ASSERT_EQ(node2, decomposition->parent(node5));
+    ASSERT_EQ(node5, decomposition->parent(node6));
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), decomposition->bagContent(root));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3, 4 }), decomposition->bagContent(node1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3, 4 }), decomposition->bagContent(node3));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3, 4 }), decomposition->bagContent(node4));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3, 5 }), decomposition->bagContent(node2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3, 5 }), decomposition->bagContent(node5));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3, 5 }), decomposition->bagContent(node6));
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(ManipulationOperationTest, CheckJoinNodeReplacementOperation2)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::pair<htd::IMultiHypergraph *, htd::IMutableTreeDecomposition *> input = computeTreeDecomposition(libraryInstance);
+
+    htd::IMultiHypergraph * graph = input.first;
+
+    htd::IMutableTreeDecomposition * decomposition = input.second;
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    std::size_t vertexCount = decomposition->vertexCount();
+
+    htd::JoinNodeReplacementOperation operation(libraryInstance);
+
+    operation.apply(*graph, *decomposition);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(vertexCount, decomposition->vertexCount());
+    ASSERT_EQ((std::size_t)0, decomposition->joinNodeCount());
+    ASSERT_EQ((std::size_t)1, decomposition->leafCount());
+
+    htd::JoinNodeReplacementOperation * clonedOperation = operation.clone();
+
+    ASSERT_TRUE(clonedOperation->managementInstance() == libraryInstance);
+
+    delete graph;
+    delete decomposition;
+    delete clonedOperation;
+    delete libraryInstance;
+}
+
 TEST(ManipulationOperationTest, CheckTreeDecompositionOptimizationOperation1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -4883,6 +5047,128 @@ TEST(ManipulationOperationTest, CheckPathDecompositionNormalizationOperation3)
     delete libraryInstance;
 }
 
+TEST(ManipulationOperationTest, CheckTreeDecompositionNormalizationOperation4)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    for (int flags = 0; flags < 16; ++flags)
+    {
+        bool emptyRoot = (flags & 1) != 0;
+        bool emptyLeaves = (flags & 2) != 0;
+        bool identicalJoinNodeParent = (flags & 4) != 0;
+        bool treatLeafNodesAsIntroduceNodes = (flags & 8) != 0;
+
+        BagSizeLabelingFunction * labelingFunction = new BagSizeLabelingFunction(libraryInstance);
+
+        std::pair<htd::IMultiHypergraph *, htd::IMutableTreeDecomposition *> input = computeTreeDecomposition(libraryInstance, { labelingFunction->clone() });
+
+        htd::IMultiHypergraph * graph = input.first;
+
+        htd::IMutableTreeDecomposition * decomposition = input.second;
+
+        /* Labels which are not computed by the labeling functions have to be retained at the original nodes. */
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            decomposition->setVertexLabel("ORIGINAL_NODE", vertex, new htd::Label<htd::vertex_t>(vertex));
+        }
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        htd::IMutableTreeDecomposition * expectedDecomposition = decomposition->clone();
+#else
+        htd::IMutableTreeDecomposition * expectedDecomposition = decomposition->cloneMutableTreeDecomposition();
+#endif
+
+        htd::SemiNormalizationOperation(libraryInstance, emptyRoot, emptyLeaves, identicalJoinNodeParent).apply(*graph, *expectedDecomposition, { labelingFunction });
+        htd::ExchangeNodeReplacementOperation(libraryInstance).apply(*graph, *expectedDecomposition, { labelingFunction });
+        htd::LimitMaximumForgottenVertexCountOperation(libraryInstance, 1).apply(*graph, *expectedDecomposition, { labelingFunction });
+        htd::LimitMaximumIntroducedVertexCountOperation(libraryInstance, 1, treatLeafNodesAsIntroduceNodes).apply(*graph, *expectedDecomposition, { labelingFunction });
+
+        htd::NormalizationOperation operation(libraryInstance, emptyRoot, emptyLeaves, identicalJoinNodeParent, treatLeafNodesAsIntroduceNodes);
+
+        operation.apply(*graph, *decomposition, { labelingFunction });
+
+        ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+        ASSERT_EQ(expectedDecomposition->vertexCount(), decomposition->vertexCount());
+        ASSERT_EQ(expectedDecomposition->joinNodeCount(), decomposition->joinNodeCount());
+        ASSERT_EQ(expectedDecomposition->introduceNodeCount(), decomposition->introduceNodeCount());
+        ASSERT_EQ(expectedDecomposition->forgetNodeCount(), decomposition->forgetNodeCount());
+        ASSERT_EQ(expectedDecomposition->leafCount(), decomposition->leafCount());
+
+        ASSERT_EQ(normalizedStructure(*expectedDecomposition, expectedDecomposition->root()), normalizedStructure(*decomposition, decomposition->root()));
+
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            ASSERT_TRUE(decomposition->isLabeledVertex("BAG_SIZE", vertex));
+            ASSERT_EQ(decomposition->bagSize(vertex), htd::accessLabel<std::size_t>(decomposition->vertexLabel("BAG_SIZE", vertex)));
+
+            for (const htd::Hyperedge & hyperedge : decomposition->inducedHyperedges(vertex))
+            {
+                ASSERT_TRUE(std::includes(decomposition->bagContent(vertex).begin(), decomposition->bagContent(vertex).end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()));
+            }
+        }
+
+        delete graph;
+        delete decomposition;
+        delete expectedDecomposition;
+        delete labelingFunction;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(ManipulationOperationTest, CheckTreeDecompositionNormalizationOperation5)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    BagSizeLabelingFunction labelingFunction(libraryInstance);
+
+    std::pair<htd::IMultiHypergraph *, htd::IMutableTreeDecomposition *> input = computeTreeDecomposition(libraryInstance, { labelingFunction.clone() });
+
+    htd::IMultiHypergraph * graph = input.first;
+
+    htd::IMutableTreeDecomposition * decomposition = input.second;
+
+    for (htd::vertex_t vertex : decomposition->vertices())
+    {
+        decomposition->setVertexLabel("ORIGINAL_NODE", vertex, new htd::Label<htd::vertex_t>(vertex));
+    }
+
+    /* Decompositions of a derived type are normalized in place, so the identifiers of the original nodes remain valid. */
+    htd::CompactTreeDecomposition compactDecomposition(*decomposition);
+
+    std::vector<htd::vertex_t> originalNodes;
+
+    compactDecomposition.copyVerticesTo(originalNodes);
+
+    htd::NormalizationOperation operation(libraryInstance);
+
+    operation.apply(*graph, *decomposition, { &labelingFunction });
+
+    operation.apply(*graph, compactDecomposition, { &labelingFunction });
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+    ASSERT_TRUE(verifier.verify(*graph, compactDecomposition));
+
+    for (htd::vertex_t vertex : originalNodes)
+    {
+        ASSERT_TRUE(compactDecomposition.isVertex(vertex));
+        ASSERT_TRUE(compactDecomposition.isLabeledVertex("ORIGINAL_NODE", vertex));
+        ASSERT_EQ(vertex, htd::accessLabel<htd::vertex_t>(compactDecomposition.vertexLabel("ORIGINAL_NODE", vertex)));
+    }
+
+    ASSERT_EQ(normalizedStructure(compactDecomposition, compactDecomposition.root()), normalizedStructure(*decomposition, decomposition->root()));
+
+    delete graph;
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
 TEST(ManipulationOperationTest, CheckTreeDecompositionSemiNormalizationOperation1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -0,0 +1,172 @@
+/*
+ * File:   MaxFlowAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <memory>
+#include <vector>
+
+class MaxFlowAlgorithmTest : public ::testing::Test
+{
+    public:
+        MaxFlowAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~MaxFlowAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(MaxFlowAlgorithmTest, CheckFlowNetworkStructure)
+{
+    htd::FlowNetworkStructure flowNetwork(4);
+
+    flowNetwork.updateCapacity(0, 2, 5);
+    flowNetwork.updateCapacity(0, 1, 3);
+    flowNetwork.updateCapacity(2, 3, 7);
+    flowNetwork.updateCapacity(0, 1, 4);
+
+    ASSERT_EQ((std::size_t)4, flowNetwork.vertexCount());
+    ASSERT_EQ((std::size_t)3, flowNetwork.edgeCount());
+
+    ASSERT_EQ((std::size_t)4, flowNetwork.capacity(0, 1));
+    ASSERT_EQ((std::size_t)5, flowNetwork.capacity(0, 2));
+    ASSERT_EQ((std::size_t)7, flowNetwork.capacity(2, 3));
+    ASSERT_EQ((std::size_t)0, flowNetwork.capacity(1, 0));
+    ASSERT_EQ((std::size_t)0, flowNetwork.capacity(3, 3));
+
+    ASSERT_TRUE(flowNetwork.isNeighbor(0, 1));
+    ASSERT_FALSE(flowNetwork.isNeighbor(1, 0));
+}
+
+TEST(MaxFlowAlgorithmTest, CheckMaximumFlow1)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::FlowNetworkStructure flowNetwork(6);
+
+    flowNetwork.updateCapacity(0, 1, 16);
+    flowNetwork.updateCapacity(0, 2, 13);
+    flowNetwork.updateCapacity(1, 3, 12);
+    flowNetwork.updateCapacity(2, 1, 4);
+    flowNetwork.updateCapacity(2, 4, 14);
+    flowNetwork.updateCapacity(3, 2, 9);
+    flowNetwork.updateCapacity(3, 5, 20);
+    flowNetwork.updateCapacity(4, 3, 7);
+    flowNetwork.updateCapacity(4, 5, 4);
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::IFlow> flow(algorithm.determineMaximumFlow(flowNetwork, 0, 5));
+
+    ASSERT_EQ((std::size_t)6, flow->vertexCount());
+    ASSERT_EQ((htd::vertex_t)0, flow->source());
+    ASSERT_EQ((htd::vertex_t)5, flow->target());
+    ASSERT_EQ((std::size_t)23, flow->value());
+
+    ASSERT_EQ(23, flow->flow(0, 1) + flow->flow(0, 2));
+    ASSERT_EQ(23, flow->flow(3, 5) + flow->flow(4, 5));
+
+    for (htd::vertex_t vertex = 0; vertex < 6; ++vertex)
+    {
+        for (htd::vertex_t neighbor = 0; neighbor < 6; ++neighbor)
+        {
+            ASSERT_EQ(flow->flow(vertex, neighbor), -flow->flow(neighbor, vertex));
+
+            ASSERT_LE(flow->flow(vertex, neighbor), static_cast<long long>(flowNetwork.capacity(vertex, neighbor)));
+        }
+    }
+}
+
+TEST(MaxFlowAlgorithmTest, CheckMaximumFlow2)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    /* The maximum flow can only be found if flow is redirected along reverse edges. */
+    htd::FlowNetworkStructure flowNetwork(4);
+
+    flowNetwork.updateCapacity(0, 1, 1);
+    flowNetwork.updateCapacity(0, 2, 1);
+    flowNetwork.updateCapacity(1, 2, 1);
+    flowNetwork.updateCapacity(1, 3, 1);
+    flowNetwork.updateCapacity(2, 3, 1);
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::IFlow> flow(algorithm.determineMaximumFlow(flowNetwork, 0, 3));
+
+    ASSERT_EQ((std::size_t)2, flow->value());
+
+    htd::ResidualNetwork network(flowNetwork);
+
+    ASSERT_EQ((std::size_t)4, network.vertexCount());
+    ASSERT_EQ((std::size_t)10, network.edgeCount());
+
+    ASSERT_EQ((std::size_t)1, algorithm.increaseFlow(network, 0, 3, 1));
+    ASSERT_EQ((std::size_t)1, algorithm.increaseFlow(network, 0, 3, (std::size_t)-1));
+    ASSERT_EQ((std::size_t)0, algorithm.increaseFlow(network, 0, 3, (std::size_t)-1));
+
+    network.reset();
+
+    ASSERT_EQ((std::size_t)2, algorithm.increaseFlow(network, 0, 3, (std::size_t)-1));
+}
+
+TEST(MaxFlowAlgorithmTest, CheckMaximumFlowDisconnected)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::FlowNetworkStructure flowNetwork(4);
+
+    flowNetwork.updateCapacity(0, 1, 3);
+    flowNetwork.updateCapacity(2, 3, 3);
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::IFlow> flow(algorithm.determineMaximumFlow(flowNetwork, 0, 3));
+
+    ASSERT_EQ((std::size_t)0, flow->value());
+    ASSERT_EQ(0, flow->flow(0, 1));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <atomic>
+#include <memory>
 #include <vector>
 
 class MinDegreeOrderingAlgorithmTest : public ::testing::Test
@@ -1278,6 +1280,46 @@ TEST(MinDegreeOrderingAlgorithmTest, CheckSize50Graph2)
     delete libraryInstance;
 }
 
+TEST(MinDegreeOrderingAlgorithmTest, CheckSharedMaximumBagSizeBound)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 6; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 6; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    std::unique_ptr<htd::IPreprocessedGraph> preprocessedGraph(preprocessor.prepare(graph));
+
+    htd::MinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    std::atomic<std::size_t> sharedMaxBagSize((std::size_t)-1);
+
+    std::unique_ptr<htd::IWidthLimitedVertexOrdering> ordering(algorithm.computeOrdering(graph, *preprocessedGraph, (std::size_t)-1, 1, sharedMaxBagSize));
+
+    ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+    ASSERT_TRUE(isValidOrdering(graph, ordering->sequence()));
+
+    ASSERT_EQ((std::size_t)6, ordering->maximumBagSize());
+
+    /* A bound tightened by another thread aborts the construction of the ordering. */
+    sharedMaxBagSize.store(3);
+
+    ordering.reset(algorithm.computeOrdering(graph, *preprocessedGraph, (std::size_t)-1, 1, sharedMaxBagSize));
+
+    ASSERT_LT(ordering->sequence().size(), (std::size_t)6);
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
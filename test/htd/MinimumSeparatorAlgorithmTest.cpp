@@ -0,0 +1,183 @@
+/*
+ * File:   MinimumSeparatorAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+class MinimumSeparatorAlgorithmTest : public ::testing::Test
+{
+    public:
+        MinimumSeparatorAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~MinimumSeparatorAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(MinimumSeparatorAlgorithmTest, CheckPathGraph)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::Graph graph(libraryInstance.get());
+
+    htd::vertex_t vertex1 = graph.addVertex();
+    htd::vertex_t vertex2 = graph.addVertex();
+    htd::vertex_t vertex3 = graph.addVertex();
+
+    graph.addEdge(vertex1, vertex2);
+    graph.addEdge(vertex2, vertex3);
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(graph));
+
+    ASSERT_EQ((std::size_t)1, separator->size());
+    ASSERT_EQ(vertex2, (*separator)[0]);
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckCycleGraph)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::Graph graph(libraryInstance.get());
+
+    graph.addVertices(6);
+
+    for (htd::vertex_t vertex = 1; vertex <= 6; ++vertex)
+    {
+        graph.addEdge(vertex, vertex % 6 + 1);
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(graph));
+
+    ASSERT_EQ((std::size_t)2, separator->size());
+
+    /* The first pair of non-adjacent vertices is (1, 3), hence the separator consists of vertex 2 and one vertex of the other path. */
+    ASSERT_EQ((htd::vertex_t)2, (*separator)[0]);
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckCompleteGraph)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::Graph graph(libraryInstance.get());
+
+    graph.addVertices(4);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 4; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 4; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(graph));
+
+    ASSERT_EQ((std::size_t)4, separator->size());
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckParallelResult)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::Graph graph(libraryInstance.get());
+
+    graph.addVertices(60);
+
+    std::mt19937 generator(7);
+
+    std::uniform_int_distribution<htd::vertex_t> distribution(1, 60);
+
+    for (std::size_t index = 0; index < 180; ++index)
+    {
+        htd::vertex_t vertex1 = distribution(generator);
+        htd::vertex_t vertex2 = distribution(generator);
+
+        if (vertex1 != vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<std::vector<htd::vertex_t>> expectedSeparator(algorithm.computeSeparator(graph));
+
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    std::unique_ptr<htd::MinimumSeparatorAlgorithm> clone(algorithm.clone());
+
+    ASSERT_EQ((std::size_t)4, clone->threadCount());
+
+    for (std::size_t iteration = 0; iteration < 5; ++iteration)
+    {
+        std::unique_ptr<std::vector<htd::vertex_t>> separator(clone->computeSeparator(graph));
+
+        ASSERT_EQ(*expectedSeparator, *separator);
+    }
+
+    htd::IMutableGraph * reducedGraph = graph.clone();
+
+    for (htd::vertex_t vertex : *expectedSeparator)
+    {
+        reducedGraph->removeVertex(vertex);
+    }
+
+    ASSERT_FALSE(reducedGraph->isConnected());
+
+    delete reducedGraph;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -521,6 +521,45 @@ TEST(MultiGraphTest, CheckGraphModifications)
     delete libraryInstance;
 }
 
+TEST(MultiGraphTest, CheckBulkEdgeInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges { { 3, 1 }, { 1, 2 }, { 1, 3 }, { 2, 2 } };
+
+    htd::MultiGraph graph1(libraryInstance, 4);
+    htd::MultiGraph graph2(libraryInstance, 4);
+
+    graph1.addEdge((htd::vertex_t)4, (htd::vertex_t)1);
+    graph2.addEdge((htd::vertex_t)4, (htd::vertex_t)1);
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        graph1.addEdge(edge.first, edge.second);
+    }
+
+    ASSERT_EQ((htd::id_t)2, graph2.addEdges(edges));
+
+    ASSERT_EQ(graph1.edgeCount(), graph2.edgeCount());
+
+    for (htd::vertex_t vertex = 1; vertex <= 4; ++vertex)
+    {
+        ASSERT_EQ(std::vector<htd::vertex_t>(graph1.neighbors(vertex).begin(), graph1.neighbors(vertex).end()),
+                  std::vector<htd::vertex_t>(graph2.neighbors(vertex).begin(), graph2.neighbors(vertex).end()));
+    }
+
+    for (htd::index_t index = 0; index < graph1.edgeCount(); ++index)
+    {
+        ASSERT_EQ(graph1.hyperedgeAtPosition(index).id(), graph2.hyperedgeAtPosition(index).id());
+        ASSERT_EQ(graph1.hyperedgeAtPosition(index).elements(), graph2.hyperedgeAtPosition(index).elements());
+    }
+
+    ASSERT_TRUE(graph2.isEdge((htd::vertex_t)1, (htd::vertex_t)3));
+    ASSERT_TRUE(graph2.isNeighbor((htd::vertex_t)2, (htd::vertex_t)2));
+
+    delete libraryInstance;
+}
+
 TEST(MultiGraphTest, CheckCopyConstructors)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -737,6 +737,116 @@ TEST(MultiHypergraphTest, CheckGraphModifications)
     delete libraryInstance;
 }
 
+static void expectEqualGraphs(const htd::IMultiHypergraph & graph1, const htd::IMultiHypergraph & graph2)
+{
+    ASSERT_EQ(graph1.vertexCount(), graph2.vertexCount());
+    ASSERT_EQ(graph1.edgeCount(), graph2.edgeCount());
+
+    for (htd::vertex_t vertex : graph1.vertices())
+    {
+        ASSERT_EQ(std::vector<htd::vertex_t>(graph1.neighbors(vertex).begin(), graph1.neighbors(vertex).end()),
+                  std::vector<htd::vertex_t>(graph2.neighbors(vertex).begin(), graph2.neighbors(vertex).end()));
+    }
+
+    for (htd::index_t index = 0; index < graph1.edgeCount(); ++index)
+    {
+        const htd::Hyperedge & hyperedge1 = graph1.hyperedgeAtPosition(index);
+        const htd::Hyperedge & hyperedge2 = graph2.hyperedgeAtPosition(index);
+
+        ASSERT_EQ(hyperedge1.id(), hyperedge2.id());
+        ASSERT_EQ(hyperedge1.elements(), hyperedge2.elements());
+        ASSERT_EQ(hyperedge1.sortedElements(), hyperedge2.sortedElements());
+    }
+}
+
+TEST(MultiHypergraphTest, CheckBulkEdgeInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges { { 4, 2 }, { 1, 2 }, { 2, 4 }, { 3, 3 }, { 5, 1 }, { 2, 1 } };
+
+    htd::MultiHypergraph graph1(libraryInstance, 6);
+    htd::MultiHypergraph graph2(libraryInstance, 6);
+
+    graph1.addEdge((htd::vertex_t)6, (htd::vertex_t)2);
+    graph2.addEdge((htd::vertex_t)6, (htd::vertex_t)2);
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        graph1.addEdge(edge.first, edge.second);
+    }
+
+    ASSERT_EQ((htd::id_t)2, graph2.addEdges(edges));
+    ASSERT_EQ((htd::id_t)8, graph2.addEdges(std::vector<std::pair<htd::vertex_t, htd::vertex_t>>()));
+
+    expectEqualGraphs(graph1, graph2);
+
+    ASSERT_TRUE(graph2.isNeighbor((htd::vertex_t)3, (htd::vertex_t)3));
+    ASSERT_FALSE(graph2.isNeighbor((htd::vertex_t)2, (htd::vertex_t)2));
+    ASSERT_EQ((std::size_t)3, graph2.neighborCount((htd::vertex_t)2));
+
+    std::vector<std::vector<htd::vertex_t>> hyperedges { { 5, 3, 1 }, { 6 }, { 2, 4 }, { 4, 1, 4, 6 }, { 3, 3 }, { 6, 5, 4, 3, 2 } };
+
+    std::vector<htd::vertex_t> elements;
+    std::vector<htd::index_t> offsets(1, 0);
+
+    for (const std::vector<htd::vertex_t> & hyperedge : hyperedges)
+    {
+        graph1.addEdge(hyperedge);
+
+        elements.insert(elements.end(), hyperedge.begin(), hyperedge.end());
+
+        offsets.push_back(elements.size());
+    }
+
+    ASSERT_EQ((htd::id_t)8, graph2.addEdges(elements, offsets));
+
+    expectEqualGraphs(graph1, graph2);
+
+    ASSERT_TRUE(graph2.isNeighbor((htd::vertex_t)4, (htd::vertex_t)4));
+    ASSERT_FALSE(graph2.isNeighbor((htd::vertex_t)6, (htd::vertex_t)6));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckNeighborSpan)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 5);
+
+    graph.addEdge(std::vector<htd::vertex_t> { 4, 2, 1 });
+    graph.addEdge((htd::vertex_t)2, (htd::vertex_t)5);
+    graph.addEdge((htd::vertex_t)3, (htd::vertex_t)3);
+
+    const htd::IContiguousGraphStructure * contiguousGraph = dynamic_cast<const htd::IContiguousGraphStructure *>(static_cast<const htd::IMultiHypergraph *>(&graph));
+
+    ASSERT_NE(nullptr, contiguousGraph);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        htd::ConstSpan<htd::vertex_t> neighborSpan = contiguousGraph->neighborSpan(vertex);
+
+        std::vector<htd::vertex_t> neighbors;
+
+        graph.copyNeighborsTo(vertex, neighbors);
+
+        ASSERT_EQ(neighbors.size(), neighborSpan.size());
+        ASSERT_EQ(neighbors, std::vector<htd::vertex_t>(neighborSpan.begin(), neighborSpan.end()));
+    }
+
+    ASSERT_EQ((std::size_t)3, contiguousGraph->neighborSpan((htd::vertex_t)2).size());
+    ASSERT_EQ((htd::vertex_t)5, contiguousGraph->neighborSpan((htd::vertex_t)2)[2]);
+    ASSERT_EQ((htd::vertex_t)3, contiguousGraph->neighborSpan((htd::vertex_t)3)[0]);
+
+    graph.removeEdge((htd::id_t)2);
+
+    ASSERT_EQ((std::size_t)2, contiguousGraph->neighborSpan((htd::vertex_t)2).size());
+    ASSERT_TRUE(contiguousGraph->neighborSpan((htd::vertex_t)5).empty());
+
+    delete libraryInstance;
+}
+
 TEST(MultiHypergraphTest, CheckCopyConstructors)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -168,6 +168,39 @@ bool isValidSetCover(const std::vector<htd::id_t> & values,
     return ret;
 }
 
+/**
+ *  Compute the size of a minimum set cover by enumerating all subsets of the given containers.
+ *
+ *  @param[in] values       The values which must be covered.
+ *  @param[in] containers   The available containers.
+ *
+ *  @return The size of a minimum set cover or 0 if the values cannot be covered.
+ */
+std::size_t computeMinimumSetCoverSizeNaively(const std::vector<htd::id_t> & values, const std::vector<std::vector<htd::id_t>> & containers)
+{
+    std::size_t ret = 0;
+
+    for (std::size_t subset = 0; subset < ((std::size_t)1 << containers.size()); ++subset)
+    {
+        std::vector<htd::index_t> selectedPositions;
+
+        for (htd::index_t index = 0; index < containers.size(); ++index)
+        {
+            if (((subset >> index) & 1) != 0)
+            {
+                selectedPositions.push_back(index);
+            }
+        }
+
+        if ((ret == 0 || selectedPositions.size() < ret) && isValidSetCover(values, containers, selectedPositions))
+        {
+            ret = selectedPositions.size();
+        }
+    }
+
+    return ret;
+}
+
 TEST(SetCoverAlgorithmTest, CheckSetCoverAlgorithm1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -285,6 +318,38 @@ TEST(SetCoverAlgorithmTest, CheckSetCoverAlgorithm5)
     delete values;
 }
 
+TEST(SetCoverAlgorithmTest, CheckSetCoverAlgorithmOptimality)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::SetCoverAlgorithm algorithm(libraryInstance);
+
+    for (int i = 0; i < 40; ++i)
+    {
+        /* The second half of the instances requires more than one machine word per bitset. */
+        htd::id_t maxValue = i < 20 ? 30 : 100;
+
+        std::vector<htd::id_t> * values = createContainer(1, maxValue, maxValue / 3, maxValue / 2);
+
+        std::vector<std::vector<htd::id_t>> * containers = createContainers(1, maxValue, 12, 1, maxValue / 2);
+
+        std::vector<htd::index_t> result;
+
+        algorithm.computeSetCover(*values, *containers, result);
+
+        ASSERT_TRUE(isValidSetCover(*values, *containers, result));
+
+        ASSERT_TRUE(std::is_sorted(result.begin(), result.end()));
+
+        ASSERT_EQ(computeMinimumSetCoverSizeNaively(*values, *containers), result.size());
+
+        delete containers;
+        delete values;
+    }
+
+    delete libraryInstance;
+}
+
 TEST(SetCoverAlgorithmTest, CheckGreedySetCoverAlgorithm1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
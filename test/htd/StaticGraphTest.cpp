@@ -0,0 +1,284 @@
+/*
+ * File:   StaticGraphTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+class StaticGraphTest : public ::testing::Test
+{
+    public:
+        StaticGraphTest(void)
+        {
+
+        }
+
+        virtual ~StaticGraphTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(StaticGraphTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::StaticGraph graph(libraryInstance, 0, std::vector<std::pair<htd::vertex_t, htd::vertex_t>>());
+
+    ASSERT_EQ((std::size_t)0, graph.vertexCount());
+    ASSERT_EQ((std::size_t)0, graph.edgeCount());
+
+    ASSERT_EQ((std::size_t)0, graph.vertices().size());
+    ASSERT_EQ((std::size_t)0, graph.hyperedges().size());
+
+    ASSERT_EQ((std::size_t)0, graph.isolatedVertexCount());
+    ASSERT_EQ((std::size_t)0, graph.isolatedVertices().size());
+
+    ASSERT_FALSE(graph.isVertex((htd::vertex_t)1));
+
+    ASSERT_TRUE(graph.isConnected());
+
+    delete libraryInstance;
+}
+
+TEST(StaticGraphTest, CheckGraphStructure)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges { { 1, 2 }, { 3, 2 }, { 1, 2 }, { 2, 1 }, { 4, 4 } };
+
+    htd::StaticGraph graph(libraryInstance, 5, edges);
+
+    ASSERT_EQ((std::size_t)5, graph.vertexCount());
+    ASSERT_EQ((std::size_t)4, graph.edgeCount());
+
+    ASSERT_TRUE(graph.isVertex((htd::vertex_t)5));
+    ASSERT_FALSE(graph.isVertex((htd::vertex_t)6));
+    ASSERT_FALSE(graph.isVertex(htd::Vertex::UNKNOWN));
+
+    ASSERT_TRUE(graph.isEdge((htd::id_t)1));
+    ASSERT_TRUE(graph.isEdge((htd::id_t)4));
+    ASSERT_FALSE(graph.isEdge((htd::id_t)5));
+
+    ASSERT_TRUE(graph.isEdge((htd::vertex_t)1, (htd::vertex_t)2));
+    ASSERT_TRUE(graph.isEdge((htd::vertex_t)2, (htd::vertex_t)1));
+    ASSERT_TRUE(graph.isEdge((htd::vertex_t)3, (htd::vertex_t)2));
+    ASSERT_FALSE(graph.isEdge((htd::vertex_t)2, (htd::vertex_t)3));
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 4, 4 }));
+    ASSERT_FALSE(graph.isEdge(std::vector<htd::vertex_t> { 1, 2, 3 }));
+
+    ASSERT_EQ((std::size_t)1, graph.associatedEdgeIds((htd::vertex_t)1, (htd::vertex_t)2).size());
+    ASSERT_EQ((htd::id_t)1, graph.associatedEdgeIds((htd::vertex_t)1, (htd::vertex_t)2)[0]);
+    ASSERT_EQ((htd::id_t)3, graph.associatedEdgeIds((htd::vertex_t)2, (htd::vertex_t)1)[0]);
+
+    ASSERT_EQ((std::size_t)2, graph.neighborCount((htd::vertex_t)2));
+    ASSERT_EQ((htd::vertex_t)1, graph.neighborAtPosition((htd::vertex_t)2, 0));
+    ASSERT_EQ((htd::vertex_t)3, graph.neighborAtPosition((htd::vertex_t)2, 1));
+
+    std::vector<htd::vertex_t> neighbors;
+
+    graph.copyNeighborsTo((htd::vertex_t)1, neighbors);
+
+    ASSERT_EQ(std::vector<htd::vertex_t> { 2 }, neighbors);
+
+    ASSERT_TRUE(graph.isNeighbor((htd::vertex_t)4, (htd::vertex_t)4));
+    ASSERT_FALSE(graph.isNeighbor((htd::vertex_t)1, (htd::vertex_t)1));
+    ASSERT_FALSE(graph.isNeighbor((htd::vertex_t)1, (htd::vertex_t)3));
+
+    ASSERT_EQ((std::size_t)3, graph.edgeCount((htd::vertex_t)2));
+    ASSERT_EQ((std::size_t)1, graph.edgeCount((htd::vertex_t)4));
+
+    ASSERT_EQ((std::size_t)1, graph.isolatedVertexCount());
+    ASSERT_EQ((htd::vertex_t)5, graph.isolatedVertexAtPosition(0));
+    ASSERT_TRUE(graph.isIsolatedVertex((htd::vertex_t)5));
+    ASSERT_FALSE(graph.isIsolatedVertex((htd::vertex_t)4));
+
+    ASSERT_FALSE(graph.isConnected());
+    ASSERT_TRUE(graph.isConnected((htd::vertex_t)1, (htd::vertex_t)3));
+    ASSERT_FALSE(graph.isConnected((htd::vertex_t)1, (htd::vertex_t)4));
+
+    const htd::Hyperedge & hyperedge = graph.hyperedge((htd::id_t)2);
+
+    ASSERT_EQ((htd::id_t)2, hyperedge.id());
+    ASSERT_EQ((htd::vertex_t)3, hyperedge[0]);
+    ASSERT_EQ((htd::vertex_t)2, hyperedge[1]);
+
+    ASSERT_EQ((htd::id_t)4, graph.hyperedgeAtPosition(3).id());
+    ASSERT_EQ((htd::id_t)3, graph.hyperedgeAtPosition(2, (htd::vertex_t)2).id());
+
+    htd::ConstCollection<htd::Hyperedge> hyperedges = graph.hyperedges((htd::vertex_t)2);
+
+    ASSERT_EQ((std::size_t)3, hyperedges.size());
+    ASSERT_EQ((htd::id_t)1, hyperedges[0].id());
+    ASSERT_EQ((htd::id_t)2, hyperedges[1].id());
+    ASSERT_EQ((htd::id_t)3, hyperedges[2].id());
+
+    htd::FilteredHyperedgeCollection filteredHyperedges = graph.hyperedgesAtPositions(std::vector<htd::index_t> { 1, 3 });
+
+    ASSERT_EQ((std::size_t)2, filteredHyperedges.size());
+    auto it = filteredHyperedges.begin();
+
+    ASSERT_EQ((htd::id_t)2, it->id());
+
+    ++it;
+
+    ASSERT_EQ((htd::id_t)4, it->id());
+
+    delete libraryInstance;
+}
+
+TEST(StaticGraphTest, CheckEquivalenceToGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Graph graph(libraryInstance, 8);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+    for (htd::vertex_t vertex = 1; vertex < 8; ++vertex)
+    {
+        edges.emplace_back(vertex, vertex + 1);
+        edges.emplace_back((vertex * 5) % 8 + 1, vertex);
+    }
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        graph.addEdge(edge.first, edge.second);
+    }
+
+    auto checkEquivalence = [](const htd::IGraph & expectedGraph, const htd::IGraph & actualGraph)
+    {
+        ASSERT_EQ(expectedGraph.vertexCount(), actualGraph.vertexCount());
+        ASSERT_EQ(expectedGraph.edgeCount(), actualGraph.edgeCount());
+        ASSERT_EQ(expectedGraph.isConnected(), actualGraph.isConnected());
+
+        for (htd::vertex_t vertex : expectedGraph.vertices())
+        {
+            ASSERT_TRUE(actualGraph.isVertex(vertex));
+
+            ASSERT_EQ(expectedGraph.neighbors(vertex), actualGraph.neighbors(vertex));
+
+            ASSERT_EQ(expectedGraph.edgeCount(vertex), actualGraph.edgeCount(vertex));
+        }
+
+        ASSERT_EQ(expectedGraph.hyperedges(), actualGraph.hyperedges());
+    };
+
+    std::unique_ptr<htd::IGraph> staticGraph(libraryInstance->graphFactory().createStaticInstance(8, edges));
+
+    checkEquivalence(graph, *staticGraph);
+
+    graph.removeVertex((htd::vertex_t)3);
+
+    htd::StaticGraph copy(graph);
+
+    checkEquivalence(graph, copy);
+
+    ASSERT_FALSE(copy.isVertex((htd::vertex_t)3));
+
+    delete libraryInstance;
+}
+
+TEST(StaticGraphTest, CheckSpanAccess)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges { { 3, 1 }, { 1, 2 }, { 3, 2 }, { 1, 3 }, { 4, 4 } };
+
+    htd::StaticGraph graph(libraryInstance, 5, edges);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        htd::ConstSpan<htd::vertex_t> neighborSpan = graph.neighborSpan(vertex);
+
+        const htd::ConstCollection<htd::vertex_t> & neighbors = graph.neighbors(vertex);
+
+        ASSERT_EQ(neighbors.size(), neighborSpan.size());
+        ASSERT_TRUE(std::equal(neighborSpan.begin(), neighborSpan.end(), neighbors.begin()));
+    }
+
+    ASSERT_TRUE(graph.neighborSpan((htd::vertex_t)5).empty());
+
+    htd::ConstSpan<htd::Hyperedge> hyperedgeSpan = graph.hyperedgeSpan();
+
+    ASSERT_EQ(graph.edgeCount(), hyperedgeSpan.size());
+    ASSERT_TRUE(std::equal(hyperedgeSpan.begin(), hyperedgeSpan.end(), graph.hyperedges().begin()));
+
+    ASSERT_EQ((htd::id_t)4, hyperedgeSpan[3].id());
+    ASSERT_EQ((htd::vertex_t)1, hyperedgeSpan[3][0]);
+    ASSERT_EQ((htd::vertex_t)3, hyperedgeSpan[3][1]);
+
+    delete libraryInstance;
+}
+
+TEST(StaticGraphTest, CheckTreeDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+    for (htd::vertex_t vertex = 1; vertex < 10; ++vertex)
+    {
+        edges.emplace_back(vertex, vertex + 1);
+        edges.emplace_back(vertex, (vertex + 3) % 10 + 1);
+    }
+
+    htd::StaticGraph graph(libraryInstance, 10, edges);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
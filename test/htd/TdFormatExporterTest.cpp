@@ -0,0 +1,375 @@
+/*
+ * File:   TdFormatExporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class TdFormatExporterTest : public ::testing::Test
+{
+    public:
+        TdFormatExporterTest(void)
+        {
+
+        }
+
+        virtual ~TdFormatExporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Reference implementation of the format 'td' based on standard streams.
+ */
+static std::string referenceTdFormat(const htd::ITreeDecomposition & decomposition, std::size_t vertexCount)
+{
+    std::ostringstream stream;
+
+    std::unordered_map<htd::vertex_t, std::size_t> indices;
+
+    stream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << vertexCount << "\n";
+
+    if (decomposition.vertexCount() > 0)
+    {
+        std::size_t index = 1;
+
+        for (htd::vertex_t node : decomposition.vertices())
+        {
+            indices.emplace(node, index);
+
+            stream << "b " << index << " ";
+
+            for (htd::vertex_t vertex : decomposition.bagContent(node))
+            {
+                stream << vertex << " ";
+            }
+
+            stream << "\n";
+
+            ++index;
+        }
+
+        for (const htd::Hyperedge & edge : decomposition.hyperedges())
+        {
+            stream << indices.at(edge[0]) << " " << indices.at(edge[1]) << "\n";
+        }
+    }
+
+    return stream.str();
+}
+
+/**
+ *  Convert data in the format 'btd' into the format 'td'.
+ */
+static std::string convertToTdFormat(const std::string & binary)
+{
+    std::ostringstream stream;
+
+    htd_io::BinaryTdFormatReader reader(binary.data(), binary.data() + binary.size());
+
+    EXPECT_TRUE(reader.good());
+
+    stream << "s td " << reader.nodeCount() << " " << reader.maximumBagSize() << " " << reader.vertexCount() << "\n";
+
+    std::vector<htd::vertex_t> bag;
+
+    for (std::size_t node = 1; node <= reader.nodeCount(); ++node)
+    {
+        EXPECT_TRUE(reader.bagContent(node, bag));
+
+        stream << "b " << node << " ";
+
+        for (htd::vertex_t vertex : bag)
+        {
+            stream << vertex << " ";
+        }
+
+        stream << "\n";
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> edges;
+
+    EXPECT_TRUE(reader.edges(edges));
+
+    EXPECT_EQ(reader.edgeCount(), edges.size());
+
+    for (const std::pair<std::size_t, std::size_t> & edge : edges)
+    {
+        stream << edge.first << " " << edge.second << "\n";
+    }
+
+    return stream.str();
+}
+
+static void addGrid(htd::MultiHypergraph & graph, std::size_t size)
+{
+    graph.addVertices(size * size);
+
+    for (htd::vertex_t row = 0; row < size; ++row)
+    {
+        for (htd::vertex_t column = 0; column < size; ++column)
+        {
+            htd::vertex_t vertex = row * size + column + 1;
+
+            if (column + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + size);
+            }
+        }
+    }
+}
+
+TEST(TdFormatExporterTest, CheckOutputBuffer)
+{
+    std::ostringstream stream;
+
+    {
+        htd_io::OutputBuffer buffer(stream, 64);
+
+        std::vector<std::uint64_t> values { 0, 7, 9, 10, 42, 99, 100, 101, 999, 1000, 65535, 1234567890, std::numeric_limits<std::uint64_t>::max() };
+
+        for (std::uint64_t value : values)
+        {
+            buffer.appendDecimal(value);
+            buffer.append(' ');
+        }
+
+        std::string text(100, 'x');
+
+        buffer.append(text.data(), text.size());
+        buffer.append('\n');
+    }
+
+    ASSERT_EQ("0 7 9 10 42 99 100 101 999 1000 65535 1234567890 18446744073709551615 " + std::string(100, 'x') + "\n", stream.str());
+
+    std::ostringstream binaryStream;
+
+    htd_io::OutputBuffer binaryBuffer(binaryStream);
+
+    binaryBuffer.appendVarint(0);
+    binaryBuffer.appendVarint(127);
+    binaryBuffer.appendVarint(128);
+    binaryBuffer.appendVarint(300);
+    binaryBuffer.appendFixed64(0x0102030405060708);
+
+    binaryBuffer.flush();
+
+    ASSERT_EQ(std::string("\x00\x7F\x80\x01\xAC\x02\x08\x07\x06\x05\x04\x03\x02\x01", 14), binaryStream.str());
+
+    ASSERT_EQ((std::size_t)1, htd_io::OutputBuffer::varintSize(127));
+    ASSERT_EQ((std::size_t)2, htd_io::OutputBuffer::varintSize(300));
+    ASSERT_EQ((std::size_t)10, htd_io::OutputBuffer::varintSize(std::numeric_limits<std::uint64_t>::max()));
+}
+
+TEST(TdFormatExporterTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(graph));
+
+    ASSERT_NE(decomposition, nullptr);
+
+    std::ostringstream textStream;
+    std::ostringstream binaryStream;
+
+    htd_io::TdFormatExporter().write(*decomposition, graph, textStream);
+    htd_io::BinaryTdFormatExporter().write(*decomposition, graph, binaryStream);
+
+    ASSERT_EQ("s td 1 0 0\nb 1 \n", textStream.str());
+
+    ASSERT_EQ(textStream.str(), convertToTdFormat(binaryStream.str()));
+
+    delete libraryInstance;
+}
+
+TEST(TdFormatExporterTest, CheckGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addGrid(graph, 12);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(graph));
+
+    ASSERT_NE(decomposition, nullptr);
+
+    std::ostringstream textStream;
+    std::ostringstream binaryStream;
+
+    htd_io::TdFormatExporter().write(*decomposition, graph, textStream);
+    htd_io::BinaryTdFormatExporter().write(*decomposition, graph, binaryStream);
+
+    ASSERT_EQ(referenceTdFormat(*decomposition, graph.vertexCount()), textStream.str());
+
+    ASSERT_EQ(textStream.str(), convertToTdFormat(binaryStream.str()));
+
+    ASSERT_LT(binaryStream.str().size(), textStream.str().size());
+
+    delete libraryInstance;
+}
+
+TEST(TdFormatExporterTest, CheckNonConsecutiveNodeIdentifiers)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot();
+
+    htd::vertex_t removedChild = decomposition.addChild(root);
+
+    htd::vertex_t child1 = decomposition.addChild(root);
+
+    decomposition.removeVertex(removedChild);
+
+    htd::vertex_t child2 = decomposition.addChild(child1);
+
+    htd::vertex_t child3 = decomposition.addChild(root);
+
+    decomposition.mutableBagContent(root) = { 2, 3 };
+    decomposition.mutableBagContent(child1) = { 3, 4 };
+    decomposition.mutableBagContent(child2) = { 4, 5 };
+    decomposition.mutableBagContent(child3) = { 1, 2 };
+
+    std::ostringstream textStream;
+    std::ostringstream binaryStream;
+
+    htd_io::TdFormatExporter().write(decomposition, graph, textStream);
+    htd_io::BinaryTdFormatExporter().write(decomposition, graph, binaryStream);
+
+    ASSERT_EQ(referenceTdFormat(decomposition, graph.vertexCount()), textStream.str());
+
+    ASSERT_EQ(textStream.str(), convertToTdFormat(binaryStream.str()));
+
+    delete libraryInstance;
+}
+
+TEST(TdFormatExporterTest, CheckMalformedBinaryInput)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addGrid(graph, 4);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(graph));
+
+    std::ostringstream binaryStream;
+
+    htd_io::BinaryTdFormatExporter().write(*decomposition, graph, binaryStream);
+
+    const std::string binary = binaryStream.str();
+
+    std::vector<htd::vertex_t> bag;
+
+    std::vector<std::pair<std::size_t, std::size_t>> edges;
+
+    htd_io::BinaryTdFormatReader validReader(binary.data(), binary.data() + binary.size());
+
+    ASSERT_TRUE(validReader.good());
+    ASSERT_FALSE(validReader.bagContent(0, bag));
+    ASSERT_FALSE(validReader.bagContent(validReader.nodeCount() + 1, bag));
+
+    std::string invalidMagic(binary);
+
+    invalidMagic[0] = 'X';
+
+    htd_io::BinaryTdFormatReader invalidMagicReader(invalidMagic.data(), invalidMagic.data() + invalidMagic.size());
+
+    ASSERT_FALSE(invalidMagicReader.good());
+    ASSERT_EQ((std::size_t)0, invalidMagicReader.nodeCount());
+    ASSERT_FALSE(invalidMagicReader.bagContent(1, bag));
+    ASSERT_FALSE(invalidMagicReader.edges(edges));
+
+    htd_io::BinaryTdFormatReader truncatedHeaderReader(binary.data(), binary.data() + 20);
+
+    ASSERT_FALSE(truncatedHeaderReader.good());
+
+    htd_io::BinaryTdFormatReader truncatedBagReader(binary.data(), binary.data() + 48);
+
+    ASSERT_FALSE(truncatedBagReader.good());
+
+    if (validReader.edgeCount() > 0)
+    {
+        htd_io::BinaryTdFormatReader truncatedEdgeReader(binary.data(), binary.data() + binary.size() - 1);
+
+        ASSERT_TRUE(truncatedEdgeReader.good());
+        ASSERT_FALSE(truncatedEdgeReader.edges(edges));
+        ASSERT_TRUE(edges.empty());
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <chrono>
+#include <thread>
 #include <vector>
 
 class TreeDecompositionOptimizationTest : public ::testing::Test
@@ -991,6 +993,293 @@ TEST(TreeDecompositionOptimizationTest, CheckResultComplexGraph)
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckParallelResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    std::size_t iterationCount = 0;
+    std::size_t minimalHeight = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentHeight = currentDecomposition.height();
+
+        ASSERT_EQ(currentHeight, (std::size_t)(-fitness.at(0)));
+
+        if (currentHeight < minimalHeight)
+        {
+            minimalHeight = currentHeight;
+        }
+
+        ++iterationCount;
+    });
+
+    ASSERT_EQ((std::size_t)25, iterationCount);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalHeight, decomposition->height());
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ((std::size_t)4, clonedAlgorithm->threadCount());
+
+    delete clonedAlgorithm;
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelResultReproducibility)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    algorithm.setIterationCount(25);
+    algorithm.setThreadCount(3);
+
+    std::srand(42);
+
+    htd::ITreeDecomposition * decomposition1 = algorithm.computeDecomposition(*graph);
+
+    algorithm.setThreadCount(5);
+
+    std::srand(42);
+
+    htd::ITreeDecomposition * decomposition2 = algorithm.computeDecomposition(*graph);
+
+    ASSERT_NE(decomposition1, nullptr);
+    ASSERT_NE(decomposition2, nullptr);
+
+    ASSERT_EQ(decomposition1->vertexCount(), decomposition2->vertexCount());
+    ASSERT_EQ(decomposition1->height(), decomposition2->height());
+
+    for (htd::vertex_t vertex : decomposition1->vertices())
+    {
+        ASSERT_TRUE(decomposition2->isVertex(vertex));
+
+        ASSERT_EQ(decomposition1->bagContent(vertex), decomposition2->bagContent(vertex));
+    }
+
+    delete graph;
+    delete decomposition1;
+    delete decomposition2;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckWidthFitnessResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new htd::WidthFitnessFunction());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+
+    std::size_t iterationCount = 0;
+    std::size_t minimalMaximumBagSize = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentMaximumBagSize = currentDecomposition.maximumBagSize();
+
+        ASSERT_EQ(currentMaximumBagSize, (std::size_t)(-fitness.at(0)));
+
+        /* Only candidates improving on the best maximum bag size are materialized. */
+        ASSERT_LT(currentMaximumBagSize, minimalMaximumBagSize);
+
+        minimalMaximumBagSize = currentMaximumBagSize;
+
+        ++iterationCount;
+    });
+
+    ASSERT_GE(iterationCount, (std::size_t)1);
+    ASSERT_LE(iterationCount, (std::size_t)25);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalMaximumBagSize, decomposition->maximumBagSize());
+
+    algorithm.setThreadCount(3);
+
+    std::srand(42);
+
+    htd::ITreeDecomposition * decomposition1 = algorithm.computeDecomposition(*graph);
+
+    algorithm.setThreadCount(5);
+
+    std::srand(42);
+
+    htd::ITreeDecomposition * decomposition2 = algorithm.computeDecomposition(*graph);
+
+    ASSERT_NE(decomposition1, nullptr);
+    ASSERT_NE(decomposition2, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition1));
+
+    ASSERT_EQ(decomposition1->vertexCount(), decomposition2->vertexCount());
+
+    for (htd::vertex_t vertex : decomposition1->vertices())
+    {
+        ASSERT_TRUE(decomposition2->isVertex(vertex));
+
+        ASSERT_EQ(decomposition1->bagContent(vertex), decomposition2->bagContent(vertex));
+    }
+
+    delete graph;
+    delete decomposition;
+    delete decomposition1;
+    delete decomposition2;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckWidthFitnessResultWithPostProcessingComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new htd::WidthFitnessFunction(), { new htd::JoinNodeReplacementOperation(libraryInstance) });
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+
+    std::size_t iterationCount = 0;
+    std::size_t minimalMaximumBagSize = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        ASSERT_EQ(currentDecomposition.joinNodeCount(), (std::size_t)0);
+
+        ASSERT_EQ(currentDecomposition.maximumBagSize(), (std::size_t)(-fitness.at(0)));
+
+        minimalMaximumBagSize = std::min(minimalMaximumBagSize, currentDecomposition.maximumBagSize());
+
+        ++iterationCount;
+    });
+
+    /* Post-processing may change the width, so the width fast path must not prune any candidate. */
+    ASSERT_EQ(iterationCount, (std::size_t)25);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalMaximumBagSize, decomposition->maximumBagSize());
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckAdaptiveWidthMinimizationRacingResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * algorithm1 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    algorithm1->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(libraryInstance));
+
+    algorithm.addDecompositionAlgorithm(algorithm1);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * algorithm2 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    algorithm2->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(libraryInstance));
+
+    algorithm.addDecompositionAlgorithm(algorithm2);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * algorithm3 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    algorithm3->setOrderingAlgorithm(new htd::MaximumCardinalitySearchOrderingAlgorithm(libraryInstance));
+
+    algorithm.addDecompositionAlgorithm(algorithm3);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setDecisionRounds(3);
+    algorithm.setIterationCount(10);
+
+    ASSERT_FALSE(algorithm.isRacingEnabled());
+
+    algorithm.setRacingEnabled(true);
+
+    ASSERT_TRUE(algorithm.isRacingEnabled());
+
+    std::size_t minimalWidth = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentWidth = currentDecomposition.maximumBagSize();
+
+        ASSERT_EQ(currentWidth, static_cast<std::size_t>(-fitness.at(0)));
+
+        ASSERT_LT(currentWidth, minimalWidth);
+
+        minimalWidth = currentWidth;
+    });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalWidth, decomposition->maximumBagSize());
+
+    htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_TRUE(clonedAlgorithm->isRacingEnabled());
+
+    delete clonedAlgorithm;
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -1048,6 +1337,145 @@ TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraph
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckResultComplexGraphWithDeadline)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(0);
+
+    libraryInstance->setTimeLimit(std::chrono::milliseconds(200));
+
+    std::size_t iterationCount = 0;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph, [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &){ ++iterationCount; });
+
+    std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_GT(iterationCount, (std::size_t)1);
+
+    ASSERT_LT(finish, libraryInstance->deadline() + std::chrono::seconds(2));
+
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    delete decomposition;
+
+    /* Even if the deadline already passed, the first iteration is completed. The previous run may have stopped early
+       because it did not expect another iteration to fit, so wait for the deadline first. */
+    std::this_thread::sleep_until(libraryInstance->deadline() + std::chrono::milliseconds(1));
+
+    iterationCount = 0;
+
+    decomposition = algorithm.computeDecomposition(*graph, [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &){ ++iterationCount; });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ((std::size_t)1, iterationCount);
+
+    delete decomposition;
+
+    algorithm.setThreadCount(4);
+
+    libraryInstance->setTimeLimit(std::chrono::milliseconds(200));
+
+    decomposition = algorithm.computeDecomposition(*graph);
+
+    finish = std::chrono::steady_clock::now();
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_LT(finish, libraryInstance->deadline() + std::chrono::seconds(2));
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraphWithDeadline)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(0);
+
+    libraryInstance->setTimeLimit(std::chrono::milliseconds(200));
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+    std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_LT(finish, libraryInstance->deadline() + std::chrono::seconds(2));
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckAdaptiveWidthMinimizationResultComplexGraphWithDeadline)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * algorithm1 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    algorithm1->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(libraryInstance));
+
+    algorithm.addDecompositionAlgorithm(algorithm1);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * algorithm2 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    algorithm2->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(libraryInstance));
+
+    algorithm.addDecompositionAlgorithm(algorithm2);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setDecisionRounds(1000000);
+    algorithm.setIterationCount((std::size_t)-1);
+
+    libraryInstance->setTimeLimit(std::chrono::milliseconds(200));
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+    std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_LT(finish, libraryInstance->deadline() + std::chrono::seconds(2));
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComplexGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
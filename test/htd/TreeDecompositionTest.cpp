@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <random>
 #include <vector>
 
 class TreeDecompositionTest : public ::testing::Test
@@ -1267,6 +1269,262 @@ TEST(TreeDecompositionTest, TestEdgeLabelModifications)
     delete libraryInstance;
 }
 
+/**
+ *  Check that the cached statistics of a tree decomposition match the values obtained by a full rescan of all nodes.
+ *
+ *  @param[in] decomposition    The tree decomposition which shall be checked.
+ */
+void checkCachedStatistics(const htd::TreeDecomposition & decomposition)
+{
+    std::size_t minimumBagSize = decomposition.vertexCount() > 0 ? (std::size_t)-1 : 0;
+    std::size_t maximumBagSize = 0;
+
+    std::vector<htd::vertex_t> joinNodes;
+    std::vector<htd::vertex_t> forgetNodes;
+    std::vector<htd::vertex_t> introduceNodes;
+    std::vector<htd::vertex_t> exchangeNodes;
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        minimumBagSize = std::min(minimumBagSize, decomposition.bagSize(node));
+        maximumBagSize = std::max(maximumBagSize, decomposition.bagSize(node));
+
+        if (decomposition.isJoinNode(node))
+        {
+            joinNodes.push_back(node);
+        }
+
+        if (decomposition.isForgetNode(node))
+        {
+            forgetNodes.push_back(node);
+        }
+
+        if (decomposition.isIntroduceNode(node))
+        {
+            introduceNodes.push_back(node);
+        }
+
+        if (decomposition.isExchangeNode(node))
+        {
+            exchangeNodes.push_back(node);
+        }
+    }
+
+    ASSERT_EQ(minimumBagSize, decomposition.minimumBagSize());
+    ASSERT_EQ(maximumBagSize, decomposition.maximumBagSize());
+
+    ASSERT_EQ(joinNodes.size(), decomposition.joinNodeCount());
+    ASSERT_EQ(forgetNodes.size(), decomposition.forgetNodeCount());
+    ASSERT_EQ(introduceNodes.size(), decomposition.introduceNodeCount());
+    ASSERT_EQ(exchangeNodes.size(), decomposition.exchangeNodeCount());
+
+    const htd::ConstCollection<htd::vertex_t> & cachedJoinNodes = decomposition.joinNodes();
+
+    ASSERT_EQ(joinNodes, std::vector<htd::vertex_t>(cachedJoinNodes.begin(), cachedJoinNodes.end()));
+
+    const htd::ConstCollection<htd::vertex_t> & cachedForgetNodes = decomposition.forgetNodes();
+
+    ASSERT_EQ(forgetNodes, std::vector<htd::vertex_t>(cachedForgetNodes.begin(), cachedForgetNodes.end()));
+
+    const htd::ConstCollection<htd::vertex_t> & cachedIntroduceNodes = decomposition.introduceNodes();
+
+    ASSERT_EQ(introduceNodes, std::vector<htd::vertex_t>(cachedIntroduceNodes.begin(), cachedIntroduceNodes.end()));
+
+    const htd::ConstCollection<htd::vertex_t> & cachedExchangeNodes = decomposition.exchangeNodes();
+
+    ASSERT_EQ(exchangeNodes, std::vector<htd::vertex_t>(cachedExchangeNodes.begin(), cachedExchangeNodes.end()));
+
+    for (htd::index_t index = 0; index < forgetNodes.size(); ++index)
+    {
+        ASSERT_EQ(forgetNodes[index], decomposition.forgetNodeAtPosition(index));
+    }
+}
+
+/**
+ *  Apply a sequence of random modifications to a tree decomposition and check the cached statistics after each step.
+ *
+ *  @param[in] td           The tree decomposition which shall be modified.
+ *  @param[in] generator    The random number generator.
+ */
+void checkCachedStatisticsUnderModifications(htd::TreeDecomposition & td, std::mt19937 & generator)
+{
+    auto randomBag = [&](void)
+    {
+        std::vector<htd::vertex_t> ret;
+
+        for (htd::vertex_t vertex = 1; vertex <= 8; ++vertex)
+        {
+            if (generator() % 3 == 0)
+            {
+                ret.push_back(vertex);
+            }
+        }
+
+        return ret;
+    };
+
+    checkCachedStatistics(td);
+
+    td.insertRoot(randomBag(), htd::FilteredHyperedgeCollection());
+
+    checkCachedStatistics(td);
+
+    for (std::size_t iteration = 0; iteration < 500; ++iteration)
+    {
+        const std::vector<htd::vertex_t> & nodes = td.vertexVector();
+
+        htd::vertex_t node = nodes[generator() % nodes.size()];
+
+        switch (generator() % 9)
+        {
+            case 0:
+            case 1:
+            {
+                td.addChild(node, randomBag(), htd::FilteredHyperedgeCollection());
+
+                break;
+            }
+            case 2:
+            {
+                td.addParent(node, randomBag(), htd::FilteredHyperedgeCollection());
+
+                break;
+            }
+            case 3:
+            {
+                td.addChild(node);
+
+                break;
+            }
+            case 4:
+            {
+                td.mutableBagContent(node) = randomBag();
+
+                break;
+            }
+            case 5:
+            {
+                td.makeRoot(node);
+
+                break;
+            }
+            case 6:
+            {
+                if (!td.isRoot(node))
+                {
+                    if (generator() % 2 == 0)
+                    {
+                        td.swapWithParent(node);
+                    }
+                    else
+                    {
+                        td.setParent(node, td.root());
+                    }
+                }
+
+                break;
+            }
+            case 7:
+            {
+                if (!td.isRoot(node))
+                {
+                    td.removeVertex(node);
+                }
+
+                break;
+            }
+            default:
+            {
+                if (!td.isRoot(node) && td.vertexCount() > 20)
+                {
+                    td.removeSubtree(node);
+                }
+
+                break;
+            }
+        }
+
+        if (generator() % 4 != 0)
+        {
+            checkCachedStatistics(td);
+        }
+    }
+
+    checkCachedStatistics(td);
+}
+
+TEST(TreeDecompositionTest, CheckCachedStatistics)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(1);
+
+    htd::TreeDecomposition td(libraryInstance);
+
+    checkCachedStatisticsUnderModifications(td, generator);
+
+    htd::TreeDecomposition copy(td);
+
+    checkCachedStatistics(copy);
+
+    if (copy.childCount(copy.root()) > 0)
+    {
+        copy.removeChild(copy.root(), copy.childAtPosition(copy.root(), 0));
+    }
+
+    checkCachedStatistics(copy);
+    checkCachedStatistics(td);
+
+    td = copy;
+
+    checkCachedStatistics(td);
+
+    htd::CompactTreeDecomposition compactTd(libraryInstance);
+
+    checkCachedStatisticsUnderModifications(compactTd, generator);
+
+    htd::CompactTreeDecomposition compactCopy(compactTd);
+
+    checkCachedStatistics(compactCopy);
+
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionTest, CheckCachedStatisticsWithRetainedBagReference)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecomposition td(libraryInstance);
+
+    htd::vertex_t root = td.insertRoot(std::vector<htd::vertex_t> { 1, 2 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t child = td.addChild(root, std::vector<htd::vertex_t> { 1 }, htd::FilteredHyperedgeCollection());
+
+    std::vector<htd::vertex_t> & bag = td.mutableBagContent(child);
+
+    checkCachedStatistics(td);
+
+    /* Modifications through a reference kept across queries must be reflected by the statistics. */
+    bag.push_back(2);
+    bag.push_back(3);
+
+    checkCachedStatistics(td);
+
+    ASSERT_EQ((std::size_t)3, td.maximumBagSize());
+
+    bag.clear();
+
+    checkCachedStatistics(td);
+
+    ASSERT_EQ((std::size_t)0, td.minimumBagSize());
+
+    td.addChild(root, std::vector<htd::vertex_t> { 2 }, htd::FilteredHyperedgeCollection());
+
+    checkCachedStatistics(td);
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
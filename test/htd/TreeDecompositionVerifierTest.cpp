@@ -0,0 +1,283 @@
+/*
+ * File:   TreeDecompositionVerifierTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class TreeDecompositionVerifierTest : public ::testing::Test
+{
+    public:
+        TreeDecompositionVerifierTest(void)
+        {
+
+        }
+
+        virtual ~TreeDecompositionVerifierTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the hyperedges which are not covered by any bag by comparing each hyperedge with each bag.
+ */
+std::vector<htd::Hyperedge> uncoveredHyperedges(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition)
+{
+    std::vector<htd::Hyperedge> ret;
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        bool covered = false;
+
+        for (htd::vertex_t node : decomposition.vertices())
+        {
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+
+            covered = covered || std::includes(bag.begin(), bag.end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end());
+        }
+
+        if (!covered)
+        {
+            ret.push_back(hyperedge);
+        }
+    }
+
+    std::sort(ret.begin(), ret.end());
+
+    return ret;
+}
+
+/**
+ *  Compute the vertices whose occurrences in the bags are disconnected by counting the connected components of the
+ *  nodes containing each vertex.
+ */
+std::vector<htd::vertex_t> disconnectedVertices(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition)
+{
+    std::vector<htd::vertex_t> ret;
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        std::size_t componentCount = 0;
+
+        for (htd::vertex_t node : decomposition.vertices())
+        {
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+
+            if (std::binary_search(bag.begin(), bag.end(), vertex))
+            {
+                if (decomposition.isRoot(node))
+                {
+                    ++componentCount;
+                }
+                else
+                {
+                    const std::vector<htd::vertex_t> & parentBag = decomposition.bagContent(decomposition.parent(node));
+
+                    if (!std::binary_search(parentBag.begin(), parentBag.end(), vertex))
+                    {
+                        ++componentCount;
+                    }
+                }
+            }
+        }
+
+        if (componentCount > 1)
+        {
+            ret.push_back(vertex);
+        }
+    }
+
+    return ret;
+}
+
+TEST(TreeDecompositionVerifierTest, CheckValidDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 200);
+
+    std::mt19937 generator(1);
+
+    std::uniform_int_distribution<htd::vertex_t> distribution(1, 200);
+
+    for (std::size_t index = 0; index < 400; ++index)
+    {
+        graph.addEdge(std::vector<htd::vertex_t> { distribution(generator), distribution(generator), distribution(generator) });
+    }
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_EQ((std::size_t)1, verifier.threadCount());
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    verifier.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, verifier.threadCount());
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionVerifierTest, CheckViolations)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(std::vector<htd::vertex_t> { 1, 3, 2 });
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot();
+
+    decomposition.mutableBagContent(root) = std::vector<htd::vertex_t> { 1, 2 };
+
+    htd::vertex_t child = decomposition.addChild(root);
+
+    decomposition.mutableBagContent(child) = std::vector<htd::vertex_t> { 2, 3 };
+
+    htd::vertex_t grandChild = decomposition.addChild(child);
+
+    decomposition.mutableBagContent(grandChild) = std::vector<htd::vertex_t> { 1, 3, 4 };
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_FALSE(verifier.verify(graph, decomposition));
+
+    const htd::ConstCollection<htd::vertex_t> & missingVertices = verifier.violationsVertexExistence(graph, decomposition);
+
+    ASSERT_EQ((std::size_t)1, missingVertices.size());
+    ASSERT_EQ((htd::vertex_t)5, missingVertices[0]);
+
+    const htd::ConstCollection<htd::Hyperedge> & missingHyperedges = verifier.violationsHyperedgeCoverage(graph, decomposition);
+
+    ASSERT_EQ((std::size_t)1, missingHyperedges.size());
+    ASSERT_TRUE(missingHyperedges[0].sortedElements() == std::vector<htd::vertex_t>({ 1, 2, 3 }));
+
+    const htd::ConstCollection<htd::vertex_t> & disconnected = verifier.violationsConnectednessCriterion(graph, decomposition);
+
+    ASSERT_EQ((std::size_t)1, disconnected.size());
+    ASSERT_EQ((htd::vertex_t)1, disconnected[0]);
+
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionVerifierTest, CheckRandomViolations)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(2);
+
+    for (std::size_t iteration = 0; iteration < 20; ++iteration)
+    {
+        htd::MultiHypergraph graph(libraryInstance, 60);
+
+        std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, 60);
+
+        for (std::size_t index = 0; index < 3000; ++index)
+        {
+            graph.addEdge(vertexDistribution(generator), vertexDistribution(generator));
+        }
+
+        htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        htd::IMutableTreeDecomposition * decomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm.computeDecomposition(graph));
+
+        ASSERT_NE(decomposition, nullptr);
+
+        std::vector<htd::vertex_t> nodes(decomposition->vertices().begin(), decomposition->vertices().end());
+
+        std::uniform_int_distribution<std::size_t> nodeDistribution(0, nodes.size() - 1);
+
+        for (std::size_t index = 0; index < 10; ++index)
+        {
+            std::vector<htd::vertex_t> & bag = decomposition->mutableBagContent(nodes[nodeDistribution(generator)]);
+
+            if (!bag.empty())
+            {
+                bag.erase(bag.begin() + std::uniform_int_distribution<std::size_t>(0, bag.size() - 1)(generator));
+            }
+        }
+
+        std::vector<htd::Hyperedge> expectedHyperedges = uncoveredHyperedges(graph, *decomposition);
+
+        std::vector<htd::vertex_t> expectedVertices = disconnectedVertices(graph, *decomposition);
+
+        for (std::size_t threadCount : { 1, 3 })
+        {
+            htd::TreeDecompositionVerifier verifier;
+
+            verifier.setThreadCount(threadCount);
+
+            const htd::ConstCollection<htd::Hyperedge> & actualHyperedges = verifier.violationsHyperedgeCoverage(graph, *decomposition);
+
+            ASSERT_EQ(expectedHyperedges.size(), actualHyperedges.size());
+            ASSERT_TRUE(std::equal(expectedHyperedges.begin(), expectedHyperedges.end(), actualHyperedges.begin()));
+
+            const htd::ConstCollection<htd::vertex_t> & actualVertices = verifier.violationsConnectednessCriterion(graph, *decomposition);
+
+            ASSERT_EQ(expectedVertices.size(), actualVertices.size());
+            ASSERT_TRUE(std::equal(expectedVertices.begin(), expectedVertices.end(), actualVertices.begin()));
+        }
+
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -692,6 +692,69 @@ TEST(TreeTest, CheckMakeRootFunctionality1)
     delete libraryInstance;
 }
 
+TEST(TreeTest, CheckVertexRemovalAndReinsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t root = tree.insertRoot();
+
+    htd::vertex_t node1 = tree.addChild(root);
+    htd::vertex_t node2 = tree.addChild(root);
+    htd::vertex_t node3 = tree.addChild(node1);
+
+    tree.removeVertex(node1);
+
+    ASSERT_EQ((std::size_t)3, tree.vertexCount());
+    ASSERT_EQ((std::size_t)2, tree.edgeCount());
+
+    ASSERT_FALSE(tree.isVertex(node1));
+    ASSERT_TRUE(tree.isParent(node3, root));
+
+    htd::vertex_t node4 = tree.addChild(node2);
+    htd::vertex_t node5 = tree.addParent(node3);
+
+    ASSERT_GT(node4, node3);
+    ASSERT_GT(node5, node4);
+
+    ASSERT_FALSE(tree.isVertex(node1));
+
+    ASSERT_EQ((std::size_t)5, tree.vertexCount());
+    ASSERT_EQ((std::size_t)4, tree.edgeCount());
+
+    ASSERT_TRUE(tree.isParent(node4, node2));
+    ASSERT_TRUE(tree.isParent(node5, root));
+    ASSERT_TRUE(tree.isParent(node3, node5));
+
+    const htd::ConstCollection<htd::Hyperedge> & hyperedges = tree.hyperedges();
+
+    ASSERT_EQ((std::size_t)4, hyperedges.size());
+
+    htd::id_t lastId = htd::Id::UNKNOWN;
+
+    for (const htd::Hyperedge & hyperedge : hyperedges)
+    {
+        ASSERT_TRUE(lastId == htd::Id::UNKNOWN || lastId < hyperedge.id());
+
+        lastId = hyperedge.id();
+    }
+
+    htd::Tree copy(tree);
+
+    copy.removeVertex(node5);
+
+    ASSERT_EQ((std::size_t)5, tree.vertexCount());
+    ASSERT_EQ((std::size_t)4, copy.vertexCount());
+
+    ASSERT_TRUE(copy.isParent(node3, root));
+    ASSERT_TRUE(tree.isParent(node3, node5));
+
+    ASSERT_EQ(tree.nextVertex(), copy.nextVertex());
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);